@@ -29,9 +29,10 @@
  * \{
  */
 
-#define HS_CMD_MID     0x18AE /**< \brief Msg ID for cmds to HS                */
-#define HS_SEND_HK_MID 0x18AF /**< \brief Msg ID to request HS housekeeping    */
-#define HS_WAKEUP_MID  0x18B0 /**< \brief Msg ID to wake up HS                 */
+#define HS_CMD_MID       0x18AE /**< \brief Msg ID for cmds to HS                */
+#define HS_SEND_HK_MID   0x18AF /**< \brief Msg ID to request HS housekeeping    */
+#define HS_WAKEUP_MID    0x18B0 /**< \brief Msg ID to wake up HS                 */
+#define HS_UTIL_MARK_MID 0x18B1 /**< \brief Msg ID to mark HS CPU utilization    */
 
 /**\}*/
 
@@ -40,7 +41,12 @@
  * \{
  */
 
-#define HS_HK_TLM_MID 0x08AD /**< \brief HS Housekeeping Telemetry            */
+#define HS_HK_TLM_MID        0x08AD /**< \brief HS Housekeeping Telemetry             */
+#define HS_UTIL_HIST_TLM_MID 0x08AE /**< \brief HS Utilization History Telemetry     */
+#define HS_TASK_CPU_TLM_MID  0x08AF /**< \brief HS Per-Task CPU Telemetry            */
+#define HS_UTIL_PCTL_TLM_MID 0x08B0 /**< \brief HS Utilization Percentile Telemetry  */
+#define HS_UTIL_DIAG_TLM_MID 0x08B1 /**< \brief HS Utilization Diagnostics Telemetry */
+#define HS_STACK_TLM_MID     0x08B2 /**< \brief HS Stack Usage Telemetry             */
 
 /**\}*/
 
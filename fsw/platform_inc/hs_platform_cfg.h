@@ -77,6 +77,66 @@
  */
 #define HS_IDLE_TASK_PRIORITY 252
 
+/**
+ * \brief Number of Processor Cores Monitored (custom)
+ *
+ *  \par Description:
+ *       Number of processor cores whose utilization is monitored. One Idle
+ *       Task is created per core. When this is greater than 1, each Idle Task
+ *       is named #HS_IDLE_TASK_NAME followed by its core number and is pinned
+ *       to that core (Linux only), and utilization and hogging are also
+ *       reported per core.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter can't be less than 1 or larger than 32.
+ */
+#define HS_UTIL_NUM_CORES 1
+
+/**
+ * \brief Cache Line Size (custom)
+ *
+ *  \par Description:
+ *       Size in bytes of a data cache line of the processor. The Idle Task
+ *       counters, and the state shared between the Idle Tasks, the time
+ *       synch callback and the main task, are each kept on their own cache
+ *       lines so that the writes of one context don't evict the lines read
+ *       by another.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter must be a power of 2 and can't be less than 8.
+ */
+#define HS_CACHE_LINE_SIZE 64
+
+/**
+ * \brief Default CPU Utilization Backend (custom)
+ *
+ *  \par Description:
+ *       Source of the CPU utilization used at startup. 0 counts Idle Task
+ *       loop iterations and needs the conversion factors to be calibrated,
+ *       1 computes utilization from /proc/stat tick deltas (including irq,
+ *       softirq and steal time) without running an Idle Task, 2 computes it
+ *       from the CPU time consumed by the Idle Task and needs no calibration.
+ *       1 and 2 are Linux only; if the selected backend is not available HS
+ *       falls back to 0, so the default of 1 runs no Idle Task on Linux and
+ *       keeps the Idle Task count elsewhere. The backend can be changed by
+ *       command.
+ *
+ *       Backend 2 keeps the spinning Idle Tasks by design: the CPU time an
+ *       Idle Task gets at the lowest priority is the idle time it measures.
+ *       The kernel's own idle time is what backend 1 reads.
+ *
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter must be 0, 1 or 2.
+ */
+#define HS_UTIL_DEFAULT_BACKEND 1
+
 /**
  * \brief Maximum reported execution counters
  *
@@ -145,6 +205,72 @@
  */
 #define HS_MAX_MSG_ACT_SIZE 16
 
+/**
+ * \brief Maximum load shedding steps
+ *
+ *  \par Description:
+ *       Maximum number of steps in the Load Shedding Table, each
+ *       with a shed and a restore message.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 16 bit integer (65535).
+ *
+ *       This parameter will influence the size of the Load
+ *       Shedding Table (LST):
+ *
+ *       LST Size = HS_MAX_LOAD_SHED_STEPS * (2 * HS_MAX_MSG_ACT_SIZE + 4)
+ *
+ *       The total size of this table should not exceed the
+ *       cFE size limit for a single buffered table set by the
+ *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE parameter
+ */
+#define HS_MAX_LOAD_SHED_STEPS 4
+
+/**
+ * \brief Maximum number of CPU budgets
+ *
+ *  \par Description:
+ *       Maximum number of tasks whose CPU usage can be held to a
+ *       budget by the CPU Budget Table.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 16 bit integer (65535).
+ *
+ *       This parameter will influence the size of the CPU Budget
+ *       Table (CBT):
+ *
+ *       CBT Size = HS_MAX_CPU_BUDGETS * (OS_MAX_API_NAME + 12)
+ *
+ *       The total size of this table should not exceed the
+ *       cFE size limit for a single buffered table set by the
+ *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE parameter
+ */
+#define HS_MAX_CPU_BUDGETS 8
+
+/**
+ * \brief Maximum number of rebalance tasks
+ *
+ *  \par Description:
+ *       Maximum number of tasks that the Rebalance Table can allow
+ *       HS to move between processor cores.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 16 bit integer (65535).
+ *
+ *       This parameter will influence the size of the Rebalance
+ *       Table (RBT):
+ *
+ *       RBT Size = HS_MAX_REBALANCE_TASKS * (OS_MAX_API_NAME + 8)
+ *
+ *       The total size of this table should not exceed the
+ *       cFE size limit for a single buffered table set by the
+ *       #CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE parameter
+ */
+#define HS_MAX_REBALANCE_TASKS 8
+
 /**
  * \brief Maximum number of monitored applications
  *
@@ -193,6 +319,22 @@
  */
 #define HS_MAX_MONITORED_EVENTS 16
 
+/**
+ * \brief Maximum number of event source processors tracked
+ *
+ *  \par Description:
+ *       Maximum number of distinct spacecraft/processor pairs for which
+ *       the Event Monitor keeps a separate count of received event
+ *       messages. Events from additional processors are counted in
+ *       the overflow counter.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       This parameter can't be larger than 255.
+ */
+#define HS_MAX_EVENT_PROCESSORS 4
+
 /**
  * \brief Watchdog Timeout Value
  *
@@ -240,6 +382,58 @@
  */
 #define HS_WAKEUP_TIMEOUT 1200
 
+/**
+ * \brief Wakeup Period
+ *
+ *  \par Description:
+ *       Nominal time in microseconds between two #HS_WAKEUP_MID
+ *       messages, the rate HS is scheduled at. The time between
+ *       wakeups is measured against it for the wakeup telemetry.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 2147483647.
+ */
+#define HS_WAKEUP_PERIOD_US 1000000
+
+/**
+ * \brief Late Wakeup Margin
+ *
+ *  \par Description:
+ *       Time in microseconds by which the time between two wakeups
+ *       must exceed #HS_WAKEUP_PERIOD_US to count as a late wakeup.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than 2147483647.
+ */
+#define HS_WAKEUP_LATE_US 100000
+
+/**
+ * \brief Wakeup Histogram Buckets
+ *
+ *  \par Description:
+ *       Number of buckets of the wakeup interval histogram. The buckets
+ *       are centered on #HS_WAKEUP_PERIOD_US, the first counting early
+ *       wakeups and the last late ones beyond the histogram range.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 2 and can't be larger than 64.
+ */
+#define HS_WAKEUP_HIST_BUCKETS 16
+
+/**
+ * \brief Wakeup Histogram Bucket Width
+ *
+ *  \par Description:
+ *       Width in microseconds of each bucket of the wakeup interval
+ *       histogram.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 2147483647 divided by #HS_WAKEUP_HIST_BUCKETS.
+ */
+#define HS_WAKEUP_HIST_BUCKET_US 10000
+
 /**
  * \brief CPU aliveness output string
  *
@@ -457,6 +651,45 @@
  */
 #define HS_MAT_FILENAME "/cf/hs_mat.tbl"
 
+/**
+ * \brief Load Shedding Table (LST) filename
+ *
+ *  \par Description:
+ *       Default file to load the Load Shedding Table from
+ *       during a power-on reset sequence
+ *
+ *  \par Limits:
+ *       This string shouldn't be longer than #OS_MAX_PATH_LEN for the
+ *       target platform in question
+ */
+#define HS_LST_FILENAME "/cf/hs_lst.tbl"
+
+/**
+ * \brief CPU Budget Table (CBT) filename
+ *
+ *  \par Description:
+ *       Default file to load the CPU Budget Table from
+ *       during a power-on reset sequence
+ *
+ *  \par Limits:
+ *       This string shouldn't be longer than #OS_MAX_PATH_LEN for the
+ *       target platform in question
+ */
+#define HS_CBT_FILENAME "/cf/hs_cbt.tbl"
+
+/**
+ * \brief Rebalance Table (RBT) filename
+ *
+ *  \par Description:
+ *       Default file to load the Rebalance Table from
+ *       during a power-on reset sequence
+ *
+ *  \par Limits:
+ *       This string shouldn't be longer than #OS_MAX_PATH_LEN for the
+ *       target platform in question
+ */
+#define HS_RBT_FILENAME "/cf/hs_rbt.tbl"
+
 /**
  * \brief CPU Utilization Calls per Mark (custom)
  *
@@ -475,6 +708,62 @@
  */
 #define HS_UTIL_CALLS_PER_MARK 1
 
+/**
+ * \brief CPU Utilization Mark Source (custom)
+ *
+ *  \par Description:
+ *       Selects what calls the Mark function. 0 uses the cFE TIME
+ *       synchronization callback (typically the 1 Hz time tone), 1 an
+ *       OSAL timer firing #HS_UTIL_CALLS_PER_MARK times every
+ *       #HS_UTIL_MARK_PERIOD_US, 2 each HS wakeup and 3 each
+ *       #HS_UTIL_MARK_MID message. Sources 1 to 3 keep marking while time
+ *       synchronization is disturbed. Source 3 receives the message on
+ *       its own pipe, drained once per HS cycle, so messages faster than
+ *       the HS wakeup are merged into one mark. If the selected source
+ *       can't be started HS falls back to 0. The conversion factors are
+ *       per mark interval, so recalibrate when the mark rate changes.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter must be 0, 1, 2 or 3.
+ */
+#define HS_UTIL_MARK_SOURCE 0
+
+/**
+ * \brief CPU Utilization Mark Pipe Depth (custom)
+ *
+ *  \par Description:
+ *       Maximum number of #HS_UTIL_MARK_MID messages queued on the mark
+ *       pipe of #HS_UTIL_MARK_SOURCE 3 between two HS cycles. Messages
+ *       beyond it are dropped by the Software Bus, which does not lose a
+ *       mark as the queued ones are merged into one.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ */
+#define HS_UTIL_MARK_PIPE_DEPTH 2
+
+/**
+ * \brief CPU Utilization Mark Period (custom)
+ *
+ *  \par Description:
+ *       Expected time in microseconds between two utilization marks.
+ *       The mark jitter reported in housekeeping is the difference
+ *       between this and the measured mark interval, and the mark timer
+ *       of #HS_UTIL_MARK_SOURCE 1 fires every #HS_UTIL_MARK_PERIOD_US /
+ *       #HS_UTIL_CALLS_PER_MARK microseconds.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter can't be less than #HS_UTIL_CALLS_PER_MARK or
+ *       larger than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_UTIL_MARK_PERIOD_US 1000000
+
 /**
  * \brief CPU Utilization Cycles per Interval (custom)
  *
@@ -569,6 +858,57 @@
  */
 #define HS_UTIL_CONV_MULT2 1
 
+/**
+ * \brief CPU Utilization Calibration Default Intervals (custom)
+ *
+ *  \par Description:
+ *       Number of utilization intervals over which the peak Idle Task count
+ *       is measured when a calibration is commanded with 0 intervals. The
+ *       processor should be quiescent for the whole calibration. Once done,
+ *       the calibrated factors replace #HS_UTIL_CONV_MULT1, #HS_UTIL_CONV_DIV
+ *       and #HS_UTIL_CONV_MULT2 for the Idle Task count backend.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       This parameter can't be larger than 65535.
+ */
+#define HS_UTIL_CAL_DEFAULT_INTERVALS 10
+
+/**
+ * \brief CPU Utilization Startup Calibration Intervals (custom)
+ *
+ *  \par Description:
+ *       Number of utilization intervals to calibrate over at startup when no
+ *       calibration could be restored from the CDS. The result is saved to
+ *       the CDS. 0 disables the startup calibration, which should only be
+ *       enabled if the processor is known to be quiescent after startup.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than 65535.
+ */
+#define HS_UTIL_CAL_STARTUP_INTERVALS 0
+
+/**
+ * \brief CPU Utilization Calibration Peak Tracking (custom)
+ *
+ *  \par Description:
+ *       When 1, the startup calibration keeps tracking the peak Idle Task
+ *       count after it completes, and recalibrates whenever a higher count
+ *       is seen in an interval. Commanded calibrations select this in the
+ *       command.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter must be 0 or 1.
+ */
+#define HS_UTIL_CAL_TRACK_PEAK 0
+
 /**
  * \brief CPU Utilization Hogging Timeout
  *
@@ -593,7 +933,9 @@
  *       integer (4294967295).
  *
  *       This parameter controls the size of the array which stores
- *       previously measured utilization values.
+ *       previously measured utilization values, and of the queue used
+ *       to track the peak. The per-interval cost of updating the peak
+ *       and average does not depend on this value.
  */
 #define HS_UTIL_PEAK_NUM_INTERVAL 64
 
@@ -627,9 +969,13 @@
  * \brief CPU Utilization Diagnostics Array Configuration (custom)
  *
  *  \par Description:
- *       Time will be marked into an array of subseconds. The independant parameter
- *       controls the exponent to which 2 is raised to determine the array size. As
- *       such, large values will require significant memory usage.
+ *       Time will be marked into an array of monotonic nanosecond time stamps. The
+ *       independant parameter controls the exponent to which 2 is raised to determine
+ *       the array size. As such, large values will require significant memory usage:
+ *       the array and the work array used to sort it for the diagnostics report each
+ *       take 8 bytes per entry, 256 bytes in total with the default value. The
+ *       report sorts the array, so missions that need more samples for calibration
+ *       can raise this value without the report becoming expensive.
  *       Note that these values are only necessarily relevant in the
  *       default hs_custom.c.
  *
@@ -640,6 +986,677 @@
 #define HS_UTIL_TIME_DIAG_ARRAY_LENGTH (1 << (HS_UTIL_TIME_DIAG_ARRAY_POWER))
 #define HS_UTIL_TIME_DIAG_ARRAY_MASK   (HS_UTIL_TIME_DIAG_ARRAY_LENGTH - 1)
 
+/**
+ * \brief CPU Utilization Diagnostics Maximum Reported Values (custom)
+ *
+ *  \par Description:
+ *       Maximum number of distinct time deltas, lowest first, sent with
+ *       their frequencies in the utilization diagnostics packet. Deltas
+ *       beyond this number are only counted in the packet overflow count.
+ *       Note that these values are only necessarily relevant in the
+ *       default hs_custom.c.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       This parameter can't be larger than 1024, to keep the packet
+ *       within the software bus message size.
+ */
+#define HS_UTIL_DIAG_MAX_VALUES 64
+
+/**
+ * \brief CPU Utilization History Number of Levels
+ *
+ *  \par Description:
+ *       Number of resolutions kept in the utilization history. Level 0
+ *       holds one entry per utilization interval, and each following
+ *       level holds one entry per #HS_UTIL_HIST_ROLLUP entries of the
+ *       level below it.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       This parameter can't be larger than 8.
+ */
+#define HS_UTIL_HIST_NUM_LEVELS 3
+
+/**
+ * \brief CPU Utilization History Entries per Level
+ *
+ *  \par Description:
+ *       Number of average/minimum/maximum entries stored at each level
+ *       of the utilization history. With the default values and a 1 Hz
+ *       utilization interval, the levels cover 72 seconds, 72 minutes
+ *       and 72 hours.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       The utilization history telemetry packet holds this many
+ *       entries, so it must fit in #CFE_MISSION_SB_MAX_SB_MSG_SIZE.
+ */
+#define HS_UTIL_HIST_DEPTH 72
+
+/**
+ * \brief CPU Utilization History Rollup Factor
+ *
+ *  \par Description:
+ *       Number of entries of one utilization history level that are
+ *       combined into a single entry of the next level.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 1.
+ *
+ *       The product of this parameter and #HS_UTIL_PER_INTERVAL_TOTAL
+ *       can't be larger than an unsigned 32 bit integer (4294967295).
+ *
+ *       This parameter raised to the power #HS_UTIL_HIST_NUM_LEVELS - 1,
+ *       the number of intervals in an entry of the highest level, can't
+ *       be larger than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_UTIL_HIST_ROLLUP 60
+
+/**
+ * \brief CPU Utilization History Default Dump File Name
+ *
+ *  \par Description:
+ *       File written by the #HS_DUMP_UTIL_HIST_CC command when no file
+ *       name is given in the command.
+ *
+ *  \par Limits:
+ *       The length of this string, including the NULL terminator, can't
+ *       exceed #OS_MAX_PATH_LEN.
+ */
+#define HS_UTIL_HIST_FILENAME "/ram/hs_util_hist.dat"
+
+/**
+ * \brief CPU Utilization History File Sub-Type
+ *
+ *  \par Description:
+ *       Sub-type written to the cFE file header of utilization history
+ *       dump files.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define HS_UTIL_HIST_FILE_SUBTYPE 0x48530001
+
+/**
+ * \brief CPU Utilization Percentile Histogram Buckets
+ *
+ *  \par Description:
+ *       Number of equal width buckets the range of interval utilization
+ *       (0 to #HS_UTIL_PER_INTERVAL_TOTAL) is divided into for the
+ *       utilization percentiles. Percentiles are reported as the upper
+ *       edge of their bucket.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       This parameter can't be larger than #HS_UTIL_PER_INTERVAL_TOTAL
+ *       or 65535.
+ */
+#define HS_UTIL_PCTL_NUM_BUCKETS 100
+
+/**
+ * \brief CPU Utilization Percentile Window
+ *
+ *  \par Description:
+ *       Number of most recent utilization intervals the utilization
+ *       percentiles are computed over.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       Two bytes per interval are kept in the HS global data.
+ */
+#define HS_UTIL_PCTL_WINDOW 600
+
+/**
+ * \brief CPU Load Levels
+ *
+ *  \par Description:
+ *       Number of CPU load levels. Each level has its own enter and
+ *       exit thresholds, dwell time and action, and can be changed by
+ *       command.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 8.
+ */
+#define HS_UTIL_LOAD_NUM_LEVELS 2
+
+/**
+ * \brief CPU Load Level Defaults
+ *
+ *  \par Description:
+ *       Initializer for the #HS_UtilLoadLevel_t settings of each CPU
+ *       load level used at startup: enter threshold, exit threshold
+ *       (both in Utils, see #HS_UTIL_PER_INTERVAL_TOTAL), dwell
+ *       intervals and action type. The action type is
+ *       #HS_ALARM_ACT_NOACT, #HS_ALARM_ACT_EVENT, or
+ *       #HS_ALARM_ACT_LAST_NONMSG plus one plus the index of a
+ *       Message Actions Table entry.
+ *
+ *  \par Limits:
+ *       Must have #HS_UTIL_LOAD_NUM_LEVELS entries. An exit threshold
+ *       can't be larger than its enter threshold. An enter threshold
+ *       larger than #HS_UTIL_PER_INTERVAL_TOTAL is never reached.
+ */
+#define HS_UTIL_LOAD_LEVEL_DEFAULTS {{8500, 8000, 3, HS_ALARM_ACT_EVENT}, {9500, 9000, 3, HS_ALARM_ACT_EVENT}}
+
+/**
+ * \brief Load Shedding High Utilization
+ *
+ *  \par Description:
+ *       Interval utilization, in Utils, at or above which HS sheds
+ *       the next step of the Load Shedding Table once it has lasted
+ *       #HS_LOAD_SHED_DWELL intervals.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_UTIL_PER_INTERVAL_TOTAL
+ *       or smaller than #HS_LOAD_SHED_LOW_UTIL.
+ */
+#define HS_LOAD_SHED_HIGH_UTIL 9000
+
+/**
+ * \brief Load Shedding Low Utilization
+ *
+ *  \par Description:
+ *       Interval utilization, in Utils, below which HS restores the
+ *       last shed step of the Load Shedding Table once it has lasted
+ *       #HS_LOAD_SHED_DWELL intervals. The gap to
+ *       #HS_LOAD_SHED_HIGH_UTIL keeps a restored step from being
+ *       shed again straight away.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_LOAD_SHED_HIGH_UTIL.
+ */
+#define HS_LOAD_SHED_LOW_UTIL 7000
+
+/**
+ * \brief Load Shedding Dwell Intervals
+ *
+ *  \par Description:
+ *       Number of consecutive utilization intervals above
+ *       #HS_LOAD_SHED_HIGH_UTIL, or below #HS_LOAD_SHED_LOW_UTIL,
+ *       before HS sheds or restores one step. This is also the least
+ *       time between two steps, giving each step time to take effect.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_LOAD_SHED_DWELL 5
+
+/**
+ * \brief CPU Saturation Trend Intervals
+ *
+ *  \par Description:
+ *       Number of most recent utilization intervals that the CPU
+ *       utilization trend is fitted over. A longer window follows slow
+ *       load creep and ignores short bursts; a shorter one reacts
+ *       sooner.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 2, can't be larger than 256
+ *       and can't be larger than #HS_UTIL_PEAK_NUM_INTERVAL.
+ */
+#define HS_UTIL_TREND_NUM_INTERVAL 32
+
+/**
+ * \brief CPU Saturation Utilization
+ *
+ *  \par Description:
+ *       Interval utilization, in Utils, that the CPU utilization trend
+ *       predicts the time to. By default this is the hogging threshold,
+ *       so the warning comes before hogging can be detected.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_UTIL_PER_INTERVAL_TOTAL.
+ */
+#define HS_UTIL_TREND_SATURATION_UTIL HS_UTIL_PER_INTERVAL_HOGGING
+
+/**
+ * \brief CPU Saturation Warning Horizon
+ *
+ *  \par Description:
+ *       Number of utilization intervals used at startup as the horizon
+ *       of the CPU saturation warning: the warning is given when the
+ *       predicted time to #HS_UTIL_TREND_SATURATION_UTIL is this many
+ *       intervals or less. 0 disables the warning. It can be changed
+ *       by command.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define HS_UTIL_TREND_HORIZON 300
+
+/**
+ * \brief CPU Saturation Warning Action
+ *
+ *  \par Description:
+ *       Action type used at startup for the CPU saturation warning:
+ *       #HS_ALARM_ACT_NOACT, #HS_ALARM_ACT_EVENT, or
+ *       #HS_ALARM_ACT_LAST_NONMSG plus one plus the index of a
+ *       Message Actions Table entry. It can be changed by command.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than
+ *       #HS_ALARM_ACT_LAST_NONMSG plus #HS_MAX_MSG_ACT_TYPES.
+ */
+#define HS_UTIL_TREND_ACTION HS_ALARM_ACT_EVENT
+
+/**
+ * \brief Pressure Stall Levels
+ *
+ *  \par Description:
+ *       Initializer for the #HS_PsiLevel_t settings of the CPU, memory
+ *       and I/O pressure stall monitors, in that order: enter threshold,
+ *       exit threshold (both the "some" avg10 stall in hundredths of a
+ *       percent), dwell intervals and action type. The action type is
+ *       #HS_ALARM_ACT_NOACT, #HS_ALARM_ACT_EVENT, or
+ *       #HS_ALARM_ACT_LAST_NONMSG plus one plus the index of a
+ *       Message Actions Table entry. Pressure stall information is only
+ *       available on Linux kernels built with PSI; resources without it
+ *       are not monitored.
+ *
+ *  \par Limits:
+ *       Must have #HS_PSI_NUM_RESOURCES entries. An exit threshold
+ *       can't be larger than its enter threshold. An enter threshold
+ *       larger than 10000 is never reached.
+ */
+#define HS_PSI_LEVEL_DEFAULTS                                                                                   \
+    {{2000, 1000, 3, HS_ALARM_ACT_EVENT}, {1000, 500, 3, HS_ALARM_ACT_EVENT}, {2000, 1000, 3, HS_ALARM_ACT_EVENT}}
+
+/**
+ * \brief Memory History Intervals
+ *
+ *  \par Description:
+ *       Number of utilization intervals averaged into each sample of
+ *       the memory history. The process resident set size is read every
+ *       interval, but only its average over this many intervals is kept.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ */
+#define HS_MEM_HISTORY_INTERVALS 60
+
+/**
+ * \brief Memory History Size
+ *
+ *  \par Description:
+ *       Number of memory history samples a line is fitted to for the
+ *       resident set size growth. Leaks are only looked for once the
+ *       history is full, #HS_MEM_HISTORY_SIZE times
+ *       #HS_MEM_HISTORY_INTERVALS intervals after startup.
+ *
+ *  \par Limits:
+ *       This parameter can't be less than 2 or larger than 1024.
+ */
+#define HS_MEM_HISTORY_SIZE 32
+
+/**
+ * \brief Memory Leak Growth
+ *
+ *  \par Description:
+ *       Fitted resident set size growth, in KiB per memory history
+ *       sample, at or above which a leak is suspected and
+ *       #HS_MEM_LEAK_ACTION is taken. The suspicion is cleared once the
+ *       growth falls below half of this. 0 disables leak detection.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than a signed 32 bit integer
+ *       (2147483647).
+ */
+#define HS_MEM_LEAK_GROWTH_KB 256
+
+/**
+ * \brief Memory Leak Action
+ *
+ *  \par Description:
+ *       Action taken when a leak is suspected: #HS_ALARM_ACT_NOACT,
+ *       #HS_ALARM_ACT_EVENT, or #HS_ALARM_ACT_LAST_NONMSG plus
+ *       one plus the index of a Message Actions Table entry.
+ *
+ *  \par Limits:
+ *       Message actions beyond #HS_MAX_MSG_ACT_TYPES are ignored.
+ */
+#define HS_MEM_LEAK_ACTION HS_ALARM_ACT_EVENT
+
+/**
+ * \brief Low Available Memory
+ *
+ *  \par Description:
+ *       Available system memory, in KiB, at or below which
+ *       #HS_MEM_LOW_ACTION is taken. It is cleared once available
+ *       memory is back above twice this. 0 disables the check.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than 2147483647.
+ */
+#define HS_MEM_LOW_AVAIL_KB 16384
+
+/**
+ * \brief Low Available Memory Action
+ *
+ *  \par Description:
+ *       Action taken when available memory reaches #HS_MEM_LOW_AVAIL_KB:
+ *       #HS_ALARM_ACT_NOACT, #HS_ALARM_ACT_EVENT, or
+ *       #HS_ALARM_ACT_LAST_NONMSG plus one plus the index of a
+ *       Message Actions Table entry.
+ *
+ *  \par Limits:
+ *       Message actions beyond #HS_MAX_MSG_ACT_TYPES are ignored.
+ */
+#define HS_MEM_LOW_ACTION HS_ALARM_ACT_EVENT
+
+/**
+ * \brief Per-Task CPU Accounting Maximum Tasks
+ *
+ *  \par Description:
+ *       Maximum number of threads of the cFS process whose CPU time is
+ *       sampled each utilization interval. Threads beyond this number
+ *       are not accounted for.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0.
+ *
+ *       Two sample sets of this size are kept in the HS global data.
+ */
+#define HS_TASK_CPU_MAX_TASKS 64
+
+/**
+ * \brief Per-Task CPU Accounting Top Consumers
+ *
+ *  \par Description:
+ *       Number of threads with the highest CPU usage reported in the
+ *       per-task CPU telemetry packet each utilization interval.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than #HS_TASK_CPU_MAX_TASKS.
+ */
+#define HS_TASK_CPU_TOP_N 5
+
+/**
+ * \brief Per-Task Run Delay Threshold
+ *
+ *  \par Description:
+ *       Run queue wait, in Utils of one core per utilization interval,
+ *       at or above which the thread that waited longest for a CPU
+ *       triggers #HS_TASK_RUN_DELAY_ACTION. A thread waiting this long
+ *       was ready to run but not given a CPU.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_UTIL_PER_INTERVAL_TOTAL.
+ *       0 disables the run delay action.
+ */
+#define HS_TASK_RUN_DELAY_THRESHOLD 2000
+
+/**
+ * \brief Per-Task Run Delay Action
+ *
+ *  \par Description:
+ *       Action taken when a thread reaches #HS_TASK_RUN_DELAY_THRESHOLD:
+ *       #HS_ALARM_ACT_NOACT, #HS_ALARM_ACT_EVENT, or
+ *       #HS_ALARM_ACT_LAST_NONMSG plus one plus the index of a
+ *       Message Actions Table entry. It is taken again only after every
+ *       thread has dropped below the threshold.
+ *
+ *  \par Limits:
+ *       Message actions beyond #HS_MAX_MSG_ACT_TYPES are ignored.
+ */
+#define HS_TASK_RUN_DELAY_ACTION HS_ALARM_ACT_EVENT
+
+/**
+ * \brief CPU Hog Snapshot Filename
+ *
+ *  \par Description:
+ *       Name of the file the CPU hog snapshot is written to each time
+ *       CPU hogging is detected. Each snapshot replaces the previous one.
+ *
+ *  \par Limits:
+ *       The length of each string, including the NULL terminator cannot
+ *       exceed #OS_MAX_PATH_LEN.
+ */
+#define HS_HOG_SNAPSHOT_FILENAME "/ram/hs_hog_snapshot.dat"
+
+/**
+ * \brief CPU Hog Snapshot File Sub-Type
+ *
+ *  \par Description:
+ *       Sub-type written to the cFE file header of CPU hog snapshot
+ *       files.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define HS_HOG_SNAPSHOT_FILE_SUBTYPE 0x48530002
+
+/**
+ * \brief CPU Hog Snapshot Utilization Intervals
+ *
+ *  \par Description:
+ *       Number of the most recent interval utilization values recorded
+ *       in the CPU hog snapshot.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than #HS_UTIL_PEAK_NUM_INTERVAL.
+ */
+#define HS_HOG_SNAPSHOT_NUM_UTIL 16
+
+/**
+ * \brief CPU Hog Snapshot Event Tasks
+ *
+ *  \par Description:
+ *       Number of threads with the most CPU time over the hogging
+ *       window that are named in the CPU hog snapshot event.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than #HS_TASK_CPU_MAX_TASKS. Names that do not fit in the
+ *       event message are truncated.
+ */
+#define HS_HOG_SNAPSHOT_EVENT_TASKS 3
+
+/**
+ * \brief Stack Monitor Threads per Interval
+ *
+ *  \par Description:
+ *       Number of threads whose stack high-water mark is measured each
+ *       utilization interval. The threads are taken in turn from the
+ *       latest per-task CPU sample, and the stack telemetry packet is
+ *       sent each time every thread has been measured.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_TASK_CPU_MAX_TASKS.
+ *       0 disables stack monitoring.
+ */
+#define HS_STACK_TASKS_PER_INTERVAL 4
+
+/**
+ * \brief Stack Usage Threshold
+ *
+ *  \par Description:
+ *       Stack high-water mark, in percent of the stack, at or above
+ *       which a thread triggers #HS_STACK_USAGE_ACTION.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than 100. 0 disables the stack
+ *       usage action.
+ */
+#define HS_STACK_USAGE_THRESHOLD 80
+
+/**
+ * \brief Stack Usage Action
+ *
+ *  \par Description:
+ *       Action taken when a thread reaches #HS_STACK_USAGE_THRESHOLD:
+ *       #HS_ALARM_ACT_NOACT, #HS_ALARM_ACT_EVENT, or
+ *       #HS_ALARM_ACT_LAST_NONMSG plus one plus the index of a
+ *       Message Actions Table entry. A high-water mark never falls, so
+ *       the action is taken once per thread.
+ *
+ *  \par Limits:
+ *       Message actions beyond #HS_MAX_MSG_ACT_TYPES are ignored.
+ */
+#define HS_STACK_USAGE_ACTION HS_ALARM_ACT_EVENT
+
+/**
+ * \brief Software Bus Statistics Period
+ *
+ *  \par Description:
+ *       Number of HS cycles between requests for the Software Bus
+ *       statistics, from which the depths of the pipes are monitored.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295). 0 disables the pipe depth monitor; the
+ *       dropped message monitor still runs on the Software Bus
+ *       housekeeping telemetry.
+ */
+#define HS_SB_STATS_PERIOD 10
+
+/**
+ * \brief Maximum Monitored Software Bus Pipes
+ *
+ *  \par Description:
+ *       Number of entries of #HS_SB_PIPE_LIMITS.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 32.
+ */
+#define HS_SB_MAX_PIPE_LIMITS 8
+
+/**
+ * \brief Software Bus Pipe Limits
+ *
+ *  \par Description:
+ *       Initializer for the #HS_SbPipeLimit_t settings of the monitored
+ *       pipes: pipe name, enter usage, exit usage (both in percent of
+ *       the pipe depth) and action type. The action type is
+ *       #HS_ALARM_ACT_NOACT, #HS_ALARM_ACT_EVENT, or
+ *       #HS_ALARM_ACT_LAST_NONMSG plus one plus the index of a
+ *       Message Actions Table entry. The action is taken once when the
+ *       queue depth of the pipe reaches the enter usage, and again only
+ *       after it fell below the exit usage. Pipes not created yet are
+ *       looked up again on every statistics request.
+ *
+ *  \par Limits:
+ *       Can't have more than #HS_SB_MAX_PIPE_LIMITS entries. An exit
+ *       usage can't be larger than its enter usage. An enter usage of
+ *       0 disables the entry.
+ */
+#define HS_SB_PIPE_LIMITS                                                                                       \
+    {{"HS_CMD_PIPE", 75, 25, HS_ALARM_ACT_EVENT}, {"HS_EVENT_PIPE", 75, 25, HS_ALARM_ACT_EVENT},                \
+     {"HS_WAKEUP_PIPE", 75, 25, HS_ALARM_ACT_EVENT}}
+
+/**
+ * \brief Software Bus Worst Pipes
+ *
+ *  \par Description:
+ *       Number of pipes with the highest queue usage, of all Software
+ *       Bus pipes, reported in housekeeping telemetry.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than 16.
+ */
+#define HS_SB_WORST_PIPES 3
+
+/**
+ * \brief Software Bus Dropped Message Threshold
+ *
+ *  \par Description:
+ *       Messages dropped by the Software Bus between two of its
+ *       housekeeping packets, counted by its pipe overflow and message
+ *       limit error counters, at or above which #HS_SB_DROP_ACTION is
+ *       taken. The action is taken again only after a housekeeping
+ *       packet without dropped messages.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than 65535. 0 disables the
+ *       dropped message action.
+ */
+#define HS_SB_DROP_THRESHOLD 1
+
+/**
+ * \brief Software Bus Dropped Message Action
+ *
+ *  \par Description:
+ *       Action taken when the Software Bus dropped
+ *       #HS_SB_DROP_THRESHOLD messages: #HS_ALARM_ACT_NOACT,
+ *       #HS_ALARM_ACT_EVENT, or #HS_ALARM_ACT_LAST_NONMSG plus
+ *       one plus the index of a Message Actions Table entry.
+ *
+ *  \par Limits:
+ *       Message actions beyond #HS_MAX_MSG_ACT_TYPES are ignored.
+ */
+#define HS_SB_DROP_ACTION HS_ALARM_ACT_EVENT
+
+/**
+ * \brief Core Rebalance High Utilization
+ *
+ *  \par Description:
+ *       Interval utilization of a core, in Utils, at or above which the
+ *       core is saturated. When one core is saturated while another is
+ *       at or below #HS_REBALANCE_LOW_UTIL for #HS_REBALANCE_DWELL
+ *       intervals, HS moves a task of the Rebalance Table from the
+ *       saturated core to the idle one.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_UTIL_PER_INTERVAL_TOTAL
+ *       or smaller than #HS_REBALANCE_LOW_UTIL. Rebalancing is only
+ *       done when #HS_UTIL_NUM_CORES is greater than 1.
+ */
+#define HS_REBALANCE_HIGH_UTIL 9000
+
+/**
+ * \brief Core Rebalance Low Utilization
+ *
+ *  \par Description:
+ *       Interval utilization of a core, in Utils, at or below which the
+ *       core can take a task moved off a saturated core.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #HS_REBALANCE_HIGH_UTIL.
+ */
+#define HS_REBALANCE_LOW_UTIL 3000
+
+/**
+ * \brief Core Rebalance Dwell Intervals
+ *
+ *  \par Description:
+ *       Number of consecutive utilization intervals the same cores must
+ *       stay saturated and idle before HS moves a task, so that a short
+ *       burst does not move tasks.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than 0 and can't be larger
+ *       than an unsigned 32 bit integer (4294967295).
+ */
+#define HS_REBALANCE_DWELL 5
+
+/**
+ * \brief Core Rebalance Cooldown Intervals
+ *
+ *  \par Description:
+ *       Number of utilization intervals after a move before HS starts
+ *       looking for the next one, giving the move time to take effect
+ *       and keeping tasks from bouncing between cores.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 32 bit
+ *       integer (4294967295).
+ */
+#define HS_REBALANCE_COOLDOWN 30
+
 /**
  * \brief Mission specific version number for HS application
  *
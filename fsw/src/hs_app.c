@@ -141,6 +141,11 @@ void HS_AppMain(void)
         */
         CFE_ES_PerfLogEntry(HS_APPMAIN_PERF_ID);
 
+        /*
+        ** Measure the time since the previous wakeup
+        */
+        HS_MonitorWakeup(Status);
+
         /*
         ** Process the software bus message
         */
@@ -202,7 +207,9 @@ void HS_AppMain(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 HS_AppInit(void)
 {
-    int32 Status;
+    int32                    Status;
+    const HS_UtilLoadLevel_t UtilLoadLevelDefaults[HS_UTIL_LOAD_NUM_LEVELS] = HS_UTIL_LOAD_LEVEL_DEFAULTS;
+    const HS_SbPipeLimit_t   SbPipeLimitDefaults[HS_SB_MAX_PIPE_LIMITS]     = HS_SB_PIPE_LIMITS;
 
     /*
     ** Initialize operating data to default states...
@@ -223,12 +230,29 @@ int32 HS_AppInit(void)
 #endif
 
     HS_AppData.MsgActsState   = HS_STATE_ENABLED;
+    HS_AppData.LoadShedState  = HS_STATE_ENABLED;
+    HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+    HS_AppData.RebalanceState = HS_STATE_ENABLED;
     HS_AppData.AppMonLoaded   = HS_STATE_ENABLED;
     HS_AppData.EventMonLoaded = HS_STATE_ENABLED;
     HS_AppData.CDSState       = HS_STATE_ENABLED;
 
     HS_AppData.MaxCPUHoggingTime = HS_UTIL_HOGGING_TIMEOUT;
 
+    memcpy(HS_AppData.UtilLoadLevels, UtilLoadLevelDefaults, sizeof(HS_AppData.UtilLoadLevels));
+
+    HS_AppData.UtilTrendConfig.HorizonIntervals = HS_UTIL_TREND_HORIZON;
+    HS_AppData.UtilTrendConfig.ActionType       = HS_UTIL_TREND_ACTION;
+    HS_AppData.UtilTrend.TimeToSat              = HS_UTIL_TREND_NOT_RISING;
+
+    memcpy(HS_AppData.SbPipeLimits, SbPipeLimitDefaults, sizeof(HS_AppData.SbPipeLimits));
+
+    /*
+    ** Cache local identity for processor-qualified Event Monitor entries
+    */
+    HS_AppData.LocalSpacecraftID = CFE_PSP_GetSpacecraftId();
+    HS_AppData.LocalProcessorID  = CFE_PSP_GetProcessorId();
+
     /*
     ** Register for event services...
     */
@@ -355,6 +379,25 @@ int32 HS_SbInit(void)
     /* Initialize housekeeping packet  */
     CFE_MSG_Init(&HS_AppData.HkPacket.TlmHeader.Msg, CFE_SB_ValueToMsgId(HS_HK_TLM_MID), sizeof(HS_HkPacket_t));
 
+    /* Initialize utilization history packet */
+    CFE_MSG_Init(&HS_AppData.UtilHistPacket.TlmHeader.Msg, CFE_SB_ValueToMsgId(HS_UTIL_HIST_TLM_MID),
+                 sizeof(HS_UtilHistPkt_t));
+
+    /* Initialize utilization percentile histogram packet */
+    CFE_MSG_Init(&HS_AppData.UtilPctlPacket.TlmHeader.Msg, CFE_SB_ValueToMsgId(HS_UTIL_PCTL_TLM_MID),
+                 sizeof(HS_UtilPctlPkt_t));
+
+    /* Initialize per-task CPU packet */
+    CFE_MSG_Init(&HS_AppData.TaskCpuPacket.TlmHeader.Msg, CFE_SB_ValueToMsgId(HS_TASK_CPU_TLM_MID),
+                 sizeof(HS_TaskCpuPkt_t));
+
+    /* Initialize stack usage packet */
+    CFE_MSG_Init(&HS_AppData.StackPacket.TlmHeader.Msg, CFE_SB_ValueToMsgId(HS_STACK_TLM_MID), sizeof(HS_StackPkt_t));
+
+    /* Initialize Software Bus statistics request */
+    CFE_MSG_Init(&HS_AppData.SbStatsCmd.Msg, CFE_SB_ValueToMsgId(CFE_SB_CMD_MID), sizeof(HS_AppData.SbStatsCmd));
+    CFE_MSG_SetFcnCode(&HS_AppData.SbStatsCmd.Msg, CFE_SB_SEND_SB_STATS_CC);
+
     /* Create Command Pipe */
     Status = CFE_SB_CreatePipe(&HS_AppData.CmdPipe, HS_CMD_PIPE_DEPTH, HS_CMD_PIPE_NAME);
     if (Status != CFE_SUCCESS)
@@ -409,6 +452,26 @@ int32 HS_SbInit(void)
         return (Status);
     }
 
+    /* Subscribe to Software Bus Housekeeping for its dropped message counts */
+    Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CFE_SB_HK_TLM_MID), HS_AppData.CmdPipe);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_SUB_SB_TLM_ERR_EID, CFE_EVS_EventType_ERROR, "Error Subscribing to SB HK,RC=0x%08X",
+                          (unsigned int)Status);
+        return (Status);
+    }
+
+#if HS_SB_STATS_PERIOD != 0
+    /* Subscribe to Software Bus Statistics for its pipe depths */
+    Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID), HS_AppData.CmdPipe);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_SUB_SB_TLM_ERR_EID, CFE_EVS_EventType_ERROR, "Error Subscribing to SB Stats,RC=0x%08X",
+                          (unsigned int)Status);
+        return (Status);
+    }
+#endif
+
     /*
     ** Event message subscription delayed until after startup synch
     */
@@ -492,6 +555,42 @@ int32 HS_TblInit(void)
     }
 #endif
 
+    /* Register The HS Load Shedding Table */
+    TableSize = HS_MAX_LOAD_SHED_STEPS * sizeof(HS_LSTEntry_t);
+    Status    = CFE_TBL_Register(&HS_AppData.LSTableHandle, HS_LST_TABLENAME, TableSize, CFE_TBL_OPT_DEFAULT,
+                              HS_ValidateLSTable);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_LST_REG_ERR_EID, CFE_EVS_EventType_ERROR, "Error Registering LoadShed Table,RC=0x%08X",
+                          (unsigned int)Status);
+        return (Status);
+    }
+
+    /* Register The HS CPU Budget Table */
+    TableSize = HS_MAX_CPU_BUDGETS * sizeof(HS_CBTEntry_t);
+    Status    = CFE_TBL_Register(&HS_AppData.CBTableHandle, HS_CBT_TABLENAME, TableSize, CFE_TBL_OPT_DEFAULT,
+                              HS_ValidateCBTable);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_CBT_REG_ERR_EID, CFE_EVS_EventType_ERROR, "Error Registering CpuBudget Table,RC=0x%08X",
+                          (unsigned int)Status);
+        return (Status);
+    }
+
+    /* Register The HS Rebalance Table */
+    TableSize = HS_MAX_REBALANCE_TASKS * sizeof(HS_RBTEntry_t);
+    Status    = CFE_TBL_Register(&HS_AppData.RBTableHandle, HS_RBT_TABLENAME, TableSize, CFE_TBL_OPT_DEFAULT,
+                              HS_ValidateRBTable);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_RBT_REG_ERR_EID, CFE_EVS_EventType_ERROR, "Error Registering Rebalance Table,RC=0x%08X",
+                          (unsigned int)Status);
+        return (Status);
+    }
+
     /* Load the HS Applications Monitor Table */
     Status = CFE_TBL_Load(HS_AppData.AMTableHandle, CFE_TBL_SRC_FILE, (const void *)HS_AMT_FILENAME);
     if (Status != CFE_SUCCESS)
@@ -525,6 +624,33 @@ int32 HS_TblInit(void)
         HS_AppData.MsgActsState = HS_STATE_DISABLED;
     }
 
+    /* Load the HS Load Shedding Table */
+    Status = CFE_TBL_Load(HS_AppData.LSTableHandle, CFE_TBL_SRC_FILE, (const void *)HS_LST_FILENAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_LST_LD_ERR_EID, CFE_EVS_EventType_ERROR, "Error Loading LoadShed Table,RC=0x%08X",
+                          (unsigned int)Status);
+        HS_AppData.LoadShedState = HS_STATE_DISABLED;
+    }
+
+    /* Load the HS CPU Budget Table */
+    Status = CFE_TBL_Load(HS_AppData.CBTableHandle, CFE_TBL_SRC_FILE, (const void *)HS_CBT_FILENAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_CBT_LD_ERR_EID, CFE_EVS_EventType_ERROR, "Error Loading CpuBudget Table,RC=0x%08X",
+                          (unsigned int)Status);
+        HS_AppData.CpuBudgetState = HS_STATE_DISABLED;
+    }
+
+    /* Load the HS Rebalance Table */
+    Status = CFE_TBL_Load(HS_AppData.RBTableHandle, CFE_TBL_SRC_FILE, (const void *)HS_RBT_FILENAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_RBT_LD_ERR_EID, CFE_EVS_EventType_ERROR, "Error Loading Rebalance Table,RC=0x%08X",
+                          (unsigned int)Status);
+        HS_AppData.RebalanceState = HS_STATE_DISABLED;
+    }
+
     /*
     ** Get pointers to table data
     */
@@ -574,6 +700,11 @@ int32 HS_ProcessMain(void)
     */
     HS_CustomMonitorUtilization();
 
+    /*
+    ** Monitor Software Bus Pipes
+    */
+    HS_MonitorSbPipes();
+
     /*
     ** Output Aliveness
     */
@@ -30,6 +30,7 @@
  ************************************************************************/
 #include "hs_msg.h"
 #include "hs_tbl.h"
+#include "hs_utils.h"
 #include "cfe.h"
 #include "cfe_msgids.h"
 #include "cfe_platform_cfg.h"
@@ -71,6 +72,82 @@ typedef struct
     uint16 MaxResetsNot;       /**< \brief Inverted Max Number of Resets Allowed for validation */
 } HS_CDSData_t;
 
+/**
+ *  \brief HS Utilization History Level
+ */
+typedef struct
+{
+    uint32 NextIndex;   /**< \brief Index of the next entry to be written */
+    uint32 NumEntries;  /**< \brief Number of valid entries */
+    uint32 RollupCount; /**< \brief Entries of the level below accumulated so far */
+    uint32 RollupSum;   /**< \brief Sum of accumulated averages */
+    uint32 RollupMin;   /**< \brief Minimum of accumulated entries */
+    uint32 RollupMax;   /**< \brief Maximum of accumulated entries */
+
+    HS_UtilHistEntry_t Entries[HS_UTIL_HIST_DEPTH]; /**< \brief History ring buffer */
+} HS_UtilHistLevel_t;
+
+/**
+ *  \brief HS Utilization Percentile Histogram
+ *
+ *  Bucket counts of the interval utilizations over the last
+ *  #HS_UTIL_PCTL_WINDOW intervals, and the bucket of each of those
+ *  intervals so the oldest can be removed in constant time
+ */
+typedef struct
+{
+    uint32 NextIndex;  /**< \brief Index of the next interval to be written */
+    uint32 NumSamples; /**< \brief Number of intervals in the histogram */
+
+    uint32 Counts[HS_UTIL_PCTL_NUM_BUCKETS]; /**< \brief Intervals counted by each bucket */
+    uint16 Window[HS_UTIL_PCTL_WINDOW];      /**< \brief Bucket of each interval in the window */
+} HS_UtilPctl_t;
+
+/**
+ *  \brief HS Utilization Window State
+ *
+ *  Running sum and peak queue over a utilization tracker array, giving
+ *  the window average and peak in constant time per interval
+ */
+typedef struct
+{
+    uint32 Sum;            /**< \brief Running sum of the last #HS_UTIL_AVERAGE_NUM_INTERVAL utilizations */
+    uint32 PeakQueueHead;  /**< \brief Index of the oldest entry in the peak queue */
+    uint32 PeakQueueCount; /**< \brief Number of entries in the peak queue */
+    uint32 PeakQueue[HS_UTIL_PEAK_NUM_INTERVAL]; /**< \brief Tracker indices of peak candidates */
+} HS_UtilWindow_t;
+
+/**
+ *  \brief HS Utilization Trend State
+ *
+ *  Running sums for a least-squares line over the last
+ *  #HS_UTIL_TREND_NUM_INTERVAL interval utilizations, with the oldest
+ *  interval at position 0, updated in constant time per interval
+ */
+typedef struct
+{
+    uint32 NumSamples;  /**< \brief Number of intervals in the sums, up to #HS_UTIL_TREND_NUM_INTERVAL */
+    uint32 SumUtil;     /**< \brief Sum of the interval utilizations */
+    uint64 SumWeighted; /**< \brief Sum of each interval utilization times its position */
+    int32  Slope;       /**< \brief Fitted utilization change in Utils per 100 intervals */
+    uint32 TimeToSat;   /**< \brief Predicted intervals to saturation, or #HS_UTIL_TREND_NOT_RISING */
+    bool   Warned;      /**< \brief Saturation warning has been given */
+} HS_UtilTrend_t;
+
+/**
+ *  \brief HS Software Bus Pipe Limit
+ *
+ *  The action is taken when the queue depth of the pipe reaches
+ *  EnterUsage, and is armed again once it falls below ExitUsage
+ */
+typedef struct
+{
+    char   PipeName[OS_MAX_API_NAME]; /**< \brief Name of the monitored pipe */
+    uint8  EnterUsage;                /**< \brief Queue usage in percent at or above which to act, 0 if unused */
+    uint8  ExitUsage;                 /**< \brief Queue usage in percent below which to rearm */
+    uint16 ActionType;                /**< \brief Action taken when entered, see #HS_ALARM_ACT_EVENT */
+} HS_SbPipeLimit_t;
+
 /**
  *  \brief HS Global Data Structure
  */
@@ -93,19 +170,31 @@ typedef struct
     uint8 EventMonLoaded; /**< \brief If EventMon Table is loaded */
 
     uint8 CurrentCPUHogState; /**< \brief Status of HS CPU Hogging Indicator */
-    uint8 SpareBytes[3];      /**< \brief Spare bytes for 32 bit alignment padding */
+    uint8 LoadShedState;      /**< \brief Status of Load Shedding Table */
+    uint8 CpuBudgetState;     /**< \brief Status of CPU Budget Table */
+    uint8 RebalanceState;     /**< \brief Status of Rebalance Table */
 
     uint8 CmdCount;    /**< \brief Number of valid commands received */
     uint8 CmdErrCount; /**< \brief Number of invalid commands received */
 
     uint32 EventsMonitoredCount; /**< \brief Total count of event messages monitored */
 
+    uint32 LocalSpacecraftID; /**< \brief Local spacecraft ID for #HS_EMT_QUAL_LOCAL matching */
+    uint32 LocalProcessorID;  /**< \brief Local processor ID for #HS_EMT_QUAL_LOCAL matching */
+
+    uint32              ProcEventOverflowCount;                   /**< \brief Events from untracked processors */
+    uint32              ProcEventCountsUsed;                      /**< \brief Number of ProcEventCounts in use */
+    HS_ProcEventCount_t ProcEventCounts[HS_MAX_EVENT_PROCESSORS]; /**< \brief Event counts by source processor */
+
     uint16 MsgActCooldown[HS_MAX_MSG_ACT_TYPES];          /**< \brief Counts until Message Actions is available */
     uint16 AppMonCheckInCountdown[HS_MAX_MONITORED_APPS]; /**< \brief Counts until Application Monitor times out */
 
     uint32 AppMonEnables[((HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE) +
                          1]; /**< \brief AppMon state by monitor */
 
+    uint32 EventMonEnables[((HS_MAX_MONITORED_EVENTS - 1) / HS_BITS_PER_EVENTMON_ENABLE) +
+                           1]; /**< \brief EventMon state by table entry */
+
     uint32 AppMonLastExeCount[HS_MAX_MONITORED_APPS]; /**< \brief Last Execution Count for application being checked */
 
     uint32 AlivenessCounter; /**< \brief Current Count towards the CPU Aliveness output period */
@@ -120,12 +209,84 @@ typedef struct
 
     uint32 UtilizationTracker[HS_UTIL_PEAK_NUM_INTERVAL]; /**< \brief Utilization from previous intervals */
 
+    HS_UtilWindow_t UtilWindow; /**< \brief Average and peak state for the Utilization Tracker */
+
     uint32 UtilCpuAvg;  /**< \brief Current CPU Utilization Average */
     uint32 UtilCpuPeak; /**< \brief Current CPU Utilization Peak */
 
+    uint32 CurrentCoreHoggingTime[HS_UTIL_NUM_CORES]; /**< \brief Hogging cycle counts by core */
+    uint32 UtilCoreTracker[HS_UTIL_NUM_CORES][HS_UTIL_PEAK_NUM_INTERVAL]; /**< \brief Utilization history by core */
+    HS_UtilWindow_t UtilCoreWindow[HS_UTIL_NUM_CORES]; /**< \brief Average and peak state by core */
+
+    uint32 UtilCoreAvg[HS_UTIL_NUM_CORES];  /**< \brief Current CPU Utilization Average by core */
+    uint32 UtilCorePeak[HS_UTIL_NUM_CORES]; /**< \brief Current CPU Utilization Peak by core */
+
+    HS_UtilHistLevel_t UtilHist[HS_UTIL_HIST_NUM_LEVELS]; /**< \brief Multi-resolution utilization history */
+
+    HS_UtilPctl_t UtilPctl; /**< \brief Utilization percentile histogram */
+
+    HS_UtilLoadLevel_t UtilLoadLevels[HS_UTIL_LOAD_NUM_LEVELS]; /**< \brief CPU load level settings */
+    uint32             UtilLoadDwell[HS_UTIL_LOAD_NUM_LEVELS];  /**< \brief Consecutive intervals at or above enter */
+    uint32             UtilLoadActiveMask; /**< \brief Bit N set while CPU load level N is active */
+
+    uint32 LoadShedStep;      /**< \brief Number of Load Shedding Table steps currently shed */
+    uint32 LoadShedHighCount; /**< \brief Consecutive intervals at or above #HS_LOAD_SHED_HIGH_UTIL */
+    uint32 LoadShedLowCount;  /**< \brief Consecutive intervals below #HS_LOAD_SHED_LOW_UTIL */
+    uint32 LoadShedLastAvg;   /**< \brief CPU Utilization Average at the previous load shedding step */
+
+    HS_UtilTrendConfig_t UtilTrendConfig; /**< \brief CPU saturation warning settings */
+    HS_UtilTrend_t       UtilTrend;       /**< \brief CPU utilization trend */
+
+    uint32 CpuBudgetCount[HS_MAX_CPU_BUDGETS]; /**< \brief Consecutive intervals each task was over budget */
+
+    uint32 RebalanceFromCore;     /**< \brief Saturated core of the imbalance being dwelled on */
+    uint32 RebalanceToCore;       /**< \brief Idle core of the imbalance being dwelled on */
+    uint32 RebalanceDwell;        /**< \brief Consecutive intervals of the same imbalance */
+    uint32 RebalanceCooldown;     /**< \brief Intervals until the next move can be made */
+    uint32 RebalanceMoveCount;    /**< \brief Number of tasks moved between cores */
+    uint32 RebalanceLastEntry;    /**< \brief Rebalance Table entry of the latest move */
+    uint32 RebalanceLastFromCore; /**< \brief Core the latest move was from */
+    uint32 RebalanceLastToCore;   /**< \brief Core the latest move was to */
+
+    HS_TaskCpuSample_t TaskCpuSamples[2][HS_TASK_CPU_MAX_TASKS]; /**< \brief Latest and previous thread CPU times */
+    uint32             TaskCpuNumSamples[2];                     /**< \brief Number of valid thread CPU times */
+    uint32             TaskCpuCurrent;     /**< \brief Index of the latest thread CPU times */
+    uint64             TaskCpuLastTime;    /**< \brief Time of the latest thread CPU times, 0 if none */
+    bool               TaskCpuErrReported; /**< \brief Thread CPU times read error has been reported */
+    bool               RunDelayActive;     /**< \brief A thread is at or above the run delay threshold */
+
+    HS_TaskCpuSample_t HogBaseline[HS_TASK_CPU_MAX_TASKS]; /**< \brief Thread CPU times at the start of hogging */
+    uint32             HogBaselineNum;                     /**< \brief Number of valid thread CPU times */
+    uint64             HogBaselineTime; /**< \brief Time of the hogging baseline, 0 if none */
+    HS_HogSnapshot_t   HogSnapshot;     /**< \brief Latest CPU hog snapshot */
+
+    uint32 StackNext;     /**< \brief Index of the next thread whose stack is measured */
+    uint32 StackMaxUsage; /**< \brief Highest stack usage in percent at the last full stack scan */
+
+    HS_SbPipeLimit_t SbPipeLimits[HS_SB_MAX_PIPE_LIMITS]; /**< \brief Monitored pipe settings */
+    CFE_SB_PipeId_t  SbPipeIds[HS_SB_MAX_PIPE_LIMITS];    /**< \brief Ids of the monitored pipes */
+    HS_SbPipeTlm_t   SbWorstPipes[HS_SB_WORST_PIPES];     /**< \brief Pipes with the highest queue usage */
+    uint32           SbPipeActiveMask;     /**< \brief Bit N set while the pipe of limit N is at or above EnterUsage */
+    uint32           SbStatsCounter;       /**< \brief HS cycles since the last statistics request */
+    uint32           SbDropCount;          /**< \brief Messages dropped by the Software Bus since HS started */
+    uint16           SbLastOverflowErrors; /**< \brief Pipe overflow error count of the last SB housekeeping */
+    uint16           SbLastMsgLimitErrors; /**< \brief Message limit error count of the last SB housekeeping */
+    bool             SbHkReceived;         /**< \brief An SB housekeeping packet has been received */
+    bool             SbDropActive;         /**< \brief Dropped message action taken, not yet rearmed */
+
+    HS_WakeupTlm_t WakeupTlm;      /**< \brief Wakeup intervals, missed and late wakeups */
+    uint64         WakeupLastTime; /**< \brief Monotonic time in ns of the previous wakeup, 0 if none */
+    uint64         WakeupSumUs;    /**< \brief Sum of the measured intervals in microseconds */
+    uint64         WakeupMissed;   /**< \brief Wakeups already counted missed since the previous wakeup */
+
+    CFE_MSG_CommandHeader_t SbStatsCmd; /**< \brief Software Bus statistics request */
+
     CFE_TBL_Handle_t AMTableHandle; /**< \brief Apps Monitor table handle */
     CFE_TBL_Handle_t EMTableHandle; /**< \brief Events Monitor table handle */
     CFE_TBL_Handle_t MATableHandle; /**< \brief Message Actions table handle */
+    CFE_TBL_Handle_t LSTableHandle; /**< \brief Load Shedding table handle */
+    CFE_TBL_Handle_t CBTableHandle; /**< \brief CPU Budget table handle */
+    CFE_TBL_Handle_t RBTableHandle; /**< \brief Rebalance table handle */
 
 #if HS_MAX_EXEC_CNT_SLOTS != 0
     CFE_TBL_Handle_t XCTableHandle; /**< \brief Execution Counters table handle */
@@ -135,11 +296,18 @@ typedef struct
     HS_AMTEntry_t *AMTablePtr; /**< \brief Ptr to Apps Monitor table entry */
     HS_EMTEntry_t *EMTablePtr; /**< \brief Ptr to Events Monitor table entry */
     HS_MATEntry_t *MATablePtr; /**< \brief Ptr to Message Actions table entry */
+    HS_LSTEntry_t *LSTablePtr; /**< \brief Ptr to Load Shedding table entry */
+    HS_CBTEntry_t *CBTablePtr; /**< \brief Ptr to CPU Budget table entry */
+    HS_RBTEntry_t *RBTablePtr; /**< \brief Ptr to Rebalance table entry */
 
     CFE_ES_CDSHandle_t MyCDSHandle; /* \brief Handle to CDS memory block */
     HS_CDSData_t       CDSData;     /* \brief Copy of Critical Data */
 
-    HS_HkPacket_t HkPacket; /**< \brief HK Housekeeping Packet */
+    HS_HkPacket_t    HkPacket;       /**< \brief HK Housekeeping Packet */
+    HS_UtilHistPkt_t UtilHistPacket; /**< \brief Utilization History Packet */
+    HS_TaskCpuPkt_t  TaskCpuPacket;  /**< \brief Per-Task CPU Packet */
+    HS_UtilPctlPkt_t UtilPctlPacket; /**< \brief Utilization Percentile Histogram Packet */
+    HS_StackPkt_t    StackPacket;    /**< \brief Stack Usage Packet */
 } HS_AppData_t;
 
 /************************************************************************
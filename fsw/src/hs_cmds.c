@@ -34,6 +34,8 @@
 #include "hs_utils.h"
 #include "hs_version.h"
 
+#include <string.h>
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process a command pipe message                                  */
@@ -56,6 +58,17 @@ void HS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
             HS_HousekeepingReq(BufPtr);
             break;
 
+        /*
+        ** Software Bus telemetry for the pipe monitor
+        */
+        case CFE_SB_HK_TLM_MID:
+            HS_SbHkTlm(BufPtr);
+            break;
+
+        case CFE_SB_STATS_TLM_MID:
+            HS_SbStatsTlm(BufPtr);
+            break;
+
         /*
         ** HS application commands...
         */
@@ -113,6 +126,30 @@ void HS_AppPipe(const CFE_SB_Buffer_t *BufPtr)
                     HS_DisableCPUHogCmd(BufPtr);
                     break;
 
+                case HS_ENABLE_EVENTMON_ENTRIES_CC:
+                    HS_EnableEventMonEntriesCmd(BufPtr);
+                    break;
+
+                case HS_DISABLE_EVENTMON_ENTRIES_CC:
+                    HS_DisableEventMonEntriesCmd(BufPtr);
+                    break;
+
+                case HS_DUMP_UTIL_HIST_CC:
+                    HS_DumpUtilHistCmd(BufPtr);
+                    break;
+
+                case HS_SEND_UTIL_PCTL_CC:
+                    HS_SendUtilPctlCmd(BufPtr);
+                    break;
+
+                case HS_SET_UTIL_LOAD_LEVEL_CC:
+                    HS_SetUtilLoadLevelCmd(BufPtr);
+                    break;
+
+                case HS_SET_UTIL_TREND_CC:
+                    HS_SetUtilTrendCmd(BufPtr);
+                    break;
+
                 default:
                     if (HS_CustomCommands(BufPtr) != CFE_SUCCESS)
                     {
@@ -180,6 +217,10 @@ void HS_HousekeepingReq(const CFE_SB_Buffer_t *BufPtr)
         HS_AppData.HkPacket.EventsMonitoredCount  = HS_AppData.EventsMonitoredCount;
         HS_AppData.HkPacket.MsgActExec            = HS_AppData.MsgActExec;
 
+        HS_AppData.HkPacket.ProcEventOverflowCount = HS_AppData.ProcEventOverflowCount;
+        memcpy(HS_AppData.HkPacket.ProcEventCounts, HS_AppData.ProcEventCounts,
+               sizeof(HS_AppData.HkPacket.ProcEventCounts));
+
         /*
         ** Calculate the current number of invalid event monitor entries
         */
@@ -187,7 +228,15 @@ void HS_HousekeepingReq(const CFE_SB_Buffer_t *BufPtr)
 
         for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_EVENTS; TableIndex++)
         {
-            if (HS_AppData.EMTablePtr[TableIndex].ActionType != HS_EMT_ACT_NOACT)
+            /*
+            ** Entries qualified for another spacecraft or processor can't be
+            ** checked against local applications, so they are never invalid here
+            */
+            if ((HS_AppData.EMTablePtr[TableIndex].ActionType != HS_EMT_ACT_NOACT) &&
+                HS_EMTQualifierMatches(HS_AppData.EMTablePtr[TableIndex].SpacecraftID, HS_AppData.LocalSpacecraftID,
+                                       HS_AppData.LocalSpacecraftID) &&
+                HS_EMTQualifierMatches(HS_AppData.EMTablePtr[TableIndex].ProcessorID, HS_AppData.LocalProcessorID,
+                                       HS_AppData.LocalProcessorID))
             {
                 Status = CFE_ES_GetAppIDByName(&AppId, HS_AppData.EMTablePtr[TableIndex].AppName);
 
@@ -224,6 +273,18 @@ void HS_HousekeepingReq(const CFE_SB_Buffer_t *BufPtr)
         {
             HS_AppData.HkPacket.StatusFlags |= HS_CDS_IN_USE;
         }
+        if (HS_AppData.LoadShedState == HS_STATE_ENABLED)
+        {
+            HS_AppData.HkPacket.StatusFlags |= HS_LOADED_LST;
+        }
+        if (HS_AppData.CpuBudgetState == HS_STATE_ENABLED)
+        {
+            HS_AppData.HkPacket.StatusFlags |= HS_LOADED_CBT;
+        }
+        if (HS_AppData.RebalanceState == HS_STATE_ENABLED)
+        {
+            HS_AppData.HkPacket.StatusFlags |= HS_LOADED_RBT;
+        }
 
         /*
         ** Update the AppMon Enables
@@ -233,8 +294,52 @@ void HS_HousekeepingReq(const CFE_SB_Buffer_t *BufPtr)
             HS_AppData.HkPacket.AppMonEnables[TableIndex] = HS_AppData.AppMonEnables[TableIndex];
         }
 
+        /*
+        ** Update the EventMon Enables
+        */
+        for (TableIndex = 0; TableIndex <= ((HS_MAX_MONITORED_EVENTS - 1) / HS_BITS_PER_EVENTMON_ENABLE); TableIndex++)
+        {
+            HS_AppData.HkPacket.EventMonEnables[TableIndex] = HS_AppData.EventMonEnables[TableIndex];
+        }
+
         HS_AppData.HkPacket.UtilCpuAvg  = HS_AppData.UtilCpuAvg;
         HS_AppData.HkPacket.UtilCpuPeak = HS_AppData.UtilCpuPeak;
+        HS_AppData.HkPacket.UtilCpuP50  = HS_UtilPctlValue(50);
+        HS_AppData.HkPacket.UtilCpuP90  = HS_UtilPctlValue(90);
+        HS_AppData.HkPacket.UtilCpuP99  = HS_UtilPctlValue(99);
+
+        for (TableIndex = 0; TableIndex < HS_UTIL_NUM_CORES; TableIndex++)
+        {
+            HS_AppData.HkPacket.UtilCoreAvg[TableIndex]  = HS_AppData.UtilCoreAvg[TableIndex];
+            HS_AppData.HkPacket.UtilCorePeak[TableIndex] = HS_AppData.UtilCorePeak[TableIndex];
+        }
+
+        HS_UtilMarkGetStats(&HS_AppData.HkPacket.UtilMarkSource, &HS_AppData.HkPacket.UtilMarkCount,
+                            &HS_AppData.HkPacket.UtilMarkJitterAvg, &HS_AppData.HkPacket.UtilMarkJitterMax);
+
+        HS_PsiGetStats(&HS_AppData.HkPacket.PsiAvailableMask, &HS_AppData.HkPacket.PsiActiveMask,
+                       HS_AppData.HkPacket.Psi);
+        HS_MemGetStats(&HS_AppData.HkPacket.Mem);
+
+        HS_AppData.HkPacket.UtilLoadActiveMask = HS_AppData.UtilLoadActiveMask;
+        memcpy(HS_AppData.HkPacket.UtilLoadLevels, HS_AppData.UtilLoadLevels, sizeof(HS_AppData.UtilLoadLevels));
+
+        HS_AppData.HkPacket.LoadShedStep  = HS_AppData.LoadShedStep;
+        HS_AppData.HkPacket.StackMaxUsage = HS_AppData.StackMaxUsage;
+
+        memcpy(HS_AppData.HkPacket.SbWorstPipes, HS_AppData.SbWorstPipes, sizeof(HS_AppData.HkPacket.SbWorstPipes));
+        HS_AppData.HkPacket.SbPipeActiveMask = HS_AppData.SbPipeActiveMask;
+        HS_AppData.HkPacket.SbDropCount      = HS_AppData.SbDropCount;
+        HS_AppData.HkPacket.Wakeup           = HS_AppData.WakeupTlm;
+
+        HS_AppData.HkPacket.RebalanceMoveCount    = HS_AppData.RebalanceMoveCount;
+        HS_AppData.HkPacket.RebalanceLastEntry    = HS_AppData.RebalanceLastEntry;
+        HS_AppData.HkPacket.RebalanceLastFromCore = HS_AppData.RebalanceLastFromCore;
+        HS_AppData.HkPacket.RebalanceLastToCore   = HS_AppData.RebalanceLastToCore;
+
+        HS_AppData.HkPacket.UtilTrendConfig    = HS_AppData.UtilTrendConfig;
+        HS_AppData.HkPacket.UtilTrendSlope     = HS_AppData.UtilTrend.Slope;
+        HS_AppData.HkPacket.UtilTrendTimeToSat = HS_AppData.UtilTrend.TimeToSat;
 
 #if HS_MAX_EXEC_CNT_SLOTS != 0
         /*
@@ -360,6 +465,13 @@ void HS_ResetCounters(void)
     HS_AppData.EventsMonitoredCount = 0;
     HS_AppData.MsgActExec           = 0;
 
+    HS_AppData.ProcEventOverflowCount = 0;
+    HS_AppData.ProcEventCountsUsed    = 0;
+    memset(HS_AppData.ProcEventCounts, 0, sizeof(HS_AppData.ProcEventCounts));
+
+    memset(&HS_AppData.WakeupTlm, 0, sizeof(HS_AppData.WakeupTlm));
+    HS_AppData.WakeupSumUs = 0;
+
     return;
 
 } /* end HS_ResetCounters */
@@ -676,6 +788,374 @@ void HS_SetMaxResetsCmd(const CFE_SB_Buffer_t *BufPtr)
 
 } /* end HS_SetMaxResetsCmd */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Enable a range of Event Monitor entries                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_EnableEventMonEntriesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                   ExpectedLength = sizeof(HS_EventMonEntriesCmd_t);
+    HS_EventMonEntriesCmd_t *CmdPtr         = NULL;
+    uint32                   TableIndex     = 0;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_EventMonEntriesCmd_t *)BufPtr);
+
+        if ((CmdPtr->NumEntries == 0) || (CmdPtr->FirstEntry >= HS_MAX_MONITORED_EVENTS) ||
+            (CmdPtr->NumEntries > (HS_MAX_MONITORED_EVENTS - CmdPtr->FirstEntry)))
+        {
+            CFE_EVS_SendEvent(HS_EVENTMON_ENTRIES_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid EventMon entry range: First = %u, Num = %u, Max = %u",
+                              (unsigned int)CmdPtr->FirstEntry, (unsigned int)CmdPtr->NumEntries,
+                              (unsigned int)HS_MAX_MONITORED_EVENTS);
+            HS_AppData.CmdErrCount++;
+        }
+        else
+        {
+            HS_AppData.CmdCount++;
+
+            for (TableIndex = CmdPtr->FirstEntry; TableIndex < (CmdPtr->FirstEntry + CmdPtr->NumEntries);
+                 TableIndex++)
+            {
+                CFE_SET((HS_AppData.EventMonEnables[TableIndex / HS_BITS_PER_EVENTMON_ENABLE]),
+                        (TableIndex % HS_BITS_PER_EVENTMON_ENABLE));
+            }
+
+            CFE_EVS_SendEvent(HS_ENABLE_EVENTMON_ENTRIES_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "Event Monitor Entries Enabled: First = %u, Num = %u", (unsigned int)CmdPtr->FirstEntry,
+                              (unsigned int)CmdPtr->NumEntries);
+        }
+    }
+
+    return;
+
+} /* end HS_EnableEventMonEntriesCmd */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Disable a range of Event Monitor entries                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_DisableEventMonEntriesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                   ExpectedLength = sizeof(HS_EventMonEntriesCmd_t);
+    HS_EventMonEntriesCmd_t *CmdPtr         = NULL;
+    uint32                   TableIndex     = 0;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_EventMonEntriesCmd_t *)BufPtr);
+
+        if ((CmdPtr->NumEntries == 0) || (CmdPtr->FirstEntry >= HS_MAX_MONITORED_EVENTS) ||
+            (CmdPtr->NumEntries > (HS_MAX_MONITORED_EVENTS - CmdPtr->FirstEntry)))
+        {
+            CFE_EVS_SendEvent(HS_EVENTMON_ENTRIES_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid EventMon entry range: First = %u, Num = %u, Max = %u",
+                              (unsigned int)CmdPtr->FirstEntry, (unsigned int)CmdPtr->NumEntries,
+                              (unsigned int)HS_MAX_MONITORED_EVENTS);
+            HS_AppData.CmdErrCount++;
+        }
+        else
+        {
+            HS_AppData.CmdCount++;
+
+            for (TableIndex = CmdPtr->FirstEntry; TableIndex < (CmdPtr->FirstEntry + CmdPtr->NumEntries);
+                 TableIndex++)
+            {
+                CFE_CLR((HS_AppData.EventMonEnables[TableIndex / HS_BITS_PER_EVENTMON_ENABLE]),
+                        (TableIndex % HS_BITS_PER_EVENTMON_ENABLE));
+            }
+
+            CFE_EVS_SendEvent(HS_DISABLE_EVENTMON_ENTRIES_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "Event Monitor Entries Disabled: First = %u, Num = %u", (unsigned int)CmdPtr->FirstEntry,
+                              (unsigned int)CmdPtr->NumEntries);
+        }
+    }
+
+    return;
+
+} /* end HS_DisableEventMonEntriesCmd */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the utilization percentile histogram                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SendUtilPctlCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                ExpectedLength = sizeof(HS_NoArgsCmd_t);
+    HS_UtilPctlPayload_t *PayloadPtr     = &HS_AppData.UtilPctlPacket.Payload;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        PayloadPtr->NumSamples  = HS_AppData.UtilPctl.NumSamples;
+        PayloadPtr->BucketWidth = HS_UTIL_PER_INTERVAL_TOTAL / HS_UTIL_PCTL_NUM_BUCKETS;
+        PayloadPtr->UtilP50     = HS_UtilPctlValue(50);
+        PayloadPtr->UtilP90     = HS_UtilPctlValue(90);
+        PayloadPtr->UtilP99     = HS_UtilPctlValue(99);
+
+        memcpy(PayloadPtr->Counts, HS_AppData.UtilPctl.Counts, sizeof(PayloadPtr->Counts));
+
+        CFE_SB_TimeStampMsg(&HS_AppData.UtilPctlPacket.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&HS_AppData.UtilPctlPacket.TlmHeader.Msg, true);
+
+        HS_AppData.CmdCount++;
+        CFE_EVS_SendEvent(HS_SEND_UTIL_PCTL_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Utilization percentile histogram sent: %d intervals", (int)PayloadPtr->NumSamples);
+    }
+
+    return;
+
+} /* end HS_SendUtilPctlCmd */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump one level of the utilization history                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_DumpUtilHistCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                ExpectedLength = sizeof(HS_DumpUtilHistCmd_t);
+    HS_DumpUtilHistCmd_t *CmdPtr         = NULL;
+    HS_UtilHistLevel_t *  HistPtr        = NULL;
+    HS_UtilHistPayload_t *PayloadPtr     = &HS_AppData.UtilHistPacket.Payload;
+    uint32                EntryIndex     = 0;
+    uint32                OldestIndex    = 0;
+    uint32                Level          = 0;
+    char                  Filename[OS_MAX_PATH_LEN];
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_DumpUtilHistCmd_t *)BufPtr);
+
+        if ((CmdPtr->Level >= HS_UTIL_HIST_NUM_LEVELS) ||
+            ((CmdPtr->Destination != HS_UTIL_HIST_DEST_TLM) && (CmdPtr->Destination != HS_UTIL_HIST_DEST_FILE)))
+        {
+            CFE_EVS_SendEvent(HS_DUMP_UTIL_HIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid utilization history dump: Level = %d, Destination = %d", CmdPtr->Level,
+                              CmdPtr->Destination);
+            HS_AppData.CmdErrCount++;
+            return;
+        }
+
+        /*
+        ** Unroll the level ring buffer into the payload, oldest entry first
+        */
+        HistPtr = &HS_AppData.UtilHist[CmdPtr->Level];
+
+        PayloadPtr->Level             = CmdPtr->Level;
+        PayloadPtr->IntervalsPerEntry = 1;
+        PayloadPtr->NumEntries        = HistPtr->NumEntries;
+
+        for (Level = 0; Level < CmdPtr->Level; Level++)
+        {
+            PayloadPtr->IntervalsPerEntry *= HS_UTIL_HIST_ROLLUP;
+        }
+
+        OldestIndex = (HistPtr->NextIndex + HS_UTIL_HIST_DEPTH - HistPtr->NumEntries) % HS_UTIL_HIST_DEPTH;
+
+        for (EntryIndex = 0; EntryIndex < HS_UTIL_HIST_DEPTH; EntryIndex++)
+        {
+            if (EntryIndex < HistPtr->NumEntries)
+            {
+                PayloadPtr->Entries[EntryIndex] = HistPtr->Entries[(OldestIndex + EntryIndex) % HS_UTIL_HIST_DEPTH];
+            }
+            else
+            {
+                memset(&PayloadPtr->Entries[EntryIndex], 0, sizeof(PayloadPtr->Entries[EntryIndex]));
+            }
+        }
+
+        if (CmdPtr->Destination == HS_UTIL_HIST_DEST_TLM)
+        {
+            CFE_SB_TimeStampMsg(&HS_AppData.UtilHistPacket.TlmHeader.Msg);
+            CFE_SB_TransmitMsg(&HS_AppData.UtilHistPacket.TlmHeader.Msg, true);
+
+            HS_AppData.CmdCount++;
+            CFE_EVS_SendEvent(HS_DUMP_UTIL_HIST_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "Utilization history level %d sent: %d entries", CmdPtr->Level,
+                              (int)PayloadPtr->NumEntries);
+        }
+        else
+        {
+            if (CmdPtr->Filename[0] == '\0')
+            {
+                strncpy(Filename, HS_UTIL_HIST_FILENAME, sizeof(Filename) - 1);
+            }
+            else
+            {
+                strncpy(Filename, CmdPtr->Filename, sizeof(Filename) - 1);
+            }
+            Filename[sizeof(Filename) - 1] = '\0';
+
+            if (HS_UtilHistWriteFile(Filename, PayloadPtr) == CFE_SUCCESS)
+            {
+                HS_AppData.CmdCount++;
+                CFE_EVS_SendEvent(HS_DUMP_UTIL_HIST_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                  "Utilization history level %d written to %s: %d entries", CmdPtr->Level, Filename,
+                                  (int)PayloadPtr->NumEntries);
+            }
+            else
+            {
+                HS_AppData.CmdErrCount++;
+            }
+        }
+    }
+
+    return;
+
+} /* end HS_DumpUtilHistCmd */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set one CPU load level                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SetUtilLoadLevelCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                    ExpectedLength = sizeof(HS_SetUtilLoadLevelCmd_t);
+    HS_SetUtilLoadLevelCmd_t *CmdPtr         = NULL;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_SetUtilLoadLevelCmd_t *)BufPtr);
+
+        if ((CmdPtr->Level >= HS_UTIL_LOAD_NUM_LEVELS) || (CmdPtr->LoadLevel.ExitUtil > CmdPtr->LoadLevel.EnterUtil) ||
+            (CmdPtr->LoadLevel.ActionType > (HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES)))
+        {
+            CFE_EVS_SendEvent(HS_SET_UTIL_LOAD_LEVEL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid CPU load level: Level = %u, Enter = %u, Exit = %u, Action = %u",
+                              (unsigned int)CmdPtr->Level, (unsigned int)CmdPtr->LoadLevel.EnterUtil,
+                              (unsigned int)CmdPtr->LoadLevel.ExitUtil, (unsigned int)CmdPtr->LoadLevel.ActionType);
+            HS_AppData.CmdErrCount++;
+            return;
+        }
+
+        HS_AppData.UtilLoadLevels[CmdPtr->Level] = CmdPtr->LoadLevel;
+        HS_AppData.UtilLoadDwell[CmdPtr->Level]  = 0;
+
+        HS_AppData.CmdCount++;
+        CFE_EVS_SendEvent(HS_SET_UTIL_LOAD_LEVEL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "CPU load level %u set: Enter = %u, Exit = %u, Dwell = %u, Action = %u",
+                          (unsigned int)CmdPtr->Level, (unsigned int)CmdPtr->LoadLevel.EnterUtil,
+                          (unsigned int)CmdPtr->LoadLevel.ExitUtil, (unsigned int)CmdPtr->LoadLevel.DwellIntervals,
+                          (unsigned int)CmdPtr->LoadLevel.ActionType);
+    }
+
+    return;
+
+} /* end HS_SetUtilLoadLevelCmd */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set the CPU saturation warning                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SetUtilTrendCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                ExpectedLength = sizeof(HS_SetUtilTrendCmd_t);
+    HS_SetUtilTrendCmd_t *CmdPtr         = NULL;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_SetUtilTrendCmd_t *)BufPtr);
+
+        if (CmdPtr->Config.ActionType > (HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES))
+        {
+            CFE_EVS_SendEvent(HS_SET_UTIL_TREND_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid CPU saturation warning: Horizon = %u, Action = %u",
+                              (unsigned int)CmdPtr->Config.HorizonIntervals, (unsigned int)CmdPtr->Config.ActionType);
+            HS_AppData.CmdErrCount++;
+            return;
+        }
+
+        HS_AppData.UtilTrendConfig  = CmdPtr->Config;
+        HS_AppData.UtilTrend.Warned = false;
+
+        HS_AppData.CmdCount++;
+        CFE_EVS_SendEvent(HS_SET_UTIL_TREND_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "CPU saturation warning set: Horizon = %u, Action = %u",
+                          (unsigned int)CmdPtr->Config.HorizonIntervals, (unsigned int)CmdPtr->Config.ActionType);
+    }
+
+    return;
+
+} /* end HS_SetUtilTrendCmd */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a utilization history payload to a file                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_UtilHistWriteFile(const char *Filename, const HS_UtilHistPayload_t *PayloadPtr)
+{
+    osal_id_t       FileHandle = OS_OBJECT_ID_UNDEFINED;
+    CFE_FS_Header_t FileHeader;
+    int32           Status     = CFE_SUCCESS;
+    size_t          WriteSize  = 0;
+
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (Status != OS_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_UTIL_HIST_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error creating utilization history file %s, RC=0x%08X", Filename, (unsigned int)Status);
+        return (Status);
+    }
+
+    CFE_FS_InitHeader(&FileHeader, "HS Utilization History", HS_UTIL_HIST_FILE_SUBTYPE);
+
+    Status = CFE_FS_WriteHeader(FileHandle, &FileHeader);
+    if (Status != sizeof(CFE_FS_Header_t))
+    {
+        CFE_EVS_SendEvent(HS_UTIL_HIST_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error writing utilization history file header %s, RC=0x%08X", Filename,
+                          (unsigned int)Status);
+        OS_close(FileHandle);
+        return (CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    }
+
+    /*
+    ** Only the valid entries of the payload are written
+    */
+    WriteSize = sizeof(HS_UtilHistPayload_t) - sizeof(PayloadPtr->Entries) +
+                (PayloadPtr->NumEntries * sizeof(HS_UtilHistEntry_t));
+
+    Status = OS_write(FileHandle, PayloadPtr, WriteSize);
+    if (Status != (int32)WriteSize)
+    {
+        CFE_EVS_SendEvent(HS_UTIL_HIST_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error writing utilization history file data %s, RC=0x%08X", Filename,
+                          (unsigned int)Status);
+        OS_close(FileHandle);
+        return (CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    }
+
+    OS_close(FileHandle);
+
+    return (CFE_SUCCESS);
+
+} /* end HS_UtilHistWriteFile */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Acquire table pointers                                          */
@@ -748,6 +1228,14 @@ void HS_AcquirePointers(void)
     */
     Status = CFE_TBL_GetAddress((void *)&HS_AppData.EMTablePtr, HS_AppData.EMTableHandle);
 
+    /*
+    ** If there is a new table, refresh status (EventMon)
+    */
+    if (Status == CFE_TBL_INFO_UPDATED)
+    {
+        HS_EventMonStatusRefresh();
+    }
+
     /*
     ** If Address acquisition fails and currently enabled, report and disable (EventMon)
     */
@@ -880,6 +1368,144 @@ void HS_AcquirePointers(void)
 
 #endif
 
+    /*
+    ** Release the table (LoadShed)
+    */
+    CFE_TBL_ReleaseAddress(HS_AppData.LSTableHandle);
+
+    /*
+    ** Manage the table (LoadShed)
+    */
+    CFE_TBL_Manage(HS_AppData.LSTableHandle);
+
+    /*
+    ** Get a pointer to the table (LoadShed)
+    */
+    Status = CFE_TBL_GetAddress((void *)&HS_AppData.LSTablePtr, HS_AppData.LSTableHandle);
+
+    /*
+    ** If there is a new table, refresh status (LoadShed)
+    */
+    if (Status == CFE_TBL_INFO_UPDATED)
+    {
+        HS_LoadShedStatusRefresh();
+    }
+
+    /*
+    ** If Address acquisition fails report and disable (LoadShed)
+    */
+    if (Status < CFE_SUCCESS)
+    {
+        /*
+        ** To prevent redundant reporting, only report if enabled (LoadShed)
+        */
+        if (HS_AppData.LoadShedState == HS_STATE_ENABLED)
+        {
+            CFE_EVS_SendEvent(HS_LOADSHED_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error getting LoadShed Table address, RC=0x%08X", (unsigned int)Status);
+            HS_AppData.LoadShedState = HS_STATE_DISABLED;
+        }
+    }
+    /*
+    ** Otherwise, make sure it is enabled (LoadShed)
+    */
+    else
+    {
+        HS_AppData.LoadShedState = HS_STATE_ENABLED;
+    }
+
+    /*
+    ** Release the table (CpuBudget)
+    */
+    CFE_TBL_ReleaseAddress(HS_AppData.CBTableHandle);
+
+    /*
+    ** Manage the table (CpuBudget)
+    */
+    CFE_TBL_Manage(HS_AppData.CBTableHandle);
+
+    /*
+    ** Get a pointer to the table (CpuBudget)
+    */
+    Status = CFE_TBL_GetAddress((void *)&HS_AppData.CBTablePtr, HS_AppData.CBTableHandle);
+
+    /*
+    ** If there is a new table, refresh status (CpuBudget)
+    */
+    if (Status == CFE_TBL_INFO_UPDATED)
+    {
+        HS_CpuBudgetStatusRefresh();
+    }
+
+    /*
+    ** If Address acquisition fails report and disable (CpuBudget)
+    */
+    if (Status < CFE_SUCCESS)
+    {
+        /*
+        ** To prevent redundant reporting, only report if enabled (CpuBudget)
+        */
+        if (HS_AppData.CpuBudgetState == HS_STATE_ENABLED)
+        {
+            CFE_EVS_SendEvent(HS_CPUBUDGET_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error getting CpuBudget Table address, RC=0x%08X", (unsigned int)Status);
+            HS_AppData.CpuBudgetState = HS_STATE_DISABLED;
+        }
+    }
+    /*
+    ** Otherwise, make sure it is enabled (CpuBudget)
+    */
+    else
+    {
+        HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+    }
+
+    /*
+    ** Release the table (Rebalance)
+    */
+    CFE_TBL_ReleaseAddress(HS_AppData.RBTableHandle);
+
+    /*
+    ** Manage the table (Rebalance)
+    */
+    CFE_TBL_Manage(HS_AppData.RBTableHandle);
+
+    /*
+    ** Get a pointer to the table (Rebalance)
+    */
+    Status = CFE_TBL_GetAddress((void *)&HS_AppData.RBTablePtr, HS_AppData.RBTableHandle);
+
+    /*
+    ** If there is a new table, refresh status (Rebalance)
+    */
+    if (Status == CFE_TBL_INFO_UPDATED)
+    {
+        HS_RebalanceStatusRefresh();
+    }
+
+    /*
+    ** If Address acquisition fails report and disable (Rebalance)
+    */
+    if (Status < CFE_SUCCESS)
+    {
+        /*
+        ** To prevent redundant reporting, only report if enabled (Rebalance)
+        */
+        if (HS_AppData.RebalanceState == HS_STATE_ENABLED)
+        {
+            CFE_EVS_SendEvent(HS_REBALANCE_GETADDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error getting Rebalance Table address, RC=0x%08X", (unsigned int)Status);
+            HS_AppData.RebalanceState = HS_STATE_DISABLED;
+        }
+    }
+    /*
+    ** Otherwise, make sure it is enabled (Rebalance)
+    */
+    else
+    {
+        HS_AppData.RebalanceState = HS_STATE_ENABLED;
+    }
+
     return;
 
 } /* End of HS_AcquirePointers */
@@ -926,6 +1552,40 @@ void HS_AppMonStatusRefresh(void)
 
 } /* end HS_AppMonStatusRefresh */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh EventMon Status (on Table Update)                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_EventMonStatusRefresh(void)
+{
+    uint32 TableIndex  = 0;
+    uint32 EnableIndex = 0;
+
+    /*
+    ** Clear all EventMon Enable bits
+    */
+    for (EnableIndex = 0; EnableIndex <= ((HS_MAX_MONITORED_EVENTS - 1) / HS_BITS_PER_EVENTMON_ENABLE); EnableIndex++)
+    {
+        HS_AppData.EventMonEnables[EnableIndex] = 0;
+    }
+
+    /*
+    ** Set EventMon enable bits for entries with an action
+    */
+    for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_EVENTS; TableIndex++)
+    {
+        if (HS_AppData.EMTablePtr[TableIndex].ActionType != HS_EMT_ACT_NOACT)
+        {
+            CFE_SET((HS_AppData.EventMonEnables[TableIndex / HS_BITS_PER_EVENTMON_ENABLE]),
+                    (TableIndex % HS_BITS_PER_EVENTMON_ENABLE));
+        }
+    }
+
+    return;
+
+} /* end HS_EventMonStatusRefresh */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Refresh MsgActs Status (on Table Update or Enable)              */
@@ -947,6 +1607,62 @@ void HS_MsgActsStatusRefresh(void)
 
 } /* end HS_MsgActsStatusRefresh */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh LoadShed Status (on Table Update)                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_LoadShedStatusRefresh(void)
+{
+    /*
+    ** Restart the dwell counts, steps already shed are restored
+    ** using the restore messages of the new table
+    */
+    HS_AppData.LoadShedHighCount = 0;
+    HS_AppData.LoadShedLowCount  = 0;
+
+    return;
+
+} /* end HS_LoadShedStatusRefresh */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh CpuBudget Status (on Table Update)                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_CpuBudgetStatusRefresh(void)
+{
+    uint32 TableIndex = 0;
+
+    /*
+    ** Entries may now belong to other tasks, so start counting again
+    */
+    for (TableIndex = 0; TableIndex < HS_MAX_CPU_BUDGETS; TableIndex++)
+    {
+        HS_AppData.CpuBudgetCount[TableIndex] = 0;
+    }
+
+    return;
+
+} /* end HS_CpuBudgetStatusRefresh */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh Rebalance Status (on Table Update)                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_RebalanceStatusRefresh(void)
+{
+    /*
+    ** The new table may allow other moves, so look at the cores afresh
+    */
+    HS_AppData.RebalanceDwell    = 0;
+    HS_AppData.RebalanceCooldown = 0;
+
+    return;
+
+} /* end HS_RebalanceStatusRefresh */
+
 /************************/
 /*  End of File Comment */
 /************************/
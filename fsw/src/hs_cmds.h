@@ -29,6 +29,7 @@
  * Includes
  ************************************************************************/
 #include "cfe.h"
+#include "hs_msg.h"
 
 /*************************************************************************
  * Exported Functions
@@ -274,6 +275,122 @@ void HS_ResetResetsPerformedCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 void HS_SetMaxResetsCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Process an enable event monitor entries command
+ *
+ *  \par Description
+ *       Sets the enable bits of a range of Event Monitor Table entries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_ENABLE_EVENTMON_ENTRIES_CC
+ */
+void HS_EnableEventMonEntriesCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process a disable event monitor entries command
+ *
+ *  \par Description
+ *       Clears the enable bits of a range of Event Monitor Table entries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_DISABLE_EVENTMON_ENTRIES_CC
+ */
+void HS_DisableEventMonEntriesCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process a send utilization percentile histogram command
+ *
+ *  \par Description
+ *       Copies the utilization percentile histogram and its 50th, 90th
+ *       and 99th percentiles into the utilization percentile packet and
+ *       sends it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_SEND_UTIL_PCTL_CC
+ */
+void HS_SendUtilPctlCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process a dump utilization history command
+ *
+ *  \par Description
+ *       Copies one level of the utilization history, oldest entry
+ *       first, into the utilization history packet and either sends
+ *       the packet or writes it to a file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_DUMP_UTIL_HIST_CC
+ */
+void HS_DumpUtilHistCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process a set CPU load level command
+ *
+ *  \par Description
+ *       Validates and replaces the settings of one CPU load level and
+ *       restarts its dwell count.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_SET_UTIL_LOAD_LEVEL_CC
+ */
+void HS_SetUtilLoadLevelCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process a set CPU saturation warning command
+ *
+ *  \par Description
+ *       Validates and replaces the horizon and action of the CPU
+ *       saturation warning, and clears a warning already given.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #HS_SET_UTIL_TREND_CC
+ */
+void HS_SetUtilTrendCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Write utilization history to a file
+ *
+ *  \par Description
+ *       Creates the named file and writes a cFE file header followed by
+ *       the utilization history payload, truncated to its valid entries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Filename   Name of the file to create
+ *  \param[in] PayloadPtr Pointer to the utilization history payload
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *
+ *  \sa #HS_UTIL_HIST_FILE_ERR_EID
+ */
+int32 HS_UtilHistWriteFile(const char *Filename, const HS_UtilHistPayload_t *PayloadPtr);
+
 /**
  * \brief Refresh Critical Applications Monitor Status
  *
@@ -288,6 +405,19 @@ void HS_SetMaxResetsCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 void HS_AppMonStatusRefresh(void);
 
+/**
+ * \brief Refresh Event Monitor Status
+ *
+ *  \par Description
+ *       This function gets called when HS detects that a new event
+ *       monitor table has been loaded: it then enables every entry
+ *       that has an action and disables all others
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_EventMonStatusRefresh(void);
+
 /**
  * \brief Refresh Message Actions Status
  *
@@ -301,4 +431,44 @@ void HS_AppMonStatusRefresh(void);
  */
 void HS_MsgActsStatusRefresh(void);
 
+/**
+ * \brief Refresh Load Shedding Status
+ *
+ *  \par Description
+ *       This function gets called when HS detects that a new
+ *       load shedding table has been loaded: it then restarts
+ *       the shed and restore dwell counts.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Steps already shed stay shed and are restored using
+ *       the restore messages of the new table.
+ */
+void HS_LoadShedStatusRefresh(void);
+
+/**
+ * \brief Refresh CPU Budget Status
+ *
+ *  \par Description
+ *       This function gets called when HS detects that a new
+ *       CPU budget table has been loaded: it then resets the
+ *       over budget counts of all entries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_CpuBudgetStatusRefresh(void);
+
+/**
+ * \brief Refresh Rebalance Status
+ *
+ *  \par Description
+ *       This function gets called when HS detects that a new
+ *       rebalance table has been loaded: it then restarts the
+ *       imbalance dwell count and ends any move cooldown.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Tasks already moved keep their core affinity.
+ */
+void HS_RebalanceStatusRefresh(void);
+
 #endif
@@ -34,6 +34,7 @@
 #include "hs_app.h"
 #include "hs_cmds.h"
 #include "hs_msg.h"
+#include "hs_msgids.h"
 #include "hs_utils.h"
 #include "hs_custom.h"
 #include "hs_events.h"
@@ -42,6 +43,8 @@
 
 HS_CustomData_t HS_CustomData;
 
+const char *const HS_PsiPaths[HS_PSI_NUM_RESOURCES] = {HS_PSI_PATH_CPU, HS_PSI_PATH_MEMORY, HS_PSI_PATH_IO};
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Idle Task Main Process Loop                                     */
@@ -50,14 +53,49 @@ HS_CustomData_t HS_CustomData;
 
 void HS_IdleTask(void)
 {
-    OS_time_t PSPTime = {0};
+    HS_CustomCoreData_t *CorePtr   = NULL;
+    uint32               CoreIndex = 0;
+    int32                Status    = CFE_SUCCESS;
+
+    CoreIndex = HS_IdleTaskCoreIndex();
+
+    if (CoreIndex >= HS_UTIL_NUM_CORES)
+    {
+        return;
+    }
+
+    CorePtr = &HS_CustomData.Core[CoreIndex];
+
+    /* Lets the stack monitor measure this task to the word */
+    HS_PaintStack();
+
+    /*
+    ** With more than one core, each Idle Task only counts the idle time of its own core
+    */
+    if (HS_UTIL_NUM_CORES > 1)
+    {
+        Status = HS_SetCpuAffinity(CoreIndex);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HS_IDLE_AFFINITY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error Setting Idle Task Affinity to core %d,RC=0x%08X", (int)CoreIndex,
+                              (unsigned int)Status);
+        }
+    }
+
+    /* Lets the thread time backend read the CPU time of this task, publishing the clock before the flag */
+    if (HS_GetThreadCpuClock(&CorePtr->IdleClockId) == CFE_SUCCESS)
+    {
+        HS_ATOMIC_STORE(&CorePtr->IdleClockValid, true);
+    }
 
-    while (HS_CustomData.IdleTaskRunStatus == CFE_SUCCESS)
+    while (HS_ATOMIC_LOAD(&HS_CustomData.IdleTaskRunStatus) == CFE_SUCCESS)
     {
 
-        /* Check to see if we are to mark the time. */
-        if (((HS_CustomData.ThisIdleTaskExec & HS_CustomData.UtilMask) == HS_CustomData.UtilMask) &&
-            (HS_CustomData.ThisIdleTaskExec > HS_CustomData.UtilMask))
+        /* Check to see if we are to mark the time (the diagnostics only follow the first core) */
+        if ((CoreIndex == 0) && ((CorePtr->ThisIdleTaskExec & HS_CustomData.UtilMask) == HS_CustomData.UtilMask) &&
+            (CorePtr->ThisIdleTaskExec > HS_CustomData.UtilMask))
         {
             /* Entry and Exit markers are for easy time marking only; not performance */
             CFE_ES_PerfLogEntry(HS_IDLETASK_PERF_ID);
@@ -65,16 +103,17 @@ void HS_IdleTask(void)
             /* Increment the child task Execution Counter */
             CFE_ES_IncrementTaskCounter();
 
-            /* update stamp and array */
-            CFE_PSP_GetTime(&PSPTime);
-            HS_CustomData.UtilArray[HS_CustomData.UtilArrayIndex & HS_CustomData.UtilArrayMask] = (uint32)PSPTime.ticks;
-            HS_CustomData.UtilArrayIndex++;
+            /* update stamp and array, publishing the stamp before the index (a plain 64-bit
+            ** store, as 64-bit atomics are not lock free on every 32-bit target) */
+            HS_CustomData.UtilArray[HS_CustomData.UtilArrayIndex & HS_CustomData.UtilArrayMask] =
+                HS_GetMonotonicTimeNs();
+            HS_ATOMIC_STORE(&HS_CustomData.UtilArrayIndex, HS_CustomData.UtilArrayIndex + 1);
 
             CFE_ES_PerfLogExit(HS_IDLETASK_PERF_ID);
         }
 
         /* Call the Utilization Tracking function */
-        HS_UtilizationIncrement();
+        HS_UtilizationIncrement(CoreIndex);
 
         /* Thread cancellation point/give up CPU */
         OS_TaskDelay(0);
@@ -84,6 +123,36 @@ void HS_IdleTask(void)
 
 } /* End of HS_IdleTask() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the core of the calling Idle Task                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_IdleTaskCoreIndex(void)
+{
+    CFE_ES_TaskId_t TaskId    = CFE_ES_TASKID_UNDEFINED;
+    uint32          CoreIndex = 0;
+
+    while (HS_ATOMIC_LOAD(&HS_CustomData.IdleTaskRunStatus) == CFE_SUCCESS)
+    {
+        CFE_ES_GetTaskID(&TaskId);
+
+        for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(TaskId, HS_CustomData.Core[CoreIndex].IdleTaskID))
+            {
+                return CoreIndex;
+            }
+        }
+
+        /* The creating task has not recorded this task ID yet */
+        OS_TaskDelay(1);
+    }
+
+    return HS_UTIL_NUM_CORES;
+
+} /* end HS_IdleTaskCoreIndex */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Initialize The Idle Task                                        */
@@ -92,30 +161,52 @@ void HS_IdleTask(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 HS_CustomInit(void)
 {
-    int32 Status;
+    int32  Status;
+    uint32 CoreIndex = 0;
 
     memset(&HS_CustomData, 0, sizeof(HS_CustomData));
 
+    /* Initialize utilization diagnostics packet */
+    CFE_MSG_Init(&HS_CustomData.UtilDiagPacket.TlmHeader.Msg, CFE_SB_ValueToMsgId(HS_UTIL_DIAG_TLM_MID),
+                 sizeof(HS_UtilDiagPkt_t));
+
     /*
-    ** Spawn the Idle Task
+    ** Start the configured utilization backend, falling back to the Idle Task count
     */
-    HS_CustomData.IdleTaskRunStatus = CFE_SUCCESS;
+    HS_CustomData.UtilBackend = HS_UTIL_DEFAULT_BACKEND;
 
-    Status = CFE_ES_CreateChildTask(&HS_CustomData.IdleTaskID, HS_IDLE_TASK_NAME, HS_IdleTask, HS_IDLE_TASK_STACK_PTR,
-                                    HS_IDLE_TASK_STACK_SIZE, HS_IDLE_TASK_PRIORITY, HS_IDLE_TASK_FLAGS);
+    Status = HS_UtilBackendStart();
+
+    if ((Status != CFE_SUCCESS) && (HS_CustomData.UtilBackend != HS_UTIL_BACKEND_IDLE_COUNT))
+    {
+        HS_CustomData.UtilBackend = HS_UTIL_BACKEND_IDLE_COUNT;
+
+        Status = HS_UtilBackendStart();
+    }
 
     if (Status != CFE_SUCCESS)
     {
-        HS_CustomData.IdleTaskRunStatus = !CFE_SUCCESS;
-        CFE_EVS_SendEvent(HS_CR_CHILD_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Error Creating Child Task for CPU Utilization Monitoring,RC=0x%08X", (unsigned int)Status);
         return (Status);
     }
 
     /*
-    ** Connect to CFE TIME's time reference marker (typically 1 Hz) for Idle Task Marking
+    ** Start the configured mark source, falling back to CFE TIME's time reference marker (typically 1 Hz)
     */
-    Status = CFE_TIME_RegisterSynchCallback((CFE_TIME_SynchCallbackPtr_t)&HS_MarkIdleCallback);
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE;
+
+    Status = HS_UtilMarkStart();
+
+    if ((Status != CFE_SUCCESS) && (HS_CustomData.MarkSource != HS_UTIL_MARK_SOURCE_TIME_SYNC))
+    {
+        CFE_EVS_SendEvent(HS_UTIL_MARK_SOURCE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error starting utilization mark source %d, using time sync,RC=0x%08X",
+                          (int)HS_CustomData.MarkSource, (unsigned int)Status);
+
+        HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_TIME_SYNC;
+
+        Status = HS_UtilMarkStart();
+    }
+
     if (Status != CFE_SUCCESS)
     {
         CFE_EVS_SendEvent(HS_CR_SYNC_CALLBACK_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -124,340 +215,1811 @@ int32 HS_CustomInit(void)
     }
 
     /* Non-zero initialization */
-    HS_CustomData.UtilMult1        = HS_UTIL_CONV_MULT1;
-    HS_CustomData.UtilMult2        = HS_UTIL_CONV_MULT2;
-    HS_CustomData.UtilDiv          = HS_UTIL_CONV_DIV;
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+    {
+        HS_CustomData.Core[CoreIndex].UtilMult1 = HS_UTIL_CONV_MULT1;
+        HS_CustomData.Core[CoreIndex].UtilMult2 = HS_UTIL_CONV_MULT2;
+        HS_CustomData.Core[CoreIndex].UtilDiv   = HS_UTIL_CONV_DIV;
+    }
+
     HS_CustomData.UtilMask         = HS_UTIL_DIAG_MASK;
     HS_CustomData.UtilArrayMask    = HS_UTIL_TIME_DIAG_ARRAY_MASK;
     HS_CustomData.UtilCallsPerMark = HS_UTIL_CALLS_PER_MARK;
 
+    /*
+    ** Restore a saved utilization calibration, or calibrate now if configured to
+    */
+    if (!HS_UtilCalRestore() && (HS_UTIL_CAL_STARTUP_INTERVALS > 0) &&
+        (HS_CustomData.UtilBackend == HS_UTIL_BACKEND_IDLE_COUNT))
+    {
+        HS_UtilCalStart(HS_UTIL_CAL_STARTUP_INTERVALS, true, HS_UTIL_CAL_TRACK_PEAK);
+    }
+
+    HS_PsiStart();
+    HS_MemStart();
+
     return (Status);
 
 } /* end HS_CustomInit */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Terminate The Idle Task                                         */
+/* Start the Idle Tasks                                            */
 /*                                                                 */
 /* NOTE: For complete prolog information, see 'hs_custom.h'        */
-/*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_CustomCleanup(void)
+int32 HS_CustomStartIdleTasks(void)
 {
-    /*
-    ** Unregister the Sync Callback for CPU Monitoring
-    */
-    CFE_TIME_UnregisterSynchCallback((CFE_TIME_SynchCallbackPtr_t)&HS_MarkIdleCallback);
+    int32  Status    = CFE_SUCCESS;
+    uint32 CoreIndex = 0;
+    char   TaskName[OS_MAX_API_NAME];
 
     /*
-    ** Force the Idle Task to stop running
+    ** Spawn the Idle Task(s)
     */
-    HS_CustomData.IdleTaskRunStatus = !CFE_SUCCESS;
+    HS_ATOMIC_STORE(&HS_CustomData.IdleTaskRunStatus, CFE_SUCCESS);
 
-    /*
-    ** Delete the Idle Task
-    */
-    CFE_ES_DeleteChildTask(HS_CustomData.IdleTaskID);
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+    {
+        if (HS_UTIL_NUM_CORES > 1)
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s%u", HS_IDLE_TASK_NAME, (unsigned int)CoreIndex);
+        }
+        else
+        {
+            snprintf(TaskName, sizeof(TaskName), "%s", HS_IDLE_TASK_NAME);
+        }
 
-} /* end HS_CustomCleanup */
+        Status = CFE_ES_CreateChildTask(&HS_CustomData.Core[CoreIndex].IdleTaskID, TaskName, HS_IdleTask,
+                                        HS_IDLE_TASK_STACK_PTR, HS_IDLE_TASK_STACK_SIZE, HS_IDLE_TASK_PRIORITY,
+                                        HS_IDLE_TASK_FLAGS);
 
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-/*                                                                 */
-/* Increment the Utilization Counter                               */
-/*                                                                 */
-/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_UtilizationIncrement(void)
-{
-    HS_CustomData.ThisIdleTaskExec++;
+        if (Status != CFE_SUCCESS)
+        {
+            HS_ATOMIC_STORE(&HS_CustomData.IdleTaskRunStatus, !CFE_SUCCESS);
+            CFE_EVS_SendEvent(HS_CR_CHILD_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error Creating Child Task for CPU Utilization Monitoring,RC=0x%08X",
+                              (unsigned int)Status);
+            break;
+        }
+    }
 
-    return;
+    return (Status);
 
-} /* end HS_UtilizationIncrement */
+} /* end HS_CustomStartIdleTasks */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Mark the Utilization Counter                                    */
+/* Stop the Idle Tasks                                             */
 /*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_UtilizationMark(void)
+void HS_CustomStopIdleTasks(void)
 {
-    static uint32 CycleCount = 0;
+    uint32 CoreIndex = 0;
 
-    CycleCount++;
+    /*
+    ** Force the Idle Task(s) to stop running
+    */
+    HS_ATOMIC_STORE(&HS_CustomData.IdleTaskRunStatus, !CFE_SUCCESS);
 
-    if (CycleCount >= HS_CustomData.UtilCallsPerMark)
+    /*
+    ** Delete the Idle Task(s)
+    */
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
     {
-        HS_CustomData.LastIdleTaskInterval = HS_CustomData.ThisIdleTaskExec - HS_CustomData.LastIdleTaskExec;
-        HS_CustomData.LastIdleTaskExec     = HS_CustomData.ThisIdleTaskExec;
-        CycleCount                         = 0;
-    }
+        CFE_ES_DeleteChildTask(HS_CustomData.Core[CoreIndex].IdleTaskID);
 
-    return;
+        HS_CustomData.Core[CoreIndex].IdleTaskID = CFE_ES_TASKID_UNDEFINED;
+        HS_ATOMIC_STORE(&HS_CustomData.Core[CoreIndex].IdleClockValid, false);
+    }
 
-} /* end HS_UtilizationMark */
+} /* end HS_CustomStopIdleTasks */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Callback function that marks the Idle time                      */
+/* Start the active utilization backend                            */
 /*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_MarkIdleCallback(void)
+int32 HS_UtilBackendStart(void)
 {
+    HS_CpuTimes_t        Times[HS_UTIL_NUM_CORES];
+    HS_CustomCoreData_t *CorePtr   = NULL;
+    uint32               CoreIndex = 0;
+    int32                ClockId   = 0;
+    int32                Status    = CFE_SUCCESS;
+
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+    {
+        CorePtr                  = &HS_CustomData.Core[CoreIndex];
+        CorePtr->SampledUtil     = 0;
+        CorePtr->LastBusyTime    = 0;
+        CorePtr->LastTotalTime   = 0;
+        CorePtr->LastIdleCpuTime = 0;
+    }
+
+    HS_CustomData.LastSampleTime        = 0;
+    HS_CustomData.UtilSampleErrReported = false;
+
     /*
-    ** Capture the CPU Utilization (at a consistant time)
+    ** Make sure the data source of the backend exists on this platform
     */
-    HS_UtilizationMark();
+    switch (HS_CustomData.UtilBackend)
+    {
+        case HS_UTIL_BACKEND_PROC_STAT:
+            Status = HS_ReadProcStat(Times, HS_UTIL_NUM_CORES);
+            break;
 
-    return;
+        case HS_UTIL_BACKEND_THREAD_TIME:
+            Status = HS_GetThreadCpuClock(&ClockId);
+            break;
 
-} /* End of HS_MarkIdleCallback() */
+        default:
+            break;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(HS_UTIL_BACKEND_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Utilization backend %d not available,RC=0x%08X", (int)HS_CustomData.UtilBackend,
+                          (unsigned int)Status);
+    }
+    else if (HS_UtilBackendUsesIdleTask(HS_CustomData.UtilBackend))
+    {
+        Status = HS_CustomStartIdleTasks();
+    }
+
+    return (Status);
+
+} /* end HS_UtilBackendStart */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Performs Utilization Monitoring and reporting                   */
-/*                                                                 */
-/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* Check if a utilization backend uses the Idle Tasks              */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_CustomMonitorUtilization(void)
+bool HS_UtilBackendUsesIdleTask(uint32 Backend)
 {
-    HS_CustomData.UtilCycleCounter++;
-    if (HS_CustomData.UtilCycleCounter >= HS_UTIL_CYCLES_PER_INTERVAL)
-    {
-        HS_MonitorUtilization();
-        HS_CustomData.UtilCycleCounter = 0;
-    }
+    /*
+    ** The thread time backend needs the spinning Idle Tasks too, the CPU
+    ** time they get at the lowest priority is the idle time it measures
+    */
+    return (Backend != HS_UTIL_BACKEND_PROC_STAT);
 
-} /* End of HS_CustomMonitorUtilization() */
+} /* end HS_UtilBackendUsesIdleTask */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Processes any additional commands                               */
+/* Sample the CPU times of the active utilization backend          */
 /*                                                                 */
 /* NOTE: For complete prolog information, see 'hs_custom.h'        */
-/*                                                                 */
-/* This function MUST return CFE_SUCCESS if any command is found   */
-/* and must NOT return CFE_SUCCESS if no command was found         */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 HS_CustomCommands(const CFE_SB_Buffer_t *BufPtr)
+void HS_UtilBackendSample(void)
 {
     int32 Status = CFE_SUCCESS;
 
-    CFE_MSG_FcnCode_t CommandCode = 0;
-
-    CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
-
-    switch (CommandCode)
+    switch (HS_CustomData.UtilBackend)
     {
-        case HS_REPORT_DIAG_CC:
-            HS_UtilDiagReport();
-            break;
-
-        case HS_SET_UTIL_PARAMS_CC:
-            HS_SetUtilParamsCmd(BufPtr);
+        case HS_UTIL_BACKEND_PROC_STAT:
+            Status = HS_UtilSampleProcStat();
             break;
 
-        case HS_SET_UTIL_DIAG_CC:
-            HS_SetUtilDiagCmd(BufPtr);
+        case HS_UTIL_BACKEND_THREAD_TIME:
+            Status = HS_UtilSampleThreadTime();
             break;
 
         default:
-            Status = !CFE_SUCCESS;
+            /* The Idle Task count is marked by HS_UtilizationMark */
             break;
+    }
 
-    } /* end CommandCode switch */
+    if (Status != CFE_SUCCESS)
+    {
+        HS_CustomData.UtilSampleErrCount++;
 
-    return Status;
+        if (!HS_CustomData.UtilSampleErrReported)
+        {
+            CFE_EVS_SendEvent(HS_UTIL_SAMPLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error sampling CPU utilization with backend %d,RC=0x%08X",
+                              (int)HS_CustomData.UtilBackend, (unsigned int)Status);
+            HS_CustomData.UtilSampleErrReported = true;
+        }
+    }
+    else
+    {
+        HS_CustomData.UtilSampleErrReported = false;
+    }
 
-} /* End of HS_CustomCommands() */
+} /* end HS_UtilBackendSample */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Report Utilization Diagnostics Information                      */
+/* Sample the per core utilization from /proc/stat                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void HS_UtilDiagReport(void)
+int32 HS_UtilSampleProcStat(void)
 {
-    uint32 DiagValue[HS_UTIL_TIME_DIAG_ARRAY_LENGTH];
-    uint32 DiagCount[HS_UTIL_TIME_DIAG_ARRAY_LENGTH];
-    uint32 i         = 0;
-    uint32 j         = 0;
-    uint32 ThisValue = 0;
-
-    uint32 Ordinal         = 0;
-    uint32 NewOrdinalIndex = 0;
-    uint32 OutputValue[HS_UTIL_DIAG_REPORTS];
-    uint32 OutputCount[HS_UTIL_DIAG_REPORTS];
-    uint32 OutputOrdinal[HS_UTIL_DIAG_REPORTS];
+    HS_CpuTimes_t        Times[HS_UTIL_NUM_CORES];
+    HS_CustomCoreData_t *CorePtr    = NULL;
+    uint32               CoreIndex  = 0;
+    uint64               BusyDelta  = 0;
+    uint64               TotalDelta = 0;
+    int32                Status     = CFE_SUCCESS;
 
-    /* Initialize the arrays */
-    for (i = 0; i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH; i++)
-    {
-        DiagValue[i] = 0xFFFFFFFF;
-        DiagCount[i] = 0;
-    }
-    for (i = 0; i < HS_UTIL_DIAG_REPORTS; i++)
-    {
-        OutputValue[i]   = 0xFFFFFFFF;
-        OutputCount[i]   = 0;
-        OutputOrdinal[i] = i;
-    }
+    Status = HS_ReadProcStat(Times, HS_UTIL_NUM_CORES);
 
-    /* Populate the arrays */
-    for (i = 0; i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH; i++)
+    if (Status == CFE_SUCCESS)
     {
-        if (i == 0)
-        {
-            ThisValue = HS_CustomData.UtilArray[i] - HS_CustomData.UtilArray[HS_UTIL_TIME_DIAG_ARRAY_LENGTH - 1];
-        }
-        else
+        for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
         {
-            ThisValue = HS_CustomData.UtilArray[i] - HS_CustomData.UtilArray[i - 1];
-        }
+            CorePtr    = &HS_CustomData.Core[CoreIndex];
+            BusyDelta  = Times[CoreIndex].Busy - CorePtr->LastBusyTime;
+            TotalDelta = Times[CoreIndex].Total - CorePtr->LastTotalTime;
 
-        for (j = 0; j < HS_UTIL_TIME_DIAG_ARRAY_LENGTH; j++)
-        {
-            if (DiagValue[j] == 0xFFFFFFFF)
+            /* The first sample only sets the baseline */
+            if ((CorePtr->LastTotalTime != 0) && (TotalDelta != 0))
             {
-                /* Acquire a slot if empty */
-                DiagValue[j] = ThisValue;
+                CorePtr->SampledUtil = (int32)((BusyDelta * HS_UTIL_PER_INTERVAL_TOTAL) / TotalDelta);
             }
 
-            if (ThisValue == DiagValue[j])
-            {
-                /* Increment count and cause loop to exit on match */
-                DiagCount[j]++;
-                j = HS_UTIL_TIME_DIAG_ARRAY_LENGTH;
-            }
+            CorePtr->LastBusyTime  = Times[CoreIndex].Busy;
+            CorePtr->LastTotalTime = Times[CoreIndex].Total;
         }
     }
 
-    /* Calculate the lowest time jumps */
-    i = 0;
-    while (i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH)
+    return Status;
+
+} /* end HS_UtilSampleProcStat */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sample the per core utilization from Idle Task CPU time         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_UtilSampleThreadTime(void)
+{
+    HS_CustomCoreData_t *CorePtr   = NULL;
+    uint32               CoreIndex = 0;
+    uint64               Now       = 0;
+    uint64               Elapsed   = 0;
+    uint64               CpuTime   = 0;
+    uint64               CpuDelta  = 0;
+    int32                Status    = CFE_SUCCESS;
+
+    Now     = HS_GetMonotonicTimeNs();
+    Elapsed = Now - HS_CustomData.LastSampleTime;
+
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
     {
-        if (DiagValue[i] == 0xFFFFFFFF)
+        CorePtr = &HS_CustomData.Core[CoreIndex];
+
+        /* The Idle Task records its clock once it has started */
+        if (!HS_ATOMIC_LOAD(&CorePtr->IdleClockValid))
         {
-            break;
+            continue;
         }
 
-        Ordinal = 0;
-        for (j = 0; j < HS_UTIL_DIAG_REPORTS; j++)
+        Status = HS_GetClockTimeNs(CorePtr->IdleClockId, &CpuTime);
+
+        if (Status != CFE_SUCCESS)
         {
-            if (OutputValue[j] < DiagValue[i])
-            {
-                Ordinal++;
-            }
+            break;
         }
-        if (Ordinal < HS_UTIL_DIAG_REPORTS)
-        {
-            /* Take over the outputs occupied by the current last */
-            NewOrdinalIndex              = OutputOrdinal[HS_UTIL_DIAG_REPORTS - 1];
-            OutputValue[NewOrdinalIndex] = DiagValue[i];
-            OutputCount[NewOrdinalIndex] = DiagCount[i];
 
-            /* Slide everything else down */
-            for (j = HS_UTIL_DIAG_REPORTS - 1; j > Ordinal; j--)
+        CpuDelta = CpuTime - CorePtr->LastIdleCpuTime;
+
+        /* The first sample only sets the baseline */
+        if ((CorePtr->LastIdleCpuTime != 0) && (HS_CustomData.LastSampleTime != 0) && (Elapsed != 0))
+        {
+            if (CpuDelta > Elapsed)
             {
-                OutputOrdinal[j] = OutputOrdinal[j - 1];
+                CpuDelta = Elapsed;
             }
 
-            /* Point to the new output */
-            OutputOrdinal[Ordinal] = NewOrdinalIndex;
+            CorePtr->SampledUtil =
+                HS_UTIL_PER_INTERVAL_TOTAL - (int32)((CpuDelta * HS_UTIL_PER_INTERVAL_TOTAL) / Elapsed);
         }
 
-        i++;
+        CorePtr->LastIdleCpuTime = CpuTime;
     }
 
-    /* Output the HS_UTIL_DIAG_REPORTS as en event */
-    CFE_EVS_SendEvent(
-        HS_UTIL_DIAG_REPORT_EID, CFE_EVS_EventType_INFORMATION,
-        "Mask 0x%08X Base Time Ticks per Idle Ticks (frequency): %i(%i), %i(%i), %i(%i), %i(%i)",
-        (unsigned int)HS_CustomData.UtilMask, (int)OutputValue[OutputOrdinal[0]], (int)OutputCount[OutputOrdinal[0]],
-        (int)OutputValue[OutputOrdinal[1]], (int)OutputCount[OutputOrdinal[1]], (int)OutputValue[OutputOrdinal[2]],
-        (int)OutputCount[OutputOrdinal[2]], (int)OutputValue[OutputOrdinal[3]], (int)OutputCount[OutputOrdinal[3]]);
+    HS_CustomData.LastSampleTime = Now;
 
-    return;
+    return Status;
 
-} /* end HS_UtilDiagReport */
+} /* end HS_UtilSampleThreadTime */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Report Utilization                                              */
+/* Terminate The Idle Task                                         */
 /*                                                                 */
 /* NOTE: For complete prolog information, see 'hs_custom.h'        */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 HS_CustomGetUtil(void)
+void HS_CustomCleanup(void)
 {
-    int32 CurrentUtil = 0;
+    /*
+    ** Stop the mark source for CPU Monitoring
+    */
+    HS_UtilMarkStop();
 
-    if (HS_CustomData.UtilDiv != 0)
+    /*
+    ** Stop and delete the Idle Task(s)
+    */
+    if (HS_UtilBackendUsesIdleTask(HS_CustomData.UtilBackend))
     {
-        CurrentUtil = HS_UTIL_PER_INTERVAL_TOTAL -
-                      (((HS_CustomData.LastIdleTaskInterval * HS_CustomData.UtilMult1) / HS_CustomData.UtilDiv) *
-                       HS_CustomData.UtilMult2);
+        HS_CustomStopIdleTasks();
     }
 
-    return CurrentUtil;
-}
+} /* end HS_CustomCleanup */
 
-void HS_SetUtilParamsCmd(const CFE_SB_Buffer_t *BufPtr)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Increment the Utilization Counter                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilizationIncrement(uint32 CoreIndex)
 {
-    size_t                 ExpectedLength = sizeof(HS_SetUtilParamsCmd_t);
-    HS_SetUtilParamsCmd_t *CmdPtr         = NULL;
+    /* Only this core's Idle Task writes the counter, so no locked increment is needed */
+    HS_ATOMIC_INCREMENT(&HS_CustomData.Core[CoreIndex].ThisIdleTaskExec);
 
-    /*
-    ** Verify message packet length
-    */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
-    {
-        CmdPtr = ((HS_SetUtilParamsCmd_t *)BufPtr);
+    return;
 
-        if ((CmdPtr->Mult1 != 0) && (CmdPtr->Mult2 != 0) && (CmdPtr->Div != 0))
+} /* end HS_UtilizationIncrement */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark the Utilization Counter                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilizationMark(void)
+{
+    HS_CustomCoreData_t *CorePtr   = NULL;
+    uint32               CoreIndex = 0;
+    uint32               ThisExec  = 0;
+    uint64               Now       = 0;
+
+    HS_CustomData.MarkCycleCount++;
+
+    if (HS_CustomData.MarkCycleCount >= HS_CustomData.UtilCallsPerMark)
+    {
+        /* The first mark only sets the baseline for the jitter */
+        Now = HS_GetMonotonicTimeNs();
+        if (HS_CustomData.LastMarkTime != 0)
         {
-            HS_CustomData.UtilMult1 = CmdPtr->Mult1;
-            HS_CustomData.UtilMult2 = CmdPtr->Mult2;
-            HS_CustomData.UtilDiv   = CmdPtr->Div;
-            HS_AppData.CmdCount++;
-            CFE_EVS_SendEvent(HS_SET_UTIL_PARAMS_DBG_EID, CFE_EVS_EventType_DEBUG,
-                              "Utilization Parms set: Mult1: %d Div: %d Mult2: %d", (int)HS_CustomData.UtilMult1,
-                              (int)HS_CustomData.UtilDiv, (int)HS_CustomData.UtilMult2);
+            HS_UtilMarkJitter(Now - HS_CustomData.LastMarkTime);
         }
-        else
+        HS_CustomData.LastMarkTime = Now;
+
+        HS_ATOMIC_STORE(&HS_CustomData.MarkCount, HS_CustomData.MarkCount + 1);
+
+        for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
         {
-            HS_AppData.CmdErrCount++;
-            CFE_EVS_SendEvent(HS_SET_UTIL_PARAMS_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Utilization Parms Error: No parameter may be 0: Mult1: %d Div: %d Mult2: %d",
-                              (int)CmdPtr->Mult1, (int)CmdPtr->Div, (int)CmdPtr->Mult2);
+            CorePtr  = &HS_CustomData.Core[CoreIndex];
+            ThisExec = HS_ATOMIC_LOAD(&CorePtr->ThisIdleTaskExec);
+
+            HS_ATOMIC_STORE(&CorePtr->LastIdleTaskInterval, ThisExec - CorePtr->LastIdleTaskExec);
+            CorePtr->LastIdleTaskExec = ThisExec;
         }
+
+        HS_CustomData.MarkCycleCount = 0;
+    }
+
+    return;
+
+} /* end HS_UtilizationMark */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start the Utilization Mark Source                               */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_UtilMarkStart(void)
+{
+    int32  Status   = CFE_SUCCESS;
+    uint32 Accuracy = 0;
+
+    switch (HS_CustomData.MarkSource)
+    {
+        case HS_UTIL_MARK_SOURCE_TIMER:
+            Status = OS_TimerCreate(&HS_CustomData.MarkTimerId, HS_UTIL_MARK_TIMER_NAME, &Accuracy,
+                                    HS_MarkTimerCallback);
+
+            if (Status == OS_SUCCESS)
+            {
+                Status = OS_TimerSet(HS_CustomData.MarkTimerId, HS_UTIL_MARK_PERIOD_US / HS_UTIL_CALLS_PER_MARK,
+                                     HS_UTIL_MARK_PERIOD_US / HS_UTIL_CALLS_PER_MARK);
+
+                if (Status != OS_SUCCESS)
+                {
+                    OS_TimerDelete(HS_CustomData.MarkTimerId);
+                }
+            }
+            break;
+
+        case HS_UTIL_MARK_SOURCE_WAKEUP:
+            /* Marked by HS_CustomMonitorUtilization */
+            break;
+
+        case HS_UTIL_MARK_SOURCE_MESSAGE:
+            Status = CFE_SB_CreatePipe(&HS_CustomData.MarkPipe, HS_UTIL_MARK_PIPE_DEPTH, HS_UTIL_MARK_PIPE_NAME);
+
+            if (Status == CFE_SUCCESS)
+            {
+                Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(HS_UTIL_MARK_MID), HS_CustomData.MarkPipe);
+
+                if (Status != CFE_SUCCESS)
+                {
+                    CFE_SB_DeletePipe(HS_CustomData.MarkPipe);
+                }
+            }
+            break;
+
+        default:
+            Status = CFE_TIME_RegisterSynchCallback((CFE_TIME_SynchCallbackPtr_t)&HS_MarkIdleCallback);
+            break;
+    }
+
+    return Status;
+
+} /* end HS_UtilMarkStart */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop the Utilization Mark Source                                */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilMarkStop(void)
+{
+    switch (HS_CustomData.MarkSource)
+    {
+        case HS_UTIL_MARK_SOURCE_TIMER:
+            OS_TimerDelete(HS_CustomData.MarkTimerId);
+            break;
+
+        case HS_UTIL_MARK_SOURCE_WAKEUP:
+            break;
+
+        case HS_UTIL_MARK_SOURCE_MESSAGE:
+            CFE_SB_DeletePipe(HS_CustomData.MarkPipe);
+            break;
+
+        default:
+            CFE_TIME_UnregisterSynchCallback((CFE_TIME_SynchCallbackPtr_t)&HS_MarkIdleCallback);
+            break;
+    }
+
+    return;
+
+} /* end HS_UtilMarkStop */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record the Jitter of a Utilization Mark Interval                */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilMarkJitter(uint64 Interval)
+{
+    uint64 Expected = (uint64)HS_UTIL_MARK_PERIOD_US * 1000;
+    uint64 Jitter   = 0;
+    uint32 Average  = HS_CustomData.MarkJitterAvg;
+
+    if (Interval > Expected)
+    {
+        Jitter = Interval - Expected;
+    }
+    else
+    {
+        Jitter = Expected - Interval;
+    }
+
+    if (Jitter > 0xFFFFFFFF)
+    {
+        Jitter = 0xFFFFFFFF;
+    }
+
+    Average = Average - (Average >> HS_UTIL_MARK_JITTER_SHIFT) + ((uint32)Jitter >> HS_UTIL_MARK_JITTER_SHIFT);
+    HS_ATOMIC_STORE(&HS_CustomData.MarkJitterAvg, Average);
+
+    if ((uint32)Jitter > HS_CustomData.MarkJitterMax)
+    {
+        HS_ATOMIC_STORE(&HS_CustomData.MarkJitterMax, (uint32)Jitter);
+    }
+
+    return;
+
+} /* end HS_UtilMarkJitter */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the Utilization Mark Statistics                             */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilMarkGetStats(uint32 *Source, uint32 *Count, uint32 *JitterAvg, uint32 *JitterMax)
+{
+    *Source    = HS_CustomData.MarkSource;
+    *Count     = HS_ATOMIC_LOAD(&HS_CustomData.MarkCount);
+    *JitterAvg = HS_ATOMIC_LOAD(&HS_CustomData.MarkJitterAvg) / 1000;
+    *JitterMax = HS_ATOMIC_EXCHANGE(&HS_CustomData.MarkJitterMax, 0) / 1000;
+
+    return;
+
+} /* end HS_UtilMarkGetStats */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark Utilization from the Mark Pipe                             */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_CustomMarkPoll(void)
+{
+    CFE_SB_Buffer_t *BufPtr   = NULL;
+    int32            Status   = CFE_SUCCESS;
+    uint32           NumMarks = 0;
+
+    while (Status == CFE_SUCCESS)
+    {
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, HS_CustomData.MarkPipe, CFE_SB_POLL);
+
+        if ((Status == CFE_SUCCESS) && (BufPtr != NULL))
+        {
+            NumMarks++;
+        }
+    }
+
+    /* Marks queued since the previous cycle close a single interval */
+    if (NumMarks != 0)
+    {
+        HS_UtilizationMark();
+    }
+
+    return;
+
+} /* end HS_CustomMarkPoll */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Timer callback function that marks the Idle time                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MarkTimerCallback(osal_id_t TimerId)
+{
+    (void)TimerId;
+
+    /*
+    ** Capture the CPU Utilization (at the timer rate)
+    */
+    HS_UtilizationMark();
+
+    return;
+
+} /* End of HS_MarkTimerCallback() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Callback function that marks the Idle time                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MarkIdleCallback(void)
+{
+    /*
+    ** Capture the CPU Utilization (at a consistant time)
+    */
+    HS_UtilizationMark();
+
+    return;
+
+} /* End of HS_MarkIdleCallback() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Performs Utilization Monitoring and reporting                   */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_CustomMonitorUtilization(void)
+{
+    if (HS_CustomData.MarkSource == HS_UTIL_MARK_SOURCE_WAKEUP)
+    {
+        HS_UtilizationMark();
+    }
+    else if (HS_CustomData.MarkSource == HS_UTIL_MARK_SOURCE_MESSAGE)
+    {
+        HS_CustomMarkPoll();
+    }
+
+    HS_CustomData.UtilCycleCounter++;
+    if (HS_CustomData.UtilCycleCounter >= HS_UTIL_CYCLES_PER_INTERVAL)
+    {
+        HS_UtilBackendSample();
+        HS_UtilCalUpdate();
+        HS_MonitorUtilization();
+        HS_MonitorTaskCpu();
+        HS_MonitorStacks();
+        HS_PsiMonitor();
+        HS_MemMonitor();
+        HS_CustomData.UtilCycleCounter = 0;
+    }
+
+} /* End of HS_CustomMonitorUtilization() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Processes any additional commands                               */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/*                                                                 */
+/* This function MUST return CFE_SUCCESS if any command is found   */
+/* and must NOT return CFE_SUCCESS if no command was found         */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_CustomCommands(const CFE_SB_Buffer_t *BufPtr)
+{
+    int32 Status = CFE_SUCCESS;
+
+    CFE_MSG_FcnCode_t CommandCode = 0;
+
+    CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
+
+    switch (CommandCode)
+    {
+        case HS_REPORT_DIAG_CC:
+            HS_UtilDiagReport();
+            break;
+
+        case HS_SET_UTIL_PARAMS_CC:
+            HS_SetUtilParamsCmd(BufPtr);
+            break;
+
+        case HS_SET_UTIL_DIAG_CC:
+            HS_SetUtilDiagCmd(BufPtr);
+            break;
+
+        case HS_SET_CORE_UTIL_PARAMS_CC:
+            HS_SetCoreUtilParamsCmd(BufPtr);
+            break;
+
+        case HS_SET_UTIL_BACKEND_CC:
+            HS_SetUtilBackendCmd(BufPtr);
+            break;
+
+        case HS_START_UTIL_CAL_CC:
+            HS_StartUtilCalCmd(BufPtr);
+            break;
+
+        default:
+            Status = !CFE_SUCCESS;
+            break;
+
+    } /* end CommandCode switch */
+
+    return Status;
+
+} /* End of HS_CustomCommands() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report Utilization Diagnostics Information                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilDiagReport(void)
+{
+    HS_UtilDiagPayload_t *PayloadPtr = &HS_CustomData.UtilDiagPacket.Payload;
+    uint64 *              Deltas     = HS_CustomData.UtilDiagDeltas;
+    uint32                i          = 0;
+    uint64                ThisValue  = 0;
+    uint32                ThisCount  = 0;
+
+    uint64 OutputValue[HS_UTIL_DIAG_REPORTS];
+    uint32 OutputCount[HS_UTIL_DIAG_REPORTS];
+
+    /* Initialize the outputs */
+    for (i = 0; i < HS_UTIL_DIAG_REPORTS; i++)
+    {
+        OutputValue[i] = 0xFFFFFFFFFFFFFFFFULL;
+        OutputCount[i] = 0;
+    }
+
+    /* Acquire the index so every stamp published before it is visible */
+    (void)HS_ATOMIC_LOAD(&HS_CustomData.UtilArrayIndex);
+
+    /* Snapshot the deltas between consecutive time stamps */
+    for (i = 0; i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH; i++)
+    {
+        if (i == 0)
+        {
+            Deltas[i] = HS_CustomData.UtilArray[i] - HS_CustomData.UtilArray[HS_UTIL_TIME_DIAG_ARRAY_LENGTH - 1];
+        }
+        else
+        {
+            Deltas[i] = HS_CustomData.UtilArray[i] - HS_CustomData.UtilArray[i - 1];
+        }
+    }
+
+    /* Sort the deltas so equal values are adjacent, lowest first */
+    HS_UtilDiagSort(Deltas, HS_UTIL_TIME_DIAG_ARRAY_LENGTH);
+
+    PayloadPtr->Mask          = HS_CustomData.UtilMask;
+    PayloadPtr->NumSamples    = HS_UTIL_TIME_DIAG_ARRAY_LENGTH;
+    PayloadPtr->NumValues     = 0;
+    PayloadPtr->NumEntries    = 0;
+    PayloadPtr->OverflowCount = 0;
+
+    /* Count each run of equal deltas */
+    i = 0;
+    while (i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH)
+    {
+        ThisValue = Deltas[i];
+        ThisCount = 0;
+
+        while ((i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH) && (Deltas[i] == ThisValue))
+        {
+            ThisCount++;
+            i++;
+        }
+
+        if (PayloadPtr->NumValues < HS_UTIL_DIAG_REPORTS)
+        {
+            OutputValue[PayloadPtr->NumValues] = ThisValue;
+            OutputCount[PayloadPtr->NumValues] = ThisCount;
+        }
+
+        if (PayloadPtr->NumEntries < HS_UTIL_DIAG_MAX_VALUES)
+        {
+            PayloadPtr->Entries[PayloadPtr->NumEntries].Value = ThisValue;
+            PayloadPtr->Entries[PayloadPtr->NumEntries].Count = ThisCount;
+            PayloadPtr->NumEntries++;
+        }
+        else
+        {
+            PayloadPtr->OverflowCount += ThisCount;
+        }
+
+        PayloadPtr->NumValues++;
+    }
+
+    /* Output the HS_UTIL_DIAG_REPORTS as en event */
+    CFE_EVS_SendEvent(HS_UTIL_DIAG_REPORT_EID, CFE_EVS_EventType_INFORMATION,
+                      "Mask 0x%08X Base Time ns per Idle Ticks (frequency): %lld(%i), %lld(%i), %lld(%i), %lld(%i)",
+                      (unsigned int)HS_CustomData.UtilMask, (long long)OutputValue[0], (int)OutputCount[0],
+                      (long long)OutputValue[1], (int)OutputCount[1], (long long)OutputValue[2], (int)OutputCount[2],
+                      (long long)OutputValue[3], (int)OutputCount[3]);
+
+    /* Output the full distribution as a packet */
+    CFE_SB_TimeStampMsg(&HS_CustomData.UtilDiagPacket.TlmHeader.Msg);
+    CFE_SB_TransmitMsg(&HS_CustomData.UtilDiagPacket.TlmHeader.Msg, true);
+
+    return;
+
+} /* end HS_UtilDiagReport */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sort Utilization Diagnostics Values                             */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilDiagSort(uint64 *Values, uint32 Count)
+{
+    uint32 i    = 0;
+    uint64 Temp = 0;
+
+    if (Count < 2)
+    {
+        return;
+    }
+
+    /* Build a max heap */
+    for (i = Count / 2; i > 0; i--)
+    {
+        HS_UtilDiagSiftDown(Values, i - 1, Count);
+    }
+
+    /* Repeatedly move the largest remaining value to the end */
+    for (i = Count - 1; i > 0; i--)
+    {
+        Temp      = Values[0];
+        Values[0] = Values[i];
+        Values[i] = Temp;
+
+        HS_UtilDiagSiftDown(Values, 0, i);
+    }
+
+    return;
+
+} /* end HS_UtilDiagSort */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sift Down a Utilization Diagnostics Heap                        */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilDiagSiftDown(uint64 *Values, uint32 Root, uint32 Count)
+{
+    uint32 Child = 0;
+    uint64 Temp  = 0;
+
+    while ((Root * 2) + 1 < Count)
+    {
+        Child = (Root * 2) + 1;
+
+        /* Pick the larger of the two children */
+        if ((Child + 1 < Count) && (Values[Child + 1] > Values[Child]))
+        {
+            Child++;
+        }
+
+        if (Values[Root] >= Values[Child])
+        {
+            break;
+        }
+
+        Temp          = Values[Root];
+        Values[Root]  = Values[Child];
+        Values[Child] = Temp;
+
+        Root = Child;
+    }
+
+    return;
+
+} /* end HS_UtilDiagSiftDown */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report Utilization                                              */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_CustomGetUtil(void)
+{
+    int32  CurrentUtil = 0;
+    uint32 CoreIndex   = 0;
+
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+    {
+        CurrentUtil += HS_CustomGetCoreUtil(CoreIndex);
+    }
+
+    return CurrentUtil / HS_UTIL_NUM_CORES;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report Utilization of a single core                             */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_CustomGetCoreUtil(uint32 CoreIndex)
+{
+    HS_CustomCoreData_t *CorePtr      = &HS_CustomData.Core[CoreIndex];
+    int32                CurrentUtil  = 0;
+    uint32               IdleInterval = HS_ATOMIC_LOAD(&CorePtr->LastIdleTaskInterval);
+
+    switch (HS_CustomData.UtilBackend)
+    {
+        case HS_UTIL_BACKEND_PROC_STAT:
+        case HS_UTIL_BACKEND_THREAD_TIME:
+            CurrentUtil = CorePtr->SampledUtil;
+            break;
+
+        default:
+            if (CorePtr->UtilScale != 0)
+            {
+                /* Idle counts at or above the calibrated rate are 0 utilization */
+                if (IdleInterval < CorePtr->CalIdleRate)
+                {
+                    CurrentUtil = HS_UTIL_PER_INTERVAL_TOTAL -
+                                  (int32)((IdleInterval * CorePtr->UtilScale) >> HS_UTIL_CAL_FRAC_BITS);
+                }
+            }
+            else if (CorePtr->UtilDiv != 0)
+            {
+                CurrentUtil =
+                    HS_UTIL_PER_INTERVAL_TOTAL -
+                    (((IdleInterval * CorePtr->UtilMult1) / CorePtr->UtilDiv) * CorePtr->UtilMult2);
+            }
+            break;
+    }
+
+    return CurrentUtil;
+}
+
+void HS_SetUtilParamsCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                 ExpectedLength = sizeof(HS_SetUtilParamsCmd_t);
+    HS_SetUtilParamsCmd_t *CmdPtr         = NULL;
+    uint32                 CoreIndex      = 0;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_SetUtilParamsCmd_t *)BufPtr);
+
+        if ((CmdPtr->Mult1 != 0) && (CmdPtr->Mult2 != 0) && (CmdPtr->Div != 0))
+        {
+            for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+            {
+                HS_CustomData.Core[CoreIndex].UtilMult1 = CmdPtr->Mult1;
+                HS_CustomData.Core[CoreIndex].UtilMult2 = CmdPtr->Mult2;
+                HS_CustomData.Core[CoreIndex].UtilDiv   = CmdPtr->Div;
+
+                /* Commanded factors override any calibration */
+                HS_UtilCalApply(CoreIndex, 0);
+            }
+            HS_UtilCalSave();
+            HS_AppData.CmdCount++;
+            CFE_EVS_SendEvent(HS_SET_UTIL_PARAMS_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "Utilization Parms set: Mult1: %d Div: %d Mult2: %d", (int)CmdPtr->Mult1,
+                              (int)CmdPtr->Div, (int)CmdPtr->Mult2);
+        }
+        else
+        {
+            HS_AppData.CmdErrCount++;
+            CFE_EVS_SendEvent(HS_SET_UTIL_PARAMS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Utilization Parms Error: No parameter may be 0: Mult1: %d Div: %d Mult2: %d",
+                              (int)CmdPtr->Mult1, (int)CmdPtr->Div, (int)CmdPtr->Mult2);
+        }
+    }
+
+    return;
+
+} /* end HS_SetUtilParamsCmd */
+
+void HS_SetUtilDiagCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t               ExpectedLength = sizeof(HS_SetUtilDiagCmd_t);
+    HS_SetUtilDiagCmd_t *CmdPtr         = NULL;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        HS_AppData.CmdCount++;
+        CmdPtr = ((HS_SetUtilDiagCmd_t *)BufPtr);
+
+        HS_CustomData.UtilMask = CmdPtr->Mask;
+        CFE_EVS_SendEvent(HS_SET_UTIL_DIAG_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Utilization Diagnostics Mask has been set to %08X", (unsigned int)HS_CustomData.UtilMask);
+    }
+
+    return;
+
+} /* end HS_SetUtilDiagCmd */
+
+void HS_SetCoreUtilParamsCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                     ExpectedLength = sizeof(HS_SetCoreUtilParamsCmd_t);
+    HS_SetCoreUtilParamsCmd_t *CmdPtr         = NULL;
+    HS_CustomCoreData_t *      CorePtr        = NULL;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_SetCoreUtilParamsCmd_t *)BufPtr);
+
+        if ((CmdPtr->Core < HS_UTIL_NUM_CORES) && (CmdPtr->Mult1 != 0) && (CmdPtr->Mult2 != 0) && (CmdPtr->Div != 0))
+        {
+            CorePtr            = &HS_CustomData.Core[CmdPtr->Core];
+            CorePtr->UtilMult1 = CmdPtr->Mult1;
+            CorePtr->UtilMult2 = CmdPtr->Mult2;
+            CorePtr->UtilDiv   = CmdPtr->Div;
+            HS_UtilCalApply(CmdPtr->Core, 0);
+            HS_UtilCalSave();
+            HS_AppData.CmdCount++;
+            CFE_EVS_SendEvent(HS_SET_CORE_UTIL_PARAMS_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "Core %d Utilization Parms set: Mult1: %d Div: %d Mult2: %d", (int)CmdPtr->Core,
+                              (int)CorePtr->UtilMult1, (int)CorePtr->UtilDiv, (int)CorePtr->UtilMult2);
+        }
+        else
+        {
+            HS_AppData.CmdErrCount++;
+            CFE_EVS_SendEvent(HS_SET_CORE_UTIL_PARAMS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Core Utilization Parms Error: Invalid core or 0 parameter: Core: %d Mult1: %d Div: %d "
+                              "Mult2: %d",
+                              (int)CmdPtr->Core, (int)CmdPtr->Mult1, (int)CmdPtr->Div, (int)CmdPtr->Mult2);
+        }
+    }
+
+    return;
+
+} /* end HS_SetCoreUtilParamsCmd */
+
+void HS_SetUtilBackendCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                  ExpectedLength = sizeof(HS_SetUtilBackendCmd_t);
+    HS_SetUtilBackendCmd_t *CmdPtr         = NULL;
+    uint32                  PrevBackend    = 0;
+    int32                   Status         = CFE_SUCCESS;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_SetUtilBackendCmd_t *)BufPtr);
+
+        if (CmdPtr->Backend > HS_UTIL_BACKEND_LAST)
+        {
+            HS_AppData.CmdErrCount++;
+            CFE_EVS_SendEvent(HS_UTIL_BACKEND_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid utilization backend %d",
+                              (int)CmdPtr->Backend);
+        }
+        else
+        {
+            PrevBackend = HS_CustomData.UtilBackend;
+
+            if (CmdPtr->Backend != PrevBackend)
+            {
+                if (HS_UtilBackendUsesIdleTask(PrevBackend))
+                {
+                    HS_CustomStopIdleTasks();
+                }
+
+                HS_CustomData.UtilBackend = CmdPtr->Backend;
+
+                Status = HS_UtilBackendStart();
+
+                if (Status != CFE_SUCCESS)
+                {
+                    /* Keep measuring with the previous backend */
+                    HS_CustomData.UtilBackend = PrevBackend;
+                    HS_UtilBackendStart();
+                }
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                HS_AppData.CmdCount++;
+                CFE_EVS_SendEvent(HS_SET_UTIL_BACKEND_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                  "Utilization backend set to %d", (int)HS_CustomData.UtilBackend);
+            }
+            else
+            {
+                HS_AppData.CmdErrCount++;
+            }
+        }
+    }
+
+    return;
+
+} /* end HS_SetUtilBackendCmd */
+
+void HS_StartUtilCalCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    size_t                ExpectedLength = sizeof(HS_StartUtilCalCmd_t);
+    HS_StartUtilCalCmd_t *CmdPtr         = NULL;
+    uint32                NumIntervals   = 0;
+
+    /*
+    ** Verify message packet length
+    */
+    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    {
+        CmdPtr = ((HS_StartUtilCalCmd_t *)BufPtr);
+
+        if (HS_CustomData.UtilBackend == HS_UTIL_BACKEND_IDLE_COUNT)
+        {
+            NumIntervals = CmdPtr->NumIntervals;
+            if (NumIntervals == 0)
+            {
+                NumIntervals = HS_UTIL_CAL_DEFAULT_INTERVALS;
+            }
+
+            HS_AppData.CmdCount++;
+            HS_UtilCalStart(NumIntervals, (CmdPtr->SaveToCDS != 0), (CmdPtr->TrackPeak != 0));
+        }
+        else
+        {
+            HS_AppData.CmdErrCount++;
+            CFE_EVS_SendEvent(HS_UTIL_CAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Utilization Calibration Error: Backend %d does not use the Idle Task count",
+                              (int)HS_CustomData.UtilBackend);
+        }
+    }
+
+    return;
+
+} /* end HS_StartUtilCalCmd */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start a Utilization Calibration                                 */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilCalStart(uint32 NumIntervals, bool SaveToCDS, bool TrackPeak)
+{
+    uint32 CoreIndex = 0;
+
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+    {
+        HS_CustomData.Core[CoreIndex].CalPeak = 0;
+    }
+
+    HS_CustomData.CalIntervalsLeft = NumIntervals;
+    HS_CustomData.CalSaveToCDS     = SaveToCDS;
+    HS_CustomData.CalTrackPeak     = TrackPeak;
+
+    CFE_EVS_SendEvent(HS_UTIL_CAL_START_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Utilization Calibration started over %d intervals: SaveToCDS: %d TrackPeak: %d",
+                      (int)NumIntervals, (int)SaveToCDS, (int)TrackPeak);
+
+    return;
+
+} /* end HS_UtilCalStart */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update the Utilization Calibration                              */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilCalUpdate(void)
+{
+    HS_CustomCoreData_t *CorePtr      = NULL;
+    uint32               CoreIndex    = 0;
+    uint32               IdleInterval = 0;
+    bool                 Raised       = false;
+
+    if (HS_CustomData.UtilBackend != HS_UTIL_BACKEND_IDLE_COUNT)
+    {
+        /* Idle counts are meaningless without the Idle Task, abandon any calibration */
+        HS_CustomData.CalIntervalsLeft = 0;
+    }
+    else if (HS_CustomData.CalIntervalsLeft > 0)
+    {
+        for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+        {
+            CorePtr      = &HS_CustomData.Core[CoreIndex];
+            IdleInterval = HS_ATOMIC_LOAD(&CorePtr->LastIdleTaskInterval);
+            if (IdleInterval > CorePtr->CalPeak)
+            {
+                CorePtr->CalPeak = IdleInterval;
+            }
+        }
+
+        HS_CustomData.CalIntervalsLeft--;
+
+        if (HS_CustomData.CalIntervalsLeft == 0)
+        {
+            for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+            {
+                CorePtr = &HS_CustomData.Core[CoreIndex];
+                if (CorePtr->CalPeak == 0)
+                {
+                    CFE_EVS_SendEvent(HS_UTIL_CAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Utilization Calibration Error: No Idle Task count measured on core %d",
+                                      (int)CoreIndex);
+                }
+                else
+                {
+                    HS_UtilCalApply(CoreIndex, CorePtr->CalPeak);
+                    CFE_EVS_SendEvent(HS_UTIL_CAL_DONE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                      "Core %d Utilization calibrated: Idle count %u per interval, Scale 0x%08X.%08X",
+                                      (int)CoreIndex, (unsigned int)CorePtr->CalIdleRate,
+                                      (unsigned int)(CorePtr->UtilScale >> 32),
+                                      (unsigned int)(CorePtr->UtilScale & 0xFFFFFFFF));
+                }
+            }
+
+            if (HS_CustomData.CalSaveToCDS)
+            {
+                HS_UtilCalSave();
+            }
+        }
+    }
+    else if (HS_CustomData.CalTrackPeak)
+    {
+        for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+        {
+            CorePtr      = &HS_CustomData.Core[CoreIndex];
+            IdleInterval = HS_ATOMIC_LOAD(&CorePtr->LastIdleTaskInterval);
+            if ((CorePtr->UtilScale != 0) && (IdleInterval > CorePtr->CalIdleRate))
+            {
+                HS_UtilCalApply(CoreIndex, IdleInterval);
+                Raised = true;
+            }
+        }
+
+        if (Raised && HS_CustomData.CalSaveToCDS)
+        {
+            HS_UtilCalSave();
+        }
+    }
+
+    return;
+
+} /* end HS_UtilCalUpdate */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Apply a Utilization Calibration                                 */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilCalApply(uint32 CoreIndex, uint32 IdleRate)
+{
+    HS_CustomCoreData_t *CorePtr = &HS_CustomData.Core[CoreIndex];
+
+    CorePtr->CalIdleRate = IdleRate;
+
+    if (IdleRate != 0)
+    {
+        /* Rounding down keeps IdleRate * UtilScale within 64 bits */
+        CorePtr->UtilScale = ((uint64)HS_UTIL_PER_INTERVAL_TOTAL << HS_UTIL_CAL_FRAC_BITS) / IdleRate;
+    }
+    else
+    {
+        CorePtr->UtilScale = 0;
+    }
+
+    return;
+
+} /* end HS_UtilCalApply */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Save the Utilization Calibration                                */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilCalSave(void)
+{
+    uint32 CoreIndex = 0;
+
+    if (HS_CustomData.CalCDSValid)
+    {
+        for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+        {
+            HS_CustomData.CalCDSData.IdleRate[CoreIndex]    = HS_CustomData.Core[CoreIndex].CalIdleRate;
+            HS_CustomData.CalCDSData.IdleRateNot[CoreIndex] = ~HS_CustomData.Core[CoreIndex].CalIdleRate;
+        }
+
+        CFE_ES_CopyToCDS(HS_CustomData.CalCDSHandle, &HS_CustomData.CalCDSData);
     }
 
     return;
 
-} /* end HS_SetUtilParamsCmd */
+} /* end HS_UtilCalSave */
 
-void HS_SetUtilDiagCmd(const CFE_SB_Buffer_t *BufPtr)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Restore the Utilization Calibration                             */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_UtilCalRestore(void)
 {
-    size_t               ExpectedLength = sizeof(HS_SetUtilDiagCmd_t);
-    HS_SetUtilDiagCmd_t *CmdPtr         = NULL;
+    int32  Status    = CFE_SUCCESS;
+    uint32 CoreIndex = 0;
+    bool   Valid     = true;
+    bool   Restored  = false;
+
+    Status = CFE_ES_RegisterCDS(&HS_CustomData.CalCDSHandle, sizeof(HS_UtilCalCDSData_t), HS_UTIL_CAL_CDSNAME);
+
+    if (Status == CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        HS_CustomData.CalCDSValid = true;
+
+        Status = CFE_ES_RestoreFromCDS(&HS_CustomData.CalCDSData, HS_CustomData.CalCDSHandle);
+
+        if (Status == CFE_SUCCESS)
+        {
+            for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+            {
+                if (HS_CustomData.CalCDSData.IdleRate[CoreIndex] != ~HS_CustomData.CalCDSData.IdleRateNot[CoreIndex])
+                {
+                    Valid = false;
+                }
+            }
+
+            if (Valid)
+            {
+                for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+                {
+                    if (HS_CustomData.CalCDSData.IdleRate[CoreIndex] != 0)
+                    {
+                        HS_UtilCalApply(CoreIndex, HS_CustomData.CalCDSData.IdleRate[CoreIndex]);
+                        Restored = true;
+                    }
+                }
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HS_UTIL_CAL_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Data in utilization calibration CDS was corrupt, discarding it");
+                HS_UtilCalSave();
+            }
+        }
+        else
+        {
+            CFE_EVS_SendEvent(HS_UTIL_CAL_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Failed to restore utilization calibration from CDS (Err=0x%08x), discarding it",
+                              (unsigned int)Status);
+            HS_UtilCalSave();
+        }
+    }
+    else if (Status == CFE_SUCCESS)
+    {
+        HS_CustomData.CalCDSValid = true;
+        HS_UtilCalSave();
+    }
+    else
+    {
+        CFE_EVS_SendEvent(HS_UTIL_CAL_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Failed to create utilization calibration CDS (Err=0x%08x), calibrations will not be saved",
+                          (unsigned int)Status);
+    }
+
+    return Restored;
+
+} /* end HS_UtilCalRestore */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start Pressure Stall Monitoring                                 */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_PsiStart(void)
+{
+    const HS_PsiLevel_t Defaults[HS_PSI_NUM_RESOURCES] = HS_PSI_LEVEL_DEFAULTS;
+    uint32              Resource                       = 0;
+    uint32              UnavailableMask                = 0;
+
+    memcpy(HS_CustomData.PsiLevels, Defaults, sizeof(HS_CustomData.PsiLevels));
+
+    HS_CustomData.PsiAvailableMask   = 0;
+    HS_CustomData.PsiActiveMask      = 0;
+    HS_CustomData.PsiErrReportedMask = 0;
+
+    for (Resource = 0; Resource < HS_PSI_NUM_RESOURCES; Resource++)
+    {
+        HS_CustomData.PsiDwell[Resource] = 0;
+        memset(&HS_CustomData.PsiTlm[Resource], 0, sizeof(HS_CustomData.PsiTlm[Resource]));
+
+        if (HS_ReadPsi(HS_PsiPaths[Resource], &HS_CustomData.PsiLast[Resource]) == CFE_SUCCESS)
+        {
+            HS_CustomData.PsiAvailableMask |= (1U << Resource);
+        }
+        else
+        {
+            UnavailableMask |= (1U << Resource);
+        }
+    }
+
+    if (UnavailableMask != 0)
+    {
+        CFE_EVS_SendEvent(HS_PSI_UNAVAILABLE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Pressure stall information unavailable, not monitored: Mask = 0x%02X",
+                          (unsigned int)UnavailableMask);
+    }
+
+    return;
+
+} /* end HS_PsiStart */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Monitor Pressure Stall                                          */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_PsiMonitor(void)
+{
+    HS_PsiSample_t  Sample;
+    HS_PsiSample_t *LastPtr      = NULL;
+    HS_PsiTlm_t *   TlmPtr       = NULL;
+    HS_PsiLevel_t * LevelPtr     = NULL;
+    uint32          Resource     = 0;
+    uint32          MsgActsIndex = 0;
+    uint64          Delta        = 0;
+    int32           Status       = CFE_SUCCESS;
+
+    for (Resource = 0; Resource < HS_PSI_NUM_RESOURCES; Resource++)
+    {
+        if ((HS_CustomData.PsiAvailableMask & (1U << Resource)) == 0)
+        {
+            continue;
+        }
+
+        Status = HS_ReadPsi(HS_PsiPaths[Resource], &Sample);
+
+        if (Status != CFE_SUCCESS)
+        {
+            if ((HS_CustomData.PsiErrReportedMask & (1U << Resource)) == 0)
+            {
+                HS_CustomData.PsiErrReportedMask |= (1U << Resource);
+
+                CFE_EVS_SendEvent(HS_PSI_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Error reading pressure stall information %s,RC=0x%08X", HS_PsiPaths[Resource],
+                                  (unsigned int)Status);
+            }
+
+            continue;
+        }
+
+        HS_CustomData.PsiErrReportedMask &= ~(1U << Resource);
+
+        LastPtr  = &HS_CustomData.PsiLast[Resource];
+        TlmPtr   = &HS_CustomData.PsiTlm[Resource];
+        LevelPtr = &HS_CustomData.PsiLevels[Resource];
+
+        TlmPtr->SomeAvg10 = Sample.Some.Avg10;
+        TlmPtr->SomeAvg60 = Sample.Some.Avg60;
+        TlmPtr->FullAvg10 = Sample.Full.Avg10;
+        TlmPtr->FullAvg60 = Sample.Full.Avg60;
+
+        /* Totals only grow, anything else is a restart of the counter */
+        Delta = (Sample.Some.TotalUs >= LastPtr->Some.TotalUs) ? (Sample.Some.TotalUs - LastPtr->Some.TotalUs) : 0;
+        TlmPtr->SomeStallUs = (Delta > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)Delta;
+
+        Delta = (Sample.Full.TotalUs >= LastPtr->Full.TotalUs) ? (Sample.Full.TotalUs - LastPtr->Full.TotalUs) : 0;
+        TlmPtr->FullStallUs = (Delta > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)Delta;
+
+        *LastPtr = Sample;
+
+        if ((HS_CustomData.PsiActiveMask & (1U << Resource)) != 0)
+        {
+            /*
+            ** An active level is left once the stall share is below its exit threshold
+            */
+            if (Sample.Some.Avg10 < LevelPtr->ExitAvg10)
+            {
+                HS_CustomData.PsiActiveMask &= ~(1U << Resource);
+
+                if (LevelPtr->ActionType != HS_ALARM_ACT_NOACT)
+                {
+                    CFE_EVS_SendEvent(HS_PSI_EXIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                      "Pressure Stall Level Cleared: %s: Avg10 = %d", HS_PsiPaths[Resource],
+                                      (int)Sample.Some.Avg10);
+                }
+            }
+
+            continue;
+        }
+
+        if (Sample.Some.Avg10 < LevelPtr->EnterAvg10)
+        {
+            HS_CustomData.PsiDwell[Resource] = 0;
+            continue;
+        }
+
+        HS_CustomData.PsiDwell[Resource]++;
+
+        if (HS_CustomData.PsiDwell[Resource] < LevelPtr->DwellIntervals)
+        {
+            continue;
+        }
+
+        HS_CustomData.PsiDwell[Resource] = 0;
+        HS_CustomData.PsiActiveMask |= (1U << Resource);
+
+        switch (LevelPtr->ActionType)
+        {
+            case HS_ALARM_ACT_NOACT:
+                break;
+
+            case HS_ALARM_ACT_EVENT:
+                CFE_EVS_SendEvent(HS_PSI_ENTER_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Pressure Stall Level Entered: %s: Avg10 = %d: Action: Event Only",
+                                  HS_PsiPaths[Resource], (int)Sample.Some.Avg10);
+                break;
+
+            /*
+            ** Message Action types processing (invalid will be skipped)
+            */
+            default:
+
+                /* Calculate the requested message action index */
+                MsgActsIndex = LevelPtr->ActionType - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+                /*
+                ** Send the message if valid, off cooldown and not disabled
+                */
+                if (HS_ExecuteMsgAction(MsgActsIndex))
+                {
+                    CFE_EVS_SendEvent(HS_PSI_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Pressure Stall Level Entered: %s: Avg10 = %d: Action: Message Action Index: %d",
+                                      HS_PsiPaths[Resource], (int)Sample.Some.Avg10, (int)MsgActsIndex);
+                }
+
+                /* Otherwise, Take No Action */
+                break;
+        }
+    }
+
+    return;
+
+} /* end HS_PsiMonitor */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the Pressure Stall Telemetry                                */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_PsiGetStats(uint32 *AvailableMask, uint32 *ActiveMask, HS_PsiTlm_t *TlmPtr)
+{
+    *AvailableMask = HS_CustomData.PsiAvailableMask;
+    *ActiveMask    = HS_CustomData.PsiActiveMask;
+
+    memcpy(TlmPtr, HS_CustomData.PsiTlm, sizeof(HS_CustomData.PsiTlm));
+
+    return;
+
+} /* end HS_PsiGetStats */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start Memory Monitoring                                         */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MemStart(void)
+{
+    HS_MemSample_t Sample;
+
+    memset(HS_CustomData.MemHistory, 0, sizeof(HS_CustomData.MemHistory));
+    memset(&HS_CustomData.MemTlm, 0, sizeof(HS_CustomData.MemTlm));
+
+    HS_CustomData.MemHistoryNext = 0;
+    HS_CustomData.MemIntervals   = 0;
+    HS_CustomData.MemRssSum      = 0;
+    HS_CustomData.MemErrReported = false;
+    HS_CustomData.MemMonitored   = (HS_ReadMemory(&Sample) == CFE_SUCCESS);
+
+    if (HS_CustomData.MemMonitored)
+    {
+        HS_CustomData.MemTlm.TotalKb = Sample.TotalKb;
+        HS_CustomData.MemTlm.AvailKb = Sample.AvailKb;
+        HS_CustomData.MemTlm.RssKb   = Sample.RssKb;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(HS_MEM_UNAVAILABLE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Memory sizes unavailable, memory not monitored");
+    }
+
+    return;
+
+} /* end HS_MemStart */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Monitor Memory                                                  */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MemMonitor(void)
+{
+    HS_MemSample_t Sample;
+    HS_MemTlm_t *  TlmPtr = &HS_CustomData.MemTlm;
+    int32          Status = CFE_SUCCESS;
+
+    if (!HS_CustomData.MemMonitored)
+    {
+        return;
+    }
+
+    Status = HS_ReadMemory(&Sample);
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (!HS_CustomData.MemErrReported)
+        {
+            HS_CustomData.MemErrReported = true;
+
+            CFE_EVS_SendEvent(HS_MEM_READ_ERR_EID, CFE_EVS_EventType_ERROR, "Error reading memory sizes,RC=0x%08X",
+                              (unsigned int)Status);
+        }
+
+        return;
+    }
+
+    HS_CustomData.MemErrReported = false;
+
+    TlmPtr->TotalKb = Sample.TotalKb;
+    TlmPtr->AvailKb = Sample.AvailKb;
+    TlmPtr->RssKb   = Sample.RssKb;
+
+    if ((TlmPtr->AlarmMask & HS_MEM_ALARM_LOW_AVAIL) != 0)
+    {
+        /*
+        ** Cleared well above the threshold so that it doesn't chatter
+        */
+        if (Sample.AvailKb > (2 * (uint32)HS_MEM_LOW_AVAIL_KB))
+        {
+            TlmPtr->AlarmMask &= ~HS_MEM_ALARM_LOW_AVAIL;
+
+            if (HS_MEM_LOW_ACTION != HS_ALARM_ACT_NOACT)
+            {
+                CFE_EVS_SendEvent(HS_MEM_CLEAR_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Low Available Memory Cleared: Available = %u KiB", (unsigned int)Sample.AvailKb);
+            }
+        }
+    }
+    else if ((HS_MEM_LOW_AVAIL_KB != 0) && (Sample.AvailKb <= HS_MEM_LOW_AVAIL_KB))
+    {
+        TlmPtr->AlarmMask |= HS_MEM_ALARM_LOW_AVAIL;
+        HS_MemAlarmAction(HS_MEM_ALARM_LOW_AVAIL);
+    }
 
     /*
-    ** Verify message packet length
+    ** The history keeps the average over each run of intervals, which
+    ** smooths out allocation churn and covers hours with a small array
     */
-    if (HS_VerifyMsgLength(&BufPtr->Msg, ExpectedLength))
+    HS_CustomData.MemRssSum += Sample.RssKb;
+    HS_CustomData.MemIntervals++;
+
+    if (HS_CustomData.MemIntervals < HS_MEM_HISTORY_INTERVALS)
     {
-        HS_AppData.CmdCount++;
-        CmdPtr = ((HS_SetUtilDiagCmd_t *)BufPtr);
+        return;
+    }
 
-        HS_CustomData.UtilMask = CmdPtr->Mask;
-        CFE_EVS_SendEvent(HS_SET_UTIL_DIAG_DBG_EID, CFE_EVS_EventType_DEBUG,
-                          "Utilization Diagnostics Mask has been set to %08X", (unsigned int)HS_CustomData.UtilMask);
+    HS_CustomData.MemHistory[HS_CustomData.MemHistoryNext] =
+        (uint32)(HS_CustomData.MemRssSum / HS_CustomData.MemIntervals);
+    HS_CustomData.MemHistoryNext = (HS_CustomData.MemHistoryNext + 1) % HS_MEM_HISTORY_SIZE;
+    HS_CustomData.MemRssSum      = 0;
+    HS_CustomData.MemIntervals   = 0;
+
+    if (TlmPtr->HistoryUsed < HS_MEM_HISTORY_SIZE)
+    {
+        TlmPtr->HistoryUsed++;
+    }
+
+    if (TlmPtr->HistoryUsed < HS_MEM_HISTORY_SIZE)
+    {
+        return;
+    }
+
+    TlmPtr->RssGrowthKb = HS_MemHistoryGrowth();
+
+    if ((TlmPtr->AlarmMask & HS_MEM_ALARM_LEAK) != 0)
+    {
+        if (TlmPtr->RssGrowthKb < (HS_MEM_LEAK_GROWTH_KB / 2))
+        {
+            TlmPtr->AlarmMask &= ~HS_MEM_ALARM_LEAK;
+
+            if (HS_MEM_LEAK_ACTION != HS_ALARM_ACT_NOACT)
+            {
+                CFE_EVS_SendEvent(HS_MEM_CLEAR_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Memory Leak Cleared: RSS Growth = %d KiB/Sample", (int)TlmPtr->RssGrowthKb);
+            }
+        }
+    }
+    else if ((HS_MEM_LEAK_GROWTH_KB != 0) && (TlmPtr->RssGrowthKb >= HS_MEM_LEAK_GROWTH_KB))
+    {
+        TlmPtr->AlarmMask |= HS_MEM_ALARM_LEAK;
+        HS_MemAlarmAction(HS_MEM_ALARM_LEAK);
     }
 
     return;
 
-} /* end HS_SetUtilDiagCmd */
+} /* end HS_MemMonitor */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fit the Memory History Growth                                   */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_MemHistoryGrowth(void)
+{
+    const int64 NumSamples  = HS_MEM_HISTORY_SIZE;
+    int64       SumRss      = 0;
+    int64       SumWeighted = 0;
+    int64       Denom       = 0;
+    uint32      Age         = 0;
+    uint32      Index       = 0;
+
+    /*
+    ** The next sample to write is the oldest
+    */
+    for (Age = 0; Age < HS_MEM_HISTORY_SIZE; Age++)
+    {
+        Index = (HS_CustomData.MemHistoryNext + Age) % HS_MEM_HISTORY_SIZE;
+
+        SumRss += HS_CustomData.MemHistory[Index];
+        SumWeighted += (int64)Age * HS_CustomData.MemHistory[Index];
+    }
+
+    Denom = (NumSamples * NumSamples * ((NumSamples * NumSamples) - 1)) / 12;
+
+    return (int32)(((NumSamples * SumWeighted) - (((NumSamples * (NumSamples - 1)) / 2) * SumRss)) / Denom);
+
+} /* end HS_MemHistoryGrowth */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take a Memory Alarm Action                                      */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MemAlarmAction(uint32 Alarm)
+{
+    uint32 ActionType   = HS_MEM_LEAK_ACTION;
+    uint32 MsgActsIndex = 0;
+
+    if (Alarm == HS_MEM_ALARM_LOW_AVAIL)
+    {
+        ActionType = HS_MEM_LOW_ACTION;
+    }
+
+    switch (ActionType)
+    {
+        case HS_ALARM_ACT_NOACT:
+            break;
+
+        case HS_ALARM_ACT_EVENT:
+            if (Alarm == HS_MEM_ALARM_LOW_AVAIL)
+            {
+                CFE_EVS_SendEvent(HS_MEM_LOW_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Low Available Memory: Available = %u KiB: Action: Event Only",
+                                  (unsigned int)HS_CustomData.MemTlm.AvailKb);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HS_MEM_LEAK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Memory Leak Suspected: RSS = %u KiB, Growth = %d KiB/Sample: Action: Event Only",
+                                  (unsigned int)HS_CustomData.MemTlm.RssKb, (int)HS_CustomData.MemTlm.RssGrowthKb);
+            }
+            break;
+
+        /*
+        ** Message Action types processing (invalid will be skipped)
+        */
+        default:
+
+            /* Calculate the requested message action index */
+            MsgActsIndex = ActionType - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+            /*
+            ** Send the message if valid, off cooldown and not disabled
+            */
+            if (HS_ExecuteMsgAction(MsgActsIndex))
+            {
+                CFE_EVS_SendEvent(HS_MEM_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Memory Alarm 0x%02X Raised: Action: Message Action Index: %d", (unsigned int)Alarm,
+                                  (int)MsgActsIndex);
+            }
+
+            /* Otherwise, Take No Action */
+            break;
+    }
+
+    return;
+
+} /* end HS_MemAlarmAction */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the Memory Telemetry                                        */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MemGetStats(HS_MemTlm_t *TlmPtr)
+{
+    *TlmPtr = HS_CustomData.MemTlm;
+
+    return;
+
+} /* end HS_MemGetStats */
 
 /************************/
 /*  End of File Comment */
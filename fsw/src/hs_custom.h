@@ -29,12 +29,45 @@
  * Includes
  ************************************************************************/
 #include "cfe.h"
+#include "hs_msg.h"
+#include "hs_utils.h"
 
 /*************************************************************************
  * Constants
  ************************************************************************/
 #define HS_UTIL_DIAG_REPORTS 4
 
+#define HS_UTIL_CAL_FRAC_BITS 32           /**< \brief Fraction bits of the calibrated utilization scale */
+#define HS_UTIL_CAL_CDSNAME   "HS_CAL_CDS" /**< \brief Name of the utilization calibration CDS block */
+
+#define HS_UTIL_MARK_TIMER_NAME   "HS_UTIL_MARK"      /**< \brief Name of the utilization mark timer */
+#define HS_UTIL_MARK_PIPE_NAME    "HS_UTIL_MARK_PIPE" /**< \brief Name of the utilization mark message pipe */
+#define HS_UTIL_MARK_JITTER_SHIFT 3                   /**< \brief Mark jitter average smoothing, 1/2^n per mark */
+
+#define HS_PSI_PATH_CPU    "/proc/pressure/cpu"    /**< \brief Pressure stall file of #HS_PSI_RESOURCE_CPU */
+#define HS_PSI_PATH_MEMORY "/proc/pressure/memory" /**< \brief Pressure stall file of #HS_PSI_RESOURCE_MEMORY */
+#define HS_PSI_PATH_IO     "/proc/pressure/io"     /**< \brief Pressure stall file of #HS_PSI_RESOURCE_IO */
+
+/**
+ * \name CPU Utilization Backends
+ * \{
+ */
+#define HS_UTIL_BACKEND_IDLE_COUNT  0 /**< \brief Calibrated Idle Task loop count */
+#define HS_UTIL_BACKEND_PROC_STAT   1 /**< \brief /proc/stat tick deltas, no Idle Task */
+#define HS_UTIL_BACKEND_THREAD_TIME 2 /**< \brief CPU time consumed by the Idle Task */
+#define HS_UTIL_BACKEND_LAST        HS_UTIL_BACKEND_THREAD_TIME /**< \brief Highest valid backend */
+/**\}*/
+
+/**
+ * \name CPU Utilization Mark Sources
+ * \{
+ */
+#define HS_UTIL_MARK_SOURCE_TIME_SYNC 0 /**< \brief cFE TIME synchronization callback */
+#define HS_UTIL_MARK_SOURCE_TIMER     1 /**< \brief OSAL timer at #HS_UTIL_MARK_PERIOD_US */
+#define HS_UTIL_MARK_SOURCE_WAKEUP    2 /**< \brief Each HS wakeup */
+#define HS_UTIL_MARK_SOURCE_MESSAGE   3 /**< \brief Each #HS_UTIL_MARK_MID message */
+/**\}*/
+
 /**
  * \ingroup cfshscmdcodes
  *
@@ -123,6 +156,109 @@
  */
 #define HS_SET_UTIL_DIAG_CC 14
 
+/**
+ * \brief Set Core Utilization Calibration Parameters
+ *
+ *  \par Description
+ *       Sets the Utilization Calibration Parameters of a single core
+ *
+ *  \par Command Structure
+ *       #HS_SetCoreUtilParamsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - The #HS_SET_CORE_UTIL_PARAMS_DBG_EID debug event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Core is not less than #HS_UTIL_NUM_CORES
+ *       - Any parameter is set to 0.
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_SET_CORE_UTIL_PARAMS_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #HS_SET_UTIL_PARAMS_CC
+ */
+#define HS_SET_CORE_UTIL_PARAMS_CC 18
+
+/**
+ * \brief Set Utilization Backend
+ *
+ *  \par Description
+ *       Selects how CPU utilization is measured. Idle Tasks are started
+ *       or stopped as the new backend requires.
+ *
+ *  \par Command Structure
+ *       #HS_SetUtilBackendCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - The #HS_SET_UTIL_BACKEND_DBG_EID debug event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Backend is not a defined backend
+ *       - Backend is not available on this platform
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_UTIL_BACKEND_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_SET_UTIL_BACKEND_CC 19
+
+/**
+ * \brief Start Utilization Calibration
+ *
+ *  \par Description
+ *       Measures the peak Idle Task count per interval of each core over
+ *       the commanded number of intervals, then replaces the conversion
+ *       factors with a 64-bit fixed point scale computed from it. The
+ *       processor should be quiescent until the calibration completes.
+ *
+ *  \par Command Structure
+ *       #HS_StartUtilCalCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - The #HS_UTIL_CAL_START_INF_EID informational event message will be
+ *         generated when the command is executed
+ *       - The #HS_UTIL_CAL_DONE_INF_EID informational event message will be
+ *         generated for each core when the calibration completes
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Utilization backend is not #HS_UTIL_BACKEND_IDLE_COUNT
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_UTIL_CAL_ERR_EID
+ *
+ *  \par Criticality
+ *       Utilization is reported as 0 while calibrating if the
+ *       processor is busy, and the resulting factors will be too low.
+ *
+ *  \sa #HS_SET_UTIL_PARAMS_CC
+ */
+#define HS_START_UTIL_CAL_CC 21
+
 /**\}*/
 
 /**
@@ -203,208 +339,806 @@
  */
 #define HS_SET_UTIL_DIAG_DBG_EID 106
 
-/**\}*/
-
-/*************************************************************************
- * Command Structure Definitions
- ************************************************************************/
-
 /**
- * \ingroup cfshscmdstructs
- * \{
+ * \brief HS Idle Task Set Affinity Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when more than one core is monitored
+ *  and an Idle Task could not be pinned to its core. The utilization
+ *  reported for that core will not be accurate.
  */
+#define HS_IDLE_AFFINITY_ERR_EID 107
 
 /**
- * \brief Set Utilitiliztion Parameters Command
+ * \brief HS Set Core Utilization Parameters Command Event ID
  *
- * See #HS_SET_UTIL_PARAMS_CC
+ *  \par Type: Debug
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFS Health and Safety successfully processes the
+ *  #HS_SET_CORE_UTIL_PARAMS_CC command.
  */
-typedef struct
-{
-    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
-
-    int32 Mult1; /**< \brief Multiplier 1 parameter */
-    int32 Div;   /**< \brief Divisior parameter */
-    int32 Mult2; /**< \brief Multiplier 2 parameter */
-} HS_SetUtilParamsCmd_t;
+#define HS_SET_CORE_UTIL_PARAMS_DBG_EID 108
 
 /**
- * \brief Set Utilization Diagnostics Command
+ * \brief HS Set Core Utilization Parameters Error Event ID
  *
- * See #HS_SET_UTIL_DIAG_CC
+ *  \par Type: Error
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFS Health and Safety fails to process the #HS_SET_CORE_UTIL_PARAMS_CC
+ *  command due to an invalid core or a 0 as at least one of the parameters.
  */
-typedef struct
-{
-    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
-
-    uint32 Mask; /**< \brief Utilization Diagnostics Mask */
-} HS_SetUtilDiagCmd_t;
-
-/**\}*/
-
-/*************************************************************************
- * Custom Global Data Structure
- *************************************************************************/
+#define HS_SET_CORE_UTIL_PARAMS_ERR_EID 109
 
 /**
- * \brief HS custom global structure
+ * \brief HS Set Utilization Backend Command Event ID
+ *
+ *  \par Type: Debug
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CFS Health and Safety successfully processes the #HS_SET_UTIL_BACKEND_CC
+ *  command.
  */
-typedef struct
-{
-    int32 UtilMult1; /**< \brief CPU Utilization Conversion Factor Multiplication 1 */
-    int32 UtilDiv;   /**< \brief CPU Utilization Conversion Factor Division */
-    int32 UtilMult2; /**< \brief CPU Utilization Conversion Factor Multiplication 2 */
-
-    uint32 UtilMask;                                  /**< \brief Mask for determining Idle Tick length */
-    uint32 UtilArrayIndex;                            /**< \brief Index for determining where to write in Util Array */
-    uint32 UtilArrayMask;                             /**< \brief Mask for determining where to write in Util Array */
-    uint32 UtilArray[HS_UTIL_TIME_DIAG_ARRAY_LENGTH]; /**< \brief Array to store time stamps for determining idle tick
-                                                         length */
-
-    uint32 ThisIdleTaskExec;     /**< \brief Idle Task Exec Counter */
-    uint32 LastIdleTaskExec;     /**< \brief Idle Task Exec Counter at Previous Interval */
-    uint32 LastIdleTaskInterval; /**< \brief Idle Task Increments during Previous Interval */
-    uint32 UtilCycleCounter;     /**< \brief Counter to determine when to monitor utilization */
-
-    int32 UtilCallsPerMark; /**< \brief CPU Utilization Calls per mark */
-
-    int32           IdleTaskRunStatus; /**< \brief HS Idle Task Run Status */
-    CFE_ES_TaskId_t IdleTaskID;        /**< \brief HS Idle Task Task ID */
-
-} HS_CustomData_t;
+#define HS_SET_UTIL_BACKEND_DBG_EID 110
 
 /**
- * \brief HS custom global
+ * \brief HS Utilization Backend Error Event ID
+ *
+ *  \par Type: Error
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when an undefined utilization backend is commanded, or when the
+ *  selected backend is not available on this platform. At startup HS then falls back to
+ *  #HS_UTIL_BACKEND_IDLE_COUNT, on command the previous backend is kept.
  */
-extern HS_CustomData_t HS_CustomData;
-
-/*************************************************************************
- * Exported Functions
- *************************************************************************/
+#define HS_UTIL_BACKEND_ERR_EID 111
 
 /**
- * \brief Initialize things needed for CPU Monitoring
+ * \brief HS Utilization Sample Error Event ID
  *
- *  \par Description
- *       This function is intended to set up everything necessary for
- *       CPU Utilization Monitoring at application startup. Currently,
- *       this initializes the Idle Task, spawning the task itself,
- *       and creating a 1Hz sync callback to mark the idle time.
- *       It is called at the end of #HS_AppInit .
- *       It may be updated to include other initializations, or
- *       modifications to already set parameters.
+ *  \par Type: Error
  *
- *  \par Assumptions, External Events, and Notes:
- *       CFE_SUCCESS will be returned if all creation was performed
- *       properly.
+ *  \par Cause:
  *
- *  \return Execution status, see \ref CFEReturnCodes
- *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *  This event message is issued when the utilization backend fails to sample the CPU times. It is
+ *  only issued again after a successful sample.
  */
-int32 HS_CustomInit(void);
+#define HS_UTIL_SAMPLE_ERR_EID 112
 
 /**
- * \brief Clean up the functionality used for Utilization Monitoring
+ * \brief HS Utilization Calibration Started Event ID
  *
- *  \par Description
- *       This function is intended to clean up everything necessary for
- *       CPU Utilization Monitoring at application termination. Currently,
- *       this terminates the Idle Task, deleting the task itself,
- *       and uncreating the 1Hz sync callback that marks the idle time.
- *       It is called at the end of #HS_AppMain if HS is exiting cleanly.
+ *  \par Type: INFORMATION
  *
- *  \par Assumptions, External Events, and Notes:
- *       Any resources that will not be cleaned up automatically be CFE
- *       need to be cleaned up in this function.
+ *  \par Cause:
+ *
+ *  This event message is issued when a utilization calibration is started, either by the
+ *  #HS_START_UTIL_CAL_CC command or at startup.
  */
-void HS_CustomCleanup(void);
+#define HS_UTIL_CAL_START_INF_EID 113
 
 /**
- * \brief Stub function for Utilization Monitoring
+ * \brief HS Utilization Calibration Error Event ID
  *
- *  \par Description
- *       This function is used as a passthrough to call #HS_MonitorUtilization
- *       but can be modified to monitor utilization differently.
- *       It is called during #HS_ProcessMain every HS cycle.
+ *  \par Type: Error
  *
- *  \par Assumptions, External Events, and Notes:
- *       None
+ *  \par Cause:
+ *
+ *  This event message is issued when a utilization calibration is commanded while the backend does
+ *  not use the Idle Task count, or when no Idle Task count was measured for a core during a
+ *  calibration. In the latter case the previous factors of that core are kept.
  */
-void HS_CustomMonitorUtilization(void);
+#define HS_UTIL_CAL_ERR_EID 114
 
 /**
- * \brief Stub function for Getting the Current Cycle Utilization
+ * \brief HS Utilization Calibration Done Event ID
  *
- *  \par Description
- *       This function is used to inform the Monitor Utilization function
- *       of the current cycle utilization.
- *       It is called during #HS_MonitorUtilization and should return a
- *       value between 0 and #HS_UTIL_PER_INTERVAL_TOTAL.
+ *  \par Type: INFORMATION
  *
- *  \par Assumptions, External Events, and Notes:
- *       None
+ *  \par Cause:
  *
- *  \return Current cycle utilization
+ *  This event message is issued for each core when a utilization calibration completes, and
+ *  reports the calibrated Idle Task count per interval and the resulting scale.
  */
-int32 HS_CustomGetUtil(void);
+#define HS_UTIL_CAL_DONE_INF_EID 115
 
 /**
- * \brief Process Custom Commands
- *
- *  \par Description
- *       This function allows for hs_custom.c to define custom commands.
- *       It will be called for any command code not already allocated
- *       to a Health and Safety command. If a custom command is found,
- *       then it is responsible for incrementing the command processed
- *       or command error counter as appropriate.
+ * \brief HS Utilization Calibration CDS Error Event ID
  *
- *  \par Assumptions, External Events, and Notes:
- *       If a command is found, this function MUST return #CFE_SUCCESS,
- *       otherwise is must not return #CFE_SUCCESS
+ *  \par Type: Error
  *
- *  \param[in] BufPtr Pointer to Software Bus buffer
+ *  \par Cause:
  *
- *  \return Execution status, see \ref CFEReturnCodes
- *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *  This event message is issued when the utilization calibration CDS block can't be created or
+ *  restored, or holds corrupt data. Calibrations are then not saved, or not restored.
  */
-int32 HS_CustomCommands(const CFE_SB_Buffer_t *BufPtr);
+#define HS_UTIL_CAL_CDS_ERR_EID 116
 
 /**
- * \brief Task that increments counters
+ * \brief HS Utilization Mark Source Error Event ID
  *
- *  \par Description
- *       This child task is started by the HS initialization process. It
- *       runs at the lowest priority on the system, incrementing a counter
- *       when all other tasks are idle. This counter is used to determine
- *       CPU Hogging (by being non-zero each cycle) and Utilization.
+ *  \par Type: ERROR
  *
- *  \par Assumptions, External Events, and Notes:
- *       None
+ *  \par Cause:
+ *
+ *  This event message is issued when the configured #HS_UTIL_MARK_SOURCE can't be started.
+ *  Utilization is then marked by the cFE TIME synchronization callback instead.
  */
-void HS_IdleTask(void);
+#define HS_UTIL_MARK_SOURCE_ERR_EID 117
 
 /**
- * \brief Increment the CPU Utilization Tracker Counter
+ * \brief HS Pressure Stall Unavailable Event ID
  *
- *  \par Description
- *       Utility function that increments the CPU Utilization tracking
- *       counter, called by Idle Task. This counter is used to determine
- *       both utilization and CPU Hogging.
+ *  \par Type: INFORMATION
  *
- *  \par Assumptions, External Events, and Notes:
- *       None
+ *  \par Cause:
  *
- *  \sa #HS_UtilizationMark
+ *  This event message is issued at startup when pressure stall information can't be read for
+ *  one or more resources, such as on kernels built without it. Those resources are not monitored.
  */
-void HS_UtilizationIncrement(void);
+#define HS_PSI_UNAVAILABLE_INF_EID 136
 
 /**
- * \brief Mark the CPU Utilization Tracker Counter
+ * \brief HS Pressure Stall Level Entered Event ID
  *
- *  \par Description
- *       Utility function that marks the CPU Utilization tracking
- *       counter while saving the previous value to a variable for use in
- *       calculating CPU Utilization and hogging.
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the 10 second stall share of a resource has been at or
+ *  above its #HS_PSI_LEVEL_DEFAULTS enter threshold for the dwell intervals.
+ */
+#define HS_PSI_ENTER_ERR_EID 137
+
+/**
+ * \brief HS Pressure Stall Level Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a pressure stall level is entered and its message
+ *  action is sent.
+ */
+#define HS_PSI_MSGACTS_ERR_EID 138
+
+/**
+ * \brief HS Pressure Stall Level Cleared Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the 10 second stall share of a resource falls below the
+ *  exit threshold of its active pressure stall level.
+ */
+#define HS_PSI_EXIT_INF_EID 139
+
+/**
+ * \brief HS Pressure Stall Read Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued the first time pressure stall information of a monitored
+ *  resource can't be read. It is issued again only after a read has succeeded.
+ */
+#define HS_PSI_READ_ERR_EID 140
+
+/**
+ * \brief HS Memory Monitor Unavailable Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued at startup when the memory sizes can't be read, such as on
+ *  platforms other than Linux. Memory is then not monitored.
+ */
+#define HS_MEM_UNAVAILABLE_INF_EID 152
+
+/**
+ * \brief HS Low Available Memory Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when available system memory reaches #HS_MEM_LOW_AVAIL_KB
+ *  and #HS_MEM_LOW_ACTION is event only.
+ */
+#define HS_MEM_LOW_ERR_EID 153
+
+/**
+ * \brief HS Memory Leak Suspected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the fitted resident set size growth of the cFS process
+ *  reaches #HS_MEM_LEAK_GROWTH_KB per memory history sample and #HS_MEM_LEAK_ACTION is
+ *  event only.
+ */
+#define HS_MEM_LEAK_ERR_EID 154
+
+/**
+ * \brief HS Memory Alarm Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a memory alarm is raised and its message action is sent.
+ */
+#define HS_MEM_MSGACTS_ERR_EID 155
+
+/**
+ * \brief HS Memory Alarm Cleared Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when available memory is back above twice
+ *  #HS_MEM_LOW_AVAIL_KB, or the resident set size growth falls below half of
+ *  #HS_MEM_LEAK_GROWTH_KB, after the alarm was raised.
+ */
+#define HS_MEM_CLEAR_INF_EID 156
+
+/**
+ * \brief HS Memory Read Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued the first time the memory sizes can't be read. It is issued
+ *  again only after a read has succeeded.
+ */
+#define HS_MEM_READ_ERR_EID 157
+
+/**\}*/
+
+/*************************************************************************
+ * Command Structure Definitions
+ ************************************************************************/
+
+/**
+ * \ingroup cfshscmdstructs
+ * \{
+ */
+
+/**
+ * \brief Set Utilitiliztion Parameters Command
+ *
+ * See #HS_SET_UTIL_PARAMS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    int32 Mult1; /**< \brief Multiplier 1 parameter */
+    int32 Div;   /**< \brief Divisior parameter */
+    int32 Mult2; /**< \brief Multiplier 2 parameter */
+} HS_SetUtilParamsCmd_t;
+
+/**
+ * \brief Set Utilization Diagnostics Command
+ *
+ * See #HS_SET_UTIL_DIAG_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32 Mask; /**< \brief Utilization Diagnostics Mask */
+} HS_SetUtilDiagCmd_t;
+
+/**
+ * \brief Set Core Utilization Parameters Command
+ *
+ * See #HS_SET_CORE_UTIL_PARAMS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32 Core;  /**< \brief Core to calibrate */
+    int32  Mult1; /**< \brief Multiplier 1 parameter */
+    int32  Div;   /**< \brief Divisior parameter */
+    int32  Mult2; /**< \brief Multiplier 2 parameter */
+} HS_SetCoreUtilParamsCmd_t;
+
+/**
+ * \brief Set Utilization Backend Command
+ *
+ * See #HS_SET_UTIL_BACKEND_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32 Backend; /**< \brief Utilization backend, see \ref HS_UTIL_BACKEND_IDLE_COUNT */
+} HS_SetUtilBackendCmd_t;
+
+/**
+ * \brief Start Utilization Calibration Command
+ *
+ * See #HS_START_UTIL_CAL_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint16 NumIntervals; /**< \brief Intervals to calibrate over, 0 for #HS_UTIL_CAL_DEFAULT_INTERVALS */
+    uint8  SaveToCDS;    /**< \brief Save the result to the CDS when not 0 */
+    uint8  TrackPeak;    /**< \brief Keep raising the calibration to higher idle counts when not 0 */
+} HS_StartUtilCalCmd_t;
+
+/**\}*/
+
+/**
+ * \ingroup cfshstlm
+ * \{
+ */
+
+/**
+ *  \brief Utilization Diagnostics Entry
+ */
+typedef struct
+{
+    uint64 Value;   /**< \brief Nanoseconds between two idle time marks */
+    uint32 Count;   /**< \brief Number of marks separated by Value */
+    uint32 Padding; /**< \brief Structure padding */
+} HS_UtilDiagEntry_t;
+
+/**
+ *  \brief Utilization Diagnostics Payload
+ */
+typedef struct
+{
+    uint32 Mask;          /**< \brief Utilization Diagnostics Mask in use */
+    uint32 NumSamples;    /**< \brief Number of time deltas counted */
+    uint32 NumValues;     /**< \brief Number of distinct time deltas */
+    uint32 NumEntries;    /**< \brief Number of valid entries */
+    uint32 OverflowCount; /**< \brief Number of time deltas not reported because the entries are full */
+    uint32 Padding;       /**< \brief Structure padding */
+
+    HS_UtilDiagEntry_t Entries[HS_UTIL_DIAG_MAX_VALUES]; /**< \brief Distinct time deltas, lowest first */
+} HS_UtilDiagPayload_t;
+
+/**
+ *  \brief Utilization Diagnostics Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry Header */
+    HS_UtilDiagPayload_t      Payload;   /**< \brief Time delta distribution */
+} HS_UtilDiagPkt_t;
+
+/**\}*/
+
+/*************************************************************************
+ * Custom Global Data Structure
+ *************************************************************************/
+
+/**
+ * \brief HS utilization calibration CDS structure
+ */
+typedef struct
+{
+    uint32 IdleRate[HS_UTIL_NUM_CORES];    /**< \brief Calibrated Idle Task count per interval, 0 if none */
+    uint32 IdleRateNot[HS_UTIL_NUM_CORES]; /**< \brief Inverse of IdleRate, for validation */
+} HS_UtilCalCDSData_t;
+
+/**
+ * \brief HS custom per core structure
+ *
+ * The Idle Task counter is alone on the first cache line, so its
+ * increments don't evict the fields read by the other tasks.
+ */
+typedef struct
+{
+    uint32 ThisIdleTaskExec;                                 /**< \brief Idle Task Exec Counter, Idle Task only */
+    uint8  ExecPadding[HS_CACHE_LINE_SIZE - sizeof(uint32)]; /**< \brief Fills the counter cache line */
+
+    int32 UtilMult1; /**< \brief CPU Utilization Conversion Factor Multiplication 1 */
+    int32 UtilDiv;   /**< \brief CPU Utilization Conversion Factor Division */
+    int32 UtilMult2; /**< \brief CPU Utilization Conversion Factor Multiplication 2 */
+
+    uint32 LastIdleTaskExec;     /**< \brief Idle Task Exec Counter at Previous Interval, callback only */
+    uint32 LastIdleTaskInterval; /**< \brief Idle Task Increments during Previous Interval */
+
+    CFE_ES_TaskId_t IdleTaskID; /**< \brief HS Idle Task Task ID */
+
+    int32  SampledUtil;     /**< \brief Utilization of the previous interval from a sampling backend */
+    uint64 LastBusyTime;    /**< \brief Busy ticks at the previous /proc/stat sample */
+    uint64 LastTotalTime;   /**< \brief Total ticks at the previous /proc/stat sample */
+    uint64 LastIdleCpuTime; /**< \brief Idle Task CPU time in ns at the previous sample */
+    int32  IdleClockId;     /**< \brief CPU time clock of the Idle Task */
+    bool   IdleClockValid;  /**< \brief Whether IdleClockId has been set, published after it by the Idle Task */
+
+    uint32 CalIdleRate; /**< \brief Calibrated Idle Task count per interval */
+    uint32 CalPeak;     /**< \brief Peak Idle Task count of the calibration in progress */
+    uint64 UtilScale;   /**< \brief Utils per idle count in fixed point, 0 if not calibrated */
+} HS_CACHE_ALIGNED HS_CustomCoreData_t;
+
+/**
+ *  \brief Pressure Stall Level
+ *
+ *  A level is entered once the 10 second "some" stall share has been at
+ *  or above EnterAvg10 for DwellIntervals consecutive utilization
+ *  intervals, and is left when it falls below ExitAvg10
+ */
+typedef struct
+{
+    uint32 EnterAvg10;     /**< \brief Stall share in hundredths of a percent at or above which to enter */
+    uint32 ExitAvg10;      /**< \brief Stall share in hundredths of a percent below which to leave */
+    uint16 DwellIntervals; /**< \brief Consecutive intervals at or above EnterAvg10 before entering */
+    uint16 ActionType;     /**< \brief Action taken when entered, see #HS_ALARM_ACT_EVENT */
+} HS_PsiLevel_t;
+
+/**
+ * \brief HS custom global structure
+ *
+ * Fields are grouped by the task that writes them, each group starting
+ * on its own cache line.
+ */
+typedef struct
+{
+    HS_CustomCoreData_t Core[HS_UTIL_NUM_CORES]; /**< \brief Idle Task counters and calibration by core */
+
+    /* Read by the Idle Tasks on every iteration, rarely written */
+    int32  IdleTaskRunStatus HS_CACHE_ALIGNED; /**< \brief HS Idle Task Run Status */
+    uint32 UtilMask;                           /**< \brief Mask for determining Idle Tick length */
+    uint32 UtilArrayMask;                      /**< \brief Mask for determining where to write in Util Array */
+
+    /* Written by the first Idle Task */
+    uint32 UtilArrayIndex HS_CACHE_ALIGNED;           /**< \brief Index for determining where to write in Util Array */
+    uint64 UtilArray[HS_UTIL_TIME_DIAG_ARRAY_LENGTH]; /**< \brief Monotonic time stamps in ns for determining idle tick
+                                                         length */
+
+    /* Written by the utilization mark source */
+    uint32 MarkCycleCount HS_CACHE_ALIGNED; /**< \brief Callbacks since the last utilization mark */
+    int32  UtilCallsPerMark;                /**< \brief CPU Utilization Calls per mark */
+    uint32 MarkCount;                       /**< \brief Number of utilization marks */
+    uint32 MarkJitterAvg;                   /**< \brief Smoothed mark interval jitter in ns */
+    uint32 MarkJitterMax;                   /**< \brief Largest mark interval jitter in ns since last read */
+    uint64 LastMarkTime;                    /**< \brief Monotonic time in ns of the previous mark */
+
+    /* Written by the main task */
+    uint32 UtilCycleCounter HS_CACHE_ALIGNED; /**< \brief Counter to determine when to monitor utilization */
+
+    uint64 UtilDiagDeltas[HS_UTIL_TIME_DIAG_ARRAY_LENGTH]; /**< \brief Work array of sorted time stamp deltas */
+
+    HS_UtilDiagPkt_t UtilDiagPacket; /**< \brief Utilization diagnostics packet */
+
+    uint32          MarkSource;  /**< \brief Active utilization mark source */
+    osal_id_t       MarkTimerId; /**< \brief Timer of the #HS_UTIL_MARK_SOURCE_TIMER mark source */
+    CFE_SB_PipeId_t MarkPipe;    /**< \brief Pipe of the #HS_UTIL_MARK_SOURCE_MESSAGE mark source */
+
+    uint32 UtilBackend;           /**< \brief Active utilization backend */
+    uint32 UtilSampleErrCount;    /**< \brief Count of failed backend samples */
+    bool   UtilSampleErrReported; /**< \brief Whether the current run of sample failures was reported */
+    uint64 LastSampleTime;        /**< \brief Monotonic time in ns of the previous backend sample */
+
+    uint32              CalIntervalsLeft; /**< \brief Intervals left in the calibration in progress */
+    bool                CalSaveToCDS;     /**< \brief Whether the calibration in progress is saved to the CDS */
+    bool                CalTrackPeak;     /**< \brief Whether higher idle counts raise the calibration */
+    bool                CalCDSValid;      /**< \brief Whether the calibration CDS block can be used */
+    CFE_ES_CDSHandle_t  CalCDSHandle;     /**< \brief Handle to the calibration CDS block */
+    HS_UtilCalCDSData_t CalCDSData;       /**< \brief Copy of the calibration CDS block */
+
+    uint32         PsiAvailableMask;                /**< \brief Bit N set when resource N is monitored */
+    uint32         PsiActiveMask;                   /**< \brief Bit N set while resource N is above its level */
+    uint32         PsiErrReportedMask;              /**< \brief Bit N set when a read failure was reported */
+    uint32         PsiDwell[HS_PSI_NUM_RESOURCES];  /**< \brief Intervals at or above the enter threshold */
+    HS_PsiSample_t PsiLast[HS_PSI_NUM_RESOURCES];   /**< \brief Previous pressure stall samples */
+    HS_PsiTlm_t    PsiTlm[HS_PSI_NUM_RESOURCES];    /**< \brief Pressure stall telemetry of the last interval */
+    HS_PsiLevel_t  PsiLevels[HS_PSI_NUM_RESOURCES]; /**< \brief Pressure stall level settings */
+
+    bool        MemMonitored;                    /**< \brief Whether the memory sizes can be read */
+    bool        MemErrReported;                  /**< \brief Whether a read failure was reported */
+    uint32      MemHistory[HS_MEM_HISTORY_SIZE]; /**< \brief Average resident set size in KiB per history sample */
+    uint32      MemHistoryNext;                  /**< \brief Index of the next history sample to write */
+    uint32      MemIntervals;                    /**< \brief Intervals summed into MemRssSum */
+    uint64      MemRssSum;                       /**< \brief Sum of resident set sizes of the history sample */
+    HS_MemTlm_t MemTlm;                          /**< \brief Memory telemetry */
+
+} HS_CustomData_t;
+
+/**
+ * \brief HS custom global
+ */
+extern HS_CustomData_t HS_CustomData;
+
+/**
+ * \brief Pressure stall file of each resource
+ */
+extern const char *const HS_PsiPaths[HS_PSI_NUM_RESOURCES];
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize things needed for CPU Monitoring
+ *
+ *  \par Description
+ *       This function is intended to set up everything necessary for
+ *       CPU Utilization Monitoring at application startup. Currently,
+ *       this initializes the Idle Task, spawning the task itself,
+ *       and creating a 1Hz sync callback to mark the idle time.
+ *       It is called at the end of #HS_AppInit .
+ *       It may be updated to include other initializations, or
+ *       modifications to already set parameters.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       CFE_SUCCESS will be returned if all creation was performed
+ *       properly.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_CustomInit(void);
+
+/**
+ * \brief Start the Idle Tasks
+ *
+ *  \par Description
+ *       Creates one Idle Task per monitored core.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_CustomStartIdleTasks(void);
+
+/**
+ * \brief Stop the Idle Tasks
+ *
+ *  \par Description
+ *       Stops and deletes the Idle Tasks of all monitored cores.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_CustomStopIdleTasks(void);
+
+/**
+ * \brief Start the Active Utilization Backend
+ *
+ *  \par Description
+ *       Checks that the active utilization backend is available on this
+ *       platform, clears its sample history, and starts the Idle Tasks
+ *       if the backend uses them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Any Idle Tasks of a previous backend must already be stopped.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_UtilBackendStart(void);
+
+/**
+ * \brief Check if a Utilization Backend uses the Idle Tasks
+ *
+ *  \par Description
+ *       Reports whether the given backend needs the Idle Tasks running.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Backend Utilization backend
+ *
+ *  \return Boolean Idle Task use
+ *  \retval true  Backend uses the Idle Tasks
+ *  \retval false Backend does not use the Idle Tasks
+ */
+bool HS_UtilBackendUsesIdleTask(uint32 Backend);
+
+/**
+ * \brief Sample the CPU Times of the Active Utilization Backend
+ *
+ *  \par Description
+ *       Computes the utilization of each core over the interval since
+ *       the previous sample, for backends that measure elapsed CPU time
+ *       directly. It is called by #HS_CustomMonitorUtilization at the
+ *       end of each utilization interval.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The Idle Task count backend is marked by #HS_UtilizationMark
+ *       instead and is not sampled here.
+ */
+void HS_UtilBackendSample(void);
+
+/**
+ * \brief Sample Utilization from /proc/stat
+ *
+ *  \par Description
+ *       Computes the utilization of each core from the busy and total
+ *       tick deltas since the previous sample.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The first sample after the backend starts only sets the baseline.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_UtilSampleProcStat(void);
+
+/**
+ * \brief Sample Utilization from Idle Task CPU Time
+ *
+ *  \par Description
+ *       Computes the utilization of each core from the CPU time its Idle
+ *       Task consumed since the previous sample, relative to the elapsed
+ *       time. No calibration is needed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The Idle Tasks must run below all other tasks under a strict
+ *       priority scheduler; under a time sharing scheduler they are given
+ *       CPU time even when other tasks are runnable.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_UtilSampleThreadTime(void);
+
+/**
+ * \brief Clean up the functionality used for Utilization Monitoring
+ *
+ *  \par Description
+ *       This function is intended to clean up everything necessary for
+ *       CPU Utilization Monitoring at application termination. Currently,
+ *       this terminates the Idle Task, deleting the task itself,
+ *       and uncreating the 1Hz sync callback that marks the idle time.
+ *       It is called at the end of #HS_AppMain if HS is exiting cleanly.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Any resources that will not be cleaned up automatically be CFE
+ *       need to be cleaned up in this function.
+ */
+void HS_CustomCleanup(void);
+
+/**
+ * \brief Stub function for Utilization Monitoring
+ *
+ *  \par Description
+ *       This function is used as a passthrough to call #HS_MonitorUtilization
+ *       but can be modified to monitor utilization differently.
+ *       It is called during #HS_ProcessMain every HS cycle.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_CustomMonitorUtilization(void);
+
+/**
+ * \brief Stub function for Getting the Current Cycle Utilization
+ *
+ *  \par Description
+ *       This function is used to inform the Monitor Utilization function
+ *       of the current cycle utilization.
+ *       It is called during #HS_MonitorUtilization and should return a
+ *       value between 0 and #HS_UTIL_PER_INTERVAL_TOTAL.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       When more than one core is monitored, this is the average of
+ *       the utilization of all cores.
+ *
+ *  \return Current cycle utilization
+ */
+int32 HS_CustomGetUtil(void);
+
+/**
+ * \brief Stub function for Getting the Current Cycle Utilization of a Core
+ *
+ *  \par Description
+ *       This function is used to inform the Monitor Utilization function
+ *       of the current cycle utilization of a single core.
+ *       It is called during #HS_MonitorUtilization for each core and
+ *       should return a value between 0 and #HS_UTIL_PER_INTERVAL_TOTAL.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] CoreIndex Core to report, less than #HS_UTIL_NUM_CORES
+ *
+ *  \return Current cycle utilization of the core
+ */
+int32 HS_CustomGetCoreUtil(uint32 CoreIndex);
+
+/**
+ * \brief Process Custom Commands
+ *
+ *  \par Description
+ *       This function allows for hs_custom.c to define custom commands.
+ *       It will be called for any command code not already allocated
+ *       to a Health and Safety command. If a custom command is found,
+ *       then it is responsible for incrementing the command processed
+ *       or command error counter as appropriate.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       If a command is found, this function MUST return #CFE_SUCCESS,
+ *       otherwise is must not return #CFE_SUCCESS
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_CustomCommands(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Task that increments counters
+ *
+ *  \par Description
+ *       This child task is started by the HS initialization process. It
+ *       runs at the lowest priority on the system, incrementing a counter
+ *       when all other tasks are idle. This counter is used to determine
+ *       CPU Hogging (by being non-zero each cycle) and Utilization.
+ *       One Idle Task runs per monitored core; when more than one core
+ *       is monitored each task pins itself to its core.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_IdleTask(void);
+
+/**
+ * \brief Find the core of the calling Idle Task
+ *
+ *  \par Description
+ *       Matches the task ID of the caller against the Idle Task IDs
+ *       recorded by #HS_CustomInit, waiting for the ID to be recorded
+ *       if the task started before its creation call returned.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called only from an Idle Task.
+ *
+ *  \return Core index of the calling Idle Task, or #HS_UTIL_NUM_CORES
+ *          if the Idle Tasks are stopped before a match is found
+ */
+uint32 HS_IdleTaskCoreIndex(void);
+
+/**
+ * \brief Increment the CPU Utilization Tracker Counter
+ *
+ *  \par Description
+ *       Utility function that increments the CPU Utilization tracking
+ *       counter of a core, called by the Idle Task of that core. This
+ *       counter is used to determine both utilization and CPU Hogging.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] CoreIndex Core of the calling Idle Task
+ *
+ *  \sa #HS_UtilizationMark
+ */
+void HS_UtilizationIncrement(uint32 CoreIndex);
+
+/**
+ * \brief Mark the CPU Utilization Tracker Counter
+ *
+ *  \par Description
+ *       Utility function that marks the CPU Utilization tracking
+ *       counter while saving the previous value to a variable for use in
+ *       calculating CPU Utilization and hogging.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
@@ -413,6 +1147,98 @@ void HS_UtilizationIncrement(void);
  */
 void HS_UtilizationMark(void);
 
+/**
+ * \brief Start the utilization mark source
+ *
+ *  \par Description
+ *       Starts marking utilization intervals from the source in
+ *       HS_CustomData.MarkSource: registers the time synchronization
+ *       callback, creates and arms the mark timer, or creates the mark
+ *       pipe and subscribes it to #HS_UTIL_MARK_MID. The wakeup source
+ *       needs no setup.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_UtilMarkStart(void);
+
+/**
+ * \brief Stop the utilization mark source
+ *
+ *  \par Description
+ *       Undoes #HS_UtilMarkStart for the active mark source.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_UtilMarkStop(void);
+
+/**
+ * \brief Record the jitter of a utilization mark interval
+ *
+ *  \par Description
+ *       Compares a measured mark interval with #HS_UTIL_MARK_PERIOD_US
+ *       and folds the difference into the smoothed and largest mark
+ *       jitter.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called from #HS_UtilizationMark in the context of the mark source.
+ *
+ *  \param[in] Interval Nanoseconds since the previous mark
+ */
+void HS_UtilMarkJitter(uint64 Interval);
+
+/**
+ * \brief Get the utilization mark statistics
+ *
+ *  \par Description
+ *       Reports the active mark source, the number of marks and the
+ *       smoothed and largest mark jitter in microseconds, then restarts
+ *       the largest jitter for the next report.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A mark landing between reading and restarting the largest jitter
+ *       is not counted in it.
+ *
+ *  \param[out] Source    Active mark source, see \ref HS_UTIL_MARK_SOURCE_TIME_SYNC
+ *  \param[out] Count     Number of marks
+ *  \param[out] JitterAvg Smoothed mark jitter in microseconds
+ *  \param[out] JitterMax Largest mark jitter in microseconds since the last call
+ */
+void HS_UtilMarkGetStats(uint32 *Source, uint32 *Count, uint32 *JitterAvg, uint32 *JitterMax);
+
+/**
+ * \brief Mark utilization from the mark pipe
+ *
+ *  \par Description
+ *       Drains the #HS_UTIL_MARK_MID messages queued on the mark pipe
+ *       without blocking and marks utilization once if there were any.
+ *       It is called by #HS_CustomMonitorUtilization every HS cycle
+ *       while the active mark source is #HS_UTIL_MARK_SOURCE_MESSAGE.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Marks are taken at the HS cycle, so messages faster than the
+ *       HS wakeup are merged into one mark per cycle.
+ */
+void HS_CustomMarkPoll(void);
+
+/**
+ * \brief Mark Idle Time Callback from an OSAL Timer
+ *
+ *  \par Description
+ *       This function marks the idle time when the utilization mark
+ *       source is #HS_UTIL_MARK_SOURCE_TIMER.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] TimerId Mark timer
+ */
+void HS_MarkTimerCallback(osal_id_t TimerId);
+
 /**
  * \brief Mark Idle Time Callback from Time App
  *
@@ -428,18 +1254,55 @@ void HS_MarkIdleCallback(void);
  * \brief Report Utilization Diagnostics information
  *
  *  \par Description
- *       This function reports the Utilization Diagnostics data.
+ *       This function reports the Utilization Diagnostics data. The
+ *       deltas between the time stamps in the diagnostics array are
+ *       sorted and counted; the lowest #HS_UTIL_DIAG_REPORTS are sent
+ *       in an event and the lowest #HS_UTIL_DIAG_MAX_VALUES in the
+ *       utilization diagnostics packet.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
  */
 void HS_UtilDiagReport(void);
 
+/**
+ * \brief Sort Utilization Diagnostics Values
+ *
+ *  \par Description
+ *       Sorts an array of time deltas in ascending order, in place. A
+ *       heap sort is used so the time taken is bounded by O(n log n)
+ *       whatever the input, with no recursion or extra memory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in,out] Values Array to sort
+ *  \param[in]     Count  Number of elements in Values
+ */
+void HS_UtilDiagSort(uint64 *Values, uint32 Count);
+
+/**
+ * \brief Sift Down a Utilization Diagnostics Heap
+ *
+ *  \par Description
+ *       Moves the element at Root down the max heap held in the first
+ *       Count elements of Values until both of its children are no
+ *       greater than it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in,out] Values Array holding the heap
+ *  \param[in]     Root   Index of the element to sift down
+ *  \param[in]     Count  Number of elements in the heap
+ */
+void HS_UtilDiagSiftDown(uint64 *Values, uint32 Root, uint32 Count);
+
 /**
  * \brief Set Utilization Paramters
  *
  *  \par Description
- *       This function sets the Utilization Parameters.
+ *       This function sets the Utilization Parameters of all cores.
  *
  *  \par Assumptions, External Events, and Notes:
  *       None
@@ -461,4 +1324,230 @@ void HS_SetUtilParamsCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 void HS_SetUtilDiagCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Set Core Utilization Paramters
+ *
+ *  \par Description
+ *       This function sets the Utilization Parameters of a single core.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ */
+void HS_SetCoreUtilParamsCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Set Utilization Backend
+ *
+ *  \par Description
+ *       This function selects the utilization backend, stopping and
+ *       starting the Idle Tasks as needed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       If the new backend is not available the previous one is restarted.
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ */
+void HS_SetUtilBackendCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Start Utilization Calibration Command
+ *
+ *  \par Description
+ *       Starts a utilization calibration, see #HS_START_UTIL_CAL_CC .
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ */
+void HS_StartUtilCalCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Start a Utilization Calibration
+ *
+ *  \par Description
+ *       Clears the peak Idle Task count of each core and starts measuring
+ *       it over the given number of intervals.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A calibration already in progress is restarted.
+ *
+ *  \param[in] NumIntervals Intervals to calibrate over
+ *  \param[in] SaveToCDS    Whether to save the result to the CDS
+ *  \param[in] TrackPeak    Whether higher idle counts seen afterwards raise the calibration
+ */
+void HS_UtilCalStart(uint32 NumIntervals, bool SaveToCDS, bool TrackPeak);
+
+/**
+ * \brief Update the Utilization Calibration
+ *
+ *  \par Description
+ *       Called once per utilization interval. Records the peak Idle Task
+ *       count of each core while calibrating and applies the calibration
+ *       when the last interval has been measured. Afterwards, raises the
+ *       calibration of a core whose count exceeds it if peak tracking is
+ *       enabled.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing unless the backend is #HS_UTIL_BACKEND_IDLE_COUNT .
+ */
+void HS_UtilCalUpdate(void);
+
+/**
+ * \brief Apply a Utilization Calibration
+ *
+ *  \par Description
+ *       Sets the calibrated Idle Task count per interval of a core and
+ *       computes the fixed point scale used to convert idle counts to
+ *       utils. A count of 0 clears the calibration, so the conversion
+ *       factors are used again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] CoreIndex Core to calibrate
+ *  \param[in] IdleRate  Idle Task count per interval of a quiescent core
+ */
+void HS_UtilCalApply(uint32 CoreIndex, uint32 IdleRate);
+
+/**
+ * \brief Save the Utilization Calibration
+ *
+ *  \par Description
+ *       Copies the calibrated Idle Task count of each core, with its
+ *       inverse, to the calibration CDS block.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing if the calibration CDS block could not be created.
+ */
+void HS_UtilCalSave(void);
+
+/**
+ * \brief Restore the Utilization Calibration
+ *
+ *  \par Description
+ *       Creates the calibration CDS block, or restores and applies the
+ *       calibration held in it if it already exists.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return true if a calibration was restored for at least one core
+ */
+bool HS_UtilCalRestore(void);
+
+/**
+ * \brief Start Pressure Stall Monitoring
+ *
+ *  \par Description
+ *       Loads the #HS_PSI_LEVEL_DEFAULTS settings and reads a first
+ *       sample of each resource to compute stall times against. Only
+ *       resources that can be read are monitored.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Reports the resources that can't be read with a single event.
+ */
+void HS_PsiStart(void);
+
+/**
+ * \brief Monitor Pressure Stall
+ *
+ *  \par Description
+ *       Reads each monitored resource, updates its telemetry, and
+ *       enters or leaves its pressure stall level, taking the level
+ *       action when entered.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once per utilization interval. A resource that can't be
+ *       read keeps its last telemetry.
+ */
+void HS_PsiMonitor(void);
+
+/**
+ * \brief Get the Pressure Stall Telemetry
+ *
+ *  \par Description
+ *       Reports the monitored and active resources and the telemetry
+ *       of each resource.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[out] AvailableMask Bit N set when resource N is monitored
+ *  \param[out] ActiveMask    Bit N set while resource N is above its level
+ *  \param[out] TlmPtr        Telemetry of the #HS_PSI_NUM_RESOURCES resources
+ */
+void HS_PsiGetStats(uint32 *AvailableMask, uint32 *ActiveMask, HS_PsiTlm_t *TlmPtr);
+
+/**
+ * \brief Start Memory Monitoring
+ *
+ *  \par Description
+ *       Clears the memory history and alarms and reads a first sample.
+ *       Memory is only monitored when it can be read.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void HS_MemStart(void);
+
+/**
+ * \brief Monitor Memory
+ *
+ *  \par Description
+ *       Reads the memory sizes, raises or clears the low available
+ *       memory alarm, and adds the average resident set size to the
+ *       history every #HS_MEM_HISTORY_INTERVALS intervals. Once the
+ *       history is full, raises or clears the leak alarm from the fitted
+ *       resident set size growth.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once per utilization interval. The alarm action is taken
+ *       when an alarm is raised.
+ */
+void HS_MemMonitor(void);
+
+/**
+ * \brief Fit the Memory History Growth
+ *
+ *  \par Description
+ *       Fits a least-squares line to the full memory history, oldest
+ *       sample first.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only called once the history holds #HS_MEM_HISTORY_SIZE samples.
+ *
+ *  \return Resident set size growth in KiB per history sample
+ */
+int32 HS_MemHistoryGrowth(void);
+
+/**
+ * \brief Take a Memory Alarm Action
+ *
+ *  \par Description
+ *       Takes #HS_MEM_LOW_ACTION or #HS_MEM_LEAK_ACTION for an alarm
+ *       that has just been raised.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Alarm  #HS_MEM_ALARM_LOW_AVAIL or #HS_MEM_ALARM_LEAK
+ */
+void HS_MemAlarmAction(uint32 Alarm);
+
+/**
+ * \brief Get the Memory Telemetry
+ *
+ *  \par Description
+ *       Reports the latest memory sizes, growth and alarms.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[out] TlmPtr  Memory telemetry
+ */
+void HS_MemGetStats(HS_MemTlm_t *TlmPtr);
+
 #endif
@@ -976,6 +976,746 @@
  */
 #define HS_SUB_SHORT_EVS_ERR_EID 79
 
+/**
+ * \brief HS Enable Event Monitor Entries Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when an enable event monitor entries
+ *  command has been successfully processed.
+ */
+#define HS_ENABLE_EVENTMON_ENTRIES_DBG_EID 80
+
+/**
+ * \brief HS Disable Event Monitor Entries Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a disable event monitor entries
+ *  command has been successfully processed.
+ */
+#define HS_DISABLE_EVENTMON_ENTRIES_DBG_EID 81
+
+/**
+ * \brief HS Event Monitor Entries Command Invalid Range Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when an enable or disable event monitor
+ *  entries command specifies an empty range or one that extends past
+ *  #HS_MAX_MONITORED_EVENTS.
+ */
+#define HS_EVENTMON_ENTRIES_ERR_EID 82
+
+/**
+ * \brief HS Dump Utilization History Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dump utilization history
+ *  command has been successfully processed.
+ */
+#define HS_DUMP_UTIL_HIST_DBG_EID 83
+
+/**
+ * \brief HS Dump Utilization History Invalid Argument Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dump utilization history
+ *  command specifies a level of #HS_UTIL_HIST_NUM_LEVELS or more, or
+ *  an unknown destination.
+ */
+#define HS_DUMP_UTIL_HIST_ERR_EID 84
+
+/**
+ * \brief HS Utilization History File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the utilization history dump
+ *  file could not be created, or its header or data could not be
+ *  written.
+ */
+#define HS_UTIL_HIST_FILE_ERR_EID 85
+
+/**
+ * \brief HS Core Hogging Detected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when more than one core is monitored
+ *  and the utilization of a single core has exceeded the CPU Hogging
+ *  threshhold for longer than the CPU Hogging duration
+ */
+#define HS_CPUMON_CORE_HOGGING_ERR_EID 86
+
+/**
+ * \brief HS Per-Task CPU Sampling Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the CPU times of the threads of
+ *  the cFS process could not be read. It is issued once until a
+ *  sample succeeds again.
+ */
+#define HS_TASK_CPU_ERR_EID 87
+
+/**
+ * \brief HS Send Utilization Percentile Histogram Command Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a send utilization percentile
+ *  histogram command has been successfully processed.
+ */
+#define HS_SEND_UTIL_PCTL_DBG_EID 88
+
+/**
+ * \brief HS CPU Load Level Entered Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a CPU load level whose action is
+ *  #HS_ALARM_ACT_EVENT is entered.
+ */
+#define HS_UTIL_LOAD_ENTER_ERR_EID 89
+
+/**
+ * \brief HS CPU Load Level Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a CPU load level with a message
+ *  action is entered and the message action is sent, unless the
+ *  message action is set to not generate events.
+ */
+#define HS_UTIL_LOAD_MSGACTS_ERR_EID 90
+
+/**
+ * \brief HS CPU Load Level Cleared Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when interval utilization falls below
+ *  the exit threshold of an active CPU load level whose action is not
+ *  #HS_ALARM_ACT_NOACT.
+ */
+#define HS_UTIL_LOAD_EXIT_INF_EID 91
+
+/**
+ * \brief HS Set CPU Load Level Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set CPU load level command has
+ *  been successfully processed.
+ */
+#define HS_SET_UTIL_LOAD_LEVEL_INF_EID 92
+
+/**
+ * \brief HS Set CPU Load Level Command Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set CPU load level command
+ *  specifies a level of #HS_UTIL_LOAD_NUM_LEVELS or more, an exit
+ *  threshold greater than the enter threshold, or an invalid action.
+ */
+#define HS_SET_UTIL_LOAD_LEVEL_ERR_EID 93
+
+/**
+ * \brief HS LoadShed Table Registration Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Register
+ *  for the load shedding table returns a value other than CFE_SUCCESS
+ */
+#define HS_LST_REG_ERR_EID 94
+
+/**
+ * \brief HS LoadShed Table Load Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Load
+ *  for the load shedding table returns a value other than CFE_SUCCESS
+ */
+#define HS_LST_LD_ERR_EID 95
+
+/**
+ * \brief HS LoadShed Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the address can't be obtained
+ *  from table services for the load shedding table.
+ */
+#define HS_LOADSHED_GETADDR_ERR_EID 96
+
+/**
+ * \brief HS LoadShed Table Validation Null Pointer Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued if the TableData pointer passed to
+ *  HS_ValidateLSTable is null.
+ */
+#define HS_LS_TBL_NULL_ERR_EID 97
+
+/**
+ * \brief HS LoadShed Table Verification Results Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a table validation has been
+ *  completed for a load shedding table load
+ */
+#define HS_LSTVAL_INF_EID 98
+
+/**
+ * \brief HS LoadShed Table Verification Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued on the first error when a table validation
+ *  fails for a load shedding table load.
+ */
+#define HS_LSTVAL_ERR_EID 99
+
+/**
+ * \brief HS Load Shedding Step Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued each time HS sheds or restores a step
+ *  of the load shedding table. It reports the current CPU utilization
+ *  average and its change since the previous step.
+ */
+#define HS_LOADSHED_STEP_INF_EID 100
+
+/**
+ * \brief HS CPU Hog Snapshot Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when CPU hogging is detected, after the
+ *  CPU hog snapshot has been taken. It names the threads that used the
+ *  most CPU time over the hogging window.
+ */
+#define HS_HOG_SNAPSHOT_INF_EID 118
+
+/**
+ * \brief HS CPU Hog Snapshot File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the CPU hog snapshot file could
+ *  not be created, or its header or data could not be written.
+ */
+#define HS_HOG_SNAPSHOT_FILE_ERR_EID 119
+
+/**
+ * \brief HS CpuBudget Table Register Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Register
+ *  for the CPU budget table returns a value other than CFE_SUCCESS
+ */
+#define HS_CBT_REG_ERR_EID 120
+
+/**
+ * \brief HS CpuBudget Table Load Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Load
+ *  for the CPU budget table returns a value other than CFE_SUCCESS
+ */
+#define HS_CBT_LD_ERR_EID 121
+
+/**
+ * \brief HS CpuBudget Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the address can't be obtained
+ *  from table services for the CPU budget table.
+ */
+#define HS_CPUBUDGET_GETADDR_ERR_EID 122
+
+/**
+ * \brief HS CpuBudget Table Validation Null Pointer Detected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued if the TableData pointer passed to
+ *  HS_ValidateCBTable is null.
+ */
+#define HS_CB_TBL_NULL_ERR_EID 123
+
+/**
+ * \brief HS CpuBudget Table Verification Results Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a table validation has been
+ *  completed for a CPU budget table load
+ */
+#define HS_CBTVAL_INF_EID 124
+
+/**
+ * \brief HS CpuBudget Table Verification Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued on the first error when a table validation
+ *  fails for a CPU budget table load.
+ */
+#define HS_CBTVAL_ERR_EID 125
+
+/**
+ * \brief HS CPU Budget Processor Reset Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a task has been over its CPU
+ *  budget for the intervals given in the CPU budget table, and the
+ *  entry's action is a processor reset.
+ */
+#define HS_CPUBUDGET_PROC_ERR_EID 126
+
+/**
+ * \brief HS CPU Budget Application Restart Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a task has been over its CPU
+ *  budget for the intervals given in the CPU budget table, and the
+ *  entry's action is to restart the application owning the task.
+ */
+#define HS_CPUBUDGET_RESTART_ERR_EID 127
+
+/**
+ * \brief HS CPU Budget Application Restart Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the application owning a task
+ *  over its CPU budget could not be found or restarted.
+ */
+#define HS_CPUBUDGET_NOT_RESTARTED_ERR_EID 128
+
+/**
+ * \brief HS CPU Budget Event Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a task has been over its CPU
+ *  budget for the intervals given in the CPU budget table, and the
+ *  entry's action is event only.
+ */
+#define HS_CPUBUDGET_FAIL_ERR_EID 129
+
+/**
+ * \brief HS CPU Budget Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a task has been over its CPU
+ *  budget for the intervals given in the CPU budget table, and the
+ *  entry's action is a message action that is sent with events.
+ */
+#define HS_CPUBUDGET_MSGACTS_ERR_EID 130
+
+/**
+ * \brief HS CPU Saturation Warning Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the CPU utilization trend predicts
+ *  saturation within the warning horizon and the warning action is
+ *  #HS_ALARM_ACT_EVENT.
+ */
+#define HS_UTIL_TREND_WARN_ERR_EID 131
+
+/**
+ * \brief HS CPU Saturation Warning Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the CPU utilization trend predicts
+ *  saturation within the warning horizon and the warning's message
+ *  action is sent, unless the message action is set to not generate
+ *  events.
+ */
+#define HS_UTIL_TREND_MSGACTS_ERR_EID 132
+
+/**
+ * \brief HS CPU Saturation Warning Cleared Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when, after a CPU saturation warning,
+ *  the predicted time to saturation is more than twice the warning
+ *  horizon, and the warning action is not #HS_ALARM_ACT_NOACT.
+ */
+#define HS_UTIL_TREND_CLEAR_INF_EID 133
+
+/**
+ * \brief HS Set CPU Saturation Warning Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set CPU saturation warning
+ *  command has been successfully processed.
+ */
+#define HS_SET_UTIL_TREND_INF_EID 134
+
+/**
+ * \brief HS Set CPU Saturation Warning Command Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a set CPU saturation warning
+ *  command specifies an invalid action.
+ */
+#define HS_SET_UTIL_TREND_ERR_EID 135
+
+/**
+ * \brief HS Run Delay Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the thread that waited longest
+ *  for a CPU over the last utilization interval reached
+ *  #HS_TASK_RUN_DELAY_THRESHOLD and #HS_TASK_RUN_DELAY_ACTION is
+ *  event only.
+ */
+#define HS_TASK_RUN_DELAY_ERR_EID 141
+
+/**
+ * \brief HS Run Delay Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a thread reached
+ *  #HS_TASK_RUN_DELAY_THRESHOLD and the message action of
+ *  #HS_TASK_RUN_DELAY_ACTION is sent.
+ */
+#define HS_TASK_RUN_DELAY_MSGACTS_ERR_EID 142
+
+/**
+ * \brief HS Run Delay Cleared Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when every thread waited less than
+ *  #HS_TASK_RUN_DELAY_THRESHOLD for a CPU over the last utilization
+ *  interval, after the run delay action was taken.
+ */
+#define HS_TASK_RUN_DELAY_CLEAR_INF_EID 143
+
+/**
+ * \brief HS Rebalance Table Register Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Register
+ *  for the rebalance table returns a value other than CFE_SUCCESS
+ */
+#define HS_RBT_REG_ERR_EID 144
+
+/**
+ * \brief HS Rebalance Table Load Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to CFE_TBL_Load
+ *  for the rebalance table returns a value other than CFE_SUCCESS
+ */
+#define HS_RBT_LD_ERR_EID 145
+
+/**
+ * \brief HS Rebalance Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the address can't be obtained
+ *  from table services for the rebalance table.
+ */
+#define HS_REBALANCE_GETADDR_ERR_EID 146
+
+/**
+ * \brief HS Rebalance Table Validation Null Pointer Detected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued if the TableData pointer passed to
+ *  HS_ValidateRBTable is null.
+ */
+#define HS_RB_TBL_NULL_ERR_EID 147
+
+/**
+ * \brief HS Rebalance Table Verification Results Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a table validation has been
+ *  completed for a rebalance table load
+ */
+#define HS_RBTVAL_INF_EID 148
+
+/**
+ * \brief HS Rebalance Table Verification Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued on the first error when a table validation
+ *  fails for a rebalance table load.
+ */
+#define HS_RBTVAL_ERR_EID 149
+
+/**
+ * \brief HS Rebalance Task Moved Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a task of the rebalance table is
+ *  moved off a core that stayed at or above #HS_REBALANCE_HIGH_UTIL
+ *  onto a core that stayed at or below #HS_REBALANCE_LOW_UTIL.
+ */
+#define HS_REBALANCE_MOVE_INF_EID 150
+
+/**
+ * \brief HS Rebalance Task Move Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the core affinity of a thread of
+ *  a task being rebalanced could not be set.
+ */
+#define HS_REBALANCE_MOVE_ERR_EID 151
+
+/**
+ * \brief HS Stack Usage Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the stack high-water mark of a
+ *  thread reached #HS_STACK_USAGE_THRESHOLD and #HS_STACK_USAGE_ACTION
+ *  is event only.
+ */
+#define HS_STACK_USAGE_ERR_EID 158
+
+/**
+ * \brief HS Stack Usage Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the stack high-water mark of a
+ *  thread reached #HS_STACK_USAGE_THRESHOLD and the message action of
+ *  #HS_STACK_USAGE_ACTION is sent.
+ */
+#define HS_STACK_USAGE_MSGACTS_ERR_EID 159
+
+/**
+ * \brief HS Subscribe To Software Bus Telemetry Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the call to #CFE_SB_Subscribe
+ *  for the Software Bus housekeeping or statistics telemetry, during
+ *  initialization returns a value other than CFE_SUCCESS
+ */
+#define HS_SUB_SB_TLM_ERR_EID 160
+
+/**
+ * \brief HS Software Bus Pipe Backlog Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the queue depth of a pipe of
+ *  #HS_SB_PIPE_LIMITS reached its enter usage and the action of the
+ *  entry is event only.
+ */
+#define HS_SB_PIPE_BACKLOG_ERR_EID 161
+
+/**
+ * \brief HS Software Bus Pipe Backlog Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the queue depth of a pipe of
+ *  #HS_SB_PIPE_LIMITS reached its enter usage and the message action
+ *  of the entry is sent.
+ */
+#define HS_SB_PIPE_BACKLOG_MSGACTS_ERR_EID 162
+
+/**
+ * \brief HS Software Bus Pipe Backlog Cleared Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the queue depth of a pipe that
+ *  reached its enter usage fell below its exit usage.
+ */
+#define HS_SB_PIPE_BACKLOG_CLEAR_INF_EID 163
+
+/**
+ * \brief HS Software Bus Dropped Messages Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Software Bus dropped
+ *  #HS_SB_DROP_THRESHOLD or more messages between two of its
+ *  housekeeping packets and #HS_SB_DROP_ACTION is event only.
+ */
+#define HS_SB_DROP_ERR_EID 164
+
+/**
+ * \brief HS Software Bus Dropped Messages Message Action Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the Software Bus dropped
+ *  #HS_SB_DROP_THRESHOLD or more messages between two of its
+ *  housekeeping packets and the message action of #HS_SB_DROP_ACTION
+ *  is sent.
+ */
+#define HS_SB_DROP_MSGACTS_ERR_EID 165
+
+/**
+ * \brief HS Software Bus Dropped Messages Cleared Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a Software Bus housekeeping packet
+ *  reports no dropped messages after the dropped message action was
+ *  taken.
+ */
+#define HS_SB_DROP_CLEAR_INF_EID 166
+
 /**\}*/
 
 #endif
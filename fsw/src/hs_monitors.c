@@ -34,6 +34,7 @@
 #include "hs_utils.h"
 #include "cfe_evs_msg.h"
 
+#include <stdio.h>
 #include <string.h>
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -49,7 +50,6 @@ void HS_MonitorApplications(void)
     uint32           TableIndex   = 0;
     uint16           ActionType   = 0;
     uint32           MsgActsIndex = 0;
-    CFE_SB_Buffer_t *BufPtr       = NULL;
 
     memset(&AppInfo, 0, sizeof(AppInfo));
 
@@ -180,29 +180,13 @@ void HS_MonitorApplications(void)
                             MsgActsIndex = ActionType - HS_AMT_ACT_LAST_NONMSG - 1;
 
                             /*
-                            ** Check to see if this is a valid Message Action Type
+                            ** Send the message if valid, off cooldown and not disabled
                             */
-                            if ((HS_AppData.MsgActsState == HS_STATE_ENABLED) && (MsgActsIndex < HS_MAX_MSG_ACT_TYPES))
+                            if (HS_ExecuteMsgAction(MsgActsIndex))
                             {
-                                /*
-                                ** Send the message if off cooldown and not disabled
-                                */
-                                if ((HS_AppData.MsgActCooldown[MsgActsIndex] == 0) &&
-                                    (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_DISABLED))
-                                {
-                                    BufPtr = (CFE_SB_Buffer_t *)&HS_AppData.MATablePtr[MsgActsIndex].MsgBuf;
-                                    CFE_SB_TransmitMsg(&BufPtr->Msg, true);
-                                    HS_AppData.MsgActExec++;
-                                    HS_AppData.MsgActCooldown[MsgActsIndex] =
-                                        HS_AppData.MATablePtr[MsgActsIndex].Cooldown;
-                                    if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
-                                    {
-                                        CFE_EVS_SendEvent(
-                                            HS_APPMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                            "App Monitor Failure: APP:(%s): Action: Message Action Index: %d",
-                                            HS_AppData.AMTablePtr[TableIndex].AppName, (int)MsgActsIndex);
-                                    }
-                                }
+                                CFE_EVS_SendEvent(HS_APPMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                                  "App Monitor Failure: APP:(%s): Action: Message Action Index: %d",
+                                                  HS_AppData.AMTablePtr[TableIndex].AppName, (int)MsgActsIndex);
                             }
 
                             /* Otherwise, Take No Action */
@@ -228,22 +212,30 @@ void HS_MonitorApplications(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
 {
-    uint32           TableIndex   = 0;
-    int32            Status       = CFE_SUCCESS;
-    CFE_ES_AppId_t   AppId        = CFE_ES_APPID_UNDEFINED;
-    uint16           ActionType   = 0;
-    uint32           MsgActsIndex = 0;
-    CFE_SB_Buffer_t *SendPtr      = NULL;
+    uint32         TableIndex   = 0;
+    int32          Status       = CFE_SUCCESS;
+    CFE_ES_AppId_t AppId        = CFE_ES_APPID_UNDEFINED;
+    uint16         ActionType   = 0;
+    uint32         MsgActsIndex = 0;
+
+    HS_CountProcessorEvent(EventPtr->Payload.PacketID.SpacecraftID, EventPtr->Payload.PacketID.ProcessorID);
 
     for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_EVENTS; TableIndex++)
     {
         ActionType = HS_AppData.EMTablePtr[TableIndex].ActionType;
 
         /*
-        ** Check this Event Monitor if it has an action, and the event IDs match
+        ** Check this Event Monitor if it has an action, is enabled, the event IDs match,
+        ** and the event came from a spacecraft and processor the entry applies to
         */
         if ((ActionType != HS_EMT_ACT_NOACT) &&
-            (HS_AppData.EMTablePtr[TableIndex].EventID == EventPtr->Payload.PacketID.EventID))
+            CFE_TST(HS_AppData.EventMonEnables[TableIndex / HS_BITS_PER_EVENTMON_ENABLE],
+                    TableIndex % HS_BITS_PER_EVENTMON_ENABLE) &&
+            (HS_AppData.EMTablePtr[TableIndex].EventID == EventPtr->Payload.PacketID.EventID) &&
+            HS_EMTQualifierMatches(HS_AppData.EMTablePtr[TableIndex].SpacecraftID,
+                                   EventPtr->Payload.PacketID.SpacecraftID, HS_AppData.LocalSpacecraftID) &&
+            HS_EMTQualifierMatches(HS_AppData.EMTablePtr[TableIndex].ProcessorID,
+                                   EventPtr->Payload.PacketID.ProcessorID, HS_AppData.LocalProcessorID))
         {
             if (strncmp(HS_AppData.EMTablePtr[TableIndex].AppName, EventPtr->Payload.PacketID.AppName,
                         OS_MAX_API_NAME) == 0)
@@ -338,31 +330,14 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
                         MsgActsIndex = ActionType - HS_AMT_ACT_LAST_NONMSG - 1;
 
                         /*
-                        ** Check to see if this is a valid Message Action Type
+                        ** Send the message if valid, off cooldown and not disabled
                         */
-                        if ((HS_AppData.MsgActsState == HS_STATE_ENABLED) && (MsgActsIndex < HS_MAX_MSG_ACT_TYPES))
+                        if (HS_ExecuteMsgAction(MsgActsIndex))
                         {
-
-                            /*
-                            ** Send the message if off cooldown and not disabled
-                            */
-                            if ((HS_AppData.MsgActCooldown[MsgActsIndex] == 0) &&
-                                (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_DISABLED))
-                            {
-                                SendPtr = (CFE_SB_Buffer_t *)&HS_AppData.MATablePtr[MsgActsIndex].MsgBuf;
-                                CFE_SB_TransmitMsg(&SendPtr->Msg, true);
-
-                                HS_AppData.MsgActExec++;
-                                HS_AppData.MsgActCooldown[MsgActsIndex] = HS_AppData.MATablePtr[MsgActsIndex].Cooldown;
-                                if (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT)
-                                {
-                                    CFE_EVS_SendEvent(
-                                        HS_EVENTMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                        "Event Monitor: APP:(%s) EID:(%d): Action: Message Action Index: %d",
-                                        HS_AppData.EMTablePtr[TableIndex].AppName,
-                                        HS_AppData.EMTablePtr[TableIndex].EventID, (int)MsgActsIndex);
-                                }
-                            }
+                            CFE_EVS_SendEvent(HS_EVENTMON_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                              "Event Monitor: APP:(%s) EID:(%d): Action: Message Action Index: %d",
+                                              HS_AppData.EMTablePtr[TableIndex].AppName,
+                                              HS_AppData.EMTablePtr[TableIndex].EventID, (int)MsgActsIndex);
                         }
 
                         /* Otherwise, Take No Action */
@@ -379,6 +354,81 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
 
 } /* end HS_MonitorEvent */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Execute a Message Action                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_ExecuteMsgAction(uint32 MsgActsIndex)
+{
+    CFE_SB_Buffer_t *BufPtr    = NULL;
+    bool             SendEvent = false;
+
+    /*
+    ** Check to see if this is a valid Message Action Type
+    */
+    if ((HS_AppData.MsgActsState == HS_STATE_ENABLED) && (MsgActsIndex < HS_MAX_MSG_ACT_TYPES))
+    {
+        /*
+        ** Send the message if off cooldown and not disabled
+        */
+        if ((HS_AppData.MsgActCooldown[MsgActsIndex] == 0) &&
+            (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_DISABLED))
+        {
+            BufPtr = (CFE_SB_Buffer_t *)&HS_AppData.MATablePtr[MsgActsIndex].MsgBuf;
+            CFE_SB_TransmitMsg(&BufPtr->Msg, true);
+            HS_AppData.MsgActExec++;
+            HS_AppData.MsgActCooldown[MsgActsIndex] = HS_AppData.MATablePtr[MsgActsIndex].Cooldown;
+
+            SendEvent = (HS_AppData.MATablePtr[MsgActsIndex].EnableState != HS_MAT_STATE_NOEVENT);
+        }
+    }
+
+    return SendEvent;
+
+} /* end HS_ExecuteMsgAction */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count an event message against its source processor             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_CountProcessorEvent(uint32 SpacecraftID, uint32 ProcessorID)
+{
+    uint32 ProcIndex = 0;
+
+    for (ProcIndex = 0; ProcIndex < HS_AppData.ProcEventCountsUsed; ProcIndex++)
+    {
+        if ((HS_AppData.ProcEventCounts[ProcIndex].SpacecraftID == SpacecraftID) &&
+            (HS_AppData.ProcEventCounts[ProcIndex].ProcessorID == ProcessorID))
+        {
+            break;
+        }
+    }
+
+    if (ProcIndex < HS_AppData.ProcEventCountsUsed)
+    {
+        HS_AppData.ProcEventCounts[ProcIndex].EventCount++;
+    }
+    else if (HS_AppData.ProcEventCountsUsed < HS_MAX_EVENT_PROCESSORS)
+    {
+        /*
+        ** First event from this source, claim the next free slot
+        */
+        HS_AppData.ProcEventCounts[ProcIndex].SpacecraftID = SpacecraftID;
+        HS_AppData.ProcEventCounts[ProcIndex].ProcessorID  = ProcessorID;
+        HS_AppData.ProcEventCounts[ProcIndex].EventCount   = 1;
+        HS_AppData.ProcEventCountsUsed++;
+    }
+    else
+    {
+        HS_AppData.ProcEventOverflowCount++;
+    }
+
+    return;
+
+} /* end HS_CountProcessorEvent */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Monitor CPU Utilization and Hogging                             */
@@ -387,10 +437,9 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
 void HS_MonitorUtilization(void)
 {
     int32  CurrentUtil   = 0;
-    uint32 UtilIndex     = 0;
-    uint32 CombinedUtil  = 0;
-    uint32 PeakUtil      = 0;
+    uint32 CoreIndex     = 0;
     uint32 ThisUtilIndex = HS_AppData.CurrentCPUUtilIndex;
+    bool   HogDetected   = false;
 
     HS_AppData.CurrentCPUUtilIndex++;
 
@@ -406,58 +455,2059 @@ void HS_MonitorUtilization(void)
         CurrentUtil = HS_UTIL_PER_INTERVAL_TOTAL;
     }
 
-    if (CurrentUtil < 0)
+    if (CurrentUtil < 0)
+    {
+        CurrentUtil = 0;
+    }
+
+    if ((CurrentUtil >= HS_UTIL_PER_INTERVAL_HOGGING) && (HS_AppData.CurrentCPUHogState == HS_STATE_ENABLED))
+    {
+        HS_AppData.CurrentCPUHoggingTime++;
+
+        if (HS_AppData.CurrentCPUHoggingTime == 1)
+        {
+            HS_HogSnapshotBaseline();
+        }
+
+        if (HS_AppData.CurrentCPUHoggingTime == HS_AppData.MaxCPUHoggingTime)
+        {
+            CFE_EVS_SendEvent(HS_CPUMON_HOGGING_ERR_EID, CFE_EVS_EventType_ERROR, "CPU Hogging Detected");
+            CFE_ES_WriteToSysLog("HS App: CPU Hogging Detected\n");
+            HogDetected = true;
+        }
+    }
+    else
+    {
+        HS_AppData.CurrentCPUHoggingTime = 0;
+    }
+
+    /* Reads the interval leaving the trend window before the tracker slot can be overwritten */
+    HS_UtilTrendUpdate(ThisUtilIndex, CurrentUtil);
+
+    HS_UtilWindowUpdate(&HS_AppData.UtilWindow, HS_AppData.UtilizationTracker, ThisUtilIndex, CurrentUtil);
+
+    HS_AppData.UtilCpuAvg = HS_AppData.UtilWindow.Sum / HS_UTIL_AVERAGE_NUM_INTERVAL;
+    HS_AppData.UtilCpuPeak =
+        HS_AppData.UtilizationTracker[HS_AppData.UtilWindow.PeakQueue[HS_AppData.UtilWindow.PeakQueueHead]];
+
+    /* Taken after this interval is in the tracker so the snapshot includes it */
+    if (HogDetected)
+    {
+        HS_HogSnapshotCapture(ThisUtilIndex);
+    }
+
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+    {
+        HS_MonitorCoreUtilization(CoreIndex, ThisUtilIndex);
+    }
+
+    HS_UtilHistRecord(CurrentUtil);
+    HS_UtilPctlRecord(CurrentUtil);
+    HS_MonitorUtilLoad(CurrentUtil);
+    HS_MonitorLoadShed(CurrentUtil);
+    HS_MonitorUtilTrend();
+    HS_MonitorRebalance(ThisUtilIndex);
+
+    return;
+
+} /* end HS_MonitorUtilization */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the CPU load levels                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorUtilLoad(uint32 CurrentUtil)
+{
+    HS_UtilLoadLevel_t *LevelPtr     = NULL;
+    uint32              Level        = 0;
+    uint32              MsgActsIndex = 0;
+
+    for (Level = 0; Level < HS_UTIL_LOAD_NUM_LEVELS; Level++)
+    {
+        LevelPtr = &HS_AppData.UtilLoadLevels[Level];
+
+        if ((HS_AppData.UtilLoadActiveMask & (1U << Level)) != 0)
+        {
+            /*
+            ** An active level is left once utilization is below its exit threshold
+            */
+            if (CurrentUtil < LevelPtr->ExitUtil)
+            {
+                HS_AppData.UtilLoadActiveMask &= ~(1U << Level);
+
+                if (LevelPtr->ActionType != HS_ALARM_ACT_NOACT)
+                {
+                    CFE_EVS_SendEvent(HS_UTIL_LOAD_EXIT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                      "CPU Load Level %d Cleared: Util = %d", (int)Level, (int)CurrentUtil);
+                }
+            }
+
+            continue;
+        }
+
+        if (CurrentUtil < LevelPtr->EnterUtil)
+        {
+            HS_AppData.UtilLoadDwell[Level] = 0;
+            continue;
+        }
+
+        HS_AppData.UtilLoadDwell[Level]++;
+
+        if (HS_AppData.UtilLoadDwell[Level] < LevelPtr->DwellIntervals)
+        {
+            continue;
+        }
+
+        HS_AppData.UtilLoadDwell[Level] = 0;
+        HS_AppData.UtilLoadActiveMask |= (1U << Level);
+
+        switch (LevelPtr->ActionType)
+        {
+            case HS_ALARM_ACT_NOACT:
+                break;
+
+            case HS_ALARM_ACT_EVENT:
+                CFE_EVS_SendEvent(HS_UTIL_LOAD_ENTER_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CPU Load Level %d Entered: Util = %d: Action: Event Only", (int)Level,
+                                  (int)CurrentUtil);
+                break;
+
+            /*
+            ** Message Action types processing (invalid will be skipped)
+            */
+            default:
+
+                /* Calculate the requested message action index */
+                MsgActsIndex = LevelPtr->ActionType - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+                /*
+                ** Send the message if valid, off cooldown and not disabled
+                */
+                if (HS_ExecuteMsgAction(MsgActsIndex))
+                {
+                    CFE_EVS_SendEvent(HS_UTIL_LOAD_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "CPU Load Level %d Entered: Util = %d: Action: Message Action Index: %d",
+                                      (int)Level, (int)CurrentUtil, (int)MsgActsIndex);
+                }
+
+                /* Otherwise, Take No Action */
+                break;
+        }
+    }
+
+    return;
+
+} /* end HS_MonitorUtilLoad */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Shed or restore load                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorLoadShed(uint32 CurrentUtil)
+{
+    CFE_SB_Buffer_t *BufPtr     = NULL;
+    uint32           TableIndex = 0;
+
+    if (HS_AppData.LoadShedState != HS_STATE_ENABLED)
+    {
+        return;
+    }
+
+    if (CurrentUtil >= HS_LOAD_SHED_HIGH_UTIL)
+    {
+        HS_AppData.LoadShedHighCount++;
+        HS_AppData.LoadShedLowCount = 0;
+    }
+    else if (CurrentUtil < HS_LOAD_SHED_LOW_UTIL)
+    {
+        HS_AppData.LoadShedLowCount++;
+        HS_AppData.LoadShedHighCount = 0;
+    }
+    else
+    {
+        HS_AppData.LoadShedHighCount = 0;
+        HS_AppData.LoadShedLowCount  = 0;
+    }
+
+    /*
+    ** With nothing shed there is no previous step to compare against
+    */
+    if (HS_AppData.LoadShedStep == 0)
+    {
+        HS_AppData.LoadShedLastAvg = HS_AppData.UtilCpuAvg;
+    }
+
+    if (HS_AppData.LoadShedHighCount >= HS_LOAD_SHED_DWELL)
+    {
+        HS_AppData.LoadShedHighCount = 0;
+
+        /*
+        ** Shed the next used step, if any are left
+        */
+        for (TableIndex = HS_AppData.LoadShedStep; TableIndex < HS_MAX_LOAD_SHED_STEPS; TableIndex++)
+        {
+            if (HS_AppData.LSTablePtr[TableIndex].EnableState == HS_LST_STATE_ENABLED)
+            {
+                BufPtr = (CFE_SB_Buffer_t *)&HS_AppData.LSTablePtr[TableIndex].ShedMsgBuf;
+                CFE_SB_TransmitMsg(&BufPtr->Msg, true);
+                HS_AppData.LoadShedStep = TableIndex + 1;
+
+                CFE_EVS_SendEvent(HS_LOADSHED_STEP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Load Shed Step %d Shed: Util = %d, Avg = %d, Avg Change Since Last Step = %d",
+                                  (int)TableIndex, (int)CurrentUtil, (int)HS_AppData.UtilCpuAvg,
+                                  (int)HS_AppData.UtilCpuAvg - (int)HS_AppData.LoadShedLastAvg);
+                HS_AppData.LoadShedLastAvg = HS_AppData.UtilCpuAvg;
+                break;
+            }
+        }
+    }
+    else if (HS_AppData.LoadShedLowCount >= HS_LOAD_SHED_DWELL)
+    {
+        HS_AppData.LoadShedLowCount = 0;
+
+        /*
+        ** Restore the last shed step, if any
+        */
+        TableIndex = HS_AppData.LoadShedStep;
+
+        while (TableIndex > 0)
+        {
+            TableIndex--;
+
+            if (HS_AppData.LSTablePtr[TableIndex].EnableState == HS_LST_STATE_ENABLED)
+            {
+                BufPtr = (CFE_SB_Buffer_t *)&HS_AppData.LSTablePtr[TableIndex].RestoreMsgBuf;
+                CFE_SB_TransmitMsg(&BufPtr->Msg, true);
+
+                CFE_EVS_SendEvent(HS_LOADSHED_STEP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Load Shed Step %d Restored: Util = %d, Avg = %d, Avg Change Since Last Step = %d",
+                                  (int)TableIndex, (int)CurrentUtil, (int)HS_AppData.UtilCpuAvg,
+                                  (int)HS_AppData.UtilCpuAvg - (int)HS_AppData.LoadShedLastAvg);
+                HS_AppData.LoadShedLastAvg = HS_AppData.UtilCpuAvg;
+                break;
+            }
+        }
+
+        HS_AppData.LoadShedStep = TableIndex;
+    }
+
+    return;
+
+} /* end HS_MonitorLoadShed */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add an interval utilization to the utilization trend            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilTrendUpdate(uint32 ThisUtilIndex, uint32 CurrentUtil)
+{
+    HS_UtilTrend_t *TrendPtr    = &HS_AppData.UtilTrend;
+    uint32          LeavingUtil = 0;
+
+    if (TrendPtr->NumSamples < HS_UTIL_TREND_NUM_INTERVAL)
+    {
+        TrendPtr->SumWeighted += (uint64)TrendPtr->NumSamples * CurrentUtil;
+        TrendPtr->SumUtil += CurrentUtil;
+        TrendPtr->NumSamples++;
+    }
+    else
+    {
+        LeavingUtil = HS_AppData.UtilizationTracker[((ThisUtilIndex + HS_UTIL_PEAK_NUM_INTERVAL) -
+                                                     HS_UTIL_TREND_NUM_INTERVAL) %
+                                                    HS_UTIL_PEAK_NUM_INTERVAL];
+
+        /*
+        ** Every interval left in the window moves one position older,
+        ** taking its utilization off the weighted sum once
+        */
+        TrendPtr->SumWeighted -= TrendPtr->SumUtil - LeavingUtil;
+        TrendPtr->SumWeighted += (uint64)(HS_UTIL_TREND_NUM_INTERVAL - 1) * CurrentUtil;
+        TrendPtr->SumUtil = (TrendPtr->SumUtil - LeavingUtil) + CurrentUtil;
+    }
+
+    return;
+
+} /* end HS_UtilTrendUpdate */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Predict CPU saturation from the utilization trend               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorUtilTrend(void)
+{
+    HS_UtilTrend_t *      TrendPtr     = &HS_AppData.UtilTrend;
+    HS_UtilTrendConfig_t *ConfigPtr    = &HS_AppData.UtilTrendConfig;
+    const int64           NumIntervals = HS_UTIL_TREND_NUM_INTERVAL;
+    int64                 Denom        = 0;
+    int64                 SlopeNum     = 0;
+    int64                 Remaining    = 0;
+    int64                 TimeToSat    = 0;
+    uint32                MsgActsIndex = 0;
+
+    if (TrendPtr->NumSamples < HS_UTIL_TREND_NUM_INTERVAL)
+    {
+        return;
+    }
+
+    /*
+    ** Least-squares slope over the window is SlopeNum / Denom Utils per interval
+    */
+    Denom    = (NumIntervals * NumIntervals * ((NumIntervals * NumIntervals) - 1)) / 12;
+    SlopeNum = (NumIntervals * (int64)TrendPtr->SumWeighted) -
+               (((NumIntervals * (NumIntervals - 1)) / 2) * (int64)TrendPtr->SumUtil);
+
+    TrendPtr->Slope = (int32)((SlopeNum * 100) / Denom);
+
+    if (SlopeNum <= 0)
+    {
+        TrendPtr->TimeToSat = HS_UTIL_TREND_NOT_RISING;
+    }
+    else
+    {
+        /*
+        ** Distance from the fitted utilization of the latest interval to
+        ** saturation, scaled by 2 * NumIntervals * Denom to stay in integers
+        */
+        Remaining = (2 * NumIntervals * Denom * HS_UTIL_TREND_SATURATION_UTIL) -
+                    (2 * Denom * (int64)TrendPtr->SumUtil) - (SlopeNum * NumIntervals * (NumIntervals - 1));
+
+        if (Remaining > 0)
+        {
+            TimeToSat = Remaining / (2 * NumIntervals * SlopeNum);
+        }
+
+        if (TimeToSat >= HS_UTIL_TREND_NOT_RISING)
+        {
+            TimeToSat = HS_UTIL_TREND_NOT_RISING - 1;
+        }
+
+        TrendPtr->TimeToSat = (uint32)TimeToSat;
+    }
+
+    if (TrendPtr->Warned)
+    {
+        /*
+        ** The warning is cleared once saturation is well beyond the horizon
+        */
+        if ((uint64)TrendPtr->TimeToSat > (2 * (uint64)ConfigPtr->HorizonIntervals))
+        {
+            TrendPtr->Warned = false;
+
+            if (ConfigPtr->ActionType != HS_ALARM_ACT_NOACT)
+            {
+                CFE_EVS_SendEvent(HS_UTIL_TREND_CLEAR_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "CPU Saturation Warning Cleared: Slope = %d Utils/100 Intervals",
+                                  (int)TrendPtr->Slope);
+            }
+        }
+
+        return;
+    }
+
+    if ((ConfigPtr->HorizonIntervals == 0) || (TrendPtr->TimeToSat > ConfigPtr->HorizonIntervals))
+    {
+        return;
+    }
+
+    TrendPtr->Warned = true;
+
+    switch (ConfigPtr->ActionType)
+    {
+        case HS_ALARM_ACT_NOACT:
+            break;
+
+        case HS_ALARM_ACT_EVENT:
+            CFE_EVS_SendEvent(HS_UTIL_TREND_WARN_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CPU Saturation Predicted In %u Intervals: Slope = %d Utils/100 Intervals: Action: "
+                              "Event Only",
+                              (unsigned int)TrendPtr->TimeToSat, (int)TrendPtr->Slope);
+            break;
+
+        /*
+        ** Message Action types processing (invalid will be skipped)
+        */
+        default:
+
+            /* Calculate the requested message action index */
+            MsgActsIndex = ConfigPtr->ActionType - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+            /*
+            ** Send the message if valid, off cooldown and not disabled
+            */
+            if (HS_ExecuteMsgAction(MsgActsIndex))
+            {
+                CFE_EVS_SendEvent(HS_UTIL_TREND_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CPU Saturation Predicted In %u Intervals: Action: Message Action Index: %d",
+                                  (unsigned int)TrendPtr->TimeToSat, (int)MsgActsIndex);
+            }
+
+            /* Otherwise, Take No Action */
+            break;
+    }
+
+    return;
+
+} /* end HS_MonitorUtilTrend */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move a task off a saturated core onto an idle one               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorRebalance(uint32 ThisUtilIndex)
+{
+    uint32 CoreIndex = 0;
+    uint32 Util      = 0;
+    uint32 FromCore  = HS_UTIL_NUM_CORES;
+    uint32 ToCore    = HS_UTIL_NUM_CORES;
+    uint32 FromUtil  = 0;
+    uint32 ToUtil    = HS_UTIL_PER_INTERVAL_TOTAL;
+
+    if ((HS_UTIL_NUM_CORES < 2) || (HS_AppData.RebalanceState != HS_STATE_ENABLED))
+    {
+        return;
+    }
+
+    /*
+    ** Give the last move time to take effect
+    */
+    if (HS_AppData.RebalanceCooldown > 0)
+    {
+        HS_AppData.RebalanceCooldown--;
+        return;
+    }
+
+    /*
+    ** Find the busiest saturated core and the least busy idle core
+    */
+    for (CoreIndex = 0; CoreIndex < HS_UTIL_NUM_CORES; CoreIndex++)
+    {
+        Util = HS_AppData.UtilCoreTracker[CoreIndex][ThisUtilIndex];
+
+        if ((Util >= HS_REBALANCE_HIGH_UTIL) && ((FromCore == HS_UTIL_NUM_CORES) || (Util > FromUtil)))
+        {
+            FromCore = CoreIndex;
+            FromUtil = Util;
+        }
+
+        if ((Util <= HS_REBALANCE_LOW_UTIL) && ((ToCore == HS_UTIL_NUM_CORES) || (Util < ToUtil)))
+        {
+            ToCore = CoreIndex;
+            ToUtil = Util;
+        }
+    }
+
+    if ((FromCore == HS_UTIL_NUM_CORES) || (ToCore == HS_UTIL_NUM_CORES))
+    {
+        HS_AppData.RebalanceDwell = 0;
+        return;
+    }
+
+    /*
+    ** Only an imbalance between the same cores that lasts is acted on
+    */
+    if ((HS_AppData.RebalanceDwell == 0) || (FromCore != HS_AppData.RebalanceFromCore) ||
+        (ToCore != HS_AppData.RebalanceToCore))
+    {
+        HS_AppData.RebalanceFromCore = FromCore;
+        HS_AppData.RebalanceToCore   = ToCore;
+        HS_AppData.RebalanceDwell    = 0;
+    }
+
+    HS_AppData.RebalanceDwell++;
+
+    if (HS_AppData.RebalanceDwell < HS_REBALANCE_DWELL)
+    {
+        return;
+    }
+
+    HS_AppData.RebalanceDwell = 0;
+
+    if (HS_RebalanceMove(FromCore, ToCore))
+    {
+        CFE_EVS_SendEvent(HS_REBALANCE_MOVE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Rebalance: TASK:(%s) moved from core %d (Util = %u) to core %d (Util = %u)",
+                          HS_AppData.RBTablePtr[HS_AppData.RebalanceLastEntry].TaskName, (int)FromCore,
+                          (unsigned int)FromUtil, (int)ToCore, (unsigned int)ToUtil);
+
+        HS_AppData.RebalanceCooldown = HS_REBALANCE_COOLDOWN;
+    }
+
+    return;
+
+} /* end HS_MonitorRebalance */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move the first movable task from one core to another            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_RebalanceMove(uint32 FromCore, uint32 ToCore)
+{
+    const HS_TaskCpuSample_t *SamplesPtr = HS_AppData.TaskCpuSamples[HS_AppData.TaskCpuCurrent];
+    HS_RBTEntry_t *           EntryPtr   = NULL;
+    uint32                    NumSamples = HS_AppData.TaskCpuNumSamples[HS_AppData.TaskCpuCurrent];
+    uint32                    TableIndex = 0;
+    uint32                    Index      = 0;
+    uint32                    CoreMask   = 0;
+    uint32                    NumMoved   = 0;
+    int32                     Status     = CFE_SUCCESS;
+
+    for (TableIndex = 0; (TableIndex < HS_MAX_REBALANCE_TASKS) && (NumMoved == 0); TableIndex++)
+    {
+        EntryPtr = &HS_AppData.RBTablePtr[TableIndex];
+
+        if ((EntryPtr->TaskName[0] == '\0') || ((EntryPtr->CoreMask & (1U << ToCore)) == 0))
+        {
+            continue;
+        }
+
+        /*
+        ** Threads of the task share its name, which the operating system
+        ** may have truncated. Only threads that can still run on the
+        ** saturated core are moved.
+        */
+        for (Index = 0; Index < NumSamples; Index++)
+        {
+            if (!HS_ThreadNameMatches(SamplesPtr[Index].Name, EntryPtr->TaskName))
+            {
+                continue;
+            }
+
+            Status = HS_GetThreadAffinity(SamplesPtr[Index].ThreadId, &CoreMask);
+
+            if ((Status != CFE_SUCCESS) || ((CoreMask & (1U << FromCore)) == 0))
+            {
+                continue;
+            }
+
+            Status = HS_SetThreadAffinity(SamplesPtr[Index].ThreadId, 1U << ToCore);
+
+            if (Status == CFE_SUCCESS)
+            {
+                NumMoved++;
+            }
+            else
+            {
+                CFE_EVS_SendEvent(HS_REBALANCE_MOVE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Rebalance: TASK:(%s) thread %u could not be moved to core %d, RC=0x%08X",
+                                  EntryPtr->TaskName, (unsigned int)SamplesPtr[Index].ThreadId, (int)ToCore,
+                                  (unsigned int)Status);
+            }
+        }
+
+        if (NumMoved > 0)
+        {
+            HS_AppData.RebalanceMoveCount++;
+            HS_AppData.RebalanceLastEntry    = TableIndex;
+            HS_AppData.RebalanceLastFromCore = FromCore;
+            HS_AppData.RebalanceLastToCore   = ToCore;
+        }
+    }
+
+    return (NumMoved > 0);
+
+} /* end HS_RebalanceMove */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Monitor the utilization of a single processor core              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorCoreUtilization(uint32 CoreIndex, uint32 ThisUtilIndex)
+{
+    HS_UtilWindow_t *WindowPtr   = &HS_AppData.UtilCoreWindow[CoreIndex];
+    uint32 *         TrackerPtr  = HS_AppData.UtilCoreTracker[CoreIndex];
+    int32            CurrentUtil = 0;
+
+    CurrentUtil = HS_CustomGetCoreUtil(CoreIndex);
+
+    if (CurrentUtil > HS_UTIL_PER_INTERVAL_TOTAL)
+    {
+        CurrentUtil = HS_UTIL_PER_INTERVAL_TOTAL;
+    }
+
+    if (CurrentUtil < 0)
+    {
+        CurrentUtil = 0;
+    }
+
+    /*
+    ** With a single core the whole CPU hogging check already covers it
+    */
+    if ((HS_UTIL_NUM_CORES > 1) && (CurrentUtil >= HS_UTIL_PER_INTERVAL_HOGGING) &&
+        (HS_AppData.CurrentCPUHogState == HS_STATE_ENABLED))
+    {
+        HS_AppData.CurrentCoreHoggingTime[CoreIndex]++;
+
+        if (HS_AppData.CurrentCoreHoggingTime[CoreIndex] == HS_AppData.MaxCPUHoggingTime)
+        {
+            CFE_EVS_SendEvent(HS_CPUMON_CORE_HOGGING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CPU Hogging Detected on core %d", (int)CoreIndex);
+            CFE_ES_WriteToSysLog("HS App: CPU Hogging Detected on core %d\n", (int)CoreIndex);
+        }
+    }
+    else
+    {
+        HS_AppData.CurrentCoreHoggingTime[CoreIndex] = 0;
+    }
+
+    HS_UtilWindowUpdate(WindowPtr, TrackerPtr, ThisUtilIndex, CurrentUtil);
+
+    HS_AppData.UtilCoreAvg[CoreIndex]  = WindowPtr->Sum / HS_UTIL_AVERAGE_NUM_INTERVAL;
+    HS_AppData.UtilCorePeak[CoreIndex] = TrackerPtr[WindowPtr->PeakQueue[WindowPtr->PeakQueueHead]];
+
+    return;
+
+} /* end HS_MonitorCoreUtilization */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add an interval utilization to a tracker and its window state   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilWindowUpdate(HS_UtilWindow_t *WindowPtr, uint32 *TrackerPtr, uint32 ThisUtilIndex, uint32 CurrentUtil)
+{
+    uint32 LeavingIndex = 0;
+    uint32 QueueTail    = 0;
+
+    /*
+    ** Update the running sum of the average window: drop the interval that
+    ** falls out of the window before its tracker slot can be overwritten
+    */
+    LeavingIndex = ((ThisUtilIndex + HS_UTIL_PEAK_NUM_INTERVAL) - HS_UTIL_AVERAGE_NUM_INTERVAL) %
+                   HS_UTIL_PEAK_NUM_INTERVAL;
+    WindowPtr->Sum -= TrackerPtr[LeavingIndex];
+    WindowPtr->Sum += CurrentUtil;
+
+    /*
+    ** Update the peak queue: tracker slots in age order with strictly
+    ** decreasing values, so the oldest entry always holds the window peak.
+    ** The slot about to be overwritten can only be the oldest entry.
+    */
+    if ((WindowPtr->PeakQueueCount > 0) && (WindowPtr->PeakQueue[WindowPtr->PeakQueueHead] == ThisUtilIndex))
+    {
+        WindowPtr->PeakQueueHead = (WindowPtr->PeakQueueHead + 1) % HS_UTIL_PEAK_NUM_INTERVAL;
+        WindowPtr->PeakQueueCount--;
+    }
+
+    while (WindowPtr->PeakQueueCount > 0)
+    {
+        QueueTail = (WindowPtr->PeakQueueHead + WindowPtr->PeakQueueCount - 1) % HS_UTIL_PEAK_NUM_INTERVAL;
+
+        if (TrackerPtr[WindowPtr->PeakQueue[QueueTail]] > CurrentUtil)
+        {
+            break;
+        }
+
+        WindowPtr->PeakQueueCount--;
+    }
+
+    TrackerPtr[ThisUtilIndex] = CurrentUtil;
+
+    QueueTail = (WindowPtr->PeakQueueHead + WindowPtr->PeakQueueCount) % HS_UTIL_PEAK_NUM_INTERVAL;
+    WindowPtr->PeakQueue[QueueTail] = ThisUtilIndex;
+    WindowPtr->PeakQueueCount++;
+
+    return;
+
+} /* end HS_UtilWindowUpdate */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record an interval utilization in the multi-level history       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilHistRecord(uint32 CurrentUtil)
+{
+    HS_UtilHistLevel_t *HistPtr = NULL;
+    HS_UtilHistEntry_t  Entry;
+    uint32              Level = 0;
+
+    Entry.Avg = CurrentUtil;
+    Entry.Min = CurrentUtil;
+    Entry.Max = CurrentUtil;
+
+    for (Level = 0; Level < HS_UTIL_HIST_NUM_LEVELS; Level++)
+    {
+        HistPtr = &HS_AppData.UtilHist[Level];
+
+        /*
+        ** Above the interval level, only store an entry once enough
+        ** entries of the level below have been rolled up
+        */
+        if (Level > 0)
+        {
+            if (HistPtr->RollupCount == 0)
+            {
+                HistPtr->RollupSum = 0;
+                HistPtr->RollupMin = Entry.Min;
+                HistPtr->RollupMax = Entry.Max;
+            }
+
+            HistPtr->RollupSum += Entry.Avg;
+
+            if (Entry.Min < HistPtr->RollupMin)
+            {
+                HistPtr->RollupMin = Entry.Min;
+            }
+
+            if (Entry.Max > HistPtr->RollupMax)
+            {
+                HistPtr->RollupMax = Entry.Max;
+            }
+
+            HistPtr->RollupCount++;
+
+            if (HistPtr->RollupCount < HS_UTIL_HIST_ROLLUP)
+            {
+                break;
+            }
+
+            Entry.Avg            = HistPtr->RollupSum / HS_UTIL_HIST_ROLLUP;
+            Entry.Min            = HistPtr->RollupMin;
+            Entry.Max            = HistPtr->RollupMax;
+            HistPtr->RollupCount = 0;
+        }
+
+        HistPtr->Entries[HistPtr->NextIndex] = Entry;
+        HistPtr->NextIndex                   = (HistPtr->NextIndex + 1) % HS_UTIL_HIST_DEPTH;
+
+        if (HistPtr->NumEntries < HS_UTIL_HIST_DEPTH)
+        {
+            HistPtr->NumEntries++;
+        }
+    }
+
+    return;
+
+} /* end HS_UtilHistRecord */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record an interval utilization in the percentile histogram      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilPctlRecord(uint32 CurrentUtil)
+{
+    HS_UtilPctl_t *PctlPtr = &HS_AppData.UtilPctl;
+    uint32         Bucket  = 0;
+
+    Bucket = (CurrentUtil * HS_UTIL_PCTL_NUM_BUCKETS) / HS_UTIL_PER_INTERVAL_TOTAL;
+
+    if (Bucket >= HS_UTIL_PCTL_NUM_BUCKETS)
+    {
+        Bucket = HS_UTIL_PCTL_NUM_BUCKETS - 1;
+    }
+
+    /* Once the window is full, the interval being overwritten leaves the histogram */
+    if (PctlPtr->NumSamples < HS_UTIL_PCTL_WINDOW)
+    {
+        PctlPtr->NumSamples++;
+    }
+    else
+    {
+        PctlPtr->Counts[PctlPtr->Window[PctlPtr->NextIndex]]--;
+    }
+
+    PctlPtr->Counts[Bucket]++;
+    PctlPtr->Window[PctlPtr->NextIndex] = (uint16)Bucket;
+    PctlPtr->NextIndex                  = (PctlPtr->NextIndex + 1) % HS_UTIL_PCTL_WINDOW;
+
+    return;
+
+} /* end HS_UtilPctlRecord */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get a percentile of interval utilization                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_UtilPctlValue(uint32 Percent)
+{
+    HS_UtilPctl_t *PctlPtr = &HS_AppData.UtilPctl;
+    uint32         Target  = 0;
+    uint32         Count   = 0;
+    uint32         Bucket  = 0;
+
+    if (PctlPtr->NumSamples == 0)
+    {
+        return 0;
+    }
+
+    /* Rank of the interval at the percentile, rounded up */
+    Target = ((PctlPtr->NumSamples * Percent) + 99) / 100;
+
+    for (Bucket = 0; Bucket < (HS_UTIL_PCTL_NUM_BUCKETS - 1); Bucket++)
+    {
+        Count += PctlPtr->Counts[Bucket];
+
+        if (Count >= Target)
+        {
+            break;
+        }
+    }
+
+    return ((Bucket + 1) * HS_UTIL_PER_INTERVAL_TOTAL) / HS_UTIL_PCTL_NUM_BUCKETS;
+
+} /* end HS_UtilPctlValue */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Monitor the CPU usage of each task                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorTaskCpu(void)
+{
+    HS_TaskCpuPayload_t *PayloadPtr = &HS_AppData.TaskCpuPacket.Payload;
+    HS_TaskCpuSample_t * CurrPtr    = NULL;
+    HS_TaskCpuSample_t * PrevPtr    = NULL;
+    HS_TaskCpuEntry_t *  EntryPtr   = NULL;
+    uint32               TopIndex[HS_TASK_CPU_TOP_N];
+    uint32               TopUtil[HS_TASK_CPU_TOP_N];
+    uint32               WaitIndex[HS_TASK_CPU_TOP_N];
+    uint32               WaitDelay[HS_TASK_CPU_TOP_N];
+    uint32               ThreadUtil[HS_TASK_CPU_MAX_TASKS];
+    uint32               ThreadDelay[HS_TASK_CPU_MAX_TASKS];
+    uint32               ThreadVol[HS_TASK_CPU_MAX_TASKS];
+    uint32               ThreadInvol[HS_TASK_CPU_MAX_TASKS];
+    uint32               NumTop    = 0;
+    uint32               NumWait   = 0;
+    uint32               Curr      = 0;
+    uint32               Prev      = 0;
+    uint32               Index     = 0;
+    uint32               PrevIndex = 0;
+    uint32               Searched  = 0;
+    uint32               Rank      = 0;
+    uint32               Util      = 0;
+    uint64               Now       = 0;
+    uint64               Elapsed   = 0;
+    int32                Status    = CFE_SUCCESS;
+
+    /*
+    ** Sample into the older of the two sample sets
+    */
+    Prev = HS_AppData.TaskCpuCurrent;
+    Curr = 1 - Prev;
+    Now  = HS_GetMonotonicTimeNs();
+
+    Status = HS_ReadTaskCpuTimes(HS_AppData.TaskCpuSamples[Curr], HS_TASK_CPU_MAX_TASKS, true,
+                                 &HS_AppData.TaskCpuNumSamples[Curr]);
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (!HS_AppData.TaskCpuErrReported)
+        {
+            CFE_EVS_SendEvent(HS_TASK_CPU_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error reading per-task CPU times,RC=0x%08X", (unsigned int)Status);
+            HS_AppData.TaskCpuErrReported = true;
+        }
+
+        /* The next good sample only sets the baseline */
+        HS_AppData.TaskCpuLastTime = 0;
+        return;
+    }
+
+    HS_AppData.TaskCpuErrReported = false;
+
+    Elapsed = Now - HS_AppData.TaskCpuLastTime;
+
+    if ((HS_AppData.TaskCpuLastTime != 0) && (Elapsed != 0))
+    {
+        for (Index = 0; Index < HS_AppData.TaskCpuNumSamples[Curr]; Index++)
+        {
+            CurrPtr            = &HS_AppData.TaskCpuSamples[Curr][Index];
+            ThreadUtil[Index]  = 0;
+            ThreadDelay[Index] = 0;
+            ThreadVol[Index]   = 0;
+            ThreadInvol[Index] = 0;
+
+            /*
+            ** Threads are listed in the same order on each pass, so the
+            ** search for the previous sample normally ends at its first step
+            */
+            for (Searched = 0; Searched < HS_AppData.TaskCpuNumSamples[Prev]; Searched++)
+            {
+                PrevPtr = &HS_AppData.TaskCpuSamples[Prev][PrevIndex];
+
+                if (PrevPtr->ThreadId == CurrPtr->ThreadId)
+                {
+                    break;
+                }
+
+                PrevIndex = (PrevIndex + 1) % HS_AppData.TaskCpuNumSamples[Prev];
+            }
+
+            /* Threads without a previous sample only set their baseline */
+            if ((Searched < HS_AppData.TaskCpuNumSamples[Prev]) && (CurrPtr->CpuTimeNs >= PrevPtr->CpuTimeNs))
+            {
+                Util = (uint32)(((CurrPtr->CpuTimeNs - PrevPtr->CpuTimeNs) * HS_UTIL_PER_INTERVAL_TOTAL) / Elapsed);
+
+                if (Util > HS_UTIL_PER_INTERVAL_TOTAL)
+                {
+                    Util = HS_UTIL_PER_INTERVAL_TOTAL;
+                }
+
+                ThreadUtil[Index] = Util;
+
+                HS_TaskCpuRank(TopIndex, TopUtil, &NumTop, Index, Util);
+
+                /*
+                ** Time spent ready to run but waiting for a CPU, and how the thread gave up the CPU
+                */
+                if (CurrPtr->RunDelayNs >= PrevPtr->RunDelayNs)
+                {
+                    Util =
+                        (uint32)(((CurrPtr->RunDelayNs - PrevPtr->RunDelayNs) * HS_UTIL_PER_INTERVAL_TOTAL) / Elapsed);
+
+                    if (Util > HS_UTIL_PER_INTERVAL_TOTAL)
+                    {
+                        Util = HS_UTIL_PER_INTERVAL_TOTAL;
+                    }
+
+                    ThreadDelay[Index] = Util;
+
+                    HS_TaskCpuRank(WaitIndex, WaitDelay, &NumWait, Index, Util);
+                }
+
+                ThreadVol[Index]   = CurrPtr->VolCtxSwitches - PrevPtr->VolCtxSwitches;
+                ThreadInvol[Index] = CurrPtr->InvolCtxSwitches - PrevPtr->InvolCtxSwitches;
+            }
+        }
+
+        /*
+        ** Report the top consumers and the longest waits, mapped to their cFE tasks
+        */
+        memset(PayloadPtr, 0, sizeof(*PayloadPtr));
+
+        PayloadPtr->NumTasks       = HS_AppData.TaskCpuNumSamples[Curr];
+        PayloadPtr->NumEntries     = NumTop;
+        PayloadPtr->NumWaitEntries = NumWait;
+
+        for (Rank = 0; Rank < (NumTop + NumWait); Rank++)
+        {
+            if (Rank < NumTop)
+            {
+                Index    = TopIndex[Rank];
+                EntryPtr = &PayloadPtr->Entries[Rank];
+            }
+            else
+            {
+                Index    = WaitIndex[Rank - NumTop];
+                EntryPtr = &PayloadPtr->WaitEntries[Rank - NumTop];
+            }
+
+            CurrPtr = &HS_AppData.TaskCpuSamples[Curr][Index];
+
+            strncpy(EntryPtr->TaskName, CurrPtr->Name, OS_MAX_API_NAME - 1);
+            EntryPtr->ThreadId         = CurrPtr->ThreadId;
+            EntryPtr->Util             = ThreadUtil[Index];
+            EntryPtr->RunDelay         = ThreadDelay[Index];
+            EntryPtr->VolCtxSwitches   = ThreadVol[Index];
+            EntryPtr->InvolCtxSwitches = ThreadInvol[Index];
+
+            if (HS_FindTaskByThreadName(CurrPtr->Name, &EntryPtr->TaskId) != CFE_SUCCESS)
+            {
+                EntryPtr->TaskId = CFE_ES_TASKID_UNDEFINED;
+            }
+        }
+
+        CFE_SB_TimeStampMsg(&HS_AppData.TaskCpuPacket.TlmHeader.Msg);
+        CFE_SB_TransmitMsg(&HS_AppData.TaskCpuPacket.TlmHeader.Msg, true);
+
+        HS_MonitorCpuBudget(HS_AppData.TaskCpuSamples[Curr], ThreadUtil, HS_AppData.TaskCpuNumSamples[Curr]);
+        HS_MonitorRunDelay(PayloadPtr);
+    }
+
+    HS_AppData.TaskCpuCurrent  = Curr;
+    HS_AppData.TaskCpuLastTime = Now;
+
+    return;
+
+} /* end HS_MonitorTaskCpu */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rank a thread in a top list                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_TaskCpuRank(uint32 *TopIndex, uint32 *TopValue, uint32 *NumTopPtr, uint32 Index, uint32 Value)
+{
+    uint32 Rank = *NumTopPtr;
+
+    while ((Rank > 0) && (TopValue[Rank - 1] < Value))
+    {
+        if (Rank < HS_TASK_CPU_TOP_N)
+        {
+            TopIndex[Rank] = TopIndex[Rank - 1];
+            TopValue[Rank] = TopValue[Rank - 1];
+        }
+
+        Rank--;
+    }
+
+    if (Rank < HS_TASK_CPU_TOP_N)
+    {
+        TopIndex[Rank] = Index;
+        TopValue[Rank] = Value;
+
+        if (*NumTopPtr < HS_TASK_CPU_TOP_N)
+        {
+            (*NumTopPtr)++;
+        }
+    }
+
+    return;
+
+} /* end HS_TaskCpuRank */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Act on the longest run queue wait                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorRunDelay(const HS_TaskCpuPayload_t *PayloadPtr)
+{
+    const HS_TaskCpuEntry_t *WorstPtr     = &PayloadPtr->WaitEntries[0];
+    uint32                   MsgActsIndex = 0;
+    uint32                   RunDelay     = 0;
+
+    if (HS_TASK_RUN_DELAY_THRESHOLD == 0)
+    {
+        return;
+    }
+
+    if (PayloadPtr->NumWaitEntries > 0)
+    {
+        RunDelay = WorstPtr->RunDelay;
+    }
+
+    if (HS_AppData.RunDelayActive)
+    {
+        if (RunDelay < HS_TASK_RUN_DELAY_THRESHOLD)
+        {
+            HS_AppData.RunDelayActive = false;
+
+            if (HS_TASK_RUN_DELAY_ACTION != HS_ALARM_ACT_NOACT)
+            {
+                CFE_EVS_SendEvent(HS_TASK_RUN_DELAY_CLEAR_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Run Delay Cleared: Wait = %d", (int)RunDelay);
+            }
+        }
+
+        return;
+    }
+
+    if (RunDelay < HS_TASK_RUN_DELAY_THRESHOLD)
+    {
+        return;
+    }
+
+    HS_AppData.RunDelayActive = true;
+
+    switch (HS_TASK_RUN_DELAY_ACTION)
+    {
+        case HS_ALARM_ACT_NOACT:
+            break;
+
+        case HS_ALARM_ACT_EVENT:
+            CFE_EVS_SendEvent(HS_TASK_RUN_DELAY_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Run Delay Reached: Task = %s, Wait = %d: Action: Event Only", WorstPtr->TaskName,
+                              (int)RunDelay);
+            break;
+
+        /*
+        ** Message Action types processing (invalid will be skipped)
+        */
+        default:
+
+            /* Calculate the requested message action index */
+            MsgActsIndex = HS_TASK_RUN_DELAY_ACTION - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+            /*
+            ** Send the message if valid, off cooldown and not disabled
+            */
+            if (HS_ExecuteMsgAction(MsgActsIndex))
+            {
+                CFE_EVS_SendEvent(HS_TASK_RUN_DELAY_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Run Delay Reached: Task = %s, Wait = %d: Action: Message Action Index: %d",
+                                  WorstPtr->TaskName, (int)RunDelay, (int)MsgActsIndex);
+            }
+
+            /* Otherwise, Take No Action */
+            break;
+    }
+
+    return;
+
+} /* end HS_MonitorRunDelay */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Measure the stack high-water marks of a few threads             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorStacks(void)
+{
+    HS_StackPayload_t *       PayloadPtr = &HS_AppData.StackPacket.Payload;
+    const HS_TaskCpuSample_t *SamplePtr  = NULL;
+    HS_StackEntry_t *         EntryPtr   = NULL;
+    CFE_ES_TaskId_t           TaskId     = CFE_ES_TASKID_UNDEFINED;
+    CFE_ES_TaskInfo_t         TaskInfo;
+    uint32                    NumTasks  = HS_AppData.TaskCpuNumSamples[HS_AppData.TaskCpuCurrent];
+    uint32                    Count     = 0;
+    uint32                    Index     = 0;
+    uint32                    StackSize = 0;
+    uint32                    StackUsed = 0;
+
+    if ((HS_STACK_TASKS_PER_INTERVAL == 0) || (NumTasks == 0))
+    {
+        return;
+    }
+
+    for (Count = 0; (Count < HS_STACK_TASKS_PER_INTERVAL) && (Count < NumTasks); Count++)
+    {
+        /* The thread list may have shrunk since the last interval */
+        if (HS_AppData.StackNext >= NumTasks)
+        {
+            HS_AppData.StackNext = 0;
+        }
+
+        Index     = HS_AppData.StackNext;
+        SamplePtr = &HS_AppData.TaskCpuSamples[HS_AppData.TaskCpuCurrent][Index];
+        EntryPtr  = &PayloadPtr->Entries[Index];
+
+        /* A different thread in this slot starts its own high-water mark */
+        if (EntryPtr->ThreadId != SamplePtr->ThreadId)
+        {
+            memset(EntryPtr, 0, sizeof(*EntryPtr));
+            strncpy(EntryPtr->TaskName, SamplePtr->Name, OS_MAX_API_NAME - 1);
+            EntryPtr->ThreadId = SamplePtr->ThreadId;
+
+            if ((HS_FindTaskByThreadName(SamplePtr->Name, &TaskId) == CFE_SUCCESS) &&
+                (CFE_ES_GetTaskInfo(&TaskInfo, TaskId) == CFE_SUCCESS))
+            {
+                EntryPtr->EsStackSize = TaskInfo.StackSize;
+            }
+        }
+
+        if ((HS_ReadThreadStack(SamplePtr->ThreadId, &StackSize, &StackUsed) == CFE_SUCCESS) && (StackSize != 0))
+        {
+            EntryPtr->StackSize = StackSize;
+
+            if (StackUsed > EntryPtr->StackUsed)
+            {
+                EntryPtr->StackUsed = StackUsed;
+            }
+
+            EntryPtr->Usage = (uint16)(((uint64)EntryPtr->StackUsed * 100) / StackSize);
+
+            if ((HS_STACK_USAGE_THRESHOLD != 0) && (EntryPtr->Usage >= HS_STACK_USAGE_THRESHOLD) &&
+                !EntryPtr->ActionTaken)
+            {
+                EntryPtr->ActionTaken = true;
+                HS_StackUsageAction(EntryPtr);
+            }
+        }
+
+        HS_AppData.StackNext++;
+
+        /*
+        ** Report once every thread has had its turn
+        */
+        if (HS_AppData.StackNext >= NumTasks)
+        {
+            HS_AppData.StackNext     = 0;
+            HS_AppData.StackMaxUsage = 0;
+            PayloadPtr->NumTasks     = NumTasks;
+            PayloadPtr->NumMeasured  = 0;
+
+            memset(&PayloadPtr->Entries[NumTasks], 0, (HS_TASK_CPU_MAX_TASKS - NumTasks) * sizeof(HS_StackEntry_t));
+
+            for (Index = 0; Index < NumTasks; Index++)
+            {
+                if (PayloadPtr->Entries[Index].StackSize != 0)
+                {
+                    PayloadPtr->NumMeasured++;
+                }
+
+                if (PayloadPtr->Entries[Index].Usage > HS_AppData.StackMaxUsage)
+                {
+                    HS_AppData.StackMaxUsage = PayloadPtr->Entries[Index].Usage;
+                }
+            }
+
+            CFE_SB_TimeStampMsg(&HS_AppData.StackPacket.TlmHeader.Msg);
+            CFE_SB_TransmitMsg(&HS_AppData.StackPacket.TlmHeader.Msg, true);
+        }
+    }
+
+    return;
+
+} /* end HS_MonitorStacks */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take the stack usage action for a thread                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_StackUsageAction(const HS_StackEntry_t *EntryPtr)
+{
+    uint32 MsgActsIndex = 0;
+
+    switch (HS_STACK_USAGE_ACTION)
+    {
+        case HS_ALARM_ACT_NOACT:
+            break;
+
+        case HS_ALARM_ACT_EVENT:
+            CFE_EVS_SendEvent(HS_STACK_USAGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Stack Usage Reached: Task = %s, Used = %u of %u bytes (%d%%): Action: Event Only",
+                              EntryPtr->TaskName, (unsigned int)EntryPtr->StackUsed,
+                              (unsigned int)EntryPtr->StackSize, (int)EntryPtr->Usage);
+            break;
+
+        /*
+        ** Message Action types processing (invalid will be skipped)
+        */
+        default:
+
+            /* Calculate the requested message action index */
+            MsgActsIndex = HS_STACK_USAGE_ACTION - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+            /*
+            ** Send the message if valid, off cooldown and not disabled
+            */
+            if (HS_ExecuteMsgAction(MsgActsIndex))
+            {
+                CFE_EVS_SendEvent(HS_STACK_USAGE_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Stack Usage Reached: Task = %s (%d%%): Action: Message Action Index: %d",
+                                  EntryPtr->TaskName, (int)EntryPtr->Usage, (int)MsgActsIndex);
+            }
+
+            /* Otherwise, Take No Action */
+            break;
+    }
+
+    return;
+
+} /* end HS_StackUsageAction */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Request the Software Bus statistics                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorSbPipes(void)
+{
+#if HS_SB_STATS_PERIOD != 0
+    CFE_SB_PipeId_t PipeId = CFE_SB_INVALID_PIPE;
+    uint32          Index  = 0;
+
+    HS_AppData.SbStatsCounter++;
+
+    if (HS_AppData.SbStatsCounter < HS_SB_STATS_PERIOD)
+    {
+        return;
+    }
+
+    HS_AppData.SbStatsCounter = 0;
+
+    /*
+    ** Look up the monitored pipes that did not exist at the last request
+    */
+    for (Index = 0; Index < HS_SB_MAX_PIPE_LIMITS; Index++)
+    {
+        if ((HS_AppData.SbPipeLimits[Index].EnterUsage != 0) &&
+            !CFE_RESOURCEID_TEST_DEFINED(HS_AppData.SbPipeIds[Index]) &&
+            (CFE_SB_GetPipeIdByName(&PipeId, HS_AppData.SbPipeLimits[Index].PipeName) == CFE_SUCCESS))
+        {
+            HS_AppData.SbPipeIds[Index] = PipeId;
+        }
+    }
+
+    CFE_SB_TransmitMsg(&HS_AppData.SbStatsCmd.Msg, true);
+#endif
+
+    return;
+
+} /* end HS_MonitorSbPipes */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process the Software Bus statistics                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbStatsTlm(const CFE_SB_Buffer_t *BufPtr)
+{
+    const CFE_SB_StatsTlm_t *      StatsPtr = NULL;
+    const CFE_SB_PipeDepthStats_t *DepthPtr = NULL;
+    const HS_SbPipeLimit_t *       LimitPtr = NULL;
+    CFE_SB_PipeId_t                WorstIds[HS_SB_WORST_PIPES];
+    HS_SbPipeTlm_t                 PipeTlm;
+    size_t                         ActualLength = 0;
+    uint32                         NumPipes     = 0;
+    uint32                         NumWorst     = 0;
+    uint32                         Index        = 0;
+    uint32                         Position     = 0;
+    uint32                         LimitIndex   = 0;
+    uint32                         LimitBit     = 0;
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
+
+    if (ActualLength != sizeof(CFE_SB_StatsTlm_t))
+    {
+        return;
+    }
+
+    StatsPtr = (const CFE_SB_StatsTlm_t *)BufPtr;
+    NumPipes = StatsPtr->Payload.PipesInUse;
+
+    if (NumPipes > CFE_MISSION_SB_MAX_PIPES)
+    {
+        NumPipes = CFE_MISSION_SB_MAX_PIPES;
+    }
+
+    memset(HS_AppData.SbWorstPipes, 0, sizeof(HS_AppData.SbWorstPipes));
+    memset(&PipeTlm, 0, sizeof(PipeTlm));
+
+    for (Index = 0; Index < NumPipes; Index++)
+    {
+        DepthPtr = &StatsPtr->Payload.PipeDepthStats[Index];
+
+        if (DepthPtr->MaxQueueDepth == 0)
+        {
+            continue;
+        }
+
+        PipeTlm.CurrentDepth = DepthPtr->CurrentQueueDepth;
+        PipeTlm.PeakDepth    = DepthPtr->PeakQueueDepth;
+        PipeTlm.MaxDepth     = DepthPtr->MaxQueueDepth;
+        PipeTlm.Usage        = (uint8)(((uint32)DepthPtr->CurrentQueueDepth * 100) / DepthPtr->MaxQueueDepth);
+        PipeTlm.PeakUsage    = (uint8)(((uint32)DepthPtr->PeakQueueDepth * 100) / DepthPtr->MaxQueueDepth);
+
+        /*
+        ** Insert the pipe into the worst pipes, highest usage first and
+        ** highest peak usage first among equal usages
+        */
+        Position = NumWorst;
+        while ((Position > 0) &&
+               ((PipeTlm.Usage > HS_AppData.SbWorstPipes[Position - 1].Usage) ||
+                ((PipeTlm.Usage == HS_AppData.SbWorstPipes[Position - 1].Usage) &&
+                 (PipeTlm.PeakUsage > HS_AppData.SbWorstPipes[Position - 1].PeakUsage))))
+        {
+            Position--;
+        }
+
+        if (Position < HS_SB_WORST_PIPES)
+        {
+            if (NumWorst < HS_SB_WORST_PIPES)
+            {
+                NumWorst++;
+            }
+
+            memmove(&HS_AppData.SbWorstPipes[Position + 1], &HS_AppData.SbWorstPipes[Position],
+                    (NumWorst - Position - 1) * sizeof(HS_SbPipeTlm_t));
+            memmove(&WorstIds[Position + 1], &WorstIds[Position], (NumWorst - Position - 1) * sizeof(CFE_SB_PipeId_t));
+
+            HS_AppData.SbWorstPipes[Position] = PipeTlm;
+            WorstIds[Position]                = DepthPtr->PipeId;
+        }
+
+        /*
+        ** Check the pipe against its limit if it is monitored
+        */
+        for (LimitIndex = 0; LimitIndex < HS_SB_MAX_PIPE_LIMITS; LimitIndex++)
+        {
+            if (!CFE_RESOURCEID_TEST_DEFINED(HS_AppData.SbPipeIds[LimitIndex]) ||
+                !CFE_RESOURCEID_TEST_EQUAL(HS_AppData.SbPipeIds[LimitIndex], DepthPtr->PipeId))
+            {
+                continue;
+            }
+
+            LimitPtr = &HS_AppData.SbPipeLimits[LimitIndex];
+            LimitBit = 1U << LimitIndex;
+
+            if (((HS_AppData.SbPipeActiveMask & LimitBit) == 0) && (LimitPtr->EnterUsage != 0) &&
+                (PipeTlm.Usage >= LimitPtr->EnterUsage))
+            {
+                HS_AppData.SbPipeActiveMask |= LimitBit;
+                HS_SbPipeAction(LimitIndex, &PipeTlm);
+            }
+            else if (((HS_AppData.SbPipeActiveMask & LimitBit) != 0) && (PipeTlm.Usage < LimitPtr->ExitUsage))
+            {
+                HS_AppData.SbPipeActiveMask &= ~LimitBit;
+                CFE_EVS_SendEvent(HS_SB_PIPE_BACKLOG_CLEAR_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "SB Pipe Backlog Cleared: Pipe = %s, Depth = %u of %u", LimitPtr->PipeName,
+                                  (unsigned int)PipeTlm.CurrentDepth, (unsigned int)PipeTlm.MaxDepth);
+            }
+        }
+    }
+
+    /*
+    ** Only the worst pipes are named
+    */
+    for (Position = 0; Position < NumWorst; Position++)
+    {
+        if (CFE_SB_GetPipeName(HS_AppData.SbWorstPipes[Position].PipeName,
+                               sizeof(HS_AppData.SbWorstPipes[Position].PipeName), WorstIds[Position]) != CFE_SUCCESS)
+        {
+            HS_AppData.SbWorstPipes[Position].PipeName[0] = '\0';
+        }
+    }
+
+    return;
+
+} /* end HS_SbStatsTlm */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process the Software Bus housekeeping                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbHkTlm(const CFE_SB_Buffer_t *BufPtr)
+{
+    const CFE_SB_HousekeepingTlm_t *HkPtr        = NULL;
+    size_t                          ActualLength = 0;
+    uint16                          Overflows    = 0;
+    uint16                          MsgLimits    = 0;
+    uint32                          Drops        = 0;
+
+    CFE_MSG_GetSize(&BufPtr->Msg, &ActualLength);
+
+    if (ActualLength != sizeof(CFE_SB_HousekeepingTlm_t))
+    {
+        return;
+    }
+
+    HkPtr     = (const CFE_SB_HousekeepingTlm_t *)BufPtr;
+    Overflows = HkPtr->Payload.PipeOverflowErrorCounter;
+    MsgLimits = HkPtr->Payload.MsgLimitErrorCounter;
+
+    if (HS_AppData.SbHkReceived)
+    {
+        /*
+        ** A counter that went down was reset, count from zero
+        */
+        Drops = Overflows;
+        if (Overflows >= HS_AppData.SbLastOverflowErrors)
+        {
+            Drops = Overflows - HS_AppData.SbLastOverflowErrors;
+        }
+
+        if (MsgLimits >= HS_AppData.SbLastMsgLimitErrors)
+        {
+            Drops += MsgLimits - HS_AppData.SbLastMsgLimitErrors;
+        }
+        else
+        {
+            Drops += MsgLimits;
+        }
+
+        HS_AppData.SbDropCount += Drops;
+
+        if (!HS_AppData.SbDropActive && (HS_SB_DROP_THRESHOLD != 0) && (Drops >= HS_SB_DROP_THRESHOLD))
+        {
+            HS_AppData.SbDropActive = true;
+            HS_SbDropAction(Drops);
+        }
+        else if (HS_AppData.SbDropActive && (Drops == 0))
+        {
+            HS_AppData.SbDropActive = false;
+            CFE_EVS_SendEvent(HS_SB_DROP_CLEAR_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "SB Dropped Messages Cleared: Total Dropped = %u", (unsigned int)HS_AppData.SbDropCount);
+        }
+    }
+
+    HS_AppData.SbLastOverflowErrors = Overflows;
+    HS_AppData.SbLastMsgLimitErrors = MsgLimits;
+    HS_AppData.SbHkReceived         = true;
+
+    return;
+
+} /* end HS_SbHkTlm */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take the backlog action for a Software Bus pipe                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbPipeAction(uint32 LimitIndex, const HS_SbPipeTlm_t *PipeTlmPtr)
+{
+    const HS_SbPipeLimit_t *LimitPtr     = &HS_AppData.SbPipeLimits[LimitIndex];
+    uint32                  MsgActsIndex = 0;
+
+    switch (LimitPtr->ActionType)
+    {
+        case HS_ALARM_ACT_NOACT:
+            break;
+
+        case HS_ALARM_ACT_EVENT:
+            CFE_EVS_SendEvent(HS_SB_PIPE_BACKLOG_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB Pipe Backlog: Pipe = %s, Depth = %u of %u (%d%%): Action: Event Only",
+                              LimitPtr->PipeName, (unsigned int)PipeTlmPtr->CurrentDepth,
+                              (unsigned int)PipeTlmPtr->MaxDepth, (int)PipeTlmPtr->Usage);
+            break;
+
+        /*
+        ** Message Action types processing (invalid will be skipped)
+        */
+        default:
+
+            /* Calculate the requested message action index */
+            MsgActsIndex = LimitPtr->ActionType - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+            /*
+            ** Send the message if valid, off cooldown and not disabled
+            */
+            if (HS_ExecuteMsgAction(MsgActsIndex))
+            {
+                CFE_EVS_SendEvent(HS_SB_PIPE_BACKLOG_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "SB Pipe Backlog: Pipe = %s (%d%%): Action: Message Action Index: %d",
+                                  LimitPtr->PipeName, (int)PipeTlmPtr->Usage, (int)MsgActsIndex);
+            }
+
+            /* Otherwise, Take No Action */
+            break;
+    }
+
+    return;
+
+} /* end HS_SbPipeAction */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take the dropped message action                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_SbDropAction(uint32 Drops)
+{
+    uint32 MsgActsIndex = 0;
+
+    switch (HS_SB_DROP_ACTION)
+    {
+        case HS_ALARM_ACT_NOACT:
+            break;
+
+        case HS_ALARM_ACT_EVENT:
+            CFE_EVS_SendEvent(HS_SB_DROP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "SB Dropped Messages: %u since last SB HK, Worst Pipe = %s: Action: Event Only",
+                              (unsigned int)Drops, HS_AppData.SbWorstPipes[0].PipeName);
+            break;
+
+        /*
+        ** Message Action types processing (invalid will be skipped)
+        */
+        default:
+
+            /* Calculate the requested message action index */
+            MsgActsIndex = HS_SB_DROP_ACTION - HS_ALARM_ACT_LAST_NONMSG - 1;
+
+            /*
+            ** Send the message if valid, off cooldown and not disabled
+            */
+            if (HS_ExecuteMsgAction(MsgActsIndex))
+            {
+                CFE_EVS_SendEvent(HS_SB_DROP_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "SB Dropped Messages: %u since last SB HK: Action: Message Action Index: %d",
+                                  (unsigned int)Drops, (int)MsgActsIndex);
+            }
+
+            /* Otherwise, Take No Action */
+            break;
+    }
+
+    return;
+
+} /* end HS_SbDropAction */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Measure the time between wakeups                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorWakeup(int32 RecvStatus)
+{
+    HS_WakeupTlm_t *TlmPtr     = &HS_AppData.WakeupTlm;
+    uint64          Now        = 0;
+    uint64          IntervalUs = 0;
+    uint64          Missed     = 0;
+    int64           Offset     = 0;
+    uint32          Bucket     = 0;
+
+    Now = HS_GetMonotonicTimeNs();
+
+    if (HS_AppData.WakeupLastTime != 0)
+    {
+        IntervalUs = (Now - HS_AppData.WakeupLastTime) / 1000;
+
+        /*
+        ** Missed wakeups follow from the time since the last one, not from
+        ** how HS was woken: a wakeup fills the nearest period, and without
+        ** one a period is missed once it is late by the late margin
+        */
+        if (RecvStatus == CFE_SUCCESS)
+        {
+            Missed = (IntervalUs + (HS_WAKEUP_PERIOD_US / 2)) / HS_WAKEUP_PERIOD_US;
+
+            if (Missed != 0)
+            {
+                Missed--;
+            }
+        }
+        else if (IntervalUs > HS_WAKEUP_LATE_US)
+        {
+            Missed = (IntervalUs - HS_WAKEUP_LATE_US) / HS_WAKEUP_PERIOD_US;
+        }
+
+        if (Missed > HS_AppData.WakeupMissed)
+        {
+            TlmPtr->MissedCount += (uint32)(Missed - HS_AppData.WakeupMissed);
+            HS_AppData.WakeupMissed = Missed;
+        }
+    }
+
+    if (RecvStatus != CFE_SUCCESS)
+    {
+        return;
+    }
+
+    if (HS_AppData.WakeupLastTime != 0)
+    {
+
+        if (IntervalUs > 0xFFFFFFFF)
+        {
+            IntervalUs = 0xFFFFFFFF;
+        }
+
+        TlmPtr->NumIntervals++;
+        HS_AppData.WakeupSumUs += IntervalUs;
+
+        TlmPtr->LastUs = (uint32)IntervalUs;
+        TlmPtr->MeanUs = (uint32)(HS_AppData.WakeupSumUs / TlmPtr->NumIntervals);
+
+        if ((TlmPtr->NumIntervals == 1) || (TlmPtr->LastUs < TlmPtr->MinUs))
+        {
+            TlmPtr->MinUs = TlmPtr->LastUs;
+        }
+
+        if (TlmPtr->LastUs > TlmPtr->MaxUs)
+        {
+            TlmPtr->MaxUs = TlmPtr->LastUs;
+        }
+
+        if (IntervalUs > ((uint64)HS_WAKEUP_PERIOD_US + HS_WAKEUP_LATE_US))
+        {
+            TlmPtr->LateCount++;
+        }
+
+        /*
+        ** Bucket by deviation from the period, the middle bucket starting
+        ** at the period and the end buckets taking everything beyond
+        */
+        Offset = (int64)IntervalUs - HS_WAKEUP_PERIOD_US +
+                 ((int64)(HS_WAKEUP_HIST_BUCKETS / 2) * HS_WAKEUP_HIST_BUCKET_US);
+
+        if (Offset > 0)
+        {
+            Bucket = (uint32)(Offset / HS_WAKEUP_HIST_BUCKET_US);
+        }
+
+        if (Bucket >= HS_WAKEUP_HIST_BUCKETS)
+        {
+            Bucket = HS_WAKEUP_HIST_BUCKETS - 1;
+        }
+
+        TlmPtr->Histogram[Bucket]++;
+    }
+
+    HS_AppData.WakeupLastTime = Now;
+    HS_AppData.WakeupMissed   = 0;
+
+    return;
+
+} /* end HS_MonitorWakeup */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hold tasks to their CPU budgets                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_MonitorCpuBudget(const HS_TaskCpuSample_t *SamplesPtr, const uint32 *UtilPtr, uint32 NumSamples)
+{
+    CFE_ES_TaskInfo_t TaskInfo;
+    HS_CBTEntry_t *   EntryPtr     = NULL;
+    CFE_ES_TaskId_t   TaskId       = CFE_ES_TASKID_UNDEFINED;
+    int32             Status       = CFE_SUCCESS;
+    uint32            TableIndex   = 0;
+    uint32            Index        = 0;
+    uint32            Util         = 0;
+    uint32            MsgActsIndex = 0;
+
+    if (HS_AppData.CpuBudgetState != HS_STATE_ENABLED)
+    {
+        return;
+    }
+
+    for (TableIndex = 0; TableIndex < HS_MAX_CPU_BUDGETS; TableIndex++)
+    {
+        EntryPtr = &HS_AppData.CBTablePtr[TableIndex];
+
+        if ((EntryPtr->Intervals == 0) || (EntryPtr->ActionType == HS_AMT_ACT_NOACT))
+        {
+            continue;
+        }
+
+        /*
+        ** Threads of the task share its name, which the operating system
+        ** may have truncated
+        */
+        Util = 0;
+
+        for (Index = 0; Index < NumSamples; Index++)
+        {
+            if (HS_ThreadNameMatches(SamplesPtr[Index].Name, EntryPtr->TaskName))
+            {
+                Util += UtilPtr[Index];
+            }
+        }
+
+        if (Util <= EntryPtr->MaxUtil)
+        {
+            HS_AppData.CpuBudgetCount[TableIndex] = 0;
+            continue;
+        }
+
+        /*
+        ** Take action once per stay over budget
+        */
+        if (HS_AppData.CpuBudgetCount[TableIndex] >= EntryPtr->Intervals)
+        {
+            continue;
+        }
+
+        HS_AppData.CpuBudgetCount[TableIndex]++;
+
+        if (HS_AppData.CpuBudgetCount[TableIndex] < EntryPtr->Intervals)
+        {
+            continue;
+        }
+
+        switch (EntryPtr->ActionType)
+        {
+            case HS_AMT_ACT_PROC_RESET:
+                CFE_EVS_SendEvent(HS_CPUBUDGET_PROC_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CPU Budget Exceeded: TASK:(%s) Util = %u, Budget = %u: Action: Processor Reset",
+                                  EntryPtr->TaskName, (unsigned int)Util, (unsigned int)EntryPtr->MaxUtil);
+
+                /*
+                ** Perform a reset if we can
+                */
+                if (HS_AppData.CDSData.ResetsPerformed < HS_AppData.CDSData.MaxResets)
+                {
+                    HS_SetCDSData((HS_AppData.CDSData.ResetsPerformed + 1), HS_AppData.CDSData.MaxResets);
+
+                    OS_TaskDelay(HS_RESET_TASK_DELAY);
+                    CFE_ES_WriteToSysLog("HS App: CPU Budget Exceeded: TASK:(%s): Action: Processor Reset\n",
+                                         EntryPtr->TaskName);
+                    HS_AppData.ServiceWatchdogFlag = HS_STATE_DISABLED;
+                    CFE_ES_ResetCFE(CFE_PSP_RST_TYPE_PROCESSOR);
+                }
+                else
+                {
+                    CFE_EVS_SendEvent(HS_RESET_LIMIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Processor Reset Action Limit Reached: No Reset Performed");
+                }
+
+                break;
+
+            case HS_AMT_ACT_APP_RESTART:
+                CFE_EVS_SendEvent(HS_CPUBUDGET_RESTART_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CPU Budget Exceeded: TASK:(%s) Util = %u, Budget = %u: Action: Restart Application",
+                                  EntryPtr->TaskName, (unsigned int)Util, (unsigned int)EntryPtr->MaxUtil);
+
+                /*
+                ** Restart the App owning the task
+                */
+                Status = CFE_ES_GetTaskIDByName(&TaskId, EntryPtr->TaskName);
+
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = CFE_ES_GetTaskInfo(&TaskInfo, TaskId);
+                }
+
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = CFE_ES_RestartApp(TaskInfo.AppId);
+                }
+
+                if (Status != CFE_SUCCESS)
+                {
+                    CFE_EVS_SendEvent(HS_CPUBUDGET_NOT_RESTARTED_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Call to Restart App Failed: TASK:(%s) ERR: 0x%08X", EntryPtr->TaskName,
+                                      (unsigned int)Status);
+                }
+
+                break;
+
+            case HS_AMT_ACT_EVENT:
+                CFE_EVS_SendEvent(HS_CPUBUDGET_FAIL_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CPU Budget Exceeded: TASK:(%s) Util = %u, Budget = %u: Action: Event Only",
+                                  EntryPtr->TaskName, (unsigned int)Util, (unsigned int)EntryPtr->MaxUtil);
+                break;
+
+            /*
+            ** Message Action types processing (invalid will be skipped)
+            */
+            default:
+
+                /* Calculate the requested message action index */
+                MsgActsIndex = EntryPtr->ActionType - HS_AMT_ACT_LAST_NONMSG - 1;
+
+                /*
+                ** Send the message if valid, off cooldown and not disabled
+                */
+                if (HS_ExecuteMsgAction(MsgActsIndex))
+                {
+                    CFE_EVS_SendEvent(HS_CPUBUDGET_MSGACTS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "CPU Budget Exceeded: TASK:(%s) Util = %u: Action: Message Action Index: %d",
+                                      EntryPtr->TaskName, (unsigned int)Util, (int)MsgActsIndex);
+                }
+
+                /* Otherwise, Take No Action */
+                break;
+        } /* end switch */
+    }
+
+    return;
+
+} /* end HS_MonitorCpuBudget */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take the thread CPU times at the start of CPU hogging           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_HogSnapshotBaseline(void)
+{
+    uint32 Curr = HS_AppData.TaskCpuCurrent;
+
+    /*
+    ** The per-task CPU monitor sampled at the end of the previous
+    ** interval, which is the start of the hogging window
+    */
+    if (HS_AppData.TaskCpuLastTime != 0)
+    {
+        memcpy(HS_AppData.HogBaseline, HS_AppData.TaskCpuSamples[Curr],
+               HS_AppData.TaskCpuNumSamples[Curr] * sizeof(HS_TaskCpuSample_t));
+        HS_AppData.HogBaselineNum  = HS_AppData.TaskCpuNumSamples[Curr];
+        HS_AppData.HogBaselineTime = HS_AppData.TaskCpuLastTime;
+    }
+    else if (HS_ReadTaskCpuTimes(HS_AppData.HogBaseline, HS_TASK_CPU_MAX_TASKS, false,
+                                 &HS_AppData.HogBaselineNum) == CFE_SUCCESS)
+    {
+        HS_AppData.HogBaselineTime = HS_GetMonotonicTimeNs();
+    }
+    else
+    {
+        HS_AppData.HogBaselineTime = 0;
+    }
+
+    return;
+
+} /* end HS_HogSnapshotBaseline */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take and report a snapshot of the detected CPU hogging          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_HogSnapshotCapture(uint32 ThisUtilIndex)
+{
+    HS_HogSnapshot_t *     SnapPtr    = &HS_AppData.HogSnapshot;
+    HS_HogSnapshotEntry_t *EntryPtr   = NULL;
+    HS_TaskCpuSample_t *   SamplesPtr = NULL;
+    HS_TaskCpuSample_t *   CurrPtr    = NULL;
+    HS_TaskCpuSample_t *   BasePtr    = NULL;
+    char                   Summary[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    size_t                 SummaryLen = 0;
+    uint32                 NumSamples = 0;
+    uint32                 Index      = 0;
+    uint32                 BaseIndex  = 0;
+    uint32                 Searched   = 0;
+    uint32                 Rank       = 0;
+    uint64                 Now        = 0;
+    uint64                 Elapsed    = 0;
+    uint64                 DeltaNs    = 0;
+
+    /*
+    ** The next per-task CPU sample overwrites the older sample set,
+    ** so it can hold the thread CPU times until then
+    */
+    SamplesPtr = HS_AppData.TaskCpuSamples[1 - HS_AppData.TaskCpuCurrent];
+    Now        = HS_GetMonotonicTimeNs();
+
+    memset(SnapPtr, 0, sizeof(*SnapPtr));
+
+    if ((HS_AppData.HogBaselineTime != 0) && (Now > HS_AppData.HogBaselineTime))
+    {
+        Elapsed = Now - HS_AppData.HogBaselineTime;
+    }
+
+    if (HS_ReadTaskCpuTimes(SamplesPtr, HS_TASK_CPU_MAX_TASKS, false, &NumSamples) != CFE_SUCCESS)
+    {
+        NumSamples = 0;
+    }
+
+    for (Index = 0; Index < NumSamples; Index++)
+    {
+        CurrPtr = &SamplesPtr[Index];
+        DeltaNs = 0;
+
+        if (Elapsed != 0)
+        {
+            for (Searched = 0; Searched < HS_AppData.HogBaselineNum; Searched++)
+            {
+                BasePtr = &HS_AppData.HogBaseline[BaseIndex];
+
+                if (BasePtr->ThreadId == CurrPtr->ThreadId)
+                {
+                    break;
+                }
+
+                BaseIndex = (BaseIndex + 1) % HS_AppData.HogBaselineNum;
+            }
+
+            /* Threads started during the window used all of their CPU time in it */
+            if (Searched >= HS_AppData.HogBaselineNum)
+            {
+                DeltaNs = CurrPtr->CpuTimeNs;
+            }
+            else if (CurrPtr->CpuTimeNs >= BasePtr->CpuTimeNs)
+            {
+                DeltaNs = CurrPtr->CpuTimeNs - BasePtr->CpuTimeNs;
+            }
+        }
+
+        /*
+        ** Insert into the entries sorted by CPU time
+        */
+        Rank = SnapPtr->NumEntries;
+
+        while ((Rank > 0) && (SnapPtr->Entries[Rank - 1].CpuTimeUs < (DeltaNs / 1000)))
+        {
+            SnapPtr->Entries[Rank] = SnapPtr->Entries[Rank - 1];
+            Rank--;
+        }
+
+        EntryPtr = &SnapPtr->Entries[Rank];
+        memset(EntryPtr, 0, sizeof(*EntryPtr));
+
+        strncpy(EntryPtr->TaskName, CurrPtr->Name, OS_MAX_API_NAME - 1);
+        EntryPtr->ThreadId  = CurrPtr->ThreadId;
+        EntryPtr->CpuTimeUs = (uint32)(DeltaNs / 1000);
+        EntryPtr->State     = CurrPtr->State;
+
+        if (Elapsed != 0)
+        {
+            EntryPtr->Util = (uint32)((DeltaNs * HS_UTIL_PER_INTERVAL_TOTAL) / Elapsed);
+
+            if (EntryPtr->Util > HS_UTIL_PER_INTERVAL_TOTAL)
+            {
+                EntryPtr->Util = HS_UTIL_PER_INTERVAL_TOTAL;
+            }
+        }
+
+        SnapPtr->NumEntries++;
+    }
+
+    SnapPtr->WindowMs = (uint32)(Elapsed / 1000000);
+
+    for (Index = 0; Index < HS_HOG_SNAPSHOT_NUM_UTIL; Index++)
+    {
+        SnapPtr->Util[Index] = HS_AppData.UtilizationTracker[(ThisUtilIndex + HS_UTIL_PEAK_NUM_INTERVAL + 1 -
+                                                              HS_HOG_SNAPSHOT_NUM_UTIL + Index) %
+                                                             HS_UTIL_PEAK_NUM_INTERVAL];
+    }
+
+    HS_HogSnapshotWriteFile(HS_HOG_SNAPSHOT_FILENAME, SnapPtr);
+
+    /*
+    ** Name the top threads in one event
+    */
+    Summary[0] = '\0';
+
+    for (Rank = 0; (Rank < SnapPtr->NumEntries) && (Rank < HS_HOG_SNAPSHOT_EVENT_TASKS); Rank++)
+    {
+        snprintf(&Summary[SummaryLen], sizeof(Summary) - SummaryLen, " %s=%u", SnapPtr->Entries[Rank].TaskName,
+                 (unsigned int)SnapPtr->Entries[Rank].Util);
+        SummaryLen = strlen(Summary);
+    }
+
+    CFE_EVS_SendEvent(HS_HOG_SNAPSHOT_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "CPU hog snapshot over %u ms of %u threads:%s", (unsigned int)SnapPtr->WindowMs,
+                      (unsigned int)SnapPtr->NumEntries, Summary);
+
+    return;
+
+} /* end HS_HogSnapshotCapture */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a CPU hog snapshot to a file                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_HogSnapshotWriteFile(const char *Filename, const HS_HogSnapshot_t *SnapPtr)
+{
+    osal_id_t       FileHandle = OS_OBJECT_ID_UNDEFINED;
+    CFE_FS_Header_t FileHeader;
+    int32           Status    = CFE_SUCCESS;
+    size_t          WriteSize = 0;
+
+    Status = OS_OpenCreate(&FileHandle, Filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
+    if (Status != OS_SUCCESS)
     {
-        CurrentUtil = 0;
+        CFE_EVS_SendEvent(HS_HOG_SNAPSHOT_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error creating CPU hog snapshot file %s, RC=0x%08X", Filename, (unsigned int)Status);
+        return (Status);
     }
 
-    if ((CurrentUtil >= HS_UTIL_PER_INTERVAL_HOGGING) && (HS_AppData.CurrentCPUHogState == HS_STATE_ENABLED))
-    {
-        HS_AppData.CurrentCPUHoggingTime++;
+    CFE_FS_InitHeader(&FileHeader, "HS CPU Hog Snapshot", HS_HOG_SNAPSHOT_FILE_SUBTYPE);
 
-        if (HS_AppData.CurrentCPUHoggingTime == HS_AppData.MaxCPUHoggingTime)
-        {
-            CFE_EVS_SendEvent(HS_CPUMON_HOGGING_ERR_EID, CFE_EVS_EventType_ERROR, "CPU Hogging Detected");
-            CFE_ES_WriteToSysLog("HS App: CPU Hogging Detected\n");
-        }
-    }
-    else
+    Status = CFE_FS_WriteHeader(FileHandle, &FileHeader);
+    if (Status != sizeof(CFE_FS_Header_t))
     {
-        HS_AppData.CurrentCPUHoggingTime = 0;
+        CFE_EVS_SendEvent(HS_HOG_SNAPSHOT_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error writing CPU hog snapshot file header %s, RC=0x%08X", Filename,
+                          (unsigned int)Status);
+        OS_close(FileHandle);
+        return (CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     }
 
-    HS_AppData.UtilizationTracker[ThisUtilIndex] = CurrentUtil;
+    /*
+    ** Only the valid entries of the snapshot are written
+    */
+    WriteSize =
+        sizeof(HS_HogSnapshot_t) - sizeof(SnapPtr->Entries) + (SnapPtr->NumEntries * sizeof(HS_HogSnapshotEntry_t));
 
-    for (UtilIndex = 0; UtilIndex < HS_UTIL_PEAK_NUM_INTERVAL; UtilIndex++)
+    Status = OS_write(FileHandle, SnapPtr, WriteSize);
+    if (Status != (int32)WriteSize)
     {
-        if (HS_AppData.UtilizationTracker[UtilIndex] > PeakUtil)
-        {
-            PeakUtil = HS_AppData.UtilizationTracker[UtilIndex];
-        }
-
-        if (ThisUtilIndex >= HS_UTIL_AVERAGE_NUM_INTERVAL)
-        {
-            if ((UtilIndex > (ThisUtilIndex - HS_UTIL_AVERAGE_NUM_INTERVAL)) && (UtilIndex <= ThisUtilIndex))
-            {
-                CombinedUtil += HS_AppData.UtilizationTracker[UtilIndex];
-            }
-        }
-        else
-        {
-            if ((UtilIndex <= ThisUtilIndex) ||
-                (UtilIndex > (HS_UTIL_PEAK_NUM_INTERVAL - (HS_UTIL_AVERAGE_NUM_INTERVAL - ThisUtilIndex))))
-            {
-                CombinedUtil += HS_AppData.UtilizationTracker[UtilIndex];
-            }
-        }
+        CFE_EVS_SendEvent(HS_HOG_SNAPSHOT_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error writing CPU hog snapshot file data %s, RC=0x%08X", Filename, (unsigned int)Status);
+        OS_close(FileHandle);
+        return (CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     }
 
-    HS_AppData.UtilCpuAvg  = (CombinedUtil / HS_UTIL_AVERAGE_NUM_INTERVAL);
-    HS_AppData.UtilCpuPeak = PeakUtil;
+    OS_close(FileHandle);
 
-    return;
+    return (CFE_SUCCESS);
 
-} /* end HS_MonitorUtilization */
+} /* end HS_HogSnapshotWriteFile */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -606,6 +2656,14 @@ int32 HS_ValidateEMTable(void *TableData)
             EntryResult = HS_EMTVAL_ERR_NUL;
             BadCount++;
         }
+        else if (TableArray[TableIndex].Padding != 0)
+        {
+            /*
+            ** Padding is reserved and must be zero
+            */
+            EntryResult = HS_EMTVAL_ERR_PAD;
+            BadCount++;
+        }
         else if (!HS_EMTActionIsValid(ActionType))
         {
             /*
@@ -841,6 +2899,298 @@ int32 HS_ValidateMATable(void *TableData)
 
 } /* end HS_ValidateMATable */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate the load shedding table                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ValidateLSTable(void *TableData)
+{
+    HS_LSTEntry_t *TableArray = (HS_LSTEntry_t *)TableData;
+
+    int32  TableResult = CFE_SUCCESS;
+    uint32 TableIndex  = 0;
+    uint32 MsgIndex    = 0;
+    size_t Length      = 0;
+    uint16 EnableState = 0;
+    int32  EntryResult = 0;
+
+    CFE_SB_MsgId_t   MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_SB_Buffer_t *BufPtr[2] = {NULL, NULL};
+
+    uint32 GoodCount   = 0;
+    uint32 BadCount    = 0;
+    uint32 UnusedCount = 0;
+
+    if (TableData == NULL)
+    {
+        CFE_EVS_SendEvent(HS_LS_TBL_NULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error in LS Table Validation. Table is null.");
+
+        return HS_TBL_VAL_ERR;
+    }
+
+    for (TableIndex = 0; TableIndex < HS_MAX_LOAD_SHED_STEPS; TableIndex++)
+    {
+
+        EntryResult = HS_LSTVAL_NO_ERR;
+        EnableState = TableArray[TableIndex].EnableState;
+        BufPtr[0]   = (CFE_SB_Buffer_t *)&TableArray[TableIndex].ShedMsgBuf;
+        BufPtr[1]   = (CFE_SB_Buffer_t *)&TableArray[TableIndex].RestoreMsgBuf;
+        Length      = 0;
+        MessageID   = CFE_SB_INVALID_MSG_ID;
+
+        if (EnableState == HS_LST_STATE_DISABLED)
+        {
+            /*
+            ** Unused table entry
+            */
+            UnusedCount++;
+        }
+        else if (EnableState != HS_LST_STATE_ENABLED)
+        {
+            /*
+            ** Enable State is Invalid
+            */
+            EntryResult = HS_LSTVAL_ERR_ENA;
+            BadCount++;
+        }
+        else
+        {
+            /*
+            ** Both the shed and the restore message must be sendable
+            */
+            for (MsgIndex = 0; (MsgIndex < 2) && (EntryResult == HS_LSTVAL_NO_ERR); MsgIndex++)
+            {
+                CFE_MSG_GetSize(&BufPtr[MsgIndex]->Msg, &Length);
+                CFE_MSG_GetMsgId(&BufPtr[MsgIndex]->Msg, &MessageID);
+
+                if (!CFE_SB_IsValidMsgId(MessageID))
+                {
+                    EntryResult = HS_LSTVAL_ERR_ID;
+                }
+                else if (Length > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+                {
+                    EntryResult = HS_LSTVAL_ERR_LEN;
+                }
+            }
+
+            if (EntryResult == HS_LSTVAL_NO_ERR)
+            {
+                GoodCount++;
+            }
+            else
+            {
+                BadCount++;
+            }
+        }
+        /*
+        ** Generate detailed event for "first" error
+        */
+        if ((EntryResult != HS_LSTVAL_NO_ERR) && (TableResult == CFE_SUCCESS))
+        {
+            CFE_EVS_SendEvent(HS_LSTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "LoadShed verify err: Entry = %d, Err = %d, Length = %d, ID = 0x%08lX", (int)TableIndex,
+                              (int)EntryResult, (int)Length, (unsigned long)CFE_SB_MsgIdToValue(MessageID));
+            TableResult = EntryResult;
+        }
+    }
+
+    /*
+    ** Generate informational event with error totals
+    */
+    CFE_EVS_SendEvent(HS_LSTVAL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "LoadShed verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
+                      (int)UnusedCount);
+
+    return (TableResult);
+
+} /* end HS_ValidateLSTable */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate the CPU budget table                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ValidateCBTable(void *TableData)
+{
+    HS_CBTEntry_t *TableArray = (HS_CBTEntry_t *)TableData;
+
+    int32  TableResult = CFE_SUCCESS;
+    uint32 TableIndex  = 0;
+    int32  EntryResult = 0;
+
+    uint16 ActionType = 0;
+    uint16 Intervals  = 0;
+    uint16 NullTerm   = 0;
+
+    uint32 GoodCount                = 0;
+    uint32 BadCount                 = 0;
+    uint32 UnusedCount              = 0;
+    char   BadName[OS_MAX_API_NAME] = "";
+
+    if (TableData == NULL)
+    {
+        CFE_EVS_SendEvent(HS_CB_TBL_NULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error in CB Table Validation. Table is null.");
+
+        return HS_TBL_VAL_ERR;
+    }
+
+    for (TableIndex = 0; TableIndex < HS_MAX_CPU_BUDGETS; TableIndex++)
+    {
+
+        ActionType  = TableArray[TableIndex].ActionType;
+        Intervals   = TableArray[TableIndex].Intervals;
+        NullTerm    = TableArray[TableIndex].NullTerm;
+        EntryResult = HS_CBTVAL_NO_ERR;
+
+        if ((Intervals == 0) || (ActionType == HS_AMT_ACT_NOACT))
+        {
+            /*
+            ** Unused table entry
+            */
+            UnusedCount++;
+        }
+        else if (NullTerm != 0)
+        {
+            /*
+            ** Null Terminator Safety Buffer is not Null
+            */
+            EntryResult = HS_CBTVAL_ERR_NUL;
+            BadCount++;
+        }
+        else if (!HS_AMTActionIsValid(ActionType))
+        {
+            /*
+            ** Action Type is not valid
+            */
+            EntryResult = HS_CBTVAL_ERR_ACT;
+            BadCount++;
+        }
+        else
+        {
+            /*
+            ** Otherwise, this entry is good
+            */
+            GoodCount++;
+        }
+        /*
+        ** Generate detailed event for "first" error
+        */
+        if ((EntryResult != HS_CBTVAL_NO_ERR) && (TableResult == CFE_SUCCESS))
+        {
+            strncpy(BadName, TableArray[TableIndex].TaskName, OS_MAX_API_NAME - 1);
+            BadName[OS_MAX_API_NAME - 1] = '\0';
+            CFE_EVS_SendEvent(HS_CBTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CpuBudget verify err: Entry = %d, Err = %d, Action = %d, Task = %s", (int)TableIndex,
+                              (int)EntryResult, ActionType, BadName);
+            TableResult = EntryResult;
+        }
+    }
+
+    /*
+    ** Generate informational event with error totals
+    */
+    CFE_EVS_SendEvent(HS_CBTVAL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "CpuBudget verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
+                      (int)UnusedCount);
+
+    return (TableResult);
+
+} /* end HS_ValidateCBTable */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate the rebalance table                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ValidateRBTable(void *TableData)
+{
+    HS_RBTEntry_t *TableArray = (HS_RBTEntry_t *)TableData;
+
+    int32  TableResult = CFE_SUCCESS;
+    uint32 TableIndex  = 0;
+    int32  EntryResult = 0;
+
+    uint32 CoreMask = 0;
+    uint16 NullTerm = 0;
+
+    uint32 GoodCount                = 0;
+    uint32 BadCount                 = 0;
+    uint32 UnusedCount              = 0;
+    char   BadName[OS_MAX_API_NAME] = "";
+
+    if (TableData == NULL)
+    {
+        CFE_EVS_SendEvent(HS_RB_TBL_NULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error in RB Table Validation. Table is null.");
+
+        return HS_TBL_VAL_ERR;
+    }
+
+    for (TableIndex = 0; TableIndex < HS_MAX_REBALANCE_TASKS; TableIndex++)
+    {
+
+        CoreMask    = TableArray[TableIndex].CoreMask;
+        NullTerm    = TableArray[TableIndex].NullTerm;
+        EntryResult = HS_RBTVAL_NO_ERR;
+
+        if ((TableArray[TableIndex].TaskName[0] == '\0') || (CoreMask == 0))
+        {
+            /*
+            ** Unused table entry
+            */
+            UnusedCount++;
+        }
+        else if (NullTerm != 0)
+        {
+            /*
+            ** Null Terminator Safety Buffer is not Null
+            */
+            EntryResult = HS_RBTVAL_ERR_NUL;
+            BadCount++;
+        }
+        else if ((CoreMask & ~(uint32)((1ULL << HS_UTIL_NUM_CORES) - 1)) != 0)
+        {
+            /*
+            ** Core Mask allows cores that are not monitored
+            */
+            EntryResult = HS_RBTVAL_ERR_CORES;
+            BadCount++;
+        }
+        else
+        {
+            /*
+            ** Otherwise, this entry is good
+            */
+            GoodCount++;
+        }
+        /*
+        ** Generate detailed event for "first" error
+        */
+        if ((EntryResult != HS_RBTVAL_NO_ERR) && (TableResult == CFE_SUCCESS))
+        {
+            strncpy(BadName, TableArray[TableIndex].TaskName, OS_MAX_API_NAME - 1);
+            BadName[OS_MAX_API_NAME - 1] = '\0';
+            CFE_EVS_SendEvent(HS_RBTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Rebalance verify err: Entry = %d, Err = %d, CoreMask = 0x%08X, Task = %s",
+                              (int)TableIndex, (int)EntryResult, (unsigned int)CoreMask, BadName);
+            TableResult = EntryResult;
+        }
+    }
+
+    /*
+    ** Generate informational event with error totals
+    */
+    CFE_EVS_SendEvent(HS_RBTVAL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Rebalance verify results: good = %d, bad = %d, unused = %d", (int)GoodCount, (int)BadCount,
+                      (int)UnusedCount);
+
+    return (TableResult);
+
+} /* end HS_ValidateRBTable */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Set the values being stored in the CDS                          */
@@ -30,6 +30,8 @@
  *************************************************************************/
 #include "cfe.h"
 #include "cfe_evs_msg.h"
+#include "cfe_sb_msg.h"
+#include "hs_app.h"
 
 /*************************************************************************
  * Exported Functions
@@ -64,6 +66,44 @@ void HS_MonitorApplications(void);
  */
 void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr);
 
+/**
+ * \brief Execute a Message Action
+ *
+ *  \par Description
+ *       Sends the Message Actions Table entry for a monitor that has
+ *       requested a message action, counts the execution and starts the
+ *       entry's cooldown. Every monitor that supports message actions
+ *       goes through this function.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is sent if message actions are disabled, the index is out
+ *       of range, the entry is still cooling down or the entry is disabled.
+ *
+ *  \param[in] MsgActsIndex  Index into the Message Actions Table
+ *
+ *  \return Whether the caller should report the action with an event
+ *  \retval true  The message was sent and the entry allows events
+ *  \retval false Nothing was sent, or the entry suppresses events
+ */
+bool HS_ExecuteMsgAction(uint32 MsgActsIndex);
+
+/**
+ * \brief Count an event message against its source processor
+ *
+ *  \par Description
+ *       Increments the per-processor event counter for the spacecraft
+ *       and processor that generated an event message. The first
+ *       #HS_MAX_EVENT_PROCESSORS distinct sources get their own counter,
+ *       events from any further source are added to the overflow count.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] SpacecraftID  Spacecraft ID of the event source
+ *  \param[in] ProcessorID   Processor ID of the event source
+ */
+void HS_CountProcessorEvent(uint32 SpacecraftID, uint32 ProcessorID);
+
 /**
  * \brief Monitor the utilization tracker counter
  *
@@ -78,6 +118,448 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr);
  */
 void HS_MonitorUtilization(void);
 
+/**
+ * \brief Monitor the utilization of a single processor core
+ *
+ *  \par Description
+ *       Converts the Idle Task counter of one core into its utilization
+ *       for the previous interval, updates that core's average and peak,
+ *       and reports hogging of the core when more than one core is
+ *       monitored.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] CoreIndex      Core to monitor, less than #HS_UTIL_NUM_CORES
+ *  \param[in] ThisUtilIndex  Tracker index of the interval that just completed
+ */
+void HS_MonitorCoreUtilization(uint32 CoreIndex, uint32 ThisUtilIndex);
+
+/**
+ * \brief Add an interval utilization to a utilization window
+ *
+ *  \par Description
+ *       Stores the utilization in the tracker slot of the interval that
+ *       just completed and updates the running sum and peak queue, so
+ *       the window average and peak are available without scanning
+ *       the tracker.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The tracker holds #HS_UTIL_PEAK_NUM_INTERVAL entries.
+ *
+ *  \param[in,out] WindowPtr      Window state to update
+ *  \param[in,out] TrackerPtr     Utilization tracker the window covers
+ *  \param[in]     ThisUtilIndex  Tracker index of the interval that just completed
+ *  \param[in]     CurrentUtil    Utilization of the completed interval
+ */
+void HS_UtilWindowUpdate(HS_UtilWindow_t *WindowPtr, uint32 *TrackerPtr, uint32 ThisUtilIndex, uint32 CurrentUtil);
+
+/**
+ * \brief Record an interval utilization in the utilization history
+ *
+ *  \par Description
+ *       Stores the utilization of the interval that just completed in
+ *       the finest level of the utilization history, and rolls every
+ *       #HS_UTIL_HIST_ROLLUP completed entries of a level up into one
+ *       average/minimum/maximum entry of the next level.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] CurrentUtil  Utilization of the completed interval
+ */
+void HS_UtilHistRecord(uint32 CurrentUtil);
+
+/**
+ * \brief Record an interval utilization in the percentile histogram
+ *
+ *  \par Description
+ *       Counts the utilization of the interval that just completed in
+ *       its histogram bucket, and removes the interval that fell out of
+ *       the #HS_UTIL_PCTL_WINDOW interval window, in constant time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       CurrentUtil is limited to #HS_UTIL_PER_INTERVAL_TOTAL.
+ *
+ *  \param[in] CurrentUtil  Utilization of the completed interval
+ */
+void HS_UtilPctlRecord(uint32 CurrentUtil);
+
+/**
+ * \brief Check the CPU load levels
+ *
+ *  \par Description
+ *       Enters each CPU load level whose enter threshold has been
+ *       reached for its dwell time and takes the level's action, and
+ *       leaves each active level whose exit threshold is no longer
+ *       reached.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       CurrentUtil is limited to #HS_UTIL_PER_INTERVAL_TOTAL.
+ *
+ *  \param[in] CurrentUtil  Utilization of the completed interval
+ */
+void HS_MonitorUtilLoad(uint32 CurrentUtil);
+
+/**
+ * \brief Shed or restore load
+ *
+ *  \par Description
+ *       Sheds the next step of the load shedding table once interval
+ *       utilization has stayed at or above #HS_LOAD_SHED_HIGH_UTIL for
+ *       #HS_LOAD_SHED_DWELL intervals, and restores the last shed step
+ *       once it has stayed below #HS_LOAD_SHED_LOW_UTIL as long.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after the CPU utilization average has been updated, so
+ *       each step reports the average it acts on.
+ *
+ *  \param[in] CurrentUtil  Utilization of the completed interval
+ */
+void HS_MonitorLoadShed(uint32 CurrentUtil);
+
+/**
+ * \brief Add an interval utilization to the utilization trend
+ *
+ *  \par Description
+ *       Updates the running sums of the least-squares line over the
+ *       last #HS_UTIL_TREND_NUM_INTERVAL interval utilizations in
+ *       constant time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must be called before the interval is written to the
+ *       utilization tracker, as the interval leaving the window is
+ *       read from it.
+ *
+ *  \param[in] ThisUtilIndex  Tracker index of the completed interval
+ *  \param[in] CurrentUtil    Utilization of the completed interval
+ */
+void HS_UtilTrendUpdate(uint32 ThisUtilIndex, uint32 CurrentUtil);
+
+/**
+ * \brief Predict CPU saturation from the utilization trend
+ *
+ *  \par Description
+ *       Fits a line to the utilization trend window and predicts the
+ *       number of intervals until it reaches
+ *       #HS_UTIL_TREND_SATURATION_UTIL. Takes the CPU saturation
+ *       warning action once when the prediction is within the warning
+ *       horizon, and clears the warning when it is more than twice the
+ *       horizon away.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is predicted until the window is full.
+ */
+void HS_MonitorUtilTrend(void);
+
+/**
+ * \brief Move a task off a saturated core onto an idle one
+ *
+ *  \par Description
+ *       Finds the busiest core at or above #HS_REBALANCE_HIGH_UTIL and
+ *       the least busy core at or below #HS_REBALANCE_LOW_UTIL over
+ *       the interval. Once the same pair has lasted #HS_REBALANCE_DWELL
+ *       intervals, moves a task of the rebalance table from the
+ *       saturated core to the idle one, and then waits
+ *       #HS_REBALANCE_COOLDOWN intervals before looking again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only done when #HS_UTIL_NUM_CORES is greater than 1 and the
+ *       rebalance table is loaded.
+ *
+ *  \param[in] ThisUtilIndex  Tracker index of the interval
+ */
+void HS_MonitorRebalance(uint32 ThisUtilIndex);
+
+/**
+ * \brief Move the first movable task from one core to another
+ *
+ *  \par Description
+ *       Walks the rebalance table in order and pins the threads of the
+ *       first task allowed on the idle core that can still run on the
+ *       saturated core to the idle core.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Threads are found by name in the latest thread CPU times read
+ *       by #HS_MonitorTaskCpu.
+ *
+ *  \param[in] FromCore  Saturated core
+ *  \param[in] ToCore    Idle core
+ *
+ *  \return Whether a task was moved
+ *  \retval true  A task was moved and the move telemetry updated
+ *  \retval false No task could be moved
+ */
+bool HS_RebalanceMove(uint32 FromCore, uint32 ToCore);
+
+/**
+ * \brief Get a percentile of interval utilization
+ *
+ *  \par Description
+ *       Returns the utilization that the given percentage of the
+ *       intervals in the percentile histogram are at or below.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The upper edge of the bucket holding the percentile is returned,
+ *       so the result never understates the utilization. With no
+ *       intervals recorded, 0 is returned.
+ *
+ *  \param[in] Percent  Percentile to get, 1 to 100
+ *
+ *  \return Utilization at the percentile
+ */
+uint32 HS_UtilPctlValue(uint32 Percent);
+
+/**
+ * \brief Monitor the CPU usage of each task
+ *
+ *  \par Description
+ *       Samples the CPU time of every thread of the cFS process, computes
+ *       the utilization, run queue wait and context switches of each
+ *       thread over the interval since the previous sample, and sends
+ *       the #HS_TASK_CPU_TOP_N busiest and the #HS_TASK_CPU_TOP_N
+ *       longest waiting threads in the per-task CPU telemetry packet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once per utilization interval. Threads are matched to
+ *       cFE tasks by name, so a thread is only reported with its ES task
+ *       ID when its operating system name matches an ES task name. The
+ *       utilization of a thread is relative to a single core.
+ */
+void HS_MonitorTaskCpu(void);
+
+/**
+ * \brief Rank a thread in a top list
+ *
+ *  \par Description
+ *       Inserts a thread into a list of at most #HS_TASK_CPU_TOP_N
+ *       threads sorted by value, highest first, dropping the lowest
+ *       when the list is full.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Threads with equal values keep the order they were ranked in.
+ *
+ *  \param[in,out] TopIndex   Sample index of each listed thread
+ *  \param[in,out] TopValue   Value of each listed thread
+ *  \param[in,out] NumTopPtr  Number of listed threads
+ *  \param[in]     Index      Sample index of the thread to rank
+ *  \param[in]     Value      Value of the thread to rank
+ */
+void HS_TaskCpuRank(uint32 *TopIndex, uint32 *TopValue, uint32 *NumTopPtr, uint32 Index, uint32 Value);
+
+/**
+ * \brief Act on the longest run queue wait
+ *
+ *  \par Description
+ *       Takes the #HS_TASK_RUN_DELAY_ACTION once when the longest
+ *       waiting thread of the interval reaches
+ *       #HS_TASK_RUN_DELAY_THRESHOLD, and reports when every thread is
+ *       below the threshold again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #HS_MonitorTaskCpu after the wait entries of the
+ *       per-task CPU telemetry packet are filled in.
+ *
+ *  \param[in] PayloadPtr  Per-task CPU telemetry of the interval
+ */
+void HS_MonitorRunDelay(const HS_TaskCpuPayload_t *PayloadPtr);
+
+/**
+ * \brief Hold tasks to their CPU budgets
+ *
+ *  \par Description
+ *       Sums the utilization of the threads of each task in the CPU
+ *       budget table and takes the entry's action once the task has been
+ *       over its budget for the entry's number of consecutive intervals.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #HS_MonitorTaskCpu with the thread utilization it
+ *       computed, so the thread CPU times are read once per interval.
+ *       The action is taken again only after the task has been back
+ *       within its budget.
+ *
+ *  \param[in] SamplesPtr  Thread CPU times of the interval
+ *  \param[in] UtilPtr     Utilization of each thread over the interval
+ *  \param[in] NumSamples  Number of threads
+ */
+void HS_MonitorCpuBudget(const HS_TaskCpuSample_t *SamplesPtr, const uint32 *UtilPtr, uint32 NumSamples);
+
+/**
+ * \brief Take the thread CPU times at the start of CPU hogging
+ *
+ *  \par Description
+ *       Keeps the CPU time of every thread of the cFS process at the
+ *       start of the hogging window, as the baseline of the CPU hog
+ *       snapshot.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Uses the latest per-task CPU sample when there is one, so the
+ *       thread CPU times are normally not read again.
+ */
+void HS_HogSnapshotBaseline(void);
+
+/**
+ * \brief Measure the stack high-water marks of a few threads
+ *
+ *  \par Description
+ *       Measures the stacks of the next #HS_STACK_TASKS_PER_INTERVAL
+ *       threads of the latest per-task CPU sample, takes the
+ *       #HS_STACK_USAGE_ACTION for a thread that reached
+ *       #HS_STACK_USAGE_THRESHOLD, and sends the stack usage telemetry
+ *       packet once every thread has been measured.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once per utilization interval after #HS_MonitorTaskCpu.
+ *       Threads that can't be measured are retried on the next pass.
+ */
+void HS_MonitorStacks(void);
+
+/**
+ * \brief Take the stack usage action for a thread
+ *
+ *  \par Description
+ *       Takes #HS_STACK_USAGE_ACTION for a thread whose stack
+ *       high-water mark reached #HS_STACK_USAGE_THRESHOLD.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] EntryPtr  Stack usage of the thread
+ */
+void HS_StackUsageAction(const HS_StackEntry_t *EntryPtr);
+
+/**
+ * \brief Request the Software Bus statistics
+ *
+ *  \par Description
+ *       Every #HS_SB_STATS_PERIOD HS cycles, looks up the monitored
+ *       pipes of #HS_SB_PIPE_LIMITS not found yet and requests the
+ *       Software Bus statistics, which come back on the command pipe.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once per HS cycle.
+ */
+void HS_MonitorSbPipes(void);
+
+/**
+ * \brief Process the Software Bus statistics
+ *
+ *  \par Description
+ *       Ranks all pipes by queue usage for the worst pipes telemetry
+ *       and checks the monitored pipes against their limits.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Packets of the wrong length are ignored.
+ *
+ *  \param[in] BufPtr  Pointer to the Software Bus statistics packet
+ */
+void HS_SbStatsTlm(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process the Software Bus housekeeping
+ *
+ *  \par Description
+ *       Counts the messages the Software Bus dropped since its last
+ *       housekeeping packet and takes #HS_SB_DROP_ACTION when they
+ *       reach #HS_SB_DROP_THRESHOLD.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The Software Bus only counts dropped messages in total, not by
+ *       pipe. A counter lower than in the previous packet was reset.
+ *       Packets of the wrong length are ignored.
+ *
+ *  \param[in] BufPtr  Pointer to the Software Bus housekeeping packet
+ */
+void HS_SbHkTlm(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Take the backlog action for a Software Bus pipe
+ *
+ *  \par Description
+ *       Takes the action of entry LimitIndex of the pipe limits for a
+ *       pipe whose queue usage reached the enter usage.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] LimitIndex  Index of the pipe limit entry
+ *  \param[in] PipeTlmPtr  Queue depths of the pipe
+ */
+void HS_SbPipeAction(uint32 LimitIndex, const HS_SbPipeTlm_t *PipeTlmPtr);
+
+/**
+ * \brief Take the dropped message action
+ *
+ *  \par Description
+ *       Takes #HS_SB_DROP_ACTION when the Software Bus dropped
+ *       #HS_SB_DROP_THRESHOLD or more messages.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] Drops  Messages dropped since the last SB housekeeping
+ */
+void HS_SbDropAction(uint32 Drops);
+
+/**
+ * \brief Measure the time between wakeups
+ *
+ *  \par Description
+ *       Measures the time since the previous wakeup message on the
+ *       monotonic clock into the wakeup telemetry: minimum, maximum,
+ *       mean, late wakeups and the interval histogram. Counts the
+ *       #HS_WAKEUP_PERIOD_US periods that passed since the previous
+ *       wakeup without one as missed wakeups, whatever woke HS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called after every receive on the wakeup pipe. Without a wakeup
+ *       a period counts as missed once it is #HS_WAKEUP_LATE_US late;
+ *       a wakeup settles the gap to the nearest whole number of periods.
+ *       Counting starts at the first wakeup.
+ *
+ *  \param[in] RecvStatus  Status of the wakeup pipe receive
+ */
+void HS_MonitorWakeup(int32 RecvStatus);
+
+/**
+ * \brief Take and report a CPU hog snapshot
+ *
+ *  \par Description
+ *       Computes the CPU time used by every thread over the hogging
+ *       window, records it with the thread states and the most recent
+ *       interval utilization, writes the snapshot to
+ *       #HS_HOG_SNAPSHOT_FILENAME and names the top threads in an event.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called when CPU hogging is detected, after the utilization of
+ *       the current interval has been recorded.
+ *
+ *  \param[in] ThisUtilIndex  Utilization tracker index of the current interval
+ *
+ *  \sa #HS_HOG_SNAPSHOT_INF_EID
+ */
+void HS_HogSnapshotCapture(uint32 ThisUtilIndex);
+
+/**
+ * \brief Write a CPU hog snapshot to a file
+ *
+ *  \par Description
+ *       Creates the file, writes a cFE file header and the valid
+ *       entries of the snapshot.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An existing file is overwritten.
+ *
+ *  \param[in] Filename  File to write
+ *  \param[in] SnapPtr   Snapshot to write
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ *
+ *  \sa #HS_HOG_SNAPSHOT_FILE_ERR_EID
+ */
+int32 HS_HogSnapshotWriteFile(const char *Filename, const HS_HogSnapshot_t *SnapPtr);
+
 /**
  * \brief Validate application monitor table
  *
@@ -115,6 +597,7 @@ int32 HS_ValidateAMTable(void *TableData);
  *  \retval #CFE_SUCCESS       \copydoc CFE_SUCCESS
  *  \retval #HS_EMTVAL_ERR_ACT \copydoc HS_EMTVAL_ERR_ACT
  *  \retval #HS_EMTVAL_ERR_NUL \copydoc HS_EMTVAL_ERR_NUL
+ *  \retval #HS_EMTVAL_ERR_PAD \copydoc HS_EMTVAL_ERR_PAD
  *
  *  \sa #HS_ValidateAMTable, #HS_ValidateXCTable, #HS_ValidateMATable
  */
@@ -163,6 +646,70 @@ int32 HS_ValidateXCTable(void *TableData);
  */
 int32 HS_ValidateMATable(void *TableData);
 
+/**
+ * \brief Validate load shedding table
+ *
+ *  \par Description
+ *       This function is called by table services when a validation of
+ *       the load shedding table is required
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   *TableData     Pointer to the table data to validate
+ *
+ *  \return Table validation status
+ *  \retval #CFE_SUCCESS       \copydoc CFE_SUCCESS
+ *  \retval #HS_LSTVAL_ERR_ID  \copydoc HS_LSTVAL_ERR_ID
+ *  \retval #HS_LSTVAL_ERR_LEN \copydoc HS_LSTVAL_ERR_LEN
+ *  \retval #HS_LSTVAL_ERR_ENA \copydoc HS_LSTVAL_ERR_ENA
+ *
+ *  \sa #HS_ValidateMATable
+ */
+int32 HS_ValidateLSTable(void *TableData);
+
+/**
+ * \brief Validate CPU budget table
+ *
+ *  \par Description
+ *       This function is called by table services when a validation of
+ *       the CPU budget table is required
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   *TableData     Pointer to the table data to validate
+ *
+ *  \return Table validation status
+ *  \retval #CFE_SUCCESS       \copydoc CFE_SUCCESS
+ *  \retval #HS_CBTVAL_ERR_ACT \copydoc HS_CBTVAL_ERR_ACT
+ *  \retval #HS_CBTVAL_ERR_NUL \copydoc HS_CBTVAL_ERR_NUL
+ *
+ *  \sa #HS_ValidateAMTable
+ */
+int32 HS_ValidateCBTable(void *TableData);
+
+/**
+ * \brief Validate rebalance table
+ *
+ *  \par Description
+ *       This function is called by table services when a validation of
+ *       the rebalance table is required
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   *TableData     Pointer to the table data to validate
+ *
+ *  \return Table validation status
+ *  \retval #CFE_SUCCESS         \copydoc CFE_SUCCESS
+ *  \retval #HS_RBTVAL_ERR_CORES \copydoc HS_RBTVAL_ERR_CORES
+ *  \retval #HS_RBTVAL_ERR_NUL   \copydoc HS_RBTVAL_ERR_NUL
+ *
+ *  \sa #HS_ValidateCBTable
+ */
+int32 HS_ValidateRBTable(void *TableData);
+
 /**
  * \brief Update and store CDS data
  *
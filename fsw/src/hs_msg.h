@@ -43,7 +43,8 @@
  * Macro Definitions
  ************************************************************************/
 
-#define HS_BITS_PER_APPMON_ENABLE 32 /**< \brief HS Bits per AppMon Enable entry */
+#define HS_BITS_PER_APPMON_ENABLE   32 /**< \brief HS Bits per AppMon Enable entry */
+#define HS_BITS_PER_EVENTMON_ENABLE 32 /**< \brief HS Bits per EventMon Enable entry */
 
 /************************************************************************
  * Type Definitions
@@ -80,6 +81,85 @@ typedef struct
     uint16 Padding;   /**< \brief Structure padding */
 } HS_SetMaxResetsCmd_t;
 
+/**
+ *  \brief Enable/Disable Event Monitor Entries Command
+ *
+ *  For command details see #HS_ENABLE_EVENTMON_ENTRIES_CC, #HS_DISABLE_EVENTMON_ENTRIES_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32 FirstEntry; /**< \brief Index of first Event Monitor Table entry */
+    uint32 NumEntries; /**< \brief Number of consecutive entries starting at FirstEntry */
+} HS_EventMonEntriesCmd_t;
+
+/**
+ *  \brief Dump Utilization History Command
+ *
+ *  For command details see #HS_DUMP_UTIL_HIST_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint8  Level;       /**< \brief History level to dump, 0 is the finest resolution */
+    uint8  Destination; /**< \brief #HS_UTIL_HIST_DEST_TLM or #HS_UTIL_HIST_DEST_FILE */
+    uint16 Padding;     /**< \brief Structure padding */
+
+    char Filename[OS_MAX_PATH_LEN]; /**< \brief Dump file name, empty for #HS_UTIL_HIST_FILENAME */
+} HS_DumpUtilHistCmd_t;
+
+/**
+ *  \brief CPU Load Level
+ *
+ *  A level is entered once interval utilization has been at or above
+ *  EnterUtil for DwellIntervals consecutive intervals, and is left
+ *  when interval utilization falls below ExitUtil
+ */
+typedef struct
+{
+    uint32 EnterUtil;      /**< \brief Utils at or above which the level is entered */
+    uint32 ExitUtil;       /**< \brief Utils below which the level is left, not more than EnterUtil */
+    uint16 DwellIntervals; /**< \brief Consecutive intervals at or above EnterUtil before the level is entered */
+    uint16 ActionType;     /**< \brief Action taken when the level is entered, see #HS_ALARM_ACT_EVENT */
+} HS_UtilLoadLevel_t;
+
+/**
+ *  \brief Set CPU Load Level Command
+ *
+ *  For command details see #HS_SET_UTIL_LOAD_LEVEL_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    uint32             Level;     /**< \brief Load level to set, less than #HS_UTIL_LOAD_NUM_LEVELS */
+    HS_UtilLoadLevel_t LoadLevel; /**< \brief New load level */
+} HS_SetUtilLoadLevelCmd_t;
+
+/**
+ *  \brief CPU Saturation Warning Settings
+ */
+typedef struct
+{
+    uint32 HorizonIntervals; /**< \brief Predicted intervals to saturation at or below which to warn, 0 disables */
+    uint16 ActionType;       /**< \brief Action taken when warning, see #HS_ALARM_ACT_EVENT */
+    uint16 Padding;          /**< \brief Structure padding */
+} HS_UtilTrendConfig_t;
+
+/**
+ *  \brief Set CPU Saturation Warning Command
+ *
+ *  For command details see #HS_SET_UTIL_TREND_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CmdHeader; /**< \brief Command header */
+
+    HS_UtilTrendConfig_t Config; /**< \brief New CPU saturation warning settings */
+} HS_SetUtilTrendCmd_t;
+
 /**\}*/
 
 /**
@@ -87,6 +167,241 @@ typedef struct
  * \{
  */
 
+/**
+ *  \brief Utilization History Entry
+ */
+typedef struct
+{
+    uint32 Avg; /**< \brief Average utilization over the entry period */
+    uint32 Min; /**< \brief Minimum interval utilization over the entry period */
+    uint32 Max; /**< \brief Maximum interval utilization over the entry period */
+} HS_UtilHistEntry_t;
+
+/**
+ *  \brief Utilization History Payload
+ *
+ *  This is also the data written after the cFE file header by the
+ *  #HS_DUMP_UTIL_HIST_CC command, truncated to NumEntries entries.
+ */
+typedef struct
+{
+    uint8  Level;             /**< \brief History level of the entries */
+    uint8  Spare[3];          /**< \brief Alignment Spares */
+    uint32 IntervalsPerEntry; /**< \brief Utilization intervals summarized by each entry */
+    uint32 NumEntries;        /**< \brief Number of valid entries */
+
+    HS_UtilHistEntry_t Entries[HS_UTIL_HIST_DEPTH]; /**< \brief History entries, oldest first */
+} HS_UtilHistPayload_t;
+
+/**
+ *  \brief Utilization History Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry Header */
+    HS_UtilHistPayload_t      Payload;   /**< \brief Utilization History */
+} HS_UtilHistPkt_t;
+
+/**
+ *  \brief Utilization Percentile Histogram Payload
+ */
+typedef struct
+{
+    uint32 NumSamples;  /**< \brief Number of intervals in the histogram */
+    uint32 BucketWidth; /**< \brief Range of utilization counted by each bucket */
+    uint32 UtilP50;     /**< \brief 50th percentile of interval utilization */
+    uint32 UtilP90;     /**< \brief 90th percentile of interval utilization */
+    uint32 UtilP99;     /**< \brief 99th percentile of interval utilization */
+
+    uint32 Counts[HS_UTIL_PCTL_NUM_BUCKETS]; /**< \brief Intervals counted by each bucket, lowest first */
+} HS_UtilPctlPayload_t;
+
+/**
+ *  \brief Utilization Percentile Histogram Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry Header */
+    HS_UtilPctlPayload_t      Payload;   /**< \brief Utilization Percentile Histogram */
+} HS_UtilPctlPkt_t;
+
+/**
+ *  \brief Per-Task CPU Entry
+ */
+typedef struct
+{
+    char            TaskName[OS_MAX_API_NAME]; /**< \brief Thread name */
+    CFE_ES_TaskId_t TaskId;                    /**< \brief ES task ID, undefined if not a cFE task */
+    uint32          ThreadId;                  /**< \brief Operating system thread ID */
+    uint32          Util;                      /**< \brief Utilization of one core over the last interval */
+    uint32          RunDelay;                  /**< \brief Utils of one core spent waiting for a CPU */
+    uint32          VolCtxSwitches;            /**< \brief Context switches from blocking over the last interval */
+    uint32          InvolCtxSwitches;          /**< \brief Context switches from preemption over the last interval */
+} HS_TaskCpuEntry_t;
+
+/**
+ *  \brief Per-Task CPU Payload
+ */
+typedef struct
+{
+    uint32 NumTasks;       /**< \brief Number of threads sampled */
+    uint32 NumEntries;     /**< \brief Number of valid entries */
+    uint32 NumWaitEntries; /**< \brief Number of valid wait entries */
+    uint32 Padding;        /**< \brief Structure padding */
+
+    HS_TaskCpuEntry_t Entries[HS_TASK_CPU_TOP_N];     /**< \brief Top consumers, highest first */
+    HS_TaskCpuEntry_t WaitEntries[HS_TASK_CPU_TOP_N]; /**< \brief Longest run queue waits, longest first */
+} HS_TaskCpuPayload_t;
+
+/**
+ *  \brief Per-Task CPU Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry Header */
+    HS_TaskCpuPayload_t       Payload;   /**< \brief Top CPU consumers */
+} HS_TaskCpuPkt_t;
+
+/**
+ *  \brief CPU Hog Snapshot Entry
+ */
+typedef struct
+{
+    char   TaskName[OS_MAX_API_NAME]; /**< \brief Thread name */
+    uint32 ThreadId;                  /**< \brief Operating system thread ID */
+    uint32 CpuTimeUs;                 /**< \brief CPU time used over the hogging window in microseconds */
+    uint32 Util;                      /**< \brief Utilization of one core over the hogging window */
+    char   State;                     /**< \brief Operating system thread state when hogging was detected */
+    uint8  Spare[3];                  /**< \brief Alignment Spares */
+} HS_HogSnapshotEntry_t;
+
+/**
+ *  \brief CPU Hog Snapshot
+ *
+ *  This is the data written after the cFE file header to
+ *  #HS_HOG_SNAPSHOT_FILENAME when CPU hogging is detected, truncated
+ *  to NumEntries entries.
+ */
+typedef struct
+{
+    uint32 WindowMs;   /**< \brief Length of the hogging window, 0 if no thread CPU times were taken at its start */
+    uint32 NumEntries; /**< \brief Number of valid entries */
+
+    uint32 Util[HS_HOG_SNAPSHOT_NUM_UTIL]; /**< \brief Most recent interval utilization, oldest first */
+
+    HS_HogSnapshotEntry_t Entries[HS_TASK_CPU_MAX_TASKS]; /**< \brief Threads sampled, most CPU time first */
+} HS_HogSnapshot_t;
+
+/**
+ *  \brief Stack Usage Entry
+ */
+typedef struct
+{
+    char   TaskName[OS_MAX_API_NAME]; /**< \brief Thread name */
+    uint32 ThreadId;                  /**< \brief Operating system thread ID */
+    uint32 EsStackSize;               /**< \brief Stack size the task was created with, 0 if not a cFE task */
+    uint32 StackSize;                 /**< \brief Size of the measured stack region in bytes, 0 if not measured */
+    uint32 StackUsed;                 /**< \brief Deepest use of the stack in bytes */
+    uint16 Usage;                     /**< \brief StackUsed in percent of StackSize */
+    uint8  ActionTaken;               /**< \brief Whether #HS_STACK_USAGE_ACTION was taken */
+    uint8  Spare;                     /**< \brief Alignment Spare */
+} HS_StackEntry_t;
+
+/**
+ *  \brief Stack Usage Payload
+ */
+typedef struct
+{
+    uint32 NumTasks;    /**< \brief Number of valid entries */
+    uint32 NumMeasured; /**< \brief Number of entries with a measured stack */
+
+    HS_StackEntry_t Entries[HS_TASK_CPU_MAX_TASKS]; /**< \brief Threads in per-task CPU sample order */
+} HS_StackPayload_t;
+
+/**
+ *  \brief Stack Usage Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TlmHeader; /**< \brief Telemetry Header */
+    HS_StackPayload_t         Payload;   /**< \brief Stack high-water marks */
+} HS_StackPkt_t;
+
+/**
+ *  \brief Per-Processor Event Count Entry
+ */
+typedef struct
+{
+    uint32 SpacecraftID; /**< \brief Spacecraft ID of event source */
+    uint32 ProcessorID;  /**< \brief Processor ID of event source */
+    uint32 EventCount;   /**< \brief Count of event messages received from this source */
+} HS_ProcEventCount_t;
+
+/**
+ *  \brief Pressure Stall Telemetry of One Resource
+ *
+ *  Averages are in hundredths of a percent, stall times are the
+ *  increase over the last utilization interval
+ */
+typedef struct
+{
+    uint32 SomeAvg10;   /**< \brief Share of time at least one task stalled, over 10 seconds */
+    uint32 SomeAvg60;   /**< \brief Share of time at least one task stalled, over 60 seconds */
+    uint32 FullAvg10;   /**< \brief Share of time all non-idle tasks stalled, over 10 seconds */
+    uint32 FullAvg60;   /**< \brief Share of time all non-idle tasks stalled, over 60 seconds */
+    uint32 SomeStallUs; /**< \brief Microseconds at least one task stalled */
+    uint32 FullStallUs; /**< \brief Microseconds all non-idle tasks stalled */
+} HS_PsiTlm_t;
+
+/**
+ *  \brief Memory Telemetry
+ *
+ *  Sizes are from the last utilization interval
+ */
+typedef struct
+{
+    uint32 TotalKb;     /**< \brief Total system memory in KiB */
+    uint32 AvailKb;     /**< \brief Available system memory in KiB */
+    uint32 RssKb;       /**< \brief Resident set size of the cFS process in KiB */
+    int32  RssGrowthKb; /**< \brief Fitted resident set size growth in KiB per memory history sample */
+    uint32 HistoryUsed; /**< \brief Number of memory history samples, up to #HS_MEM_HISTORY_SIZE */
+    uint32 AlarmMask;   /**< \brief Active memory alarms, see #HS_MEM_ALARM_LOW_AVAIL */
+} HS_MemTlm_t;
+
+/**
+ *  \brief Software Bus Pipe Telemetry
+ *
+ *  Queue depths are from the last Software Bus statistics packet
+ */
+typedef struct
+{
+    char   PipeName[OS_MAX_API_NAME]; /**< \brief Pipe name, empty if unused */
+    uint16 CurrentDepth;              /**< \brief Messages queued on the pipe */
+    uint16 PeakDepth;                 /**< \brief Most messages ever queued on the pipe */
+    uint16 MaxDepth;                  /**< \brief Depth the pipe was created with */
+    uint8  Usage;                     /**< \brief CurrentDepth in percent of MaxDepth */
+    uint8  PeakUsage;                 /**< \brief PeakDepth in percent of MaxDepth */
+} HS_SbPipeTlm_t;
+
+/**
+ *  \brief Wakeup Telemetry
+ *
+ *  Intervals are measured between consecutive #HS_WAKEUP_MID messages
+ *  on the monotonic clock, since startup or the last counter reset
+ */
+typedef struct
+{
+    uint32 NumIntervals; /**< \brief Number of intervals measured */
+    uint32 MinUs;        /**< \brief Shortest interval in microseconds */
+    uint32 MaxUs;        /**< \brief Longest interval in microseconds */
+    uint32 MeanUs;       /**< \brief Mean interval in microseconds */
+    uint32 LastUs;       /**< \brief Latest interval in microseconds */
+    uint32 MissedCount;  /**< \brief Wakeups missed, from the time since the previous wakeup */
+    uint32 LateCount;    /**< \brief Intervals over #HS_WAKEUP_PERIOD_US by more than #HS_WAKEUP_LATE_US */
+
+    uint32 Histogram[HS_WAKEUP_HIST_BUCKETS]; /**< \brief Interval counts by deviation from #HS_WAKEUP_PERIOD_US */
+} HS_WakeupTlm_t;
+
 /**
  *  \brief Housekeeping Packet Structure
  */
@@ -110,9 +425,55 @@ typedef struct
     uint32 AppMonEnables[((HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE) + 1];
     /**< \brief Enable states of App Monitor Entries */
 
+    uint32 EventMonEnables[((HS_MAX_MONITORED_EVENTS - 1) / HS_BITS_PER_EVENTMON_ENABLE) + 1];
+    /**< \brief Enable states of Event Monitor Entries */
+
     uint32 MsgActExec;  /**< \brief Number of Software Bus Message Actions Executed */
     uint32 UtilCpuAvg;  /**< \brief Current CPU Utilization Average */
     uint32 UtilCpuPeak; /**< \brief Current CPU Utilization Peak */
+    uint32 UtilCpuP50;  /**< \brief 50th Percentile of CPU Utilization over #HS_UTIL_PCTL_WINDOW intervals */
+    uint32 UtilCpuP90;  /**< \brief 90th Percentile of CPU Utilization over #HS_UTIL_PCTL_WINDOW intervals */
+    uint32 UtilCpuP99;  /**< \brief 99th Percentile of CPU Utilization over #HS_UTIL_PCTL_WINDOW intervals */
+
+    uint32 UtilCoreAvg[HS_UTIL_NUM_CORES];  /**< \brief Current CPU Utilization Average by core */
+    uint32 UtilCorePeak[HS_UTIL_NUM_CORES]; /**< \brief Current CPU Utilization Peak by core */
+
+    uint32 UtilMarkSource;    /**< \brief Active utilization mark source */
+    uint32 UtilMarkCount;     /**< \brief Number of utilization marks */
+    uint32 UtilMarkJitterAvg; /**< \brief Smoothed utilization mark jitter in microseconds */
+    uint32 UtilMarkJitterMax; /**< \brief Largest utilization mark jitter in microseconds since the last HK packet */
+
+    uint32             UtilLoadActiveMask; /**< \brief Bit N set while CPU load level N is active */
+    HS_UtilLoadLevel_t UtilLoadLevels[HS_UTIL_LOAD_NUM_LEVELS]; /**< \brief Current CPU load level settings */
+
+    uint32 LoadShedStep; /**< \brief Number of Load Shedding Table steps currently shed */
+
+    uint32 RebalanceMoveCount;    /**< \brief Number of tasks moved off saturated cores */
+    uint16 RebalanceLastEntry;    /**< \brief Rebalance Table entry of the latest move */
+    uint8  RebalanceLastFromCore; /**< \brief Core the latest move was from */
+    uint8  RebalanceLastToCore;   /**< \brief Core the latest move was to */
+
+    HS_UtilTrendConfig_t UtilTrendConfig;    /**< \brief Current CPU saturation warning settings */
+    int32                UtilTrendSlope;     /**< \brief Fitted CPU utilization change in Utils per 100 intervals */
+    uint32               UtilTrendTimeToSat; /**< \brief Predicted intervals to saturation, or not rising */
+
+    uint32      PsiAvailableMask;          /**< \brief Bit N set when pressure stall resource N is monitored */
+    uint32      PsiActiveMask;             /**< \brief Bit N set while pressure stall resource N is above its level */
+    HS_PsiTlm_t Psi[HS_PSI_NUM_RESOURCES]; /**< \brief Pressure stall by resource, see #HS_PSI_RESOURCE_CPU */
+
+    HS_MemTlm_t Mem; /**< \brief Memory usage and alarms */
+
+    uint32 StackMaxUsage; /**< \brief Highest stack usage in percent of any thread at the last full stack scan */
+
+    HS_SbPipeTlm_t SbWorstPipes[HS_SB_WORST_PIPES]; /**< \brief Pipes with the highest queue usage, highest first */
+    uint32         SbPipeActiveMask; /**< \brief Bit N set while the pipe of #HS_SB_PIPE_LIMITS entry N is above */
+    uint32         SbDropCount;      /**< \brief Messages dropped by the Software Bus since HS started */
+
+    HS_WakeupTlm_t Wakeup; /**< \brief Wakeup intervals, missed and late wakeups */
+
+    uint32 ProcEventOverflowCount; /**< \brief Events from processors beyond #HS_MAX_EVENT_PROCESSORS */
+
+    HS_ProcEventCount_t ProcEventCounts[HS_MAX_EVENT_PROCESSORS]; /**< \brief Event counts by source processor */
 
 #if HS_MAX_EXEC_CNT_SLOTS != 0
     uint32 ExeCounts[HS_MAX_EXEC_CNT_SLOTS]; /**< \brief Execution Counters */
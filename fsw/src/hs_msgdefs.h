@@ -54,6 +54,51 @@
 #define HS_LOADED_AMT 0x04
 #define HS_LOADED_EMT 0x08
 #define HS_CDS_IN_USE 0x10
+#define HS_LOADED_LST 0x20
+#define HS_LOADED_CBT 0x40
+#define HS_LOADED_RBT 0x80
+/**\}*/
+
+/**
+ * \name HS Utilization History Dump Destinations
+ * \{
+ */
+#define HS_UTIL_HIST_DEST_TLM  0 /**< \brief Dump utilization history as telemetry */
+#define HS_UTIL_HIST_DEST_FILE 1 /**< \brief Dump utilization history to a file */
+/**\}*/
+
+/**
+ * \name HS Alarm Action Types
+ * \{
+ */
+#define HS_ALARM_ACT_NOACT       0 /**< \brief No action is taken */
+#define HS_ALARM_ACT_EVENT       1 /**< \brief Generates event message when the alarm is raised */
+#define HS_ALARM_ACT_LAST_NONMSG 1 /**< \brief Index for finding end of non-message actions */
+/**\}*/
+
+/**
+ * \name HS CPU Saturation Trend Not Rising
+ * \{
+ */
+#define HS_UTIL_TREND_NOT_RISING 0xFFFFFFFF /**< \brief Time to saturation when utilization is not rising */
+/**\}*/
+
+/**
+ * \name HS Pressure Stall Resources
+ * \{
+ */
+#define HS_PSI_RESOURCE_CPU    0 /**< \brief CPU pressure, from /proc/pressure/cpu */
+#define HS_PSI_RESOURCE_MEMORY 1 /**< \brief Memory pressure, from /proc/pressure/memory */
+#define HS_PSI_RESOURCE_IO     2 /**< \brief I/O pressure, from /proc/pressure/io */
+#define HS_PSI_NUM_RESOURCES   3 /**< \brief Number of pressure stall resources */
+/**\}*/
+
+/**
+ * \name HS Memory Alarms
+ * \{
+ */
+#define HS_MEM_ALARM_LOW_AVAIL 0x01 /**< \brief Available memory is at or below #HS_MEM_LOW_AVAIL_KB */
+#define HS_MEM_ALARM_LEAK      0x02 /**< \brief Resident set size growth is at or above #HS_MEM_LEAK_GROWTH_KB */
 /**\}*/
 
 /**
@@ -450,6 +495,222 @@
  */
 #define HS_DISABLE_CPUHOG_CC 11
 
+/*
+** Command codes 12 through 14 are reserved for the platform custom
+** commands defined in hs_custom.h
+*/
+
+/**
+ * \brief Enable Event Monitor Entries
+ *
+ *  \par Description
+ *       Enables a contiguous range of Event Monitor Table entries so
+ *       that matching events again trigger the table specified action
+ *
+ *  \par Command Structure
+ *       #HS_EventMonEntriesCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - #HS_HkPacket_t.EventMonEnables bits for the entries will be set
+ *       - The #HS_ENABLE_EVENTMON_ENTRIES_DBG_EID informational event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Entry range is empty or extends past #HS_MAX_MONITORED_EVENTS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_LEN_ERR_EID or #HS_EVENTMON_ENTRIES_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #HS_DISABLE_EVENTMON_ENTRIES_CC
+ */
+#define HS_ENABLE_EVENTMON_ENTRIES_CC 15
+
+/**
+ * \brief Disable Event Monitor Entries
+ *
+ *  \par Description
+ *       Disables a contiguous range of Event Monitor Table entries so
+ *       that matching events no longer trigger any action, without
+ *       reloading the table or disabling the whole Event Monitor
+ *
+ *  \par Command Structure
+ *       #HS_EventMonEntriesCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - #HS_HkPacket_t.EventMonEnables bits for the entries will be cleared
+ *       - The #HS_DISABLE_EVENTMON_ENTRIES_DBG_EID informational event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Entry range is empty or extends past #HS_MAX_MONITORED_EVENTS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_LEN_ERR_EID or #HS_EVENTMON_ENTRIES_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #HS_ENABLE_EVENTMON_ENTRIES_CC
+ */
+#define HS_DISABLE_EVENTMON_ENTRIES_CC 16
+
+/**
+ * \brief Dump Utilization History
+ *
+ *  \par Description
+ *       Dumps one resolution level of the CPU utilization history,
+ *       oldest entry first, either as a #HS_UtilHistPkt_t telemetry
+ *       packet or to a file
+ *
+ *  \par Command Structure
+ *       #HS_DumpUtilHistCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - A #HS_UtilHistPkt_t packet will be sent or the file will be written
+ *       - The #HS_DUMP_UTIL_HIST_DBG_EID informational event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Invalid history level or destination
+ *       - Dump file could not be created or written
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_LEN_ERR_EID, #HS_DUMP_UTIL_HIST_ERR_EID
+ *         or #HS_UTIL_HIST_FILE_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_DUMP_UTIL_HIST_CC 17
+
+/**
+ * \brief Send Utilization Percentile Histogram
+ *
+ *  \par Description
+ *       Sends the histogram of interval CPU utilization over the last
+ *       #HS_UTIL_PCTL_WINDOW intervals as a #HS_UtilPctlPkt_t
+ *       telemetry packet
+ *
+ *  \par Command Structure
+ *       #HS_NoArgsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - A #HS_UtilPctlPkt_t packet will be sent
+ *       - The #HS_SEND_UTIL_PCTL_DBG_EID informational event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_LEN_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define HS_SEND_UTIL_PCTL_CC 20
+
+/**
+ * \brief Set CPU Load Level
+ *
+ *  \par Description
+ *       Replaces the enter and exit thresholds, dwell time and action
+ *       of one CPU load level and restarts its dwell count. An active
+ *       level stays active until utilization falls below its new exit
+ *       threshold.
+ *
+ *  \par Command Structure
+ *       #HS_SetUtilLoadLevelCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - #HS_HkPacket_t.UtilLoadLevels will show the new level
+ *       - The #HS_SET_UTIL_LOAD_LEVEL_INF_EID informational event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Level is #HS_UTIL_LOAD_NUM_LEVELS or more
+ *       - Exit threshold greater than the enter threshold
+ *       - Action type is not a valid action or message action
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_LEN_ERR_EID or #HS_SET_UTIL_LOAD_LEVEL_ERR_EID
+ *
+ *  \par Criticality
+ *       Setting a message action that sheds load or commands a reset
+ *       at a low enter threshold may disrupt normal operations.
+ */
+#define HS_SET_UTIL_LOAD_LEVEL_CC 22
+
+/**
+ * \brief Set CPU Saturation Warning
+ *
+ *  \par Description
+ *       Replaces the horizon and action of the CPU saturation warning.
+ *       The warning is given when the utilization trend predicts
+ *       saturation within the horizon, in utilization intervals. A
+ *       horizon of 0 disables the warning. A warning already given is
+ *       cleared, so it is given again if saturation is still predicted
+ *       within the new horizon.
+ *
+ *  \par Command Structure
+ *       #HS_SetUtilTrendCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #HS_HkPacket_t.CmdCount will increment
+ *       - #HS_HkPacket_t.UtilTrendConfig will show the new settings
+ *       - The #HS_SET_UTIL_TREND_INF_EID informational event message will be
+ *         generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Action type is not a valid action or message action
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #HS_HkPacket_t.CmdErrCount will increment
+ *       - Error specific event message #HS_LEN_ERR_EID or #HS_SET_UTIL_TREND_ERR_EID
+ *
+ *  \par Criticality
+ *       Setting a message action that sheds load or commands a reset
+ *       with a long horizon may act on a trend that would not have
+ *       reached saturation.
+ */
+#define HS_SET_UTIL_TREND_CC 23
+
 /**\}*/
 
 #endif
@@ -80,6 +80,9 @@ typedef struct
     uint16 NullTerm;                 /**< \brief Buffer of nulls to terminate string */
     uint16 EventID;                  /**< \brief Event number of monitored event */
     uint16 ActionType;               /**< \brief Action to take if event is received */
+    uint16 Padding;                  /**< \brief Structure padding */
+    uint32 SpacecraftID;             /**< \brief Spacecraft ID qualifier (or #HS_EMT_QUAL_ANY, #HS_EMT_QUAL_LOCAL) */
+    uint32 ProcessorID;              /**< \brief Processor ID qualifier (or #HS_EMT_QUAL_ANY, #HS_EMT_QUAL_LOCAL) */
 } HS_EMTEntry_t;
 
 /**
@@ -111,4 +114,45 @@ typedef struct
     HS_MATMsgBuf_t MsgBuf;      /**< \brief Message to be sent */
 } HS_MATEntry_t;
 
+/**
+ *  \brief Load Shedding Table (LST) Entry
+ */
+typedef struct
+{
+    uint16         EnableState;   /**< \brief If entry contains a step */
+    uint16         Padding;       /**< \brief Structure padding */
+    HS_MATMsgBuf_t ShedMsgBuf;    /**< \brief Message sent to shed load at this step */
+    HS_MATMsgBuf_t RestoreMsgBuf; /**< \brief Message sent to restore the load shed at this step */
+} HS_LSTEntry_t;
+
+/**
+ *  \brief CPU Budget Table (CBT) Entry
+ *
+ *  Action types are the Application Monitor Table (AMT) action types,
+ *  an application restart restarts the application owning the task.
+ */
+typedef struct
+{
+    char   TaskName[OS_MAX_API_NAME]; /**< \brief Name of task to be held to the budget */
+    uint16 NullTerm;                  /**< \brief Buffer of nulls to terminate string */
+    uint16 Intervals;                 /**< \brief Consecutive utilization intervals over budget before action */
+    uint16 ActionType;                /**< \brief Action to take if the task stays over budget */
+    uint16 Padding;                   /**< \brief Structure padding */
+    uint32 MaxUtil;                   /**< \brief Budget, in utilization of one core per interval */
+} HS_CBTEntry_t;
+
+/**
+ *  \brief Rebalance Table (RBT) Entry
+ *
+ *  Core N is allowed when bit N of the CoreMask is set. An entry with
+ *  no name or no allowed cores is unused.
+ */
+typedef struct
+{
+    char   TaskName[OS_MAX_API_NAME]; /**< \brief Name of task that can be moved between cores */
+    uint16 NullTerm;                  /**< \brief Buffer of nulls to terminate string */
+    uint16 Padding;                   /**< \brief Structure padding */
+    uint32 CoreMask;                  /**< \brief Cores the task can be moved to */
+} HS_RBTEntry_t;
+
 #endif
@@ -45,6 +45,9 @@
 #define HS_EMT_TABLENAME "EventMon_Tbl" /**< \brief EventMon Table Name */
 #define HS_XCT_TABLENAME "ExeCount_Tbl" /**< \brief ExeCount Table Name */
 #define HS_MAT_TABLENAME "MsgActs_Tbl"  /**< \brief MsgAction Table Name */
+#define HS_LST_TABLENAME "LoadShed_Tbl" /**< \brief LoadShed Table Name */
+#define HS_CBT_TABLENAME "CpuBudget_Tbl" /**< \brief CpuBudget Table Name */
+#define HS_RBT_TABLENAME "Rebalance_Tbl" /**< \brief Rebalance Table Name */
 /**\}*/
 
 /**
@@ -69,6 +72,14 @@
 #define HS_EMT_ACT_LAST_NONMSG 3 /**< \brief Index for finding end of non-message actions */
 /**\}*/
 
+/**
+ * \name Event Monitor Table (EMT) Spacecraft/Processor Qualifiers
+ * \{
+ */
+#define HS_EMT_QUAL_ANY   0xFFFFFFFF /**< \brief Matches events from any spacecraft or processor */
+#define HS_EMT_QUAL_LOCAL 0xFFFFFFFE /**< \brief Matches only events from the local spacecraft or processor */
+/**\}*/
+
 /**
  * \name Execution Counters Table (XCT) Resource Types
  * \{
@@ -89,6 +100,14 @@
 #define HS_MAT_STATE_NOEVENT  2 /**< \brief Message Actions are Enabled but produce no events */
 /**\}*/
 
+/**
+ * \name Load Shedding Table (LST) Enable State
+ * \{
+ */
+#define HS_LST_STATE_DISABLED 0 /**< \brief Load shedding step is unused */
+#define HS_LST_STATE_ENABLED  1 /**< \brief Load shedding step is used */
+/**\}*/
+
 /**
  * \name Application Monitor Table (AMT) Validation Error Enumerated Types
  * \{
@@ -105,6 +124,7 @@
 #define HS_EMTVAL_NO_ERR  0  /**< \brief No error                          */
 #define HS_EMTVAL_ERR_ACT -1 /**< \brief Invalid ActionType specified      */
 #define HS_EMTVAL_ERR_NUL -2 /**< \brief Null Safety Buffer not Null       */
+#define HS_EMTVAL_ERR_PAD -3 /**< \brief Padding not zero                  */
 /**\}*/
 
 /**
@@ -126,4 +146,32 @@
 #define HS_MATVAL_ERR_ENA -3 /**< \brief Invalid Enable State specified    */
 /**\}*/
 
+/**
+ * \name Load Shedding Table (LST) Validation Error Enumerated Types
+ * \{
+ */
+#define HS_LSTVAL_NO_ERR  0  /**< \brief No error                          */
+#define HS_LSTVAL_ERR_ID  -1 /**< \brief Invalid Message ID specified      */
+#define HS_LSTVAL_ERR_LEN -2 /**< \brief Invalid Length specified          */
+#define HS_LSTVAL_ERR_ENA -3 /**< \brief Invalid Enable State specified    */
+/**\}*/
+
+/**
+ * \name CPU Budget Table (CBT) Validation Error Enumerated Types
+ * \{
+ */
+#define HS_CBTVAL_NO_ERR  0  /**< \brief No error                          */
+#define HS_CBTVAL_ERR_ACT -1 /**< \brief Invalid ActionType specified      */
+#define HS_CBTVAL_ERR_NUL -2 /**< \brief Null Safety Buffer not Null       */
+/**\}*/
+
+/**
+ * \name Rebalance Table (RBT) Validation Error Enumerated Types
+ * \{
+ */
+#define HS_RBTVAL_NO_ERR    0  /**< \brief No error                          */
+#define HS_RBTVAL_ERR_CORES -1 /**< \brief Core beyond HS_UTIL_NUM_CORES     */
+#define HS_RBTVAL_ERR_NUL   -2 /**< \brief Null Safety Buffer not Null       */
+/**\}*/
+
 #endif
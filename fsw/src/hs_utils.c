@@ -25,6 +25,25 @@
 /************************************************************************
 ** Includes
 *************************************************************************/
+#ifdef __linux__
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cfe_psp.h"
 #include "hs_app.h"
 #include "hs_utils.h"
 #include "hs_custom.h"
@@ -133,3 +152,1269 @@ bool HS_EMTActionIsValid(uint16 ActionType)
 
     return IsValid;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check an EMT Spacecraft/Processor qualifier against a source ID */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_EMTQualifierMatches(uint32 Qualifier, uint32 SourceId, uint32 LocalId)
+{
+    bool IsMatch = false;
+
+    if (Qualifier == HS_EMT_QUAL_ANY)
+    {
+        IsMatch = true;
+    }
+    else if (Qualifier == HS_EMT_QUAL_LOCAL)
+    {
+        IsMatch = (SourceId == LocalId);
+    }
+    else
+    {
+        IsMatch = (SourceId == Qualifier);
+    }
+
+    return IsMatch;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Pin the calling task to a single processor core                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_SetCpuAffinity(uint32 CoreIndex)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    cpu_set_t CpuSet;
+
+    CPU_ZERO(&CpuSet);
+    CPU_SET(CoreIndex, &CpuSet);
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(CpuSet), &CpuSet) == 0)
+    {
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the cores a thread can run on                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_GetThreadAffinity(uint32 ThreadId, uint32 *CoreMaskPtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    cpu_set_t CpuSet;
+    uint32    CoreIndex = 0;
+
+    CPU_ZERO(&CpuSet);
+
+    if (sched_getaffinity((pid_t)ThreadId, sizeof(CpuSet), &CpuSet) == 0)
+    {
+        *CoreMaskPtr = 0;
+
+        for (CoreIndex = 0; CoreIndex < 32; CoreIndex++)
+        {
+            if (CPU_ISSET(CoreIndex, &CpuSet))
+            {
+                *CoreMaskPtr |= (1U << CoreIndex);
+            }
+        }
+
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set the cores a thread can run on                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_SetThreadAffinity(uint32 ThreadId, uint32 CoreMask)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    cpu_set_t CpuSet;
+    uint32    CoreIndex = 0;
+
+    CPU_ZERO(&CpuSet);
+
+    for (CoreIndex = 0; CoreIndex < 32; CoreIndex++)
+    {
+        if ((CoreMask & (1U << CoreIndex)) != 0)
+        {
+            CPU_SET(CoreIndex, &CpuSet);
+        }
+    }
+
+    if (sched_setaffinity((pid_t)ThreadId, sizeof(CpuSet), &CpuSet) == 0)
+    {
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the per core CPU times from /proc/stat contents           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParseProcStat(const char *Buffer, HS_CpuTimes_t *TimesPtr, uint32 NumCores)
+{
+    const char *LinePtr   = Buffer;
+    char *      EndPtr    = NULL;
+    uint32      CoreIndex = 0;
+    uint32      Field     = 0;
+    uint32      NumFound  = 0;
+    uint64      Value     = 0;
+
+    /* The cpu lines are always first, so stop at the first other line */
+    while ((LinePtr != NULL) && (strncmp(LinePtr, "cpu", 3) == 0))
+    {
+        LinePtr += 3;
+
+        if (*LinePtr == ' ')
+        {
+            /* Aggregate line, only used when a single core is monitored */
+            CoreIndex = (NumCores == 1) ? 0 : NumCores;
+        }
+        else
+        {
+            CoreIndex = (uint32)strtoul(LinePtr, &EndPtr, 10);
+            LinePtr   = EndPtr;
+
+            if (NumCores == 1)
+            {
+                CoreIndex = NumCores;
+            }
+        }
+
+        if (CoreIndex < NumCores)
+        {
+            TimesPtr[CoreIndex].Busy  = 0;
+            TimesPtr[CoreIndex].Total = 0;
+
+            /* user nice system idle iowait irq softirq steal */
+            for (Field = 0; Field < 8; Field++)
+            {
+                Value = strtoull(LinePtr, &EndPtr, 10);
+
+                if (EndPtr == LinePtr)
+                {
+                    break;
+                }
+
+                LinePtr = EndPtr;
+
+                TimesPtr[CoreIndex].Total += Value;
+
+                if ((Field != 3) && (Field != 4))
+                {
+                    TimesPtr[CoreIndex].Busy += Value;
+                }
+            }
+
+            /* Kernels since 2.6.11 report at least up to steal */
+            if (Field == 8)
+            {
+                NumFound++;
+            }
+        }
+
+        LinePtr = strchr(LinePtr, '\n');
+
+        if (LinePtr != NULL)
+        {
+            LinePtr++;
+        }
+    }
+
+    return (NumFound == NumCores) ? CFE_SUCCESS : CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read the per core CPU times from /proc/stat                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ReadProcStat(HS_CpuTimes_t *TimesPtr, uint32 NumCores)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    char    Buffer[HS_PROC_STAT_BUFFER_SIZE];
+    int     FileDes = 0;
+    ssize_t Length  = 0;
+
+    Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    FileDes = open("/proc/stat", O_RDONLY);
+
+    if (FileDes >= 0)
+    {
+        Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+        close(FileDes);
+
+        if (Length > 0)
+        {
+            Buffer[Length] = '\0';
+            Status         = HS_ParseProcStat(Buffer, TimesPtr, NumCores);
+        }
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the CPU time of one thread from its stat contents         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParseTaskStat(const char *Buffer, uint64 NsPerTick, HS_TaskCpuSample_t *SamplePtr)
+{
+    const char *NamePtr = NULL;
+    const char *LinePtr = NULL;
+    char *      EndPtr  = NULL;
+    size_t      NameLen = 0;
+    uint32      Field   = 0;
+    uint64      Value   = 0;
+    uint64      Ticks   = 0;
+    int32       Status  = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    /* The name is in parentheses and may itself contain spaces and parentheses */
+    NamePtr = strchr(Buffer, '(');
+    LinePtr = strrchr(Buffer, ')');
+
+    if ((NamePtr != NULL) && (LinePtr != NULL) && (LinePtr > NamePtr))
+    {
+        NamePtr++;
+        NameLen = LinePtr - NamePtr;
+
+        if (NameLen >= sizeof(SamplePtr->Name))
+        {
+            NameLen = sizeof(SamplePtr->Name) - 1;
+        }
+
+        memcpy(SamplePtr->Name, NamePtr, NameLen);
+        SamplePtr->Name[NameLen] = '\0';
+        SamplePtr->ThreadId      = (uint32)strtoul(Buffer, NULL, 10);
+
+        /* The state is field 3, utime and stime are fields 14 and 15 */
+        LinePtr++;
+        while (*LinePtr == ' ')
+        {
+            LinePtr++;
+        }
+
+        SamplePtr->State = *LinePtr;
+
+        if (*LinePtr != '\0')
+        {
+            LinePtr++;
+        }
+
+        for (Field = 4; Field <= 15; Field++)
+        {
+            Value = strtoull(LinePtr, &EndPtr, 10);
+
+            if (EndPtr == LinePtr)
+            {
+                break;
+            }
+
+            LinePtr = EndPtr;
+
+            if (Field >= 14)
+            {
+                Ticks += Value;
+            }
+        }
+
+        if (Field > 15)
+        {
+            SamplePtr->CpuTimeNs = Ticks * NsPerTick;
+            Status               = CFE_SUCCESS;
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read the CPU time of each thread of this process                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ReadTaskCpuTimes(HS_TaskCpuSample_t *SamplesPtr, uint32 MaxSamples, bool SchedInfo, uint32 *NumSamplesPtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+    *NumSamplesPtr = 0;
+
+#ifdef __linux__
+    char           Buffer[HS_TASK_STAT_BUFFER_SIZE];
+    DIR *          DirPtr      = NULL;
+    struct dirent *EntryPtr    = NULL;
+    int            TaskDirFd   = 0;
+    int            FileDes     = 0;
+    ssize_t        Length      = 0;
+    long           TicksPerSec = 0;
+
+    Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    TicksPerSec = sysconf(_SC_CLK_TCK);
+
+    /* One directory walk per call, the only allocation is the directory stream */
+    DirPtr = opendir("/proc/self/task");
+
+    if ((DirPtr != NULL) && (TicksPerSec > 0))
+    {
+        Status = CFE_SUCCESS;
+
+        EntryPtr = readdir(DirPtr);
+
+        while ((EntryPtr != NULL) && (*NumSamplesPtr < MaxSamples))
+        {
+            /* Skip . and .. */
+            if (EntryPtr->d_name[0] != '.')
+            {
+                /*
+                ** The thread directory is opened relative to the walk and its
+                ** files relative to it, so no path is resolved more than once.
+                ** The thread may have exited since the directory was read.
+                */
+                TaskDirFd = openat(dirfd(DirPtr), EntryPtr->d_name, O_RDONLY | O_DIRECTORY);
+
+                if (TaskDirFd >= 0)
+                {
+                    FileDes = openat(TaskDirFd, "stat", O_RDONLY);
+                    Length  = 0;
+
+                    if (FileDes >= 0)
+                    {
+                        Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+                        close(FileDes);
+                    }
+
+                    if (Length > 0)
+                    {
+                        Buffer[Length] = '\0';
+
+                        if (HS_ParseTaskStat(Buffer, 1000000000 / TicksPerSec, &SamplesPtr[*NumSamplesPtr]) ==
+                            CFE_SUCCESS)
+                        {
+                            /* Scheduler statistics are optional and left zero when missing or not asked for */
+                            if (SchedInfo)
+                            {
+                                HS_ReadTaskSchedInfo(TaskDirFd, &SamplesPtr[*NumSamplesPtr]);
+                            }
+                            else
+                            {
+                                SamplesPtr[*NumSamplesPtr].RunDelayNs       = 0;
+                                SamplesPtr[*NumSamplesPtr].VolCtxSwitches   = 0;
+                                SamplesPtr[*NumSamplesPtr].InvolCtxSwitches = 0;
+                            }
+
+                            (*NumSamplesPtr)++;
+                        }
+                    }
+
+                    close(TaskDirFd);
+                }
+            }
+
+            EntryPtr = readdir(DirPtr);
+        }
+    }
+
+    if (DirPtr != NULL)
+    {
+        closedir(DirPtr);
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the run delay of one thread from its schedstat contents   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParseTaskSchedstat(const char *Buffer, HS_TaskCpuSample_t *SamplePtr)
+{
+    const char *LinePtr = Buffer;
+    char *      EndPtr  = NULL;
+    uint64      Value   = 0;
+    int32       Status  = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    /* Time on the CPU, time waiting on a run queue, timeslices run */
+    strtoull(LinePtr, &EndPtr, 10);
+
+    if (EndPtr != LinePtr)
+    {
+        LinePtr = EndPtr;
+        Value   = strtoull(LinePtr, &EndPtr, 10);
+
+        if (EndPtr != LinePtr)
+        {
+            SamplePtr->RunDelayNs = Value;
+            Status                = CFE_SUCCESS;
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the context switches of one thread from its status        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParseTaskCtxSwitches(const char *Buffer, HS_TaskCpuSample_t *SamplePtr)
+{
+    const char *VolPtr   = NULL;
+    const char *InvolPtr = NULL;
+    int32       Status   = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    /* Match at line starts, voluntary_ctxt_switches is also the end of nonvoluntary_ctxt_switches */
+    VolPtr   = strstr(Buffer, "\nvoluntary_ctxt_switches:");
+    InvolPtr = strstr(Buffer, "\nnonvoluntary_ctxt_switches:");
+
+    if ((VolPtr != NULL) && (InvolPtr != NULL))
+    {
+        SamplePtr->VolCtxSwitches   = (uint32)strtoull(VolPtr + sizeof("\nvoluntary_ctxt_switches:") - 1, NULL, 10);
+        SamplePtr->InvolCtxSwitches =
+            (uint32)strtoull(InvolPtr + sizeof("\nnonvoluntary_ctxt_switches:") - 1, NULL, 10);
+        Status = CFE_SUCCESS;
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read the scheduler statistics of one thread of this process     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ReadTaskSchedInfo(int TaskDirFd, HS_TaskCpuSample_t *SamplePtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+    SamplePtr->RunDelayNs       = 0;
+    SamplePtr->VolCtxSwitches   = 0;
+    SamplePtr->InvolCtxSwitches = 0;
+
+#ifdef __linux__
+    char    Buffer[HS_TASK_STATUS_BUFFER_SIZE];
+    int     FileDes = 0;
+    ssize_t Length  = 0;
+    uint32  NumRead = 0;
+
+    FileDes = openat(TaskDirFd, "schedstat", O_RDONLY);
+
+    if (FileDes >= 0)
+    {
+        Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+        close(FileDes);
+
+        if (Length > 0)
+        {
+            Buffer[Length] = '\0';
+
+            if (HS_ParseTaskSchedstat(Buffer, SamplePtr) == CFE_SUCCESS)
+            {
+                NumRead++;
+            }
+        }
+    }
+
+    FileDes = openat(TaskDirFd, "status", O_RDONLY);
+
+    if (FileDes >= 0)
+    {
+        Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+        close(FileDes);
+
+        if (Length > 0)
+        {
+            Buffer[Length] = '\0';
+
+            if (HS_ParseTaskCtxSwitches(Buffer, SamplePtr) == CFE_SUCCESS)
+            {
+                NumRead++;
+            }
+        }
+    }
+
+    Status = (NumRead == 2) ? CFE_SUCCESS : CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check whether a thread name belongs to a task name              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool HS_ThreadNameMatches(const char *ThreadName, const char *TaskName)
+{
+    return (strncmp(ThreadName, TaskName, HS_TASK_COMM_LEN - 1) == 0);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the cFE task of a thread                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_FindTaskByThreadName(const char *ThreadName, CFE_ES_TaskId_t *TaskIdPtr)
+{
+    HS_TaskSearch_t Search;
+    int32           Status = CFE_SUCCESS;
+
+    Status = CFE_ES_GetTaskIDByName(TaskIdPtr, ThreadName);
+
+    /*
+    ** A name as long as Linux allows may be the truncation of a longer one
+    */
+    if ((Status != CFE_SUCCESS) && (strlen(ThreadName) >= (HS_TASK_COMM_LEN - 1)))
+    {
+        memset(&Search, 0, sizeof(Search));
+        Search.ThreadName = ThreadName;
+
+        OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_TASK, OS_OBJECT_CREATOR_ANY, HS_FindTaskCallback, &Search);
+
+        if (Search.Found)
+        {
+            *TaskIdPtr = Search.TaskId;
+            Status     = CFE_SUCCESS;
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check one OSAL task against a thread name                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_FindTaskCallback(osal_id_t ObjectId, void *SearchPtr)
+{
+    HS_TaskSearch_t *TaskSearchPtr = SearchPtr;
+    char             TaskName[OS_MAX_API_NAME];
+
+    if (!TaskSearchPtr->Found && (OS_GetResourceName(ObjectId, TaskName, sizeof(TaskName)) == OS_SUCCESS) &&
+        HS_ThreadNameMatches(TaskSearchPtr->ThreadName, TaskName))
+    {
+        TaskSearchPtr->TaskId = CFE_ES_TaskId_FromOSAL(ObjectId);
+        TaskSearchPtr->Found  = true;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the contents of a pressure stall file                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParsePsi(const char *Buffer, HS_PsiSample_t *SamplePtr)
+{
+    const char *  LinePtr  = Buffer;
+    char *        EndPtr   = NULL;
+    HS_PsiLine_t *PsiPtr   = NULL;
+    HS_PsiLine_t  Line;
+    uint32        Field    = 0;
+    uint64        Value    = 0;
+    bool          SomeDone = false;
+
+    memset(SamplePtr, 0, sizeof(*SamplePtr));
+
+    while ((LinePtr != NULL) && (*LinePtr != '\0'))
+    {
+        if (strncmp(LinePtr, "some ", 5) == 0)
+        {
+            PsiPtr = &SamplePtr->Some;
+        }
+        else if (strncmp(LinePtr, "full ", 5) == 0)
+        {
+            PsiPtr = &SamplePtr->Full;
+        }
+        else
+        {
+            PsiPtr = NULL;
+        }
+
+        if (PsiPtr != NULL)
+        {
+            memset(&Line, 0, sizeof(Line));
+
+            /* avg10=1.23 avg60=0.45 avg300=0.06 total=123456 */
+            for (Field = 0; Field < 4; Field++)
+            {
+                LinePtr = strchr(LinePtr, '=');
+
+                if (LinePtr == NULL)
+                {
+                    break;
+                }
+
+                LinePtr++;
+                Value = strtoull(LinePtr, &EndPtr, 10);
+
+                if (EndPtr == LinePtr)
+                {
+                    break;
+                }
+
+                LinePtr = EndPtr;
+
+                if (Field == 3)
+                {
+                    Line.TotalUs = Value;
+                }
+                else
+                {
+                    /* Averages have two decimals, keep them as hundredths */
+                    Value *= 100;
+
+                    if ((LinePtr[0] == '.') && (LinePtr[1] >= '0') && (LinePtr[1] <= '9') && (LinePtr[2] >= '0') &&
+                        (LinePtr[2] <= '9'))
+                    {
+                        Value += ((LinePtr[1] - '0') * 10) + (LinePtr[2] - '0');
+                        LinePtr += 3;
+                    }
+
+                    if (Field == 0)
+                    {
+                        Line.Avg10 = (uint32)Value;
+                    }
+                    else if (Field == 1)
+                    {
+                        Line.Avg60 = (uint32)Value;
+                    }
+                    else
+                    {
+                        Line.Avg300 = (uint32)Value;
+                    }
+                }
+            }
+
+            if (Field == 4)
+            {
+                *PsiPtr = Line;
+
+                if (PsiPtr == &SamplePtr->Some)
+                {
+                    SomeDone = true;
+                }
+            }
+        }
+
+        if (LinePtr != NULL)
+        {
+            LinePtr = strchr(LinePtr, '\n');
+
+            if (LinePtr != NULL)
+            {
+                LinePtr++;
+            }
+        }
+    }
+
+    return SomeDone ? CFE_SUCCESS : CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read a pressure stall file                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ReadPsi(const char *Path, HS_PsiSample_t *SamplePtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    char    Buffer[HS_PSI_BUFFER_SIZE];
+    int     FileDes = 0;
+    ssize_t Length  = 0;
+
+    Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    FileDes = open(Path, O_RDONLY);
+
+    if (FileDes >= 0)
+    {
+        Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+        close(FileDes);
+
+        if (Length > 0)
+        {
+            Buffer[Length] = '\0';
+            Status         = HS_ParsePsi(Buffer, SamplePtr);
+        }
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse a field of a /proc key value file                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParseKbField(const char *Buffer, const char *Name, uint32 *ValuePtr)
+{
+    const char *LinePtr = Buffer;
+    char *      EndPtr  = NULL;
+    size_t      NameLen = strlen(Name);
+    uint64      Value   = 0;
+    int32       Status  = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    while (LinePtr != NULL)
+    {
+        if ((strncmp(LinePtr, Name, NameLen) == 0) && (LinePtr[NameLen] == ':'))
+        {
+            LinePtr += NameLen + 1;
+            Value = strtoull(LinePtr, &EndPtr, 10);
+
+            if (EndPtr != LinePtr)
+            {
+                *ValuePtr = (Value > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)Value;
+                Status    = CFE_SUCCESS;
+            }
+
+            break;
+        }
+
+        LinePtr = strchr(LinePtr, '\n');
+
+        if (LinePtr != NULL)
+        {
+            LinePtr++;
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read the memory sizes of the system and this process            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ReadMemory(HS_MemSample_t *SamplePtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    char    Buffer[HS_TASK_STATUS_BUFFER_SIZE];
+    int     FileDes = 0;
+    ssize_t Length  = 0;
+    uint32  NumRead = 0;
+
+    FileDes = open("/proc/meminfo", O_RDONLY);
+
+    if (FileDes >= 0)
+    {
+        Length = read(FileDes, Buffer, HS_MEMINFO_BUFFER_SIZE - 1);
+        close(FileDes);
+
+        if (Length > 0)
+        {
+            Buffer[Length] = '\0';
+
+            if ((HS_ParseKbField(Buffer, "MemTotal", &SamplePtr->TotalKb) == CFE_SUCCESS) &&
+                (HS_ParseKbField(Buffer, "MemAvailable", &SamplePtr->AvailKb) == CFE_SUCCESS))
+            {
+                NumRead++;
+            }
+        }
+    }
+
+    FileDes = open("/proc/self/status", O_RDONLY);
+
+    if (FileDes >= 0)
+    {
+        Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+        close(FileDes);
+
+        if (Length > 0)
+        {
+            Buffer[Length] = '\0';
+
+            if (HS_ParseKbField(Buffer, "VmRSS", &SamplePtr->RssKb) == CFE_SUCCESS)
+            {
+                NumRead++;
+            }
+        }
+    }
+
+    Status = (NumRead == 2) ? CFE_SUCCESS : CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the stack pointer from a thread syscall file              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParseSyscallSp(const char *Buffer, cpuaddr *SpPtr)
+{
+    const char *FieldPtr  = Buffer;
+    const char *SpField   = NULL;
+    const char *PcField   = NULL;
+    char *      EndPtr    = NULL;
+    uint32      NumFields = 0;
+    uint64      Value     = 0;
+    int32       Status    = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    /* A running thread reports only "running" */
+    while (*FieldPtr != '\0')
+    {
+        while (*FieldPtr == ' ')
+        {
+            FieldPtr++;
+        }
+
+        if ((*FieldPtr == '\0') || (*FieldPtr == '\n'))
+        {
+            break;
+        }
+
+        SpField = PcField;
+        PcField = FieldPtr;
+        NumFields++;
+
+        while ((*FieldPtr != '\0') && (*FieldPtr != ' ') && (*FieldPtr != '\n'))
+        {
+            FieldPtr++;
+        }
+    }
+
+    if ((NumFields >= 3) && (strncmp(SpField, "0x", 2) == 0))
+    {
+        Value = strtoull(SpField, &EndPtr, 16);
+
+        if ((EndPtr != SpField) && (Value != 0))
+        {
+            *SpPtr = (cpuaddr)Value;
+            Status = CFE_SUCCESS;
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the memory region holding an address from maps lines      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ParseMapsRegion(const char *Buffer, cpuaddr Address, cpuaddr *LowPtr, cpuaddr *HighPtr)
+{
+    const char *LinePtr = Buffer;
+    char *      EndPtr  = NULL;
+    uint64      Low     = 0;
+    uint64      High    = 0;
+    int32       Status  = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    while ((LinePtr != NULL) && (*LinePtr != '\0'))
+    {
+        /* Each line starts with the range as low-high in hex */
+        Low = strtoull(LinePtr, &EndPtr, 16);
+
+        if ((EndPtr != LinePtr) && (*EndPtr == '-'))
+        {
+            High = strtoull(EndPtr + 1, &EndPtr, 16);
+
+            if ((Address >= Low) && (Address < High))
+            {
+                *LowPtr  = (cpuaddr)Low;
+                *HighPtr = (cpuaddr)High;
+                Status   = CFE_SUCCESS;
+                break;
+            }
+        }
+
+        LinePtr = strchr(LinePtr, '\n');
+
+        if (LinePtr != NULL)
+        {
+            LinePtr++;
+        }
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the memory region holding an address                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_FindMapsRegion(cpuaddr Address, cpuaddr *LowPtr, cpuaddr *HighPtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    char    Buffer[HS_MAPS_BUFFER_SIZE];
+    char *  LinePtr  = NULL;
+    char *  EndPtr   = NULL;
+    int     FileDes  = 0;
+    ssize_t Length   = 0;
+    size_t  Kept     = 0;
+    bool    Skipping = false;
+
+    Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    FileDes = open("/proc/self/maps", O_RDONLY);
+
+    if (FileDes >= 0)
+    {
+        Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+
+        while ((Length > 0) && (Status != CFE_SUCCESS))
+        {
+            Length += Kept;
+            Buffer[Length] = '\0';
+            LinePtr        = Buffer;
+            Kept           = 0;
+
+            /* Drop the rest of a line too long for the buffer */
+            if (Skipping)
+            {
+                LinePtr = strchr(Buffer, '\n');
+
+                if (LinePtr != NULL)
+                {
+                    LinePtr++;
+                    Skipping = false;
+                }
+            }
+
+            EndPtr = (LinePtr != NULL) ? strrchr(LinePtr, '\n') : NULL;
+
+            if (EndPtr != NULL)
+            {
+                /* Parse the complete lines and keep the partial last line */
+                *EndPtr = '\0';
+                Status  = HS_ParseMapsRegion(LinePtr, Address, LowPtr, HighPtr);
+                Kept    = Length - ((EndPtr + 1) - Buffer);
+                memmove(Buffer, EndPtr + 1, Kept);
+            }
+            else if ((LinePtr != NULL) && (Length == (ssize_t)(sizeof(Buffer) - 1)))
+            {
+                /* The start of a line is enough to parse its range */
+                Status   = HS_ParseMapsRegion(LinePtr, Address, LowPtr, HighPtr);
+                Skipping = true;
+            }
+            else if (LinePtr != NULL)
+            {
+                Kept = Length;
+            }
+
+            if (Status != CFE_SUCCESS)
+            {
+                Length = read(FileDes, &Buffer[Kept], sizeof(Buffer) - 1 - Kept);
+            }
+        }
+
+        close(FileDes);
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Measure the unused end of a stack                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_StackUnusedBytes(cpuaddr Low, cpuaddr High)
+{
+    uint32 Unused = 0;
+
+#ifdef __linux__
+    unsigned char          Resident[HS_STACK_MINCORE_PAGES];
+    const volatile uint32 *WordPtr  = NULL;
+    cpuaddr                Address  = Low;
+    cpuaddr                Length   = 0;
+    long                   PageSize = 0;
+    uint32                 NumPages = 0;
+    uint32                 Page     = 0;
+    bool                   Found    = false;
+
+    PageSize = sysconf(_SC_PAGESIZE);
+
+    /* Skip the pages that were never touched */
+    while ((PageSize > 0) && (Address < High) && !Found)
+    {
+        Length = High - Address;
+
+        if (Length > ((cpuaddr)PageSize * HS_STACK_MINCORE_PAGES))
+        {
+            Length = (cpuaddr)PageSize * HS_STACK_MINCORE_PAGES;
+        }
+
+        NumPages = (uint32)((Length + PageSize - 1) / PageSize);
+
+        if (mincore((void *)Address, Length, Resident) != 0)
+        {
+            break;
+        }
+
+        for (Page = 0; Page < NumPages; Page++)
+        {
+            if ((Resident[Page] & 1) != 0)
+            {
+                Found = true;
+                break;
+            }
+
+            Address += PageSize;
+        }
+    }
+
+    /* Then the words that were never written */
+    WordPtr = (const volatile uint32 *)Address;
+
+    while (((cpuaddr)WordPtr < High) && ((*WordPtr == 0) || (*WordPtr == HS_STACK_PAINT_WORD)))
+    {
+        WordPtr++;
+    }
+
+    if ((cpuaddr)WordPtr > High)
+    {
+        WordPtr = (const volatile uint32 *)High;
+    }
+
+    Unused = (uint32)((cpuaddr)WordPtr - Low);
+#endif
+
+    return Unused;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read the stack usage of a thread of this process                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_ReadThreadStack(uint32 ThreadId, uint32 *SizePtr, uint32 *UsedPtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    char    Path[64];
+    char    Buffer[HS_SYSCALL_BUFFER_SIZE];
+    cpuaddr StackPtr = 0;
+    cpuaddr Low      = 0;
+    cpuaddr High     = 0;
+    int     FileDes  = 0;
+    ssize_t Length   = 0;
+
+    Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+
+    if (ThreadId == (uint32)syscall(SYS_gettid))
+    {
+        /* The calling thread is always running, so it uses its own frame */
+        StackPtr = (cpuaddr)&StackPtr;
+        Status   = CFE_SUCCESS;
+    }
+    else
+    {
+        snprintf(Path, sizeof(Path), "/proc/self/task/%u/syscall", (unsigned int)ThreadId);
+
+        FileDes = open(Path, O_RDONLY);
+
+        if (FileDes >= 0)
+        {
+            Length = read(FileDes, Buffer, sizeof(Buffer) - 1);
+            close(FileDes);
+
+            if (Length > 0)
+            {
+                Buffer[Length] = '\0';
+                Status         = HS_ParseSyscallSp(Buffer, &StackPtr);
+            }
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = HS_FindMapsRegion(StackPtr, &Low, &High);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        *SizePtr = (uint32)(High - Low);
+        *UsedPtr = *SizePtr - HS_StackUnusedBytes(Low, High);
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Paint the stack of the calling task                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_PaintStack(void)
+{
+#ifdef __linux__
+    pthread_attr_t   Attr;
+    volatile uint32 *WordPtr   = NULL;
+    void *           StackAddr = NULL;
+    size_t           StackSize = 0;
+    cpuaddr          Limit     = 0;
+
+    /* The main thread stack grows on demand and can't be painted ahead */
+    if (syscall(SYS_gettid) == getpid())
+    {
+        return;
+    }
+
+    if (pthread_getattr_np(pthread_self(), &Attr) != 0)
+    {
+        return;
+    }
+
+    if (pthread_attr_getstack(&Attr, &StackAddr, &StackSize) == 0)
+    {
+        Limit   = (cpuaddr)&WordPtr - HS_STACK_PAINT_MARGIN;
+        WordPtr = (volatile uint32 *)StackAddr;
+
+        while ((cpuaddr)WordPtr < Limit)
+        {
+            *WordPtr = HS_STACK_PAINT_WORD;
+            WordPtr++;
+        }
+    }
+
+    pthread_attr_destroy(&Attr);
+#endif
+
+    return;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the CPU time clock of the calling task                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_GetThreadCpuClock(int32 *ClockIdPtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    clockid_t ClockId;
+
+    if (pthread_getcpuclockid(pthread_self(), &ClockId) == 0)
+    {
+        *ClockIdPtr = (int32)ClockId;
+        Status      = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read a clock in nanoseconds                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_GetClockTimeNs(int32 ClockId, uint64 *NsPtr)
+{
+    int32 Status = CFE_STATUS_NOT_IMPLEMENTED;
+
+#ifdef __linux__
+    struct timespec TimeSpec;
+
+    if (clock_gettime((clockid_t)ClockId, &TimeSpec) == 0)
+    {
+        *NsPtr = ((uint64)TimeSpec.tv_sec * 1000000000) + (uint64)TimeSpec.tv_nsec;
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+#endif
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get monotonic time in nanoseconds                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint64 HS_GetMonotonicTimeNs(void)
+{
+#ifdef __linux__
+    struct timespec TimeSpec;
+
+    clock_gettime(CLOCK_MONOTONIC, &TimeSpec);
+
+    return ((uint64)TimeSpec.tv_sec * 1000000000) + (uint64)TimeSpec.tv_nsec;
+#else
+    OS_time_t PSPTime = {0};
+
+    CFE_PSP_GetTime(&PSPTime);
+
+    return (uint64)OS_TimeGetTotalNanoseconds(PSPTime);
+#endif
+}
+
+#if !defined(__GNUC__)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Exchange a shared value                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 HS_ExchangeUint32(uint32 *Ptr, uint32 Val)
+{
+    uint32 OldVal = *Ptr;
+
+    *Ptr = Val;
+
+    return OldVal;
+}
+#endif
@@ -28,6 +28,181 @@
  * Includes
  *************************************************************************/
 #include "cfe.h"
+#include "hs_platform_cfg.h"
+
+/*************************************************************************
+ * Constants
+ ************************************************************************/
+
+/**
+ * \brief Size of the buffer /proc/stat is read into
+ *
+ *  Only the leading cpu lines are parsed, so room for one line per core
+ *  plus the aggregate line is enough.
+ */
+#define HS_PROC_STAT_BUFFER_SIZE ((HS_UTIL_NUM_CORES + 1) * 160)
+
+/**
+ * \brief Size of the buffer the stat file of a thread is read into
+ *
+ *  Only the fields up to the system time are parsed.
+ */
+#define HS_TASK_STAT_BUFFER_SIZE 512
+
+/**
+ * \brief Size of the buffer the status file of a thread is read into
+ *
+ *  The context switch counts are the last lines of the file.
+ */
+#define HS_TASK_STATUS_BUFFER_SIZE 2048
+
+/**
+ * \brief Size of the buffer a pressure stall file is read into
+ *
+ *  A pressure stall file holds at most a "some" and a "full" line.
+ */
+#define HS_PSI_BUFFER_SIZE 256
+
+/**
+ * \brief Size of the buffer /proc/meminfo is read into
+ *
+ *  The total and available memory are the first and third lines.
+ */
+#define HS_MEMINFO_BUFFER_SIZE 256
+
+/**
+ * \brief Size of the buffer a thread syscall file is read into
+ *
+ *  A syscall file holds the syscall number, six arguments and the
+ *  stack and instruction pointers.
+ */
+#define HS_SYSCALL_BUFFER_SIZE 256
+
+/**
+ * \brief Size of the buffer /proc/self/maps is read through
+ *
+ *  Only the address range at the start of each line is used, so
+ *  longer lines are skipped to their end.
+ */
+#define HS_MAPS_BUFFER_SIZE 1024
+
+/**
+ * \brief Pages checked for residency per call to mincore
+ */
+#define HS_STACK_MINCORE_PAGES 256
+
+/**
+ * \brief Pattern written into the unused stack of HS tasks
+ */
+#define HS_STACK_PAINT_WORD 0xA5A5A5A5
+
+/**
+ * \brief Stack left unpainted below the painting function
+ *
+ *  Covers the frames of any functions the painting loop calls.
+ */
+#define HS_STACK_PAINT_MARGIN 1024
+
+/**
+ * \name Shared State Access
+ *
+ *  Used for the state handed between the Idle Tasks, the time synch
+ *  callback and the main task. Every such value has a single writer, so
+ *  an increment is a load and a store rather than a locked
+ *  read-modify-write. A value the reader clears after reading is
+ *  swapped out with #HS_ATOMIC_EXCHANGE, so no update from the writer
+ *  falls between the read and the clear. Without GCC compatible atomic
+ *  builtins, aligned 32 bit accesses must be atomic on the target, and
+ *  the exchange is a plain load and store.
+ * \{
+ */
+#if defined(__GNUC__)
+#define HS_ATOMIC_LOAD(Ptr)          __atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#define HS_ATOMIC_STORE(Ptr, Val)    __atomic_store_n((Ptr), (Val), __ATOMIC_RELEASE)
+#define HS_ATOMIC_EXCHANGE(Ptr, Val) __atomic_exchange_n((Ptr), (Val), __ATOMIC_ACQ_REL)
+#define HS_CACHE_ALIGNED             __attribute__((aligned(HS_CACHE_LINE_SIZE)))
+#define HS_ATOMIC_INCREMENT(Ptr) \
+    __atomic_store_n((Ptr), __atomic_load_n((Ptr), __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED)
+#else
+#define HS_ATOMIC_LOAD(Ptr)          (*(Ptr))
+#define HS_ATOMIC_STORE(Ptr, Val)    (*(Ptr) = (Val))
+#define HS_ATOMIC_EXCHANGE(Ptr, Val) HS_ExchangeUint32((Ptr), (Val))
+#define HS_ATOMIC_INCREMENT(Ptr)     (*(Ptr) = *(Ptr) + 1)
+#define HS_CACHE_ALIGNED
+#endif
+/**\}*/
+
+/*************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ * \brief Length of the thread name reported by Linux, including the NUL
+ */
+#define HS_TASK_COMM_LEN 16
+
+/**
+ * \brief Accumulated CPU time of one thread
+ */
+typedef struct
+{
+    uint32 ThreadId;               /**< \brief Operating system thread ID */
+    char   Name[HS_TASK_COMM_LEN]; /**< \brief Thread name */
+    char   State;                  /**< \brief Thread state letter, such as R for running */
+    uint64 CpuTimeNs;              /**< \brief User plus system time in nanoseconds */
+    uint64 RunDelayNs;             /**< \brief Time spent waiting on a run queue in nanoseconds */
+    uint32 VolCtxSwitches;         /**< \brief Context switches from blocking */
+    uint32 InvolCtxSwitches;       /**< \brief Context switches from preemption */
+} HS_TaskCpuSample_t;
+
+/**
+ * \brief Search for the cFE task a thread name belongs to
+ */
+typedef struct
+{
+    const char *    ThreadName; /**< \brief Thread name, possibly truncated */
+    CFE_ES_TaskId_t TaskId;     /**< \brief Task found */
+    bool            Found;      /**< \brief Whether a task was found */
+} HS_TaskSearch_t;
+
+/**
+ * \brief Accumulated CPU times of one core, in clock ticks
+ */
+typedef struct
+{
+    uint64 Busy;  /**< \brief Ticks spent in user, nice, system, irq, softirq and steal */
+    uint64 Total; /**< \brief Busy ticks plus idle and iowait ticks */
+} HS_CpuTimes_t;
+
+/**
+ * \brief One line of a pressure stall file
+ */
+typedef struct
+{
+    uint32 Avg10;   /**< \brief Stall share over 10 seconds, in hundredths of a percent */
+    uint32 Avg60;   /**< \brief Stall share over 60 seconds, in hundredths of a percent */
+    uint32 Avg300;  /**< \brief Stall share over 300 seconds, in hundredths of a percent */
+    uint64 TotalUs; /**< \brief Accumulated stall time in microseconds */
+} HS_PsiLine_t;
+
+/**
+ * \brief Contents of a pressure stall file
+ */
+typedef struct
+{
+    HS_PsiLine_t Some; /**< \brief Time at least one task was stalled */
+    HS_PsiLine_t Full; /**< \brief Time all non-idle tasks were stalled, zero for the CPU on older kernels */
+} HS_PsiSample_t;
+
+/**
+ * \brief Memory sizes of the system and the cFS process, in KiB
+ */
+typedef struct
+{
+    uint32 TotalKb; /**< \brief Total system memory */
+    uint32 AvailKb; /**< \brief System memory available without swapping */
+    uint32 RssKb;   /**< \brief Resident set size of the cFS process */
+} HS_MemSample_t;
 
 /**
  * \brief Verify message length
@@ -85,4 +260,547 @@ bool HS_AMTActionIsValid(uint16 ActionType);
  */
 bool HS_EMTActionIsValid(uint16 ActionType);
 
+/**
+ * \brief Check EMT Spacecraft/Processor Qualifier
+ *
+ *  \par Description
+ *       Checks if a Spacecraft ID or Processor ID taken from an event
+ *       message satisfies the matching qualifier of an EMT entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #HS_EMT_QUAL_ANY matches every source, #HS_EMT_QUAL_LOCAL
+ *       matches only the local ID, any other value must match exactly.
+ *
+ *  \param[in] Qualifier EMT entry qualifier
+ *  \param[in] SourceId  ID reported in the event message
+ *  \param[in] LocalId   ID of the local spacecraft or processor
+ *
+ *  \return Boolean qualifier match response
+ *  \retval true  Source satisfies qualifier
+ *  \retval false Source does not satisfy qualifier
+ */
+bool HS_EMTQualifierMatches(uint32 Qualifier, uint32 SourceId, uint32 LocalId);
+
+/**
+ * \brief Pin Calling Task to a Core
+ *
+ *  \par Description
+ *       Restricts the calling task to run only on the specified
+ *       processor core.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED.
+ *
+ *  \param[in] CoreIndex Processor core to run on
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_SetCpuAffinity(uint32 CoreIndex);
+
+/**
+ * \brief Get the Cores a Thread can Run on
+ *
+ *  \par Description
+ *       Reads the core affinity of a thread of this process as a mask
+ *       with bit N set when the thread can run on core N.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED. Only the first 32 cores are
+ *       reported.
+ *
+ *  \param[in]  ThreadId     Operating system thread ID
+ *  \param[out] CoreMaskPtr  Cores the thread can run on
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_GetThreadAffinity(uint32 ThreadId, uint32 *CoreMaskPtr);
+
+/**
+ * \brief Set the Cores a Thread can Run on
+ *
+ *  \par Description
+ *       Restricts a thread of this process to the cores whose bits
+ *       are set in the mask.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED.
+ *
+ *  \param[in] ThreadId  Operating system thread ID
+ *  \param[in] CoreMask  Cores the thread can run on, bit N for core N
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_SetThreadAffinity(uint32 ThreadId, uint32 CoreMask);
+
+/**
+ * \brief Parse CPU Times from /proc/stat Contents
+ *
+ *  \par Description
+ *       Extracts the accumulated busy and total ticks from the leading
+ *       cpu lines of /proc/stat. With a single core the aggregate cpu
+ *       line is used, otherwise the cpuN line of each core.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Guest time is already included in user and nice time and is
+ *       not counted again.
+ *
+ *  \param[in]  Buffer    NUL terminated /proc/stat contents
+ *  \param[out] TimesPtr  CPU times, one entry per core
+ *  \param[in]  NumCores  Number of entries in TimesPtr
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParseProcStat(const char *Buffer, HS_CpuTimes_t *TimesPtr, uint32 NumCores);
+
+/**
+ * \brief Read CPU Times from /proc/stat
+ *
+ *  \par Description
+ *       Reads /proc/stat once and parses the CPU times of each core
+ *       with #HS_ParseProcStat.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED.
+ *
+ *  \param[out] TimesPtr  CPU times, one entry per core
+ *  \param[in]  NumCores  Number of entries in TimesPtr
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ReadProcStat(HS_CpuTimes_t *TimesPtr, uint32 NumCores);
+
+/**
+ * \brief Parse the CPU Time of a Thread from its stat Contents
+ *
+ *  \par Description
+ *       Extracts the thread ID, name, state and user plus system time
+ *       from the contents of a /proc/self/task/TID/stat file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The name is truncated to #HS_TASK_COMM_LEN - 1 characters.
+ *
+ *  \param[in]  Buffer     NUL terminated stat contents
+ *  \param[in]  NsPerTick  Length of a clock tick in nanoseconds
+ *  \param[out] SamplePtr  Thread CPU time
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParseTaskStat(const char *Buffer, uint64 NsPerTick, HS_TaskCpuSample_t *SamplePtr);
+
+/**
+ * \brief Read the CPU Time of Each Thread of this Process
+ *
+ *  \par Description
+ *       Walks /proc/self/task once and reads the stat file of each
+ *       thread with #HS_ParseTaskStat. When SchedInfo is set, the
+ *       scheduler statistics of each thread are read through the same
+ *       thread directory handle with #HS_ReadTaskSchedInfo.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED. Threads beyond MaxSamples and
+ *       threads that exit during the walk are skipped. Without
+ *       SchedInfo the scheduler statistics of each sample are zero.
+ *
+ *  \param[out] SamplesPtr     Thread CPU times
+ *  \param[in]  MaxSamples     Number of entries in SamplesPtr
+ *  \param[in]  SchedInfo      Whether to read the scheduler statistics
+ *  \param[out] NumSamplesPtr  Number of entries filled in
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ReadTaskCpuTimes(HS_TaskCpuSample_t *SamplesPtr, uint32 MaxSamples, bool SchedInfo, uint32 *NumSamplesPtr);
+
+/**
+ * \brief Parse the Run Delay of a Thread from its schedstat Contents
+ *
+ *  \par Description
+ *       Extracts the time spent waiting on a run queue from the
+ *       contents of a /proc/self/task/TID/schedstat file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in]  Buffer     NUL terminated schedstat contents
+ *  \param[out] SamplePtr  Thread sample whose RunDelayNs is set
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParseTaskSchedstat(const char *Buffer, HS_TaskCpuSample_t *SamplePtr);
+
+/**
+ * \brief Parse the Context Switches of a Thread from its status Contents
+ *
+ *  \par Description
+ *       Extracts the voluntary and involuntary context switch counts
+ *       from the contents of a /proc/self/task/TID/status file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The counts are truncated to 32 bits.
+ *
+ *  \param[in]  Buffer     NUL terminated status contents
+ *  \param[out] SamplePtr  Thread sample whose context switch counts are set
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParseTaskCtxSwitches(const char *Buffer, HS_TaskCpuSample_t *SamplePtr);
+
+/**
+ * \brief Read the Scheduler Statistics of a Thread
+ *
+ *  \par Description
+ *       Reads the run delay and the context switch counts of one thread
+ *       of this process with #HS_ParseTaskSchedstat and
+ *       #HS_ParseTaskCtxSwitches, opening its schedstat and status
+ *       files relative to its /proc/self/task/TID directory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED. Statistics that can't be read, such
+ *       as the run delay on kernels built without scheduler statistics,
+ *       are left zero.
+ *
+ *  \param[in]  TaskDirFd  Open file descriptor of the /proc/self/task/TID directory
+ *  \param[out] SamplePtr  Thread sample whose scheduler statistics are set
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ReadTaskSchedInfo(int TaskDirFd, HS_TaskCpuSample_t *SamplePtr);
+
+/**
+ * \brief Check Whether a Thread Name Belongs to a Task Name
+ *
+ *  \par Description
+ *       Compares the name Linux reports for a thread with the name of a
+ *       cFE task. Linux keeps only the first #HS_TASK_COMM_LEN - 1
+ *       characters of a thread name, so only that many characters are
+ *       compared.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Threads only carry their task name if OSAL names the threads it
+ *       creates, as the POSIX OSAL does with pthread_setname_np. Without
+ *       that every thread carries the process name and no task matches.
+ *
+ *  \param[in] ThreadName  Thread name from /proc/self/task
+ *  \param[in] TaskName    cFE task name
+ *
+ *  \return Whether the names match
+ *  \retval true  The thread name is the task name, or its truncation
+ *  \retval false The names differ
+ */
+bool HS_ThreadNameMatches(const char *ThreadName, const char *TaskName);
+
+/**
+ * \brief Find the cFE Task of a Thread
+ *
+ *  \par Description
+ *       Looks up the cFE task that a thread of this process runs, by the
+ *       thread name. A name of #HS_TASK_COMM_LEN - 1 characters may have
+ *       been truncated, so when it doesn't name a task exactly, every
+ *       OSAL task is checked with #HS_ThreadNameMatches.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       See #HS_ThreadNameMatches for how threads come to carry their
+ *       task name. When two tasks share the first #HS_TASK_COMM_LEN - 1
+ *       characters of their names the first one OSAL reports is used.
+ *
+ *  \param[in]  ThreadName  Thread name from /proc/self/task
+ *  \param[out] TaskIdPtr   Task ID
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_FindTaskByThreadName(const char *ThreadName, CFE_ES_TaskId_t *TaskIdPtr);
+
+/**
+ * \brief Check One OSAL Task Against a Thread Name
+ *
+ *  \par Description
+ *       Callback of the OSAL task walk made by #HS_FindTaskByThreadName.
+ *       Records the task when its name matches the thread name being
+ *       searched for and no task has been found yet.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in]     ObjectId   OSAL task ID
+ *  \param[in,out] SearchPtr  Pointer to the #HS_TaskSearch_t search
+ */
+void HS_FindTaskCallback(osal_id_t ObjectId, void *SearchPtr);
+
+/**
+ * \brief Parse the Contents of a Pressure Stall File
+ *
+ *  \par Description
+ *       Extracts the averages and total stall time of the "some" and
+ *       "full" lines of a /proc/pressure file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The "full" line is optional and left zero when missing.
+ *
+ *  \param[in]  Buffer     NUL terminated pressure stall contents
+ *  \param[out] SamplePtr  Pressure stall sample
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParsePsi(const char *Buffer, HS_PsiSample_t *SamplePtr);
+
+/**
+ * \brief Read a Pressure Stall File
+ *
+ *  \par Description
+ *       Reads one /proc/pressure file and parses it with #HS_ParsePsi.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED. Kernels built without pressure
+ *       stall information don't provide the file.
+ *
+ *  \param[in]  Path       Path of the pressure stall file
+ *  \param[out] SamplePtr  Pressure stall sample
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ReadPsi(const char *Path, HS_PsiSample_t *SamplePtr);
+
+/**
+ * \brief Parse a Field of a /proc Key Value File
+ *
+ *  \par Description
+ *       Extracts the number following "Name:" at the start of a line,
+ *       as in /proc/meminfo and /proc/self/status.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Values too large for 32 bits are saturated.
+ *
+ *  \param[in]  Buffer    NUL terminated file contents
+ *  \param[in]  Name      Name of the field, without the colon
+ *  \param[out] ValuePtr  Value of the field
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParseKbField(const char *Buffer, const char *Name, uint32 *ValuePtr);
+
+/**
+ * \brief Read the Memory Sizes
+ *
+ *  \par Description
+ *       Reads the total and available system memory from /proc/meminfo
+ *       and the resident set size of this process from /proc/self/status.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED. Kernels older than 3.14 don't
+ *       report available memory.
+ *
+ *  \param[out] SamplePtr  Memory sizes
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ReadMemory(HS_MemSample_t *SamplePtr);
+
+/**
+ * \brief Parse the Stack Pointer from a Thread Syscall File
+ *
+ *  \par Description
+ *       Extracts the stack pointer, the next to last field, from the
+ *       contents of /proc/self/task/<tid>/syscall.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A thread that is running reports no stack pointer.
+ *
+ *  \param[in]  Buffer  NUL terminated file contents
+ *  \param[out] SpPtr   Stack pointer of the thread
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParseSyscallSp(const char *Buffer, cpuaddr *SpPtr);
+
+/**
+ * \brief Parse the Memory Region Holding an Address
+ *
+ *  \par Description
+ *       Finds the line of /proc/self/maps contents whose address range
+ *       holds the address.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Every line of the buffer must start at a line of the file.
+ *
+ *  \param[in]  Buffer   NUL terminated maps lines
+ *  \param[in]  Address  Address to look for
+ *  \param[out] LowPtr   Lowest address of the region
+ *  \param[out] HighPtr  Address just past the region
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ParseMapsRegion(const char *Buffer, cpuaddr Address, cpuaddr *LowPtr, cpuaddr *HighPtr);
+
+/**
+ * \brief Find the Memory Region Holding an Address
+ *
+ *  \par Description
+ *       Reads /proc/self/maps in pieces until the region holding the
+ *       address is found.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED.
+ *
+ *  \param[in]  Address  Address to look for
+ *  \param[out] LowPtr   Lowest address of the region
+ *  \param[out] HighPtr  Address just past the region
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_FindMapsRegion(cpuaddr Address, cpuaddr *LowPtr, cpuaddr *HighPtr);
+
+/**
+ * \brief Measure the Unused End of a Stack
+ *
+ *  \par Description
+ *       Counts the bytes from the low end of a downward growing stack
+ *       that were never written. Pages that were never touched are
+ *       found with mincore without reading them, and the rest is
+ *       scanned for the first word that is neither zero, as a fresh
+ *       page is, nor #HS_STACK_PAINT_WORD.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report 0. A reused
+ *       thread stack keeps the marks of its previous thread, so the
+ *       count can be low but is never high.
+ *
+ *  \param[in] Low   Lowest address of the stack region
+ *  \param[in] High  Address just past the stack region
+ *
+ *  \return Bytes of the stack never used
+ */
+uint32 HS_StackUnusedBytes(cpuaddr Low, cpuaddr High);
+
+/**
+ * \brief Read the Stack Usage of a Thread
+ *
+ *  \par Description
+ *       Finds the stack region of a thread of this process from its
+ *       stack pointer and measures the deepest use of it so far.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED. The stack pointer of another
+ *       thread is only reported while it is blocked, so a thread
+ *       running on another CPU can't be measured until a later call.
+ *
+ *  \param[in]  ThreadId  Operating system thread ID
+ *  \param[out] SizePtr   Size of the stack region in bytes
+ *  \param[out] UsedPtr   Deepest use of the stack in bytes
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_ReadThreadStack(uint32 ThreadId, uint32 *SizePtr, uint32 *UsedPtr);
+
+/**
+ * \brief Paint the Stack of the Calling Task
+ *
+ *  \par Description
+ *       Fills the unused part of the stack of the calling task with
+ *       #HS_STACK_PAINT_WORD, so that its deepest use can be measured
+ *       to the word even where pages were touched without being used.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux, and only for threads other than the
+ *       main thread of the process; otherwise nothing is painted.
+ *       Called once at the start of a task.
+ */
+void HS_PaintStack(void);
+
+/**
+ * \brief Get the CPU Time Clock of the Calling Task
+ *
+ *  \par Description
+ *       Gets the clock that measures the CPU time consumed by the
+ *       calling task, for later use with #HS_GetClockTimeNs from any task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED.
+ *
+ *  \param[out] ClockIdPtr  Clock of the calling task
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_GetThreadCpuClock(int32 *ClockIdPtr);
+
+/**
+ * \brief Read a Clock in Nanoseconds
+ *
+ *  \par Description
+ *       Reads a clock obtained from #HS_GetThreadCpuClock.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only supported on Linux; other platforms report
+ *       #CFE_STATUS_NOT_IMPLEMENTED.
+ *
+ *  \param[in]  ClockId  Clock to read
+ *  \param[out] NsPtr    Clock value in nanoseconds
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+int32 HS_GetClockTimeNs(int32 ClockId, uint64 *NsPtr);
+
+/**
+ * \brief Get Monotonic Time in Nanoseconds
+ *
+ *  \par Description
+ *       Returns a monotonic time stamp in nanoseconds, using the
+ *       monotonic system clock on Linux and the PSP time elsewhere.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \return Monotonic time in nanoseconds
+ */
+uint64 HS_GetMonotonicTimeNs(void);
+
+#if !defined(__GNUC__)
+/**
+ * \brief Exchange a Shared Value
+ *
+ *  \par Description
+ *       Stores a new value and returns the one it replaced. Backs
+ *       #HS_ATOMIC_EXCHANGE when the compiler has no atomic builtins.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The load and the store are separate accesses.
+ *
+ *  \param[in,out] Ptr  Value to exchange
+ *  \param[in]     Val  New value
+ *
+ *  \return Value before the exchange
+ */
+uint32 HS_ExchangeUint32(uint32 *Ptr, uint32 Val);
+#endif
+
 #endif
@@ -38,6 +38,33 @@
 #error HS_IDLE_TASK_PRIORITY can not exceed 255
 #endif
 
+/*
+ * Number of monitored processor cores
+ */
+#if HS_UTIL_NUM_CORES < 1
+#error HS_UTIL_NUM_CORES cannot be less than 1
+#elif HS_UTIL_NUM_CORES > 32
+#error HS_UTIL_NUM_CORES can not exceed 32
+#endif
+
+/*
+ * Cache line size
+ */
+#if HS_CACHE_LINE_SIZE < 8
+#error HS_CACHE_LINE_SIZE cannot be less than 8
+#elif (HS_CACHE_LINE_SIZE & (HS_CACHE_LINE_SIZE - 1)) != 0
+#error HS_CACHE_LINE_SIZE must be a power of 2
+#endif
+
+/*
+ * Default utilization backend
+ */
+#if HS_UTIL_DEFAULT_BACKEND < 0
+#error HS_UTIL_DEFAULT_BACKEND cannot be less than 0
+#elif HS_UTIL_DEFAULT_BACKEND > 2
+#error HS_UTIL_DEFAULT_BACKEND can not exceed 2
+#endif
+
 /*
  * Maximum number execution counters
  */
@@ -73,6 +100,33 @@
 #error HS_MAX_MSG_ACT_SIZE can not exceed CFE_MISSION_SB_MAX_SB_MSG_SIZE
 #endif
 
+/*
+ * Maximum number of load shedding steps
+ */
+#if HS_MAX_LOAD_SHED_STEPS < 1
+#error HS_MAX_LOAD_SHED_STEPS cannot be less than 1
+#elif HS_MAX_LOAD_SHED_STEPS > 65535
+#error HS_MAX_LOAD_SHED_STEPS can not exceed 65535
+#endif
+
+/*
+ * Maximum number of CPU budgets
+ */
+#if HS_MAX_CPU_BUDGETS < 1
+#error HS_MAX_CPU_BUDGETS cannot be less than 1
+#elif HS_MAX_CPU_BUDGETS > 65535
+#error HS_MAX_CPU_BUDGETS can not exceed 65535
+#endif
+
+/*
+ * Maximum number of rebalance tasks
+ */
+#if HS_MAX_REBALANCE_TASKS < 1
+#error HS_MAX_REBALANCE_TASKS cannot be less than 1
+#elif HS_MAX_REBALANCE_TASKS > 65535
+#error HS_MAX_REBALANCE_TASKS can not exceed 65535
+#endif
+
 /*
  * Maximum number of monitored applications
  */
@@ -91,6 +145,12 @@
 #error HS_MAX_MONITORED_EVENTS can not exceed 4294967295
 #endif
 
+#if HS_MAX_EVENT_PROCESSORS < 1
+#error HS_MAX_EVENT_PROCESSORS cannot be less than 1
+#elif HS_MAX_EVENT_PROCESSORS > 255
+#error HS_MAX_EVENT_PROCESSORS can not exceed 255
+#endif
+
 /*
  * JPH 2015-06-29 - Removed check of Watchdog timer values
  *
@@ -114,6 +174,33 @@
 #error HS_WAKEUP_TIMEOUT not defined as a proper SB Timeout value
 #endif
 
+/*
+ * Wakeup Jitter
+ */
+#if HS_WAKEUP_PERIOD_US < 1
+#error HS_WAKEUP_PERIOD_US cannot be less than 1
+#elif HS_WAKEUP_PERIOD_US > 2147483647
+#error HS_WAKEUP_PERIOD_US can not exceed 2147483647
+#endif
+
+#if HS_WAKEUP_LATE_US < 0
+#error HS_WAKEUP_LATE_US cannot be less than 0
+#elif HS_WAKEUP_LATE_US > 2147483647
+#error HS_WAKEUP_LATE_US can not exceed 2147483647
+#endif
+
+#if HS_WAKEUP_HIST_BUCKETS < 2
+#error HS_WAKEUP_HIST_BUCKETS cannot be less than 2
+#elif HS_WAKEUP_HIST_BUCKETS > 64
+#error HS_WAKEUP_HIST_BUCKETS can not exceed 64
+#endif
+
+#if HS_WAKEUP_HIST_BUCKET_US < 1
+#error HS_WAKEUP_HIST_BUCKET_US cannot be less than 1
+#elif HS_WAKEUP_HIST_BUCKET_US > (2147483647 / HS_WAKEUP_HIST_BUCKETS)
+#error HS_WAKEUP_HIST_BUCKET_US can not exceed 2147483647 / HS_WAKEUP_HIST_BUCKETS
+#endif
+
 /*
  * CPU Aliveness Period
  */
@@ -227,6 +314,31 @@
 #error HS_UTIL_CALLS_PER_MARK can not exceed 4294967295
 #endif
 
+/*
+ * Utilization Mark Source
+ */
+#if HS_UTIL_MARK_SOURCE < 0
+#error HS_UTIL_MARK_SOURCE cannot be less than 0
+#elif HS_UTIL_MARK_SOURCE > 3
+#error HS_UTIL_MARK_SOURCE can not exceed 3
+#endif
+
+/*
+ * Utilization Mark Pipe Depth
+ */
+#if HS_UTIL_MARK_PIPE_DEPTH < 1
+#error HS_UTIL_MARK_PIPE_DEPTH cannot be less than 1
+#endif
+
+/*
+ * Utilization Mark Period
+ */
+#if HS_UTIL_MARK_PERIOD_US < HS_UTIL_CALLS_PER_MARK
+#error HS_UTIL_MARK_PERIOD_US cannot be less than HS_UTIL_CALLS_PER_MARK
+#elif HS_UTIL_MARK_PERIOD_US > 4294967295
+#error HS_UTIL_MARK_PERIOD_US can not exceed 4294967295
+#endif
+
 /*
  * Utilization Cycles per Interval
  */
@@ -243,6 +355,25 @@
 #error HS_UTIL_PER_INTERVAL_TOTAL can not exceed 4294967295
 #endif
 
+/*
+ * Utilization Calibration
+ */
+#if HS_UTIL_CAL_DEFAULT_INTERVALS < 1
+#error HS_UTIL_CAL_DEFAULT_INTERVALS cannot be less than 1
+#elif HS_UTIL_CAL_DEFAULT_INTERVALS > 65535
+#error HS_UTIL_CAL_DEFAULT_INTERVALS can not exceed 65535
+#endif
+
+#if HS_UTIL_CAL_STARTUP_INTERVALS < 0
+#error HS_UTIL_CAL_STARTUP_INTERVALS cannot be less than 0
+#elif HS_UTIL_CAL_STARTUP_INTERVALS > 65535
+#error HS_UTIL_CAL_STARTUP_INTERVALS can not exceed 65535
+#endif
+
+#if (HS_UTIL_CAL_TRACK_PEAK != 0) && (HS_UTIL_CAL_TRACK_PEAK != 1)
+#error HS_UTIL_CAL_TRACK_PEAK must be 0 or 1
+#endif
+
 /*
  * Hogging number of Utils per Interval
  */
@@ -279,6 +410,229 @@
 #error HS_UTIL_AVERAGE_NUM_INTERVAL can not exceed HS_UTIL_PEAK_NUM_INTERVAL
 #endif
 
+/*
+ * Utilization History
+ */
+#if HS_UTIL_HIST_NUM_LEVELS < 1
+#error HS_UTIL_HIST_NUM_LEVELS cannot be less than 1
+#elif HS_UTIL_HIST_NUM_LEVELS > 8
+#error HS_UTIL_HIST_NUM_LEVELS can not exceed 8
+#endif
+
+#if HS_UTIL_HIST_DEPTH < 1
+#error HS_UTIL_HIST_DEPTH cannot be less than 1
+#endif
+
+#if HS_UTIL_HIST_ROLLUP < 2
+#error HS_UTIL_HIST_ROLLUP cannot be less than 2
+#elif (HS_UTIL_HIST_ROLLUP * HS_UTIL_PER_INTERVAL_TOTAL) > 4294967295
+#error HS_UTIL_HIST_ROLLUP * HS_UTIL_PER_INTERVAL_TOTAL can not exceed 4294967295
+#endif
+
+/*
+ * Intervals per entry of the highest level, HS_UTIL_HIST_ROLLUP raised to the
+ * power HS_UTIL_HIST_NUM_LEVELS - 1, must fit in 32 bits
+ */
+#if (HS_UTIL_HIST_NUM_LEVELS == 3) && (HS_UTIL_HIST_ROLLUP > 65535)
+#error HS_UTIL_HIST_ROLLUP ^ (HS_UTIL_HIST_NUM_LEVELS - 1) can not exceed 4294967295
+#elif (HS_UTIL_HIST_NUM_LEVELS == 4) && (HS_UTIL_HIST_ROLLUP > 1625)
+#error HS_UTIL_HIST_ROLLUP ^ (HS_UTIL_HIST_NUM_LEVELS - 1) can not exceed 4294967295
+#elif (HS_UTIL_HIST_NUM_LEVELS == 5) && (HS_UTIL_HIST_ROLLUP > 255)
+#error HS_UTIL_HIST_ROLLUP ^ (HS_UTIL_HIST_NUM_LEVELS - 1) can not exceed 4294967295
+#elif (HS_UTIL_HIST_NUM_LEVELS == 6) && (HS_UTIL_HIST_ROLLUP > 84)
+#error HS_UTIL_HIST_ROLLUP ^ (HS_UTIL_HIST_NUM_LEVELS - 1) can not exceed 4294967295
+#elif (HS_UTIL_HIST_NUM_LEVELS == 7) && (HS_UTIL_HIST_ROLLUP > 40)
+#error HS_UTIL_HIST_ROLLUP ^ (HS_UTIL_HIST_NUM_LEVELS - 1) can not exceed 4294967295
+#elif (HS_UTIL_HIST_NUM_LEVELS == 8) && (HS_UTIL_HIST_ROLLUP > 23)
+#error HS_UTIL_HIST_ROLLUP ^ (HS_UTIL_HIST_NUM_LEVELS - 1) can not exceed 4294967295
+#endif
+
+/*
+ * Utilization Percentiles
+ */
+#if HS_UTIL_PCTL_NUM_BUCKETS < 1
+#error HS_UTIL_PCTL_NUM_BUCKETS cannot be less than 1
+#elif HS_UTIL_PCTL_NUM_BUCKETS > HS_UTIL_PER_INTERVAL_TOTAL
+#error HS_UTIL_PCTL_NUM_BUCKETS can not exceed HS_UTIL_PER_INTERVAL_TOTAL
+#elif HS_UTIL_PCTL_NUM_BUCKETS > 65535
+#error HS_UTIL_PCTL_NUM_BUCKETS can not exceed 65535
+#endif
+
+#if HS_UTIL_PCTL_WINDOW < 1
+#error HS_UTIL_PCTL_WINDOW cannot be less than 1
+#endif
+
+/*
+ * CPU Load Levels
+ */
+#if HS_UTIL_LOAD_NUM_LEVELS < 1
+#error HS_UTIL_LOAD_NUM_LEVELS cannot be less than 1
+#elif HS_UTIL_LOAD_NUM_LEVELS > 8
+#error HS_UTIL_LOAD_NUM_LEVELS can not exceed 8
+#endif
+
+/*
+ * Load Shedding
+ */
+#if HS_LOAD_SHED_HIGH_UTIL > HS_UTIL_PER_INTERVAL_TOTAL
+#error HS_LOAD_SHED_HIGH_UTIL can not exceed HS_UTIL_PER_INTERVAL_TOTAL
+#endif
+
+#if HS_LOAD_SHED_LOW_UTIL > HS_LOAD_SHED_HIGH_UTIL
+#error HS_LOAD_SHED_LOW_UTIL can not exceed HS_LOAD_SHED_HIGH_UTIL
+#endif
+
+#if HS_LOAD_SHED_DWELL < 1
+#error HS_LOAD_SHED_DWELL cannot be less than 1
+#elif HS_LOAD_SHED_DWELL > 4294967295
+#error HS_LOAD_SHED_DWELL can not exceed 4294967295
+#endif
+
+/*
+ * CPU Saturation Trend
+ */
+#if HS_UTIL_TREND_NUM_INTERVAL < 2
+#error HS_UTIL_TREND_NUM_INTERVAL cannot be less than 2
+#elif HS_UTIL_TREND_NUM_INTERVAL > 256
+#error HS_UTIL_TREND_NUM_INTERVAL can not exceed 256
+#elif HS_UTIL_TREND_NUM_INTERVAL > HS_UTIL_PEAK_NUM_INTERVAL
+#error HS_UTIL_TREND_NUM_INTERVAL can not exceed HS_UTIL_PEAK_NUM_INTERVAL
+#endif
+
+#if HS_UTIL_TREND_SATURATION_UTIL > HS_UTIL_PER_INTERVAL_TOTAL
+#error HS_UTIL_TREND_SATURATION_UTIL can not exceed HS_UTIL_PER_INTERVAL_TOTAL
+#endif
+
+#if HS_UTIL_TREND_HORIZON < 0
+#error HS_UTIL_TREND_HORIZON cannot be less than 0
+#elif HS_UTIL_TREND_HORIZON > 4294967295
+#error HS_UTIL_TREND_HORIZON can not exceed 4294967295
+#endif
+
+/*
+ * Per-Task CPU Accounting
+ */
+#if HS_TASK_CPU_MAX_TASKS < 1
+#error HS_TASK_CPU_MAX_TASKS cannot be less than 1
+#endif
+
+#if HS_TASK_CPU_TOP_N < 1
+#error HS_TASK_CPU_TOP_N cannot be less than 1
+#elif HS_TASK_CPU_TOP_N > HS_TASK_CPU_MAX_TASKS
+#error HS_TASK_CPU_TOP_N can not exceed HS_TASK_CPU_MAX_TASKS
+#endif
+
+#if HS_TASK_RUN_DELAY_THRESHOLD < 0
+#error HS_TASK_RUN_DELAY_THRESHOLD cannot be less than 0
+#elif HS_TASK_RUN_DELAY_THRESHOLD > HS_UTIL_PER_INTERVAL_TOTAL
+#error HS_TASK_RUN_DELAY_THRESHOLD can not exceed HS_UTIL_PER_INTERVAL_TOTAL
+#endif
+
+/*
+ * CPU Hog Snapshot
+ */
+#if HS_HOG_SNAPSHOT_NUM_UTIL < 1
+#error HS_HOG_SNAPSHOT_NUM_UTIL cannot be less than 1
+#elif HS_HOG_SNAPSHOT_NUM_UTIL > HS_UTIL_PEAK_NUM_INTERVAL
+#error HS_HOG_SNAPSHOT_NUM_UTIL can not exceed HS_UTIL_PEAK_NUM_INTERVAL
+#endif
+
+#if HS_HOG_SNAPSHOT_EVENT_TASKS < 1
+#error HS_HOG_SNAPSHOT_EVENT_TASKS cannot be less than 1
+#elif HS_HOG_SNAPSHOT_EVENT_TASKS > HS_TASK_CPU_MAX_TASKS
+#error HS_HOG_SNAPSHOT_EVENT_TASKS can not exceed HS_TASK_CPU_MAX_TASKS
+#endif
+
+/*
+ * Stack Monitor
+ */
+#if HS_STACK_TASKS_PER_INTERVAL < 0
+#error HS_STACK_TASKS_PER_INTERVAL cannot be less than 0
+#elif HS_STACK_TASKS_PER_INTERVAL > HS_TASK_CPU_MAX_TASKS
+#error HS_STACK_TASKS_PER_INTERVAL can not exceed HS_TASK_CPU_MAX_TASKS
+#endif
+
+#if HS_STACK_USAGE_THRESHOLD < 0
+#error HS_STACK_USAGE_THRESHOLD cannot be less than 0
+#elif HS_STACK_USAGE_THRESHOLD > 100
+#error HS_STACK_USAGE_THRESHOLD can not exceed 100
+#endif
+
+/*
+ * Memory Monitor
+ */
+#if HS_MEM_HISTORY_INTERVALS < 1
+#error HS_MEM_HISTORY_INTERVALS cannot be less than 1
+#endif
+
+#if HS_MEM_HISTORY_SIZE < 2
+#error HS_MEM_HISTORY_SIZE cannot be less than 2
+#elif HS_MEM_HISTORY_SIZE > 1024
+#error HS_MEM_HISTORY_SIZE can not exceed 1024
+#endif
+
+#if HS_MEM_LEAK_GROWTH_KB < 0
+#error HS_MEM_LEAK_GROWTH_KB cannot be less than 0
+#elif HS_MEM_LEAK_GROWTH_KB > 2147483647
+#error HS_MEM_LEAK_GROWTH_KB can not exceed 2147483647
+#endif
+
+#if HS_MEM_LOW_AVAIL_KB < 0
+#error HS_MEM_LOW_AVAIL_KB cannot be less than 0
+#elif HS_MEM_LOW_AVAIL_KB > 2147483647
+#error HS_MEM_LOW_AVAIL_KB can not exceed 2147483647
+#endif
+
+/*
+ * Software Bus Pipe Monitor
+ */
+#if HS_SB_STATS_PERIOD < 0
+#error HS_SB_STATS_PERIOD cannot be less than 0
+#elif HS_SB_STATS_PERIOD > 4294967295
+#error HS_SB_STATS_PERIOD can not exceed 4294967295
+#endif
+
+#if HS_SB_MAX_PIPE_LIMITS < 1
+#error HS_SB_MAX_PIPE_LIMITS cannot be less than 1
+#elif HS_SB_MAX_PIPE_LIMITS > 32
+#error HS_SB_MAX_PIPE_LIMITS can not exceed 32
+#endif
+
+#if HS_SB_WORST_PIPES < 1
+#error HS_SB_WORST_PIPES cannot be less than 1
+#elif HS_SB_WORST_PIPES > 16
+#error HS_SB_WORST_PIPES can not exceed 16
+#endif
+
+#if HS_SB_DROP_THRESHOLD < 0
+#error HS_SB_DROP_THRESHOLD cannot be less than 0
+#elif HS_SB_DROP_THRESHOLD > 65535
+#error HS_SB_DROP_THRESHOLD can not exceed 65535
+#endif
+
+/*
+ * Core Rebalance
+ */
+#if HS_REBALANCE_HIGH_UTIL > HS_UTIL_PER_INTERVAL_TOTAL
+#error HS_REBALANCE_HIGH_UTIL can not exceed HS_UTIL_PER_INTERVAL_TOTAL
+#endif
+
+#if HS_REBALANCE_LOW_UTIL > HS_REBALANCE_HIGH_UTIL
+#error HS_REBALANCE_LOW_UTIL can not exceed HS_REBALANCE_HIGH_UTIL
+#endif
+
+#if HS_REBALANCE_DWELL < 1
+#error HS_REBALANCE_DWELL cannot be less than 1
+#elif HS_REBALANCE_DWELL > 4294967295
+#error HS_REBALANCE_DWELL can not exceed 4294967295
+#endif
+
+#if HS_REBALANCE_COOLDOWN < 0
+#error HS_REBALANCE_COOLDOWN cannot be less than 0
+#elif HS_REBALANCE_COOLDOWN > 4294967295
+#error HS_REBALANCE_COOLDOWN can not exceed 4294967295
+#endif
+
 /*
  * Utilization Average Number of Intervals
  */
@@ -288,6 +642,12 @@
 #error HS_UTIL_TIME_DIAG_ARRAY_POWER can not exceed 31
 #endif
 
+#if HS_UTIL_DIAG_MAX_VALUES < 1
+#error HS_UTIL_DIAG_MAX_VALUES cannot be less than 1
+#elif HS_UTIL_DIAG_MAX_VALUES > 1024
+#error HS_UTIL_DIAG_MAX_VALUES can not exceed 1024
+#endif
+
 #ifndef HS_MISSION_REV
 #error HS_MISSION_REV must be defined!
 #elif (HS_MISSION_REV < 0)
@@ -114,6 +114,36 @@ int32 HS_APP_TEST_CFE_TBL_LoadHook3(void *UserObj, int32 StubRetcode, uint32 Cal
         return CFE_SUCCESS;
 }
 
+int32 HS_APP_TEST_CFE_TBL_LoadHook4(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    HS_APP_TEST_CFE_TBL_LoadHookCount++;
+
+    if (HS_APP_TEST_CFE_TBL_LoadHookCount == 5)
+        return -1;
+    else
+        return CFE_SUCCESS;
+}
+
+int32 HS_APP_TEST_CFE_TBL_LoadHook5(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    HS_APP_TEST_CFE_TBL_LoadHookCount++;
+
+    if (HS_APP_TEST_CFE_TBL_LoadHookCount == 6)
+        return -1;
+    else
+        return CFE_SUCCESS;
+}
+
+int32 HS_APP_TEST_CFE_TBL_LoadHook6(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    HS_APP_TEST_CFE_TBL_LoadHookCount++;
+
+    if (HS_APP_TEST_CFE_TBL_LoadHookCount == 7)
+        return -1;
+    else
+        return CFE_SUCCESS;
+}
+
 int32 HS_APP_TEST_CFE_ES_RestoreFromCDSHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                             const UT_StubContext_t *Context)
 {
@@ -209,6 +239,7 @@ void HS_AppMain_Test_NominalRcvMsgSuccess(void)
 
     /* Verify results */
     UtAssert_True(HS_AppData.EventsMonitoredCount == 1, "HS_AppData.EventsMonitoredCount == 1");
+    UtAssert_STUB_COUNT(HS_MonitorWakeup, 1);
 
     /* 1 event message that we don't care about in this test */
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -582,7 +613,8 @@ void HS_AppMain_Test_StateDisabled(void)
 
 void HS_AppInit_Test_Nominal(void)
 {
-    int32 Result;
+    int32                    Result;
+    const HS_UtilLoadLevel_t UtilLoadLevelDefaults[HS_UTIL_LOAD_NUM_LEVELS] = HS_UTIL_LOAD_LEVEL_DEFAULTS;
 
     HS_AppData.ServiceWatchdogFlag   = 99;
     HS_AppData.AlivenessCounter      = 99;
@@ -625,6 +657,11 @@ void HS_AppInit_Test_Nominal(void)
     UtAssert_UINT8_EQ(HS_AppData.CmdErrCount, 0);
     UtAssert_UINT32_EQ(HS_AppData.UtilCpuPeak, 0);
     UtAssert_UINT32_EQ(HS_AppData.UtilCpuAvg, 0);
+    UtAssert_True(memcmp(HS_AppData.UtilLoadLevels, UtilLoadLevelDefaults, sizeof(UtilLoadLevelDefaults)) == 0,
+                  "HS_AppData.UtilLoadLevels == HS_UTIL_LOAD_LEVEL_DEFAULTS");
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrendConfig.HorizonIntervals, HS_UTIL_TREND_HORIZON);
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrendConfig.ActionType, HS_UTIL_TREND_ACTION);
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.TimeToSat, HS_UTIL_TREND_NOT_RISING);
 
     UtAssert_UINT16_EQ(HS_AppData.CDSData.ResetsPerformed, 0);
     UtAssert_UINT16_EQ(HS_AppData.CDSData.MaxResets, 0);
@@ -1430,6 +1467,27 @@ void HS_SbInit_Test_SubscribeWakeupError(void)
 
 } /* end HS_SbInit_Test_SubscribeWakeupError */
 
+void HS_SbInit_Test_SubscribeSbHkError(void)
+{
+    CFE_SB_PipeId_t PipeId = HS_UT_PIPEID_1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_CreatePipe), &PipeId, sizeof(PipeId), false);
+
+    /* Set CFE_SB_Subscribe to return -1 on fourth call, to generate error HS_SUB_SB_TLM_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 4, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_SbInit(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SUB_SB_TLM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_SbInit_Test_SubscribeSbHkError */
+
 void HS_TblInit_Test_Nominal(void)
 {
     int32 Result;
@@ -1617,7 +1675,7 @@ void HS_TblInit_Test_LoadExeCountTableError(void)
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 6, "CFE_EVS_SendEvent was called %u time(s), expected 6",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 9, "CFE_EVS_SendEvent was called %u time(s), expected 9",
                   call_count_CFE_EVS_SendEvent);
 
 } /* end HS_TblInit_Test_LoadExeCountTableError */
@@ -1749,6 +1807,214 @@ void HS_TblInit_Test_LoadMsgActsTableError(void)
 
 } /* end HS_TblInit_Test_LoadMsgActsTableError */
 
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_TblInit_Test_RegisterLoadShedTableError(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Registering LoadShed Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Register to return -1 on fifth call, to generate error HS_LST_REG_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 5, -1);
+
+    /* Same return value as default, but bypasses default hook function to make test easier to write */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LST_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_TblInit_Test_RegisterLoadShedTableError */
+
+void HS_TblInit_Test_LoadLoadShedTableError(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Loading LoadShed Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Load to fail on fifth call, to generate error HS_LST_LD_ERR_EID */
+    HS_APP_TEST_CFE_TBL_LoadHookCount = 0;
+    UT_SetHookFunction(UT_KEY(CFE_TBL_Load), HS_APP_TEST_CFE_TBL_LoadHook4, NULL);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    /* Note: not verifying that HS_AppData.LoadShedState == HS_STATE_DISABLED, because HS_AppData.LoadShedState is
+     * modified by HS_AcquirePointers at the end of HS_TblInit */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LST_LD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_TblInit_Test_LoadLoadShedTableError */
+
+void HS_TblInit_Test_RegisterCpuBudgetTableError(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error Registering CpuBudget Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Register to return -1 on sixth call, to generate error HS_CBT_REG_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 6, -1);
+
+    /* Same return value as default, but bypasses default hook function to make test easier to write */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CBT_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_TblInit_Test_RegisterCpuBudgetTableError */
+
+void HS_TblInit_Test_LoadCpuBudgetTableError(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Loading CpuBudget Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Load to fail on sixth call, to generate error HS_CBT_LD_ERR_EID */
+    HS_APP_TEST_CFE_TBL_LoadHookCount = 0;
+    UT_SetHookFunction(UT_KEY(CFE_TBL_Load), HS_APP_TEST_CFE_TBL_LoadHook5, NULL);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    /* Note: not verifying that HS_AppData.CpuBudgetState == HS_STATE_DISABLED, because HS_AppData.CpuBudgetState is
+     * modified by HS_AcquirePointers at the end of HS_TblInit */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CBT_LD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_TblInit_Test_LoadCpuBudgetTableError */
+
+void HS_TblInit_Test_RegisterRebalanceTableError(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error Registering Rebalance Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Register to return -1 on seventh call, to generate error HS_RBT_REG_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 7, -1);
+
+    /* Same return value as default, but bypasses default hook function to make test easier to write */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), CFE_SUCCESS);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_RBT_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_TblInit_Test_RegisterRebalanceTableError */
+
+void HS_TblInit_Test_LoadRebalanceTableError(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Error Loading Rebalance Table,RC=0x%%08X");
+
+    /* Set CFE_TBL_Load to fail on seventh call, to generate error HS_RBT_LD_ERR_EID */
+    HS_APP_TEST_CFE_TBL_LoadHookCount = 0;
+    UT_SetHookFunction(UT_KEY(CFE_TBL_Load), HS_APP_TEST_CFE_TBL_LoadHook6, NULL);
+
+    /* Execute the function being tested */
+    Result = HS_TblInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    /* Note: not verifying that HS_AppData.RebalanceState == HS_STATE_DISABLED, because HS_AppData.RebalanceState is
+     * modified by HS_AcquirePointers at the end of HS_TblInit */
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_RBT_LD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_TblInit_Test_LoadRebalanceTableError */
+#endif
+
 void HS_ProcessMain_Test(void)
 {
     int32 Result;
@@ -1785,6 +2051,7 @@ void HS_ProcessMain_Test(void)
     UtAssert_True(HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1,
                   "HS_AppData.MsgActCooldown[HS_MAX_MSG_ACT_TYPES - 1] == 1");
     UtAssert_True(HS_AppData.AlivenessCounter == 0, "HS_AppData.AlivenessCounter == 0");
+    UtAssert_STUB_COUNT(HS_MonitorSbPipes, 1);
 
     /* Ensure the watchdog was serviced when flag is HS_STATE_ENABLED */
     UtAssert_STUB_COUNT(CFE_PSP_WatchdogService, 1);
@@ -2100,6 +2367,7 @@ void UtTest_Setup(void)
                "HS_SbInit_Test_SubscribeGndCmdsError");
     UtTest_Add(HS_SbInit_Test_SubscribeWakeupError, HS_Test_Setup, HS_Test_TearDown,
                "HS_SbInit_Test_SubscribeWakeupError");
+    UtTest_Add(HS_SbInit_Test_SubscribeSbHkError, HS_Test_Setup, HS_Test_TearDown, "HS_SbInit_Test_SubscribeSbHkError");
 
 #if HS_MAX_EXEC_CNT_SLOTS != 0
     UtTest_Add(HS_TblInit_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_TblInit_Test_Nominal");
@@ -2119,6 +2387,20 @@ void UtTest_Setup(void)
                "HS_TblInit_Test_LoadEventMonTableError");
     UtTest_Add(HS_TblInit_Test_LoadMsgActsTableError, HS_Test_Setup, HS_Test_TearDown,
                "HS_TblInit_Test_LoadMsgActsTableError");
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+    UtTest_Add(HS_TblInit_Test_RegisterLoadShedTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_RegisterLoadShedTableError");
+    UtTest_Add(HS_TblInit_Test_LoadLoadShedTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_LoadLoadShedTableError");
+    UtTest_Add(HS_TblInit_Test_RegisterCpuBudgetTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_RegisterCpuBudgetTableError");
+    UtTest_Add(HS_TblInit_Test_LoadCpuBudgetTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_LoadCpuBudgetTableError");
+    UtTest_Add(HS_TblInit_Test_RegisterRebalanceTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_RegisterRebalanceTableError");
+    UtTest_Add(HS_TblInit_Test_LoadRebalanceTableError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_TblInit_Test_LoadRebalanceTableError");
+#endif
 #endif
 
     UtTest_Add(HS_ProcessMain_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ProcessMain_Test");
@@ -83,6 +83,24 @@ void HS_AppPipe_Test_SendHK(void)
 
 } /* end HS_AppPipe_Test_SendHK */
 
+void HS_AppPipe_Test_SbTlm(void)
+{
+    CFE_SB_MsgId_t TestMsgId[2] = {CFE_SB_ValueToMsgId(CFE_SB_HK_TLM_MID), CFE_SB_ValueToMsgId(CFE_SB_STATS_TLM_MID)};
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), TestMsgId, sizeof(TestMsgId), false);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results, Software Bus telemetry goes to the pipe monitor and is not a command error */
+    UtAssert_STUB_COUNT(HS_SbHkTlm, 1);
+    UtAssert_STUB_COUNT(HS_SbStatsTlm, 1);
+    UtAssert_UINT32_EQ(HS_AppData.CmdErrCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_AppPipe_Test_SbTlm */
+
 void HS_AppPipe_Test_Noop(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -422,6 +440,172 @@ void HS_AppPipe_Test_DisableCPUHog(void)
 
 } /* end HS_AppPipe_Test_DisableCPUHog */
 
+void HS_AppPipe_Test_EnableEventMonEntries(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_ENABLE_EVENTMON_ENTRIES_CC;
+    MsgSize   = sizeof(UT_CmdBuf.EventMonEntriesCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    UT_CmdBuf.EventMonEntriesCmd.NumEntries = 1;
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AppPipe_Test_EnableEventMonEntries */
+
+void HS_AppPipe_Test_DisableEventMonEntries(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_DISABLE_EVENTMON_ENTRIES_CC;
+    MsgSize   = sizeof(UT_CmdBuf.EventMonEntriesCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    UT_CmdBuf.EventMonEntriesCmd.NumEntries = 1;
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AppPipe_Test_DisableEventMonEntries */
+
+void HS_AppPipe_Test_DumpUtilHist(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_DUMP_UTIL_HIST_CC;
+    MsgSize   = sizeof(UT_CmdBuf.DumpUtilHistCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AppPipe_Test_DumpUtilHist */
+
+void HS_AppPipe_Test_SendUtilPctl(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_SEND_UTIL_PCTL_CC;
+    MsgSize   = sizeof(UT_CmdBuf.NoArgsCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AppPipe_Test_SendUtilPctl */
+
+void HS_AppPipe_Test_SetUtilLoadLevel(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_SET_UTIL_LOAD_LEVEL_CC;
+    MsgSize   = sizeof(UT_CmdBuf.SetUtilLoadLevelCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AppPipe_Test_SetUtilLoadLevel */
+
+void HS_AppPipe_Test_SetUtilTrend(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_SET_UTIL_TREND_CC;
+    MsgSize   = sizeof(UT_CmdBuf.SetUtilTrendCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AppPipe_Test_SetUtilTrend */
+
 void HS_AppPipe_Test_InvalidCC(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -572,11 +756,16 @@ void HS_HousekeepingReq_Test_InvalidEventMon(void)
     HS_AppData.EventsMonitoredCount    = 9;
     HS_AppData.MsgActExec              = 10;
 
+    HS_AppData.ProcEventOverflowCount        = 11;
+    HS_AppData.ProcEventCounts[0].EventCount = 12;
+
     for (TableIndex = 0; TableIndex <= ((HS_MAX_MONITORED_APPS - 1) / HS_BITS_PER_APPMON_ENABLE); TableIndex++)
     {
         HS_AppData.AppMonEnables[TableIndex] = TableIndex;
     }
 
+    HS_AppData.EventMonEnables[0] = 0x5;
+
     /* Execute the function being tested */
     HS_HousekeepingReq(&UT_CmdBuf.Buf);
 
@@ -592,6 +781,11 @@ void HS_HousekeepingReq_Test_InvalidEventMon(void)
     UtAssert_True(HS_AppData.HkPacket.EventsMonitoredCount == 9, "HS_AppData.HkPacket.EventsMonitoredCount == 9");
     UtAssert_True(HS_AppData.HkPacket.MsgActExec == 10, "HS_AppData.HkPacket.MsgActExec == 10");
     UtAssert_True(HS_AppData.HkPacket.InvalidEventMonCount == 1, "HS_AppData.HkPacket.InvalidEventMonCount == 1");
+    UtAssert_True(HS_AppData.HkPacket.ProcEventOverflowCount == 11, "HS_AppData.HkPacket.ProcEventOverflowCount == 11");
+    UtAssert_True(HS_AppData.HkPacket.ProcEventCounts[0].EventCount == 12,
+                  "HS_AppData.HkPacket.ProcEventCounts[0].EventCount == 12");
+
+    UtAssert_True(HS_AppData.HkPacket.EventMonEnables[0] == 0x5, "HS_AppData.HkPacket.EventMonEnables[0] == 0x5");
 
     /* Check first, middle, and last element */
     UtAssert_True(HS_AppData.HkPacket.AppMonEnables[0] == 0, "HS_AppData.HkPacket.AppMonEnables[0] == 0");
@@ -671,18 +865,36 @@ void HS_HousekeepingReq_Test_AllFlagsEnabled(void)
     HS_AppData.CDSData.MaxResets       = 8;
     HS_AppData.EventsMonitoredCount    = 9;
     HS_AppData.MsgActExec              = 10;
+    HS_AppData.UtilCoreAvg[0]          = 11;
+    HS_AppData.UtilCorePeak[0]         = 12;
+    HS_AppData.UtilLoadActiveMask      = 2;
+
+    HS_AppData.UtilLoadLevels[0].EnterUtil = 14;
+    HS_AppData.LoadShedStep                = 15;
+
+    HS_AppData.UtilTrendConfig.HorizonIntervals = 16;
+    HS_AppData.UtilTrend.Slope                  = -17;
+    HS_AppData.UtilTrend.TimeToSat              = 18;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_UtilPctlValue), 13);
 
     HS_AppData.ExeCountState  = HS_STATE_ENABLED;
     HS_AppData.MsgActsState   = HS_STATE_ENABLED;
     HS_AppData.AppMonLoaded   = HS_STATE_ENABLED;
     HS_AppData.EventMonLoaded = HS_STATE_ENABLED;
     HS_AppData.CDSState       = HS_STATE_ENABLED;
+    HS_AppData.LoadShedState  = HS_STATE_ENABLED;
+    HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+    HS_AppData.RebalanceState = HS_STATE_ENABLED;
 
     ExpectedStatusFlags |= HS_LOADED_XCT;
     ExpectedStatusFlags |= HS_LOADED_MAT;
     ExpectedStatusFlags |= HS_LOADED_AMT;
     ExpectedStatusFlags |= HS_LOADED_EMT;
     ExpectedStatusFlags |= HS_CDS_IN_USE;
+    ExpectedStatusFlags |= HS_LOADED_LST;
+    ExpectedStatusFlags |= HS_LOADED_CBT;
+    ExpectedStatusFlags |= HS_LOADED_RBT;
 
     /* Execute the function being tested */
     HS_HousekeepingReq(&UT_CmdBuf.Buf);
@@ -698,7 +910,20 @@ void HS_HousekeepingReq_Test_AllFlagsEnabled(void)
     UtAssert_True(HS_AppData.HkPacket.MaxResets == 8, "HS_AppData.HkPacket.MaxResets == 8");
     UtAssert_True(HS_AppData.HkPacket.EventsMonitoredCount == 9, "HS_AppData.HkPacket.EventsMonitoredCount == 9");
     UtAssert_True(HS_AppData.HkPacket.MsgActExec == 10, "HS_AppData.HkPacket.MsgActExec == 10");
+    UtAssert_True(HS_AppData.HkPacket.UtilCoreAvg[0] == 11, "HS_AppData.HkPacket.UtilCoreAvg[0] == 11");
+    UtAssert_True(HS_AppData.HkPacket.UtilCorePeak[0] == 12, "HS_AppData.HkPacket.UtilCorePeak[0] == 12");
+    UtAssert_True(HS_AppData.HkPacket.UtilCpuP50 == 13, "HS_AppData.HkPacket.UtilCpuP50 == 13");
+    UtAssert_True(HS_AppData.HkPacket.UtilCpuP99 == 13, "HS_AppData.HkPacket.UtilCpuP99 == 13");
     UtAssert_True(HS_AppData.HkPacket.InvalidEventMonCount == 0, "HS_AppData.HkPacket.InvalidEventMonCount == 0");
+    UtAssert_STUB_COUNT(HS_UtilMarkGetStats, 1);
+    UtAssert_STUB_COUNT(HS_PsiGetStats, 1);
+    UtAssert_STUB_COUNT(HS_MemGetStats, 1);
+    UtAssert_UINT32_EQ(HS_AppData.HkPacket.UtilLoadActiveMask, 2);
+    UtAssert_UINT32_EQ(HS_AppData.HkPacket.UtilLoadLevels[0].EnterUtil, 14);
+    UtAssert_UINT32_EQ(HS_AppData.HkPacket.LoadShedStep, 15);
+    UtAssert_UINT32_EQ(HS_AppData.HkPacket.UtilTrendConfig.HorizonIntervals, 16);
+    UtAssert_INT32_EQ(HS_AppData.HkPacket.UtilTrendSlope, -17);
+    UtAssert_UINT32_EQ(HS_AppData.HkPacket.UtilTrendTimeToSat, 18);
 
     UtAssert_True(HS_AppData.HkPacket.StatusFlags == ExpectedStatusFlags,
                   "HS_AppData.HkPacket.StatusFlags == ExpectedStatusFlags");
@@ -1643,7 +1868,11 @@ void HS_ResetCmd_Test_MsgLengthError(void)
 
 void HS_ResetCounters_Test(void)
 {
-    /* No setup required for this test */
+    HS_AppData.ProcEventOverflowCount        = 1;
+    HS_AppData.ProcEventCountsUsed           = 1;
+    HS_AppData.ProcEventCounts[0].EventCount = 2;
+    HS_AppData.WakeupTlm.LateCount           = 3;
+    HS_AppData.WakeupSumUs                   = 4;
 
     /* ignore dummy message length check */
     UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
@@ -1656,6 +1885,11 @@ void HS_ResetCounters_Test(void)
     UtAssert_True(HS_AppData.CmdErrCount == 0, "HS_AppData.CmdErrCount == 0");
     UtAssert_True(HS_AppData.EventsMonitoredCount == 0, "HS_AppData.EventsMonitoredCount == 0");
     UtAssert_True(HS_AppData.MsgActExec == 0, "HS_AppData.MsgActExec == 0");
+    UtAssert_True(HS_AppData.ProcEventOverflowCount == 0, "HS_AppData.ProcEventOverflowCount == 0");
+    UtAssert_True(HS_AppData.ProcEventCountsUsed == 0, "HS_AppData.ProcEventCountsUsed == 0");
+    UtAssert_True(HS_AppData.ProcEventCounts[0].EventCount == 0, "HS_AppData.ProcEventCounts[0].EventCount == 0");
+    UtAssert_UINT32_EQ(HS_AppData.WakeupTlm.LateCount, 0);
+    UtAssert_True(HS_AppData.WakeupSumUs == 0, "HS_AppData.WakeupSumUs == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -2699,120 +2933,769 @@ void HS_SetMaxResetsCmd_Test_MsgLengthError(void)
 
 } /* end HS_SetMaxResetsCmd_Test_MsgLengthError */
 
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_AcquirePointers_Test_Nominal(void)
+void HS_EnableEventMonEntriesCmd_Test(void)
 {
-    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
-
-    memset(AMTable, 0, sizeof(AMTable));
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    HS_AppData.AMTablePtr = AMTable;
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Event Monitor Entries Enabled: First = %%u, Num = %%u");
 
-    /* Satisfies all instances of (Status == CFE_TBL_INFO_UPDATED), skips all (Status < CFE_SUCCESS) blocks */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+    UT_CmdBuf.EventMonEntriesCmd.FirstEntry = 1;
+    UT_CmdBuf.EventMonEntriesCmd.NumEntries = 2;
 
-    HS_AppData.CurrentAppMonState = HS_STATE_DISABLED;
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
 
     /* Execute the function being tested */
-    HS_AcquirePointers();
+    HS_EnableEventMonEntriesCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(HS_AppData.AppMonLoaded == HS_STATE_ENABLED, "HS_AppData.AppMonLoaded == HS_STATE_ENABLED");
-    UtAssert_True(HS_AppData.EventMonLoaded == HS_STATE_ENABLED, "HS_AppData.EventMonLoaded == HS_STATE_ENABLED");
-    UtAssert_True(HS_AppData.MsgActsState == HS_STATE_ENABLED, "HS_AppData.MsgActsState == HS_STATE_ENABLED");
-    UtAssert_True(HS_AppData.ExeCountState == HS_STATE_ENABLED, "HS_AppData.ExeCountState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+    UtAssert_True(HS_AppData.EventMonEnables[0] == 0x6, "HS_AppData.EventMonEnables[0] == 0x6");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_ENABLE_EVENTMON_ENTRIES_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_AcquirePointers_Test_Nominal */
-#endif
+} /* end HS_EnableEventMonEntriesCmd_Test */
 
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled(void)
+void HS_EnableEventMonEntriesCmd_Test_RangeError(void)
 {
     int32 strCmpResult;
-    char  ExpectedEventString[4][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting AppMon Table address, RC=0x%%08X, Application Monitoring Disabled");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting EventMon Table address, RC=0x%%08X, Event Monitoring Disabled");
-    snprintf(ExpectedEventString[2], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting MsgActs Table address, RC=0x%%08X");
-    snprintf(ExpectedEventString[3], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting ExeCount Table address, RC=0x%%08X");
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    HS_AppData.AppMonLoaded         = HS_STATE_ENABLED;
-    HS_AppData.EventMonLoaded       = HS_STATE_ENABLED;
-    HS_AppData.CurrentAppMonState   = HS_STATE_DISABLED;
-    HS_AppData.CurrentEventMonState = HS_STATE_DISABLED;
-    HS_AppData.MsgActsState         = HS_STATE_ENABLED;
-    HS_AppData.ExeCountState        = HS_STATE_ENABLED;
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Invalid EventMon entry range: First = %%u, Num = %%u, Max = %%u");
 
-    /* Causes to enter all (Status < CFE_SUCCESS) blocks */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
+    UT_CmdBuf.EventMonEntriesCmd.FirstEntry = HS_MAX_MONITORED_EVENTS - 1;
+    UT_CmdBuf.EventMonEntriesCmd.NumEntries = 2;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
 
     /* Execute the function being tested */
-    HS_AcquirePointers();
+    HS_EnableEventMonEntriesCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(HS_AppData.CurrentAppMonState == HS_STATE_DISABLED,
-                  "HS_AppData.CurrentAppMonState == HS_STATE_DISABLED");
-    UtAssert_True(HS_AppData.AppMonLoaded == HS_STATE_DISABLED, "HS_AppData.AppMonLoaded == HS_STATE_DISABLED");
-    UtAssert_True(HS_AppData.CurrentEventMonState == HS_STATE_DISABLED,
-                  "HS_AppData.CurrentEventMonState == HS_STATE_DISABLED");
-    UtAssert_True(HS_AppData.EventMonLoaded == HS_STATE_DISABLED, "HS_AppData.EventMonLoaded == HS_STATE_DISABLED");
-    UtAssert_True(HS_AppData.MsgActsState == HS_STATE_DISABLED, "HS_AppData.MsgActsState == HS_STATE_DISABLED");
-    UtAssert_True(HS_AppData.ExeCountState == HS_STATE_DISABLED, "HS_AppData.ExeCountState == HS_STATE_DISABLED");
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+    UtAssert_True(HS_AppData.EventMonEnables[0] == 0, "HS_AppData.EventMonEnables[0] == 0");
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EVENTMON_ENTRIES_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EVENTMON_GETADDR_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult =
-        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HS_MSGACTS_GETADDR_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult =
-        strncmp(ExpectedEventString[2], context_CFE_EVS_SendEvent[2].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[2].Spec);
+} /* end HS_EnableEventMonEntriesCmd_Test_RangeError */
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventID, HS_EXECOUNT_GETADDR_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventType, CFE_EVS_EventType_ERROR);
+void HS_EnableEventMonEntriesCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[3], context_CFE_EVS_SendEvent[3].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Execute the function being tested */
+    HS_EnableEventMonEntriesCmd(&UT_CmdBuf.Buf);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[3].Spec);
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 4, "CFE_EVS_SendEvent was called %u time(s), expected 4",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled */
-#endif
+} /* end HS_EnableEventMonEntriesCmd_Test_MsgLengthError */
 
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_AcquirePointers_Test_ErrorsWithCurrentAppMonAndCurrentEventMonEnabled2(void)
+void HS_DisableEventMonEntriesCmd_Test(void)
 {
     int32 strCmpResult;
-    char  ExpectedEventString[5][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error getting AppMon Table address, RC=0x%%08X, Application Monitoring Disabled");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Event Monitor Entries Disabled: First = %%u, Num = %%u");
+
+    HS_AppData.EventMonEnables[0] = 0x7;
+
+    UT_CmdBuf.EventMonEntriesCmd.FirstEntry = 0;
+    UT_CmdBuf.EventMonEntriesCmd.NumEntries = 2;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_DisableEventMonEntriesCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+    UtAssert_True(HS_AppData.EventMonEnables[0] == 0x4, "HS_AppData.EventMonEnables[0] == 0x4");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_DISABLE_EVENTMON_ENTRIES_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DisableEventMonEntriesCmd_Test */
+
+void HS_DisableEventMonEntriesCmd_Test_RangeError(void)
+{
+    HS_AppData.EventMonEnables[0] = 0x7;
+
+    UT_CmdBuf.EventMonEntriesCmd.FirstEntry = 0;
+    UT_CmdBuf.EventMonEntriesCmd.NumEntries = 0;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_DisableEventMonEntriesCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+    UtAssert_True(HS_AppData.EventMonEnables[0] == 0x7, "HS_AppData.EventMonEnables[0] == 0x7");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EVENTMON_ENTRIES_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DisableEventMonEntriesCmd_Test_RangeError */
+
+void HS_DisableEventMonEntriesCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    /* Execute the function being tested */
+    HS_DisableEventMonEntriesCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DisableEventMonEntriesCmd_Test_MsgLengthError */
+
+void HS_DumpUtilHistCmd_Test_Tlm(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Utilization history level %%d sent: %%d entries");
+
+    /* Wrapped level 0 history: oldest entry is at NextIndex */
+    HS_AppData.UtilHist[0].NumEntries             = HS_UTIL_HIST_DEPTH;
+    HS_AppData.UtilHist[0].NextIndex              = 1;
+    HS_AppData.UtilHist[0].Entries[1].Avg         = 11;
+    HS_AppData.UtilHist[0].Entries[0].Avg         = 22;
+    HS_AppData.UtilHistPacket.Payload.NumEntries  = 0;
+    UT_CmdBuf.DumpUtilHistCmd.Level               = 0;
+    UT_CmdBuf.DumpUtilHistCmd.Destination         = HS_UTIL_HIST_DEST_TLM;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_DumpUtilHistCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+    UtAssert_True(HS_AppData.UtilHistPacket.Payload.NumEntries == HS_UTIL_HIST_DEPTH,
+                  "HS_AppData.UtilHistPacket.Payload.NumEntries == HS_UTIL_HIST_DEPTH");
+    UtAssert_True(HS_AppData.UtilHistPacket.Payload.IntervalsPerEntry == 1,
+                  "HS_AppData.UtilHistPacket.Payload.IntervalsPerEntry == 1");
+    UtAssert_True(HS_AppData.UtilHistPacket.Payload.Entries[0].Avg == 11,
+                  "HS_AppData.UtilHistPacket.Payload.Entries[0].Avg == 11");
+    UtAssert_True(HS_AppData.UtilHistPacket.Payload.Entries[HS_UTIL_HIST_DEPTH - 1].Avg == 22,
+                  "HS_AppData.UtilHistPacket.Payload.Entries[HS_UTIL_HIST_DEPTH - 1].Avg == 22");
+    UtAssert_True(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)) == 1, "CFE_SB_TransmitMsg was called once");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_DUMP_UTIL_HIST_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DumpUtilHistCmd_Test_Tlm */
+
+void HS_DumpUtilHistCmd_Test_File(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Utilization history level %%d written to %%s: %%d entries");
+
+    HS_AppData.UtilHist[HS_UTIL_HIST_NUM_LEVELS - 1].NumEntries = 2;
+    HS_AppData.UtilHist[HS_UTIL_HIST_NUM_LEVELS - 1].NextIndex  = 2;
+    UT_CmdBuf.DumpUtilHistCmd.Level                             = HS_UTIL_HIST_NUM_LEVELS - 1;
+    UT_CmdBuf.DumpUtilHistCmd.Destination                       = HS_UTIL_HIST_DEST_FILE;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_UtilHistWriteFile), CFE_SUCCESS);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_DumpUtilHistCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+    UtAssert_True(HS_AppData.UtilHistPacket.Payload.NumEntries == 2,
+                  "HS_AppData.UtilHistPacket.Payload.NumEntries == 2");
+    UtAssert_True(UT_GetStubCount(UT_KEY(HS_UtilHistWriteFile)) == 1, "HS_UtilHistWriteFile was called once");
+    UtAssert_True(UT_GetStubCount(UT_KEY(CFE_SB_TransmitMsg)) == 0, "CFE_SB_TransmitMsg was not called");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_DUMP_UTIL_HIST_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DumpUtilHistCmd_Test_File */
+
+void HS_DumpUtilHistCmd_Test_FileError(void)
+{
+    UT_CmdBuf.DumpUtilHistCmd.Level       = 0;
+    UT_CmdBuf.DumpUtilHistCmd.Destination = HS_UTIL_HIST_DEST_FILE;
+    strncpy(UT_CmdBuf.DumpUtilHistCmd.Filename, "/ram/test.dat", sizeof(UT_CmdBuf.DumpUtilHistCmd.Filename));
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_UtilHistWriteFile), -1);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_DumpUtilHistCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DumpUtilHistCmd_Test_FileError */
+
+void HS_DumpUtilHistCmd_Test_InvalidLevel(void)
+{
+    UT_CmdBuf.DumpUtilHistCmd.Level       = HS_UTIL_HIST_NUM_LEVELS;
+    UT_CmdBuf.DumpUtilHistCmd.Destination = HS_UTIL_HIST_DEST_TLM;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_DumpUtilHistCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_DUMP_UTIL_HIST_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DumpUtilHistCmd_Test_InvalidLevel */
+
+void HS_DumpUtilHistCmd_Test_InvalidDestination(void)
+{
+    UT_CmdBuf.DumpUtilHistCmd.Level       = 0;
+    UT_CmdBuf.DumpUtilHistCmd.Destination = HS_UTIL_HIST_DEST_FILE + 1;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_DumpUtilHistCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_DUMP_UTIL_HIST_ERR_EID);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DumpUtilHistCmd_Test_InvalidDestination */
+
+void HS_DumpUtilHistCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    /* Execute the function being tested */
+    HS_DumpUtilHistCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_DumpUtilHistCmd_Test_MsgLengthError */
+
+void HS_SendUtilPctlCmd_Test_Nominal(void)
+{
+    HS_UtilPctlPayload_t *PayloadPtr = &HS_AppData.UtilPctlPacket.Payload;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+    UT_SetDefaultReturnValue(UT_KEY(HS_UtilPctlValue), 42);
+
+    HS_AppData.UtilPctl.NumSamples = 3;
+    HS_AppData.UtilPctl.Counts[0]  = 1;
+    HS_AppData.UtilPctl.Counts[HS_UTIL_PCTL_NUM_BUCKETS - 1] = 2;
+
+    /* Execute the function being tested */
+    HS_SendUtilPctlCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(PayloadPtr->NumSamples, 3);
+    UtAssert_UINT32_EQ(PayloadPtr->BucketWidth, HS_UTIL_PER_INTERVAL_TOTAL / HS_UTIL_PCTL_NUM_BUCKETS);
+    UtAssert_UINT32_EQ(PayloadPtr->UtilP90, 42);
+    UtAssert_UINT32_EQ(PayloadPtr->Counts[0], 1);
+    UtAssert_UINT32_EQ(PayloadPtr->Counts[HS_UTIL_PCTL_NUM_BUCKETS - 1], 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SEND_UTIL_PCTL_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SendUtilPctlCmd_Test_Nominal */
+
+void HS_SendUtilPctlCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    /* Execute the function being tested */
+    HS_SendUtilPctlCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SendUtilPctlCmd_Test_MsgLengthError */
+
+void HS_SetUtilLoadLevelCmd_Test_Nominal(void)
+{
+    UT_CmdBuf.SetUtilLoadLevelCmd.Level                    = HS_UTIL_LOAD_NUM_LEVELS - 1;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.EnterUtil      = 9000;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.ExitUtil       = 9000;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.DwellIntervals = 4;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.ActionType     = HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES;
+
+    HS_AppData.UtilLoadDwell[HS_UTIL_LOAD_NUM_LEVELS - 1] = 2;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_SetUtilLoadLevelCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadLevels[HS_UTIL_LOAD_NUM_LEVELS - 1].EnterUtil, 9000);
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadLevels[HS_UTIL_LOAD_NUM_LEVELS - 1].ExitUtil, 9000);
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadLevels[HS_UTIL_LOAD_NUM_LEVELS - 1].DwellIntervals, 4);
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadLevels[HS_UTIL_LOAD_NUM_LEVELS - 1].ActionType,
+                       HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES);
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadDwell[HS_UTIL_LOAD_NUM_LEVELS - 1], 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_LOAD_LEVEL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetUtilLoadLevelCmd_Test_Nominal */
+
+void HS_SetUtilLoadLevelCmd_Test_Invalid(void)
+{
+    /* Level out of range */
+    UT_CmdBuf.SetUtilLoadLevelCmd.Level               = HS_UTIL_LOAD_NUM_LEVELS;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.EnterUtil = 9000;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.ExitUtil  = 8000;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_SetUtilLoadLevelCmd(&UT_CmdBuf.Buf);
+
+    /* Exit threshold above enter threshold */
+    UT_CmdBuf.SetUtilLoadLevelCmd.Level              = 0;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.ExitUtil = 9001;
+
+    HS_SetUtilLoadLevelCmd(&UT_CmdBuf.Buf);
+
+    /* Message action beyond the Message Actions Table */
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.ExitUtil   = 8000;
+    UT_CmdBuf.SetUtilLoadLevelCmd.LoadLevel.ActionType = HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+
+    HS_SetUtilLoadLevelCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_True(HS_AppData.CmdErrCount == 3, "HS_AppData.CmdErrCount == 3");
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadLevels[0].EnterUtil, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HS_SET_UTIL_LOAD_LEVEL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 3, "CFE_EVS_SendEvent was called %u time(s), expected 3",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetUtilLoadLevelCmd_Test_Invalid */
+
+void HS_SetUtilLoadLevelCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    /* Execute the function being tested */
+    HS_SetUtilLoadLevelCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetUtilLoadLevelCmd_Test_MsgLengthError */
+
+void HS_SetUtilTrendCmd_Test_Nominal(void)
+{
+    UT_CmdBuf.SetUtilTrendCmd.Config.HorizonIntervals = 120;
+    UT_CmdBuf.SetUtilTrendCmd.Config.ActionType       = HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES;
+
+    HS_AppData.UtilTrend.Warned = true;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_SetUtilTrendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrendConfig.HorizonIntervals, 120);
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrendConfig.ActionType, HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES);
+    UtAssert_True(HS_AppData.UtilTrend.Warned == false, "HS_AppData.UtilTrend.Warned == false");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_TREND_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetUtilTrendCmd_Test_Nominal */
+
+void HS_SetUtilTrendCmd_Test_Invalid(void)
+{
+    /* Message action beyond the Message Actions Table */
+    UT_CmdBuf.SetUtilTrendCmd.Config.HorizonIntervals = 120;
+    UT_CmdBuf.SetUtilTrendCmd.Config.ActionType       = HS_ALARM_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    HS_SetUtilTrendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrendConfig.HorizonIntervals, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_TREND_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetUtilTrendCmd_Test_Invalid */
+
+void HS_SetUtilTrendCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    /* Execute the function being tested */
+    HS_SetUtilTrendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetUtilTrendCmd_Test_MsgLengthError */
+
+void HS_UtilHistWriteFile_Test_Nominal(void)
+{
+    HS_UtilHistPayload_t Payload;
+
+    memset(&Payload, 0, sizeof(Payload));
+    Payload.NumEntries = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write),
+                             sizeof(Payload) - sizeof(Payload.Entries) + (2 * sizeof(HS_UtilHistEntry_t)));
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilHistWriteFile("/ram/test.dat", &Payload), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_close)) == 1, "OS_close was called once");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_UtilHistWriteFile_Test_Nominal */
+
+void HS_UtilHistWriteFile_Test_CreateError(void)
+{
+    HS_UtilHistPayload_t Payload;
+
+    memset(&Payload, 0, sizeof(Payload));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilHistWriteFile("/ram/test.dat", &Payload), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_close)) == 0, "OS_close was not called");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_HIST_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_UtilHistWriteFile_Test_CreateError */
+
+void HS_UtilHistWriteFile_Test_HeaderError(void)
+{
+    HS_UtilHistPayload_t Payload;
+
+    memset(&Payload, 0, sizeof(Payload));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilHistWriteFile("/ram/test.dat", &Payload), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Verify results */
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_close)) == 1, "OS_close was called once");
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_write)) == 0, "OS_write was not called");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_HIST_FILE_ERR_EID);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_UtilHistWriteFile_Test_HeaderError */
+
+void HS_UtilHistWriteFile_Test_WriteError(void)
+{
+    HS_UtilHistPayload_t Payload;
+
+    memset(&Payload, 0, sizeof(Payload));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilHistWriteFile("/ram/test.dat", &Payload), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Verify results */
+    UtAssert_True(UT_GetStubCount(UT_KEY(OS_close)) == 1, "OS_close was called once");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_HIST_FILE_ERR_EID);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_UtilHistWriteFile_Test_WriteError */
+
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_AcquirePointers_Test_Nominal(void)
+{
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+    memset(EMTable, 0, sizeof(EMTable));
+
+    HS_AppData.AMTablePtr = AMTable;
+    HS_AppData.EMTablePtr = EMTable;
+
+    EMTable[0].ActionType = HS_EMT_ACT_PROC_RESET;
+
+    /* Satisfies all instances of (Status == CFE_TBL_INFO_UPDATED), skips all (Status < CFE_SUCCESS) blocks */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+
+    HS_AppData.CurrentAppMonState = HS_STATE_DISABLED;
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.AppMonLoaded == HS_STATE_ENABLED, "HS_AppData.AppMonLoaded == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.EventMonLoaded == HS_STATE_ENABLED, "HS_AppData.EventMonLoaded == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.MsgActsState == HS_STATE_ENABLED, "HS_AppData.MsgActsState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.ExeCountState == HS_STATE_ENABLED, "HS_AppData.ExeCountState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.LoadShedState == HS_STATE_ENABLED, "HS_AppData.LoadShedState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.CpuBudgetState == HS_STATE_ENABLED, "HS_AppData.CpuBudgetState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.RebalanceState == HS_STATE_ENABLED, "HS_AppData.RebalanceState == HS_STATE_ENABLED");
+    UtAssert_True(HS_AppData.EventMonEnables[0] == 1, "HS_AppData.EventMonEnables[0] == 1");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AcquirePointers_Test_Nominal */
+#endif
+
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[4][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error getting AppMon Table address, RC=0x%%08X, Application Monitoring Disabled");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error getting EventMon Table address, RC=0x%%08X, Event Monitoring Disabled");
+    snprintf(ExpectedEventString[2], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error getting MsgActs Table address, RC=0x%%08X");
+    snprintf(ExpectedEventString[3], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error getting ExeCount Table address, RC=0x%%08X");
+
+    HS_AppData.AppMonLoaded         = HS_STATE_ENABLED;
+    HS_AppData.EventMonLoaded       = HS_STATE_ENABLED;
+    HS_AppData.CurrentAppMonState   = HS_STATE_DISABLED;
+    HS_AppData.CurrentEventMonState = HS_STATE_DISABLED;
+    HS_AppData.MsgActsState         = HS_STATE_ENABLED;
+    HS_AppData.ExeCountState        = HS_STATE_ENABLED;
+
+    /* Causes to enter all (Status < CFE_SUCCESS) blocks */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CurrentAppMonState == HS_STATE_DISABLED,
+                  "HS_AppData.CurrentAppMonState == HS_STATE_DISABLED");
+    UtAssert_True(HS_AppData.AppMonLoaded == HS_STATE_DISABLED, "HS_AppData.AppMonLoaded == HS_STATE_DISABLED");
+    UtAssert_True(HS_AppData.CurrentEventMonState == HS_STATE_DISABLED,
+                  "HS_AppData.CurrentEventMonState == HS_STATE_DISABLED");
+    UtAssert_True(HS_AppData.EventMonLoaded == HS_STATE_DISABLED, "HS_AppData.EventMonLoaded == HS_STATE_DISABLED");
+    UtAssert_True(HS_AppData.MsgActsState == HS_STATE_DISABLED, "HS_AppData.MsgActsState == HS_STATE_DISABLED");
+    UtAssert_True(HS_AppData.ExeCountState == HS_STATE_DISABLED, "HS_AppData.ExeCountState == HS_STATE_DISABLED");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_APPMON_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EVENTMON_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HS_MSGACTS_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[2], context_CFE_EVS_SendEvent[2].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[2].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventID, HS_EXECOUNT_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[3], context_CFE_EVS_SendEvent[3].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[3].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 4, "CFE_EVS_SendEvent was called %u time(s), expected 4",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled */
+#endif
+
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_AcquirePointers_Test_ErrorsWithCurrentAppMonAndCurrentEventMonEnabled2(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[5][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error getting AppMon Table address, RC=0x%%08X, Application Monitoring Disabled");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Error getting EventMon Table address, RC=0x%%08X, Event Monitoring Disabled");
     snprintf(ExpectedEventString[2], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Error Unsubscribing from short-format Events,RC=0x%%08X");
@@ -3116,6 +3999,86 @@ void HS_AcquirePointers_Test_ErrorsWithCurrentAppMonLoadedDisabledAndCurrentAppM
 } /* end HS_AcquirePointers_Test_ErrorsWithCurrentAppMonLoadedDisabledAndCurrentAppMonStateDisabled */
 #endif
 
+void HS_AcquirePointers_Test_LoadShedError(void)
+{
+    HS_AppData.LoadShedState = HS_STATE_ENABLED;
+
+    /* Causes to enter all (Status < CFE_SUCCESS) blocks, only the LoadShed one reports */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.LoadShedState == HS_STATE_DISABLED, "HS_AppData.LoadShedState == HS_STATE_DISABLED");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LOADSHED_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* A second failure is not reported again */
+    HS_AcquirePointers();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AcquirePointers_Test_LoadShedError */
+
+void HS_AcquirePointers_Test_CpuBudgetError(void)
+{
+    HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+
+    /* Causes to enter all (Status < CFE_SUCCESS) blocks, only the CpuBudget one reports */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CpuBudgetState == HS_STATE_DISABLED, "HS_AppData.CpuBudgetState == HS_STATE_DISABLED");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CPUBUDGET_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* A second failure is not reported again */
+    HS_AcquirePointers();
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AcquirePointers_Test_CpuBudgetError */
+
+void HS_AcquirePointers_Test_RebalanceError(void)
+{
+    HS_AppData.RebalanceState = HS_STATE_ENABLED;
+
+    /* Causes to enter all (Status < CFE_SUCCESS) blocks, only the Rebalance one reports */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), -1);
+
+    /* Execute the function being tested */
+    HS_AcquirePointers();
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.RebalanceState == HS_STATE_DISABLED, "HS_AppData.RebalanceState == HS_STATE_DISABLED");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REBALANCE_GETADDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_AcquirePointers_Test_RebalanceError */
+
 void HS_AppMonStatusRefresh_Test_CycleCountZero(void)
 {
     HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
@@ -3265,6 +4228,35 @@ void HS_AppMonStatusRefresh_Test_ElseCase(void)
 
 } /* end HS_AppMonStatusRefresh_Test_ElseCase */
 
+void HS_EventMonStatusRefresh_Test(void)
+{
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    HS_AppData.EMTablePtr = EMTable;
+
+    HS_AppData.EventMonEnables[0] = 0x1;
+
+    HS_AppData.EMTablePtr[1].ActionType = HS_EMT_ACT_APP_RESTART;
+    HS_AppData.EMTablePtr[HS_MAX_MONITORED_EVENTS - 1].ActionType = HS_EMT_ACT_APP_DELETE;
+
+    /* Execute the function being tested */
+    HS_EventMonStatusRefresh();
+
+    /* Verify results */
+    UtAssert_True(CFE_TST(HS_AppData.EventMonEnables[0], 0) == false, "Entry 0 (no action) disabled");
+    UtAssert_True(CFE_TST(HS_AppData.EventMonEnables[0], 1) == true, "Entry 1 enabled");
+    UtAssert_True(CFE_TST(HS_AppData.EventMonEnables[(HS_MAX_MONITORED_EVENTS - 1) / HS_BITS_PER_EVENTMON_ENABLE],
+                          (HS_MAX_MONITORED_EVENTS - 1) % HS_BITS_PER_EVENTMON_ENABLE) == true,
+                  "Last entry enabled");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_EventMonStatusRefresh_Test */
+
 void HS_MsgActsStatusRefresh_Test(void)
 {
     uint32 i;
@@ -3294,12 +4286,69 @@ void HS_MsgActsStatusRefresh_Test(void)
 
 } /* end HS_MsgActsStatusRefresh_Test */
 
+void HS_LoadShedStatusRefresh_Test(void)
+{
+    HS_AppData.LoadShedStep      = 2;
+    HS_AppData.LoadShedHighCount = 3;
+    HS_AppData.LoadShedLowCount  = 4;
+
+    /* Execute the function being tested */
+    HS_LoadShedStatusRefresh();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 2);
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedHighCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedLowCount, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_LoadShedStatusRefresh_Test */
+
+void HS_CpuBudgetStatusRefresh_Test(void)
+{
+    HS_AppData.CpuBudgetCount[0]                      = 2;
+    HS_AppData.CpuBudgetCount[HS_MAX_CPU_BUDGETS - 1] = 3;
+
+    /* Execute the function being tested */
+    HS_CpuBudgetStatusRefresh();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.CpuBudgetCount[0], 0);
+    UtAssert_UINT32_EQ(HS_AppData.CpuBudgetCount[HS_MAX_CPU_BUDGETS - 1], 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_CpuBudgetStatusRefresh_Test */
+
+void HS_RebalanceStatusRefresh_Test(void)
+{
+    HS_AppData.RebalanceDwell    = 2;
+    HS_AppData.RebalanceCooldown = 3;
+
+    /* Execute the function being tested */
+    HS_RebalanceStatusRefresh();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceDwell, 0);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceCooldown, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_RebalanceStatusRefresh_Test */
+
 /*
  * Register the test cases to execute with the unit test tool
  */
 void UtTest_Setup(void)
 {
     UtTest_Add(HS_AppPipe_Test_SendHK, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_SendHK");
+    UtTest_Add(HS_AppPipe_Test_SbTlm, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_SbTlm");
     UtTest_Add(HS_AppPipe_Test_Noop, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_Noop");
     UtTest_Add(HS_AppPipe_Test_Reset, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_Reset");
     UtTest_Add(HS_AppPipe_Test_EnableAppMon, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_EnableAppMon");
@@ -3313,6 +4362,15 @@ void UtTest_Setup(void)
     UtTest_Add(HS_AppPipe_Test_SetMaxResets, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_SetMaxResets");
     UtTest_Add(HS_AppPipe_Test_EnableCPUHog, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_EnableCPUHog");
     UtTest_Add(HS_AppPipe_Test_DisableCPUHog, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_DisableCPUHog");
+    UtTest_Add(HS_AppPipe_Test_EnableEventMonEntries, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AppPipe_Test_EnableEventMonEntries");
+    UtTest_Add(HS_AppPipe_Test_DisableEventMonEntries, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AppPipe_Test_DisableEventMonEntries");
+    UtTest_Add(HS_AppPipe_Test_DumpUtilHist, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_DumpUtilHist");
+    UtTest_Add(HS_AppPipe_Test_SendUtilPctl, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_SendUtilPctl");
+    UtTest_Add(HS_AppPipe_Test_SetUtilLoadLevel, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AppPipe_Test_SetUtilLoadLevel");
+    UtTest_Add(HS_AppPipe_Test_SetUtilTrend, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_SetUtilTrend");
     UtTest_Add(HS_AppPipe_Test_InvalidCC, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_InvalidCC");
     UtTest_Add(HS_AppPipe_Test_InvalidCCNoEvent, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_InvalidCCNoEvent");
     UtTest_Add(HS_AppPipe_Test_InvalidMID, HS_Test_Setup, HS_Test_TearDown, "HS_AppPipe_Test_InvalidMID");
@@ -3407,6 +4465,48 @@ void UtTest_Setup(void)
     UtTest_Add(HS_SetMaxResetsCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
                "HS_SetMaxResetsCmd_Test_MsgLengthError");
 
+    UtTest_Add(HS_EnableEventMonEntriesCmd_Test, HS_Test_Setup, HS_Test_TearDown, "HS_EnableEventMonEntriesCmd_Test");
+    UtTest_Add(HS_EnableEventMonEntriesCmd_Test_RangeError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_EnableEventMonEntriesCmd_Test_RangeError");
+    UtTest_Add(HS_EnableEventMonEntriesCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_EnableEventMonEntriesCmd_Test_MsgLengthError");
+    UtTest_Add(HS_DisableEventMonEntriesCmd_Test, HS_Test_Setup, HS_Test_TearDown,
+               "HS_DisableEventMonEntriesCmd_Test");
+    UtTest_Add(HS_DisableEventMonEntriesCmd_Test_RangeError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_DisableEventMonEntriesCmd_Test_RangeError");
+    UtTest_Add(HS_DisableEventMonEntriesCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_DisableEventMonEntriesCmd_Test_MsgLengthError");
+
+    UtTest_Add(HS_DumpUtilHistCmd_Test_Tlm, HS_Test_Setup, HS_Test_TearDown, "HS_DumpUtilHistCmd_Test_Tlm");
+    UtTest_Add(HS_DumpUtilHistCmd_Test_File, HS_Test_Setup, HS_Test_TearDown, "HS_DumpUtilHistCmd_Test_File");
+    UtTest_Add(HS_DumpUtilHistCmd_Test_FileError, HS_Test_Setup, HS_Test_TearDown, "HS_DumpUtilHistCmd_Test_FileError");
+    UtTest_Add(HS_DumpUtilHistCmd_Test_InvalidLevel, HS_Test_Setup, HS_Test_TearDown,
+               "HS_DumpUtilHistCmd_Test_InvalidLevel");
+    UtTest_Add(HS_DumpUtilHistCmd_Test_InvalidDestination, HS_Test_Setup, HS_Test_TearDown,
+               "HS_DumpUtilHistCmd_Test_InvalidDestination");
+    UtTest_Add(HS_DumpUtilHistCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_DumpUtilHistCmd_Test_MsgLengthError");
+    UtTest_Add(HS_SendUtilPctlCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_SendUtilPctlCmd_Test_Nominal");
+    UtTest_Add(HS_SendUtilPctlCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SendUtilPctlCmd_Test_MsgLengthError");
+    UtTest_Add(HS_SetUtilLoadLevelCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilLoadLevelCmd_Test_Nominal");
+    UtTest_Add(HS_SetUtilLoadLevelCmd_Test_Invalid, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilLoadLevelCmd_Test_Invalid");
+    UtTest_Add(HS_SetUtilLoadLevelCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilLoadLevelCmd_Test_MsgLengthError");
+    UtTest_Add(HS_SetUtilTrendCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilTrendCmd_Test_Nominal");
+    UtTest_Add(HS_SetUtilTrendCmd_Test_Invalid, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilTrendCmd_Test_Invalid");
+    UtTest_Add(HS_SetUtilTrendCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilTrendCmd_Test_MsgLengthError");
+    UtTest_Add(HS_UtilHistWriteFile_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_UtilHistWriteFile_Test_Nominal");
+    UtTest_Add(HS_UtilHistWriteFile_Test_CreateError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilHistWriteFile_Test_CreateError");
+    UtTest_Add(HS_UtilHistWriteFile_Test_HeaderError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilHistWriteFile_Test_HeaderError");
+    UtTest_Add(HS_UtilHistWriteFile_Test_WriteError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilHistWriteFile_Test_WriteError");
+
 #if HS_MAX_EXEC_CNT_SLOTS != 0
     UtTest_Add(HS_AcquirePointers_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_AcquirePointers_Test_Nominal");
     UtTest_Add(HS_AcquirePointers_Test_ErrorsWithAppMonLoadedAndEventMonLoadedEnabled, HS_Test_Setup, HS_Test_TearDown,
@@ -3422,6 +4522,12 @@ void UtTest_Setup(void)
                HS_Test_Setup, HS_Test_TearDown,
                "HS_AcquirePointers_Test_ErrorsWithCurrentAppMonLoadedDisabledAndCurrentAppMonStateDisabled");
 #endif
+    UtTest_Add(HS_AcquirePointers_Test_LoadShedError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_LoadShedError");
+    UtTest_Add(HS_AcquirePointers_Test_CpuBudgetError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_CpuBudgetError");
+    UtTest_Add(HS_AcquirePointers_Test_RebalanceError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_AcquirePointers_Test_RebalanceError");
 
     UtTest_Add(HS_AppMonStatusRefresh_Test_CycleCountZero, HS_Test_Setup, HS_Test_TearDown,
                "HS_AppMonStatusRefresh_Test_CycleCountZero");
@@ -3429,8 +4535,12 @@ void UtTest_Setup(void)
                "HS_AppMonStatusRefresh_Test_ActionTypeNOACT");
     UtTest_Add(HS_AppMonStatusRefresh_Test_ElseCase, HS_Test_Setup, HS_Test_TearDown,
                "HS_AppMonStatusRefresh_Test_ElseCase");
+    UtTest_Add(HS_EventMonStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_EventMonStatusRefresh_Test");
 
     UtTest_Add(HS_MsgActsStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MsgActsStatusRefresh_Test");
+    UtTest_Add(HS_LoadShedStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_LoadShedStatusRefresh_Test");
+    UtTest_Add(HS_CpuBudgetStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CpuBudgetStatusRefresh_Test");
+    UtTest_Add(HS_RebalanceStatusRefresh_Test, HS_Test_Setup, HS_Test_TearDown, "HS_RebalanceStatusRefresh_Test");
 
 } /* end UtTest_Setup */
 
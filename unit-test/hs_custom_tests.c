@@ -49,11 +49,24 @@ int32 HS_CUSTOM_TEST_CFE_ES_IncrementTaskCounterHook(void *UserObj, int32 StubRe
     return CFE_SUCCESS;
 }
 
+void HS_CUSTOM_TEST_CFE_SB_ReceiveBufferHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", CFE_SB_Buffer_t **);
+
+    UT_Stub_CopyToLocal(UT_KEY(CFE_SB_ReceiveBuffer), BufPtr, sizeof(*BufPtr));
+}
+
 void HS_IdleTask_Test(void)
 {
-    HS_CustomData.UtilMask         = 1;
-    HS_CustomData.ThisIdleTaskExec = 0;
-    HS_CustomData.UtilArrayIndex   = 0;
+    CFE_ES_TaskId_t TaskId   = HS_CustomData.Core[0].IdleTaskID;
+    uint64          MonoTime = 0x123456789ULL;
+
+    HS_CustomData.UtilMask                 = 1;
+    HS_CustomData.Core[0].ThisIdleTaskExec = 0;
+    HS_CustomData.UtilArrayIndex           = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &TaskId, sizeof(TaskId), false);
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), &MonoTime, sizeof(MonoTime), false);
 
     /* Set to make the while loop exit after the first call to CFE_ES_IncrementTaskCounter */
     UT_SetHookFunction(UT_KEY(CFE_ES_IncrementTaskCounter), HS_CUSTOM_TEST_CFE_ES_IncrementTaskCounterHook, NULL);
@@ -62,14 +75,54 @@ void HS_IdleTask_Test(void)
     HS_IdleTask();
 
     /* Will loop incrementing ThisIdleTaskExec until update/stamp, covering all branches */
-    UtAssert_UINT32_NEQ(HS_CustomData.UtilArray[0], 0);
+    UtAssert_True(HS_CustomData.UtilArray[0] == 0x123456789ULL, "HS_CustomData.UtilArray[0] == 0x123456789");
+    UtAssert_STUB_COUNT(HS_GetMonotonicTimeNs, 1);
     UtAssert_UINT32_EQ(HS_CustomData.UtilArrayIndex, 1);
-    UtAssert_UINT32_EQ(HS_CustomData.ThisIdleTaskExec, 4);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].ThisIdleTaskExec, 4);
+    UtAssert_STUB_COUNT(HS_PaintStack, 1);
 
+    /* A single Idle Task is not pinned to a core */
+    UtAssert_STUB_COUNT(HS_SetCpuAffinity, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
 } /* end HS_IdleTask_Test */
 
+void HS_IdleTask_Test_Stopped(void)
+{
+    HS_CustomData.IdleTaskRunStatus = !CFE_SUCCESS;
+
+    /* Execute the function being tested */
+    HS_IdleTask();
+
+    /* No core is found once the Idle Tasks are stopped, so nothing is counted */
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].ThisIdleTaskExec, 0);
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskID, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_IdleTask_Test_Stopped */
+
+void HS_IdleTaskCoreIndex_Test_WaitForID(void)
+{
+    CFE_ES_TaskId_t TaskIds[2];
+
+    /* The first lookup happens before the creating task has recorded the ID */
+    memset(&HS_CustomData.Core[0].IdleTaskID, 0, sizeof(HS_CustomData.Core[0].IdleTaskID));
+    memset(&TaskIds[0], 0xFF, sizeof(TaskIds[0]));
+    TaskIds[1] = HS_CustomData.Core[0].IdleTaskID;
+
+    HS_CustomData.IdleTaskRunStatus = CFE_SUCCESS;
+
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), TaskIds, sizeof(TaskIds), false);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(HS_IdleTaskCoreIndex(), 0);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskID, 2);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+
+} /* end HS_IdleTaskCoreIndex_Test_WaitForID */
+
 void HS_CustomInit_Test_Nominal(void)
 {
     uint32 i;
@@ -80,38 +133,58 @@ void HS_CustomInit_Test_Nominal(void)
     /* Execute the function being tested */
     UtAssert_INT32_EQ(HS_CustomInit(), CFE_SUCCESS);
 
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult1, HS_UTIL_CONV_MULT1);
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult2, HS_UTIL_CONV_MULT2);
-    UtAssert_INT32_EQ(HS_CustomData.UtilDiv, HS_UTIL_CONV_DIV);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult1, HS_UTIL_CONV_MULT1);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult2, HS_UTIL_CONV_MULT2);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilDiv, HS_UTIL_CONV_DIV);
 
     UtAssert_UINT32_EQ(HS_CustomData.UtilMask, HS_UTIL_DIAG_MASK);
     UtAssert_UINT32_EQ(HS_CustomData.UtilArrayIndex, 0);
     UtAssert_UINT32_EQ(HS_CustomData.UtilArrayMask, HS_UTIL_TIME_DIAG_ARRAY_MASK);
 
-    UtAssert_UINT32_EQ(HS_CustomData.ThisIdleTaskExec, 0);
-    UtAssert_UINT32_EQ(HS_CustomData.LastIdleTaskExec, 0);
-    UtAssert_UINT32_EQ(HS_CustomData.LastIdleTaskInterval, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].ThisIdleTaskExec, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].LastIdleTaskExec, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].LastIdleTaskInterval, 0);
     UtAssert_UINT32_EQ(HS_CustomData.UtilCycleCounter, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCycleCount, 0);
 
     for (i = 0; i < sizeof(HS_CustomData.UtilArray) / sizeof(HS_CustomData.UtilArray[0]); i++)
     {
-        UtAssert_UINT32_EQ(HS_CustomData.UtilArray[i], 0);
+        UtAssert_True(HS_CustomData.UtilArray[i] == 0, "HS_CustomData.UtilArray[%u] == 0", (unsigned int)i);
     }
 
     UtAssert_UINT32_EQ(HS_CustomData.UtilCallsPerMark, HS_UTIL_CALLS_PER_MARK);
 
+    /* Only a backend measuring through the Idle Task spawns one */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilBackend, HS_UTIL_DEFAULT_BACKEND);
+    if (HS_UtilBackendUsesIdleTask(HS_UTIL_DEFAULT_BACKEND))
+    {
+        UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, HS_UTIL_NUM_CORES);
+    }
+    else
+    {
+        UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    }
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
 } /* end HS_CustomInit_Test_Nominal */
 
 void HS_CustomInit_Test_CreateChildTaskError(void)
 {
-    int32 Result;
-    int32 strCmpResult;
-    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    int32  Result;
+    int32  strCmpResult;
+    uint32 EventIndex = 0;
+    char   ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "Error Creating Child Task for CPU Utilization Monitoring,RC=0x%%08X");
 
+#if HS_UTIL_DEFAULT_BACKEND != HS_UTIL_BACKEND_IDLE_COUNT
+    /* The default backend is not available, so HS falls back to the Idle Task count */
+    UT_SetDefaultReturnValue(UT_KEY(HS_ReadProcStat), CFE_STATUS_NOT_IMPLEMENTED);
+    UT_SetDefaultReturnValue(UT_KEY(HS_GetThreadCpuClock), CFE_STATUS_NOT_IMPLEMENTED);
+    EventIndex = 1;
+#endif
+
     /* Causes event message to be generated */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, -1);
 
@@ -121,17 +194,19 @@ void HS_CustomInit_Test_CreateChildTaskError(void)
     /* Verify results */
     UtAssert_True(Result == -1, "Result == -1");
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CR_CHILD_TASK_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[EventIndex].EventID, HS_CR_CHILD_TASK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[EventIndex].EventType, CFE_EVS_EventType_ERROR);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    strCmpResult = strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[EventIndex].Spec,
+                           CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'",
+                  context_CFE_EVS_SendEvent[EventIndex].Spec);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_True(call_count_CFE_EVS_SendEvent == EventIndex + 1,
+                  "CFE_EVS_SendEvent was called %u time(s), expected %u", call_count_CFE_EVS_SendEvent,
+                  (unsigned int)(EventIndex + 1));
 
 } /* end HS_CustomInit_Test_CreateChildTaskError */
 
@@ -152,17 +227,20 @@ void HS_CustomInit_Test_RegisterSynchCallbackError(void)
     /* Verify results */
     UtAssert_True(Result == -1, "Result == -1");
 
-    UtAssert_True(HS_CustomData.UtilMult1 == HS_UTIL_CONV_MULT1, "HS_CustomData.UtilMult1 == HS_UTIL_CONV_MULT1");
-    UtAssert_True(HS_CustomData.UtilMult2 == HS_UTIL_CONV_MULT2, "HS_CustomData.UtilMult2 == HS_UTIL_CONV_MULT2");
-    UtAssert_True(HS_CustomData.UtilDiv == HS_UTIL_CONV_DIV, "HS_CustomData.UtilDiv == HS_UTIL_CONV_DIV");
+    UtAssert_True(HS_CustomData.Core[0].UtilMult1 == HS_UTIL_CONV_MULT1,
+                  "HS_CustomData.Core[0].UtilMult1 == HS_UTIL_CONV_MULT1");
+    UtAssert_True(HS_CustomData.Core[0].UtilMult2 == HS_UTIL_CONV_MULT2,
+                  "HS_CustomData.Core[0].UtilMult2 == HS_UTIL_CONV_MULT2");
+    UtAssert_True(HS_CustomData.Core[0].UtilDiv == HS_UTIL_CONV_DIV,
+                  "HS_CustomData.Core[0].UtilDiv == HS_UTIL_CONV_DIV");
     UtAssert_True(HS_CustomData.UtilCycleCounter == 0, "HS_CustomData.UtilCycleCounter == 0");
     UtAssert_True(HS_CustomData.UtilMask == HS_UTIL_DIAG_MASK, "HS_CustomData.UtilMask == HS_UTIL_DIAG_MASK");
     UtAssert_True(HS_CustomData.UtilArrayIndex == 0, "HS_CustomData.UtilArrayIndex == 0");
     UtAssert_True(HS_CustomData.UtilArrayMask == HS_UTIL_TIME_DIAG_ARRAY_MASK,
                   "HS_CustomData.UtilArrayMask == HS_UTIL_TIME_DIAG_ARRAY_MASK");
-    UtAssert_True(HS_CustomData.ThisIdleTaskExec == 0, "HS_CustomData.ThisIdleTaskExec == 0");
-    UtAssert_True(HS_CustomData.LastIdleTaskExec == 0, "HS_CustomData.LastIdleTaskExec == 0");
-    UtAssert_True(HS_CustomData.LastIdleTaskInterval == 0, "HS_CustomData.LastIdleTaskInterval == 0");
+    UtAssert_True(HS_CustomData.Core[0].ThisIdleTaskExec == 0, "HS_CustomData.Core[0].ThisIdleTaskExec == 0");
+    UtAssert_True(HS_CustomData.Core[0].LastIdleTaskExec == 0, "HS_CustomData.Core[0].LastIdleTaskExec == 0");
+    UtAssert_True(HS_CustomData.Core[0].LastIdleTaskInterval == 0, "HS_CustomData.Core[0].LastIdleTaskInterval == 0");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CR_SYNC_CALLBACK_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
@@ -187,6 +265,7 @@ void HS_CustomCleanup_Test(void)
 
     /* Verify results */
     UtAssert_True(HS_CustomData.IdleTaskRunStatus == !CFE_SUCCESS, "HS_CustomData.IdleTaskRunStatus == !CFE_SUCCESS");
+    UtAssert_STUB_COUNT(CFE_TIME_UnregisterSynchCallback, 1);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -194,15 +273,195 @@ void HS_CustomCleanup_Test(void)
 
 } /* end HS_CustomCleanup_Test */
 
+void HS_CustomCleanup_Test_ProcStat(void)
+{
+    HS_CustomData.UtilBackend = HS_UTIL_BACKEND_PROC_STAT;
+
+    /* Execute the function being tested */
+    HS_CustomCleanup();
+
+    /* Verify results, no Idle Tasks to delete */
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_CustomCleanup_Test_ProcStat */
+
+void HS_CustomStopIdleTasks_Test(void)
+{
+    HS_CustomData.IdleTaskRunStatus                   = CFE_SUCCESS;
+    HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].IdleClockValid = true;
+
+    /* Execute the function being tested */
+    HS_CustomStopIdleTasks();
+
+    /* Verify results */
+    UtAssert_True(HS_CustomData.IdleTaskRunStatus == !CFE_SUCCESS, "HS_CustomData.IdleTaskRunStatus == !CFE_SUCCESS");
+    UtAssert_BOOL_FALSE(HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].IdleClockValid);
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, HS_UTIL_NUM_CORES);
+
+} /* end HS_CustomStopIdleTasks_Test */
+
+void HS_UtilBackendStart_Test_ProcStat(void)
+{
+    HS_CustomData.UtilBackend           = HS_UTIL_BACKEND_PROC_STAT;
+    HS_CustomData.Core[0].LastTotalTime = 100;
+    HS_CustomData.Core[0].SampledUtil   = 50;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilBackendStart(), CFE_SUCCESS);
+
+    /* Verify results, the baseline is reset and no Idle Task is needed */
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].LastTotalTime, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].SampledUtil, 0);
+    UtAssert_STUB_COUNT(HS_ReadProcStat, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilBackendStart_Test_ProcStat */
+
+void HS_UtilBackendStart_Test_ThreadTime(void)
+{
+    HS_CustomData.UtilBackend = HS_UTIL_BACKEND_THREAD_TIME;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilBackendStart(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_GetThreadCpuClock, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, HS_UTIL_NUM_CORES);
+    UtAssert_INT32_EQ(HS_CustomData.IdleTaskRunStatus, CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilBackendStart_Test_ThreadTime */
+
+void HS_UtilBackendStart_Test_NotAvailable(void)
+{
+    HS_CustomData.UtilBackend = HS_UTIL_BACKEND_THREAD_TIME;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_GetThreadCpuClock), CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilBackendStart(), CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_BACKEND_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_UtilBackendStart_Test_NotAvailable */
+
+void HS_UtilBackendSample_Test_ProcStat(void)
+{
+    HS_CpuTimes_t Times[2][HS_UTIL_NUM_CORES];
+    uint32        i;
+
+    for (i = 0; i < HS_UTIL_NUM_CORES; i++)
+    {
+        Times[0][i].Busy  = 1000;
+        Times[0][i].Total = 4000;
+        Times[1][i].Busy  = 1250;
+        Times[1][i].Total = 5000;
+    }
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadProcStat), Times, sizeof(Times), false);
+
+    HS_CustomData.UtilBackend = HS_UTIL_BACKEND_PROC_STAT;
+
+    /* First sample only sets the baseline */
+    HS_UtilBackendSample();
+
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].SampledUtil, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].LastTotalTime, 4000);
+
+    /* Second sample computes the utilization from the deltas */
+    HS_UtilBackendSample();
+
+    UtAssert_INT32_EQ(HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].SampledUtil, HS_UTIL_PER_INTERVAL_TOTAL / 4);
+    UtAssert_INT32_EQ(HS_CustomGetCoreUtil(HS_UTIL_NUM_CORES - 1), HS_UTIL_PER_INTERVAL_TOTAL / 4);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilSampleErrCount, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilBackendSample_Test_ProcStat */
+
+void HS_UtilBackendSample_Test_ThreadTime(void)
+{
+    uint64 MonoTimes[2] = {1000000000, 2000000000};
+    uint64 CpuTimes[2]  = {500000000, 800000000};
+
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), MonoTimes, sizeof(MonoTimes), false);
+    UT_SetDataBuffer(UT_KEY(HS_GetClockTimeNs), CpuTimes, sizeof(CpuTimes), false);
+
+    HS_CustomData.UtilBackend            = HS_UTIL_BACKEND_THREAD_TIME;
+    HS_CustomData.Core[0].IdleClockValid = true;
+
+    /* First sample only sets the baseline */
+    HS_UtilBackendSample();
+
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].SampledUtil, 0);
+
+    /* Idle Task ran 30% of the elapsed time */
+    HS_UtilBackendSample();
+
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].SampledUtil,
+                      HS_UTIL_PER_INTERVAL_TOTAL - (HS_UTIL_PER_INTERVAL_TOTAL * 3) / 10);
+    UtAssert_INT32_EQ(HS_CustomGetCoreUtil(0), HS_CustomData.Core[0].SampledUtil);
+    UtAssert_STUB_COUNT(HS_GetClockTimeNs, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilBackendSample_Test_ThreadTime */
+
+void HS_UtilBackendSample_Test_Error(void)
+{
+    HS_CustomData.UtilBackend = HS_UTIL_BACKEND_PROC_STAT;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_ReadProcStat), -1);
+
+    /* Execute the function being tested twice, only the first error is reported */
+    HS_UtilBackendSample();
+    HS_UtilBackendSample();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilSampleErrCount, 2);
+    UtAssert_BOOL_TRUE(HS_CustomData.UtilSampleErrReported);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_SAMPLE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* A good sample allows the error to be reported again */
+    UT_SetDefaultReturnValue(UT_KEY(HS_ReadProcStat), CFE_SUCCESS);
+
+    HS_UtilBackendSample();
+
+    UtAssert_BOOL_FALSE(HS_CustomData.UtilSampleErrReported);
+
+} /* end HS_UtilBackendSample_Test_Error */
+
+void HS_UtilBackendSample_Test_ThreadTimeError(void)
+{
+    HS_CustomData.UtilBackend                                 = HS_UTIL_BACKEND_THREAD_TIME;
+    HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].IdleClockValid = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_GetClockTimeNs), -1);
+
+    /* Execute the function being tested */
+    HS_UtilBackendSample();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilSampleErrCount, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_SAMPLE_ERR_EID);
+
+} /* end HS_UtilBackendSample_Test_ThreadTimeError */
+
 void HS_UtilizationIncrement_Test(void)
 {
     /* No setup required for this test */
 
     /* Execute the function being tested */
-    HS_UtilizationIncrement();
+    HS_UtilizationIncrement(0);
 
     /* Verify results */
-    UtAssert_True(HS_CustomData.ThisIdleTaskExec == 1, "HS_CustomData.ThisIdleTaskExec == 1");
+    UtAssert_True(HS_CustomData.Core[0].ThisIdleTaskExec == 1, "HS_CustomData.Core[0].ThisIdleTaskExec == 1");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -212,8 +471,8 @@ void HS_UtilizationIncrement_Test(void)
 
 void HS_UtilizationMark_Test(void)
 {
-    HS_CustomData.ThisIdleTaskExec = 3;
-    HS_CustomData.LastIdleTaskExec = 1;
+    HS_CustomData.Core[0].ThisIdleTaskExec = 3;
+    HS_CustomData.Core[0].LastIdleTaskExec = 1;
 
     /* Force calls per mark to be able to get branch coverage */
     HS_CustomData.UtilCallsPerMark = 2;
@@ -221,15 +480,17 @@ void HS_UtilizationMark_Test(void)
     /* First call will bypass */
     HS_UtilizationMark();
 
-    UtAssert_UINT32_EQ(HS_CustomData.LastIdleTaskInterval, 0);
-    UtAssert_UINT32_EQ(HS_CustomData.LastIdleTaskExec, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].LastIdleTaskInterval, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].LastIdleTaskExec, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCycleCount, 1);
 
     /* Next call will update variables */
     HS_UtilizationMark();
 
     /* Verify results */
-    UtAssert_True(HS_CustomData.LastIdleTaskInterval == 2, "HS_CustomData.LastIdleTaskInterval == 2");
-    UtAssert_True(HS_CustomData.LastIdleTaskExec == 3, "HS_CustomData.LastIdleTaskExec == 3");
+    UtAssert_True(HS_CustomData.Core[0].LastIdleTaskInterval == 2, "HS_CustomData.Core[0].LastIdleTaskInterval == 2");
+    UtAssert_True(HS_CustomData.Core[0].LastIdleTaskExec == 3, "HS_CustomData.Core[0].LastIdleTaskExec == 3");
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCycleCount, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -237,6 +498,30 @@ void HS_UtilizationMark_Test(void)
 
 } /* end HS_UtilizationMark_Test */
 
+void HS_UtilizationMark_Test_Jitter(void)
+{
+    uint64 MonoTimes[2] = {5000000000ULL, 6001000000ULL};
+
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), MonoTimes, sizeof(MonoTimes), false);
+
+    HS_CustomData.UtilCallsPerMark = 1;
+
+    /* First mark only sets the baseline */
+    HS_UtilizationMark();
+
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCount, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkJitterMax, 0);
+    UtAssert_True(HS_CustomData.LastMarkTime == 5000000000ULL, "HS_CustomData.LastMarkTime == 5000000000");
+
+    /* Next mark lands 1 s and 1 ms after the first */
+    HS_UtilizationMark();
+
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCount, 2);
+    UtAssert_True(HS_CustomData.MarkJitterMax > 0, "HS_CustomData.MarkJitterMax > 0");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilizationMark_Test_Jitter */
+
 void HS_MarkIdleCallback_Test(void)
 {
     /* No setup required for this test */
@@ -251,6 +536,217 @@ void HS_MarkIdleCallback_Test(void)
 
 } /* end HS_MarkIdleCallback_Test */
 
+void HS_MarkTimerCallback_Test(void)
+{
+    /* Execute the function being tested */
+    HS_MarkTimerCallback(OS_OBJECT_ID_UNDEFINED);
+
+    /* Verify results, calls per mark is 0 so every call marks */
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_MarkTimerCallback_Test */
+
+void HS_UtilMarkStart_Test_TimeSync(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_TIME_SYNC;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilMarkStart(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TIME_RegisterSynchCallback, 1);
+    UtAssert_STUB_COUNT(OS_TimerCreate, 0);
+
+} /* end HS_UtilMarkStart_Test_TimeSync */
+
+void HS_UtilMarkStart_Test_Timer(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_TIMER;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilMarkStart(), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TimerCreate, 1);
+    UtAssert_STUB_COUNT(OS_TimerSet, 1);
+    UtAssert_STUB_COUNT(OS_TimerDelete, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_RegisterSynchCallback, 0);
+
+} /* end HS_UtilMarkStart_Test_Timer */
+
+void HS_UtilMarkStart_Test_TimerCreateError(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_TIMER;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_TimerCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilMarkStart(), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_TimerSet, 0);
+    UtAssert_STUB_COUNT(OS_TimerDelete, 0);
+
+} /* end HS_UtilMarkStart_Test_TimerCreateError */
+
+void HS_UtilMarkStart_Test_TimerSetError(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_TIMER;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_TimerSet), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilMarkStart(), OS_ERROR);
+
+    /* Verify results, the timer is not left behind */
+    UtAssert_STUB_COUNT(OS_TimerDelete, 1);
+
+} /* end HS_UtilMarkStart_Test_TimerSetError */
+
+void HS_UtilMarkStart_Test_Wakeup(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_WAKEUP;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilMarkStart(), CFE_SUCCESS);
+
+    /* Verify results, nothing to set up */
+    UtAssert_STUB_COUNT(CFE_TIME_RegisterSynchCallback, 0);
+    UtAssert_STUB_COUNT(OS_TimerCreate, 0);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 0);
+
+} /* end HS_UtilMarkStart_Test_Wakeup */
+
+void HS_UtilMarkStart_Test_Message(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_MESSAGE;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilMarkStart(), CFE_SUCCESS);
+
+    /* Verify results, the marks get their own pipe */
+    UtAssert_STUB_COUNT(CFE_SB_CreatePipe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_DeletePipe, 0);
+    UtAssert_STUB_COUNT(CFE_TIME_RegisterSynchCallback, 0);
+
+} /* end HS_UtilMarkStart_Test_Message */
+
+void HS_UtilMarkStart_Test_MessageSubscribeError(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_MESSAGE;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 1, CFE_SB_BAD_ARGUMENT);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_UtilMarkStart(), CFE_SB_BAD_ARGUMENT);
+
+    /* Verify results, the pipe is not left behind */
+    UtAssert_STUB_COUNT(CFE_SB_DeletePipe, 1);
+
+} /* end HS_UtilMarkStart_Test_MessageSubscribeError */
+
+void HS_UtilMarkStop_Test(void)
+{
+    /* Execute the function being tested for each source */
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_TIME_SYNC;
+    HS_UtilMarkStop();
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_TIMER;
+    HS_UtilMarkStop();
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_WAKEUP;
+    HS_UtilMarkStop();
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_MESSAGE;
+    HS_UtilMarkStop();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TIME_UnregisterSynchCallback, 1);
+    UtAssert_STUB_COUNT(OS_TimerDelete, 1);
+    UtAssert_STUB_COUNT(CFE_SB_DeletePipe, 1);
+
+} /* end HS_UtilMarkStop_Test */
+
+void HS_UtilMarkJitter_Test(void)
+{
+    uint64 Expected = HS_UTIL_MARK_PERIOD_US * 1000ULL;
+    uint32 Average  = 0;
+
+    /* Late by 2 ms */
+    HS_UtilMarkJitter(Expected + 2000000);
+
+    Average = 2000000 >> HS_UTIL_MARK_JITTER_SHIFT;
+    UtAssert_UINT32_EQ(HS_CustomData.MarkJitterAvg, Average);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkJitterMax, 2000000);
+
+    /* Early by 1 ms, the largest jitter is kept */
+    HS_UtilMarkJitter(Expected - 1000000);
+
+    Average = Average - (Average >> HS_UTIL_MARK_JITTER_SHIFT) + (1000000 >> HS_UTIL_MARK_JITTER_SHIFT);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkJitterAvg, Average);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkJitterMax, 2000000);
+
+    /* Jitter beyond 32 bits saturates */
+    HS_UtilMarkJitter(Expected + 0x100000000ULL);
+
+    UtAssert_UINT32_EQ(HS_CustomData.MarkJitterMax, 0xFFFFFFFF);
+
+} /* end HS_UtilMarkJitter_Test */
+
+void HS_UtilMarkGetStats_Test(void)
+{
+    uint32 Source    = 0;
+    uint32 Count     = 0;
+    uint32 JitterAvg = 0;
+    uint32 JitterMax = 0;
+
+    HS_CustomData.MarkSource    = HS_UTIL_MARK_SOURCE_TIMER;
+    HS_CustomData.MarkCount     = 5;
+    HS_CustomData.MarkJitterAvg = 343750;
+    HS_CustomData.MarkJitterMax = 2000000;
+
+    /* Execute the function being tested */
+    HS_UtilMarkGetStats(&Source, &Count, &JitterAvg, &JitterMax);
+
+    /* Verify results, the largest jitter restarts */
+    UtAssert_UINT32_EQ(Source, HS_UTIL_MARK_SOURCE_TIMER);
+    UtAssert_UINT32_EQ(Count, 5);
+    UtAssert_UINT32_EQ(JitterAvg, 343);
+    UtAssert_UINT32_EQ(JitterMax, 2000);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkJitterMax, 0);
+
+} /* end HS_UtilMarkGetStats_Test */
+
+void HS_CustomMarkPoll_Test_Marks(void)
+{
+    CFE_SB_Buffer_t *BufPtrs[3] = {&UT_CmdBuf.Buf, &UT_CmdBuf.Buf, &UT_CmdBuf.Buf};
+
+    /* Three marks are queued */
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), BufPtrs, sizeof(BufPtrs), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_ReceiveBuffer), HS_CUSTOM_TEST_CFE_SB_ReceiveBufferHandler, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 4, CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    HS_CustomMarkPoll();
+
+    /* Verify results, the pipe is drained and the queued marks close one interval */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 4);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCount, 1);
+
+} /* end HS_CustomMarkPoll_Test_Marks */
+
+void HS_CustomMarkPoll_Test_NoMark(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    HS_CustomMarkPoll();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCount, 0);
+
+} /* end HS_CustomMarkPoll_Test_NoMark */
+
 void HS_CustomMonitorUtilization_Test(void)
 {
     /* Setting to max will cause rollover for coverage */
@@ -265,12 +761,45 @@ void HS_CustomMonitorUtilization_Test(void)
     HS_CustomMonitorUtilization();
 
     UtAssert_STUB_COUNT(HS_MonitorUtilization, 1);
+    UtAssert_STUB_COUNT(HS_MonitorTaskCpu, 1);
+    UtAssert_STUB_COUNT(HS_MonitorStacks, 1);
     UtAssert_UINT32_EQ(HS_CustomData.UtilCycleCounter, 0);
 
+    /* No pressure stall resource is monitored */
+    UtAssert_STUB_COUNT(HS_ReadPsi, 0);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
 } /* end HS_CustomMonitorUtilization_Test */
 
+void HS_CustomMonitorUtilization_Test_WakeupMark(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_WAKEUP;
+
+    /* Execute the function being tested */
+    HS_CustomMonitorUtilization();
+
+    /* Verify results, calls per mark is 0 so every wakeup marks */
+    UtAssert_UINT32_EQ(HS_CustomData.MarkCount, 1);
+    UtAssert_STUB_COUNT(HS_MonitorUtilization, 1);
+
+} /* end HS_CustomMonitorUtilization_Test_WakeupMark */
+
+void HS_CustomMonitorUtilization_Test_MessageMark(void)
+{
+    HS_CustomData.MarkSource = HS_UTIL_MARK_SOURCE_MESSAGE;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    HS_CustomMonitorUtilization();
+
+    /* Verify results, the mark pipe is polled every cycle */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(HS_MonitorUtilization, 1);
+
+} /* end HS_CustomMonitorUtilization_Test_MessageMark */
+
 void HS_CustomCommands_Test_UtilDiagReport(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -361,7 +890,7 @@ void HS_CustomCommands_Test_SetUtilDiagCmd(void)
 
 } /* end HS_CustomCommands_Test_SetUtilDiagCmd */
 
-void HS_CustomCommands_Test_InvalidCommandCode(void)
+void HS_CustomCommands_Test_SetCoreUtilParamsCmd(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
     CFE_MSG_FcnCode_t FcnCode;
@@ -369,39 +898,127 @@ void HS_CustomCommands_Test_InvalidCommandCode(void)
     int32             Result;
 
     TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
-    FcnCode   = 99;
-    MsgSize   = sizeof(UT_CmdBuf.NoArgsCmd);
+    FcnCode   = HS_SET_CORE_UTIL_PARAMS_CC;
+    MsgSize   = sizeof(UT_CmdBuf.SetCoreUtilParamsCmd);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
     /* Execute the function being tested */
     Result = HS_CustomCommands(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(Result == !CFE_SUCCESS, "Result == !CFE_SUCCESS");
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
+    /* Generates 1 message we don't care about in this test */
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_CustomCommands_Test_InvalidCommandCode */
+} /* end HS_CustomCommands_Test_SetCoreUtilParamsCmd */
 
-void HS_UtilDiagReport_Test(void)
+void HS_CustomCommands_Test_SetUtilBackendCmd(void)
 {
-    uint32 i;
-    int32  strCmpResult;
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+    int32             Result;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_SET_UTIL_BACKEND_CC;
+    MsgSize   = sizeof(UT_CmdBuf.SetUtilBackendCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    Result = HS_CustomCommands(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_CustomCommands_Test_SetUtilBackendCmd */
+
+void HS_CustomCommands_Test_StartUtilCalCmd(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+    int32             Result;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = HS_START_UTIL_CAL_CC;
+    MsgSize   = sizeof(UT_CmdBuf.StartUtilCalCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    /* Execute the function being tested */
+    Result = HS_CustomCommands(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    /* Generates 1 message we don't care about in this test */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_CustomCommands_Test_StartUtilCalCmd */
+
+void HS_CustomCommands_Test_InvalidCommandCode(void)
+{
+    CFE_SB_MsgId_t    TestMsgId;
+    CFE_MSG_FcnCode_t FcnCode;
+    size_t            MsgSize;
+    int32             Result;
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    FcnCode   = 99;
+    MsgSize   = sizeof(UT_CmdBuf.NoArgsCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    Result = HS_CustomCommands(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(Result == !CFE_SUCCESS, "Result == !CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_CustomCommands_Test_InvalidCommandCode */
+
+void HS_UtilDiagReport_Test(void)
+{
+    uint32 i;
+    int32  strCmpResult;
     char   ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Mask 0x%%08X Base Time Ticks per Idle Ticks (frequency): %%i(%%i), %%i(%%i), %%i(%%i), %%i(%%i)");
-
-    HS_CustomData.UtilArray[0] = 0xFFFFFFFF;
-    HS_CustomData.UtilArray[1] = 0x00000111;
+             "Mask 0x%%08X Base Time ns per Idle Ticks (frequency): %%lld(%%i), %%lld(%%i), %%lld(%%i), %%lld(%%i)");
 
-    /* Sets all other elements to 0 */
-    for (i = 2; i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH; i++)
+    /* Stamps past 32 bits, 0x111 then 0x200 ns apart, so only the wrap at the buffer end is large */
+    HS_CustomData.UtilArray[0] = 0x100000000ULL;
+    for (i = 1; i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH; i++)
     {
-        HS_CustomData.UtilArray[i] = 0;
+        HS_CustomData.UtilArray[i] = 0x100000111ULL + ((uint64)(i - 1) * 0x200);
     }
 
     HS_CustomData.UtilMask = 0xFFFFFFFE;
@@ -422,6 +1039,24 @@ void HS_UtilDiagReport_Test(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
+    /* Deltas of 0x111, 0x200 and the wrap at the buffer end, lowest first */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.Mask, 0xFFFFFFFE);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.NumSamples, HS_UTIL_TIME_DIAG_ARRAY_LENGTH);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.NumValues, 3);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.NumEntries, 3);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.OverflowCount, 0);
+    UtAssert_True(HS_CustomData.UtilDiagPacket.Payload.Entries[0].Value == 0x111,
+                  "HS_CustomData.UtilDiagPacket.Payload.Entries[0].Value == 0x111");
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.Entries[0].Count, 1);
+    UtAssert_True(HS_CustomData.UtilDiagPacket.Payload.Entries[1].Value == 0x200,
+                  "HS_CustomData.UtilDiagPacket.Payload.Entries[1].Value == 0x200");
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.Entries[1].Count, HS_UTIL_TIME_DIAG_ARRAY_LENGTH - 2);
+    UtAssert_True(HS_CustomData.UtilDiagPacket.Payload.Entries[2].Value ==
+                      0x100000000ULL - HS_CustomData.UtilArray[HS_UTIL_TIME_DIAG_ARRAY_LENGTH - 1],
+                  "HS_CustomData.UtilDiagPacket.Payload.Entries[2].Value is the wrap delta");
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.Entries[2].Count, 1);
+
 } /* end HS_UtilDiagReport_Test */
 
 void HS_UtilDiagReport_Test_Loops(void)
@@ -460,14 +1095,77 @@ void HS_UtilDiagReport_Test_Loops(void)
 
 } /* end HS_UtilDiagReport_Test_Loops */
 
+void HS_UtilDiagReport_Test_Overflow(void)
+{
+    uint32 i;
+    uint32 ExpectedEntries;
+
+    /* Time stamps spaced 1, 2, 3 ... apart so every delta is distinct */
+    for (i = 0; i < HS_UTIL_TIME_DIAG_ARRAY_LENGTH; i++)
+    {
+        HS_CustomData.UtilArray[i] = (i * (i + 1)) / 2;
+    }
+
+    if (HS_UTIL_TIME_DIAG_ARRAY_LENGTH > HS_UTIL_DIAG_MAX_VALUES)
+    {
+        ExpectedEntries = HS_UTIL_DIAG_MAX_VALUES;
+    }
+    else
+    {
+        ExpectedEntries = HS_UTIL_TIME_DIAG_ARRAY_LENGTH;
+    }
+
+    /* Execute the function being tested */
+    HS_UtilDiagReport();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.NumValues, HS_UTIL_TIME_DIAG_ARRAY_LENGTH);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.NumEntries, ExpectedEntries);
+    UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.OverflowCount,
+                       HS_UTIL_TIME_DIAG_ARRAY_LENGTH - ExpectedEntries);
+
+    for (i = 0; i < ExpectedEntries - 1; i++)
+    {
+        UtAssert_True(HS_CustomData.UtilDiagPacket.Payload.Entries[i].Value == i + 1,
+                      "HS_CustomData.UtilDiagPacket.Payload.Entries[%u].Value == %u", (unsigned int)i,
+                      (unsigned int)(i + 1));
+        UtAssert_UINT32_EQ(HS_CustomData.UtilDiagPacket.Payload.Entries[i].Count, 1);
+    }
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+} /* end HS_UtilDiagReport_Test_Overflow */
+
+void HS_UtilDiagSort_Test(void)
+{
+    uint64 Values[9]   = {5, 3, 9, 0xFFFFFFFFFFFFFFFFULL, 1, 3, 7, 0x100000000ULL, 2};
+    uint64 Expected[9] = {1, 2, 3, 3, 5, 7, 9, 0x100000000ULL, 0xFFFFFFFFFFFFFFFFULL};
+    uint64 Single[1]   = {4};
+    uint32 i;
+
+    /* Execute the function being tested */
+    HS_UtilDiagSort(Values, 9);
+    HS_UtilDiagSort(Single, 1);
+
+    /* Verify results */
+    for (i = 0; i < 9; i++)
+    {
+        UtAssert_True(Values[i] == Expected[i], "Values[%u] == Expected[%u]", (unsigned int)i, (unsigned int)i);
+    }
+
+    UtAssert_True(Single[0] == 4, "Single[0] == 4");
+
+} /* end HS_UtilDiagSort_Test */
+
 void HS_CustomGetUtil_Test(void)
 {
     int32 Result;
 
-    HS_CustomData.LastIdleTaskInterval = 9999;
-    HS_CustomData.UtilMult1            = 1;
-    HS_CustomData.UtilDiv              = 1;
-    HS_CustomData.UtilMult2            = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 9999;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
 
     /* Execute the function being tested */
     Result = HS_CustomGetUtil();
@@ -485,12 +1183,12 @@ void HS_CustomGetUtil_Test_DivZero(void)
 {
     int32 Result;
 
-    HS_CustomData.LastIdleTaskInterval = 9999;
-    HS_CustomData.UtilMult1            = 1;
-    HS_CustomData.UtilDiv              = 1;
-    HS_CustomData.UtilMult2            = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 9999;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
 
-    HS_CustomData.UtilDiv = 0;
+    HS_CustomData.Core[0].UtilDiv = 0;
 
     /* Execute the function being tested */
     Result = HS_CustomGetUtil();
@@ -504,6 +1202,44 @@ void HS_CustomGetUtil_Test_DivZero(void)
 
 } /* end HS_CustomGetUtil_Test_DivZero */
 
+void HS_CustomGetCoreUtil_Test(void)
+{
+    HS_CustomData.Core[0].LastIdleTaskInterval = 5000;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 2;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_CustomGetCoreUtil(0), HS_UTIL_PER_INTERVAL_TOTAL - 2500);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_CustomGetCoreUtil_Test */
+
+void HS_CustomGetCoreUtil_Test_Calibrated(void)
+{
+    /* Calibration takes precedence over the conversion factors */
+    HS_CustomData.Core[0].UtilMult1 = 1;
+    HS_CustomData.Core[0].UtilDiv   = 2;
+    HS_CustomData.Core[0].UtilMult2 = 1;
+
+    HS_UtilCalApply(0, 10000);
+
+    HS_CustomData.Core[0].LastIdleTaskInterval = 2500;
+    UtAssert_INT32_EQ(HS_CustomGetCoreUtil(0), HS_UTIL_PER_INTERVAL_TOTAL - (HS_UTIL_PER_INTERVAL_TOTAL / 4));
+
+    /* More idle than calibrated is no utilization */
+    HS_CustomData.Core[0].LastIdleTaskInterval = 10001;
+    UtAssert_INT32_EQ(HS_CustomGetCoreUtil(0), 0);
+
+    /* No idle is full utilization */
+    HS_CustomData.Core[0].LastIdleTaskInterval = 0;
+    UtAssert_INT32_EQ(HS_CustomGetCoreUtil(0), HS_UTIL_PER_INTERVAL_TOTAL);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_CustomGetCoreUtil_Test_Calibrated */
+
 void HS_SetUtilParamsCmd_Test_Nominal(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -528,13 +1264,16 @@ void HS_SetUtilParamsCmd_Test_Nominal(void)
     UT_CmdBuf.SetUtilParamsCmd.Mult2 = 2;
     UT_CmdBuf.SetUtilParamsCmd.Div   = 3;
 
+    HS_UtilCalApply(0, 1000);
+
     /* Execute the function being tested */
     HS_SetUtilParamsCmd(&UT_CmdBuf.Buf);
 
-    /* Verify results */
-    UtAssert_True(HS_CustomData.UtilMult1 == 1, "HS_CustomData.UtilMult1 == 1");
-    UtAssert_True(HS_CustomData.UtilMult2 == 2, "HS_CustomData.UtilMult2 == 2");
-    UtAssert_True(HS_CustomData.UtilDiv == 3, "HS_CustomData.UtilDiv == 3");
+    /* Verify results, the calibration is cleared */
+    UtAssert_True(HS_CustomData.Core[0].UtilMult1 == 1, "HS_CustomData.Core[0].UtilMult1 == 1");
+    UtAssert_True(HS_CustomData.Core[0].UtilMult2 == 2, "HS_CustomData.Core[0].UtilMult2 == 2");
+    UtAssert_True(HS_CustomData.Core[0].UtilDiv == 3, "HS_CustomData.Core[0].UtilDiv == 3");
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].UtilScale, 0);
     UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_PARAMS_DBG_EID);
@@ -579,9 +1318,9 @@ void HS_SetUtilParamsCmd_Test_NominalMultZero(void)
     HS_SetUtilParamsCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult1, 0);
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult2, 0);
-    UtAssert_INT32_EQ(HS_CustomData.UtilDiv, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult1, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult2, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilDiv, 0);
     UtAssert_INT32_EQ(HS_AppData.CmdCount, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_PARAMS_ERR_EID);
@@ -626,9 +1365,9 @@ void HS_SetUtilParamsCmd_Test_NominalDivZero(void)
     HS_SetUtilParamsCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult1, 0);
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult2, 0);
-    UtAssert_INT32_EQ(HS_CustomData.UtilDiv, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult1, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult2, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilDiv, 0);
     UtAssert_INT32_EQ(HS_AppData.CmdCount, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_PARAMS_ERR_EID);
@@ -713,9 +1452,9 @@ void HS_SetUtilParamsCmd_Test_MsgLengthError(void)
     HS_SetUtilParamsCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult1, 0);
-    UtAssert_INT32_EQ(HS_CustomData.UtilMult2, 0);
-    UtAssert_INT32_EQ(HS_CustomData.UtilDiv, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult1, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult2, 0);
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilDiv, 0);
     UtAssert_INT32_EQ(HS_AppData.CmdCount, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -797,56 +1536,1118 @@ void HS_SetUtilDiagCmd_Test_MsgLengthError(void)
 
 } /* end HS_SetUtilDiagCmd_Test_MsgLengthError */
 
-/*
- * Register the test cases to execute with the unit test tool
- */
-void UtTest_Setup(void)
+void HS_SetCoreUtilParamsCmd_Test_Nominal(void)
 {
-    UtTest_Add(HS_IdleTask_Test, HS_Test_Setup, HS_Test_TearDown, "HS_IdleTask_Test");
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    UtTest_Add(HS_CustomInit_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_CustomInit_Test_Nominal");
-    UtTest_Add(HS_CustomInit_Test_CreateChildTaskError, HS_Test_Setup, HS_Test_TearDown,
-               "HS_CustomInit_Test_CreateChildTaskError");
-    UtTest_Add(HS_CustomInit_Test_RegisterSynchCallbackError, HS_Test_Setup, HS_Test_TearDown,
-               "HS_CustomInit_Test_RegisterSynchCallbackError");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Core %%d Utilization Parms set: Mult1: %%d Div: %%d Mult2: %%d");
 
-    UtTest_Add(HS_CustomCleanup_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomCleanup_Test");
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
 
-    UtTest_Add(HS_UtilizationIncrement_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationIncrement_Test");
+    UT_CmdBuf.SetCoreUtilParamsCmd.Core  = HS_UTIL_NUM_CORES - 1;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult1 = 1;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult2 = 2;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Div   = 3;
 
-    UtTest_Add(HS_UtilizationMark_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationMark_Test");
+    HS_UtilCalApply(HS_UTIL_NUM_CORES - 1, 1000);
 
-    UtTest_Add(HS_MarkIdleCallback_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MarkIdleCallback_Test");
+    /* Execute the function being tested */
+    HS_SetCoreUtilParamsCmd(&UT_CmdBuf.Buf);
 
-    UtTest_Add(HS_CustomMonitorUtilization_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomMonitorUtilization_Test");
+    /* Verify results, the calibration is cleared */
+    UtAssert_INT32_EQ(HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].UtilMult1, 1);
+    UtAssert_INT32_EQ(HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].UtilMult2, 2);
+    UtAssert_INT32_EQ(HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].UtilDiv, 3);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[HS_UTIL_NUM_CORES - 1].UtilScale, 0);
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
 
-    UtTest_Add(HS_CustomCommands_Test_UtilDiagReport, HS_Test_Setup, HS_Test_TearDown,
-               "HS_CustomCommands_Test_UtilDiagReport");
-    UtTest_Add(HS_CustomCommands_Test_SetUtilParamsCmd, HS_Test_Setup, HS_Test_TearDown,
-               "HS_CustomCommands_Test_SetUtilParamsCmd");
-    UtTest_Add(HS_CustomCommands_Test_SetUtilDiagCmd, HS_Test_Setup, HS_Test_TearDown,
-               "HS_CustomCommands_Test_SetUtilDiagCmd");
-    UtTest_Add(HS_CustomCommands_Test_InvalidCommandCode, HS_Test_Setup, HS_Test_TearDown,
-               "HS_CustomCommands_Test_InvalidCommandCode");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_CORE_UTIL_PARAMS_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
 
-    UtTest_Add(HS_UtilDiagReport_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilDiagReport_Test");
-    UtTest_Add(HS_UtilDiagReport_Test_Loops, HS_Test_Setup, HS_Test_TearDown, "HS_UtilDiagReport_Test_Loops");
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtTest_Add(HS_CustomGetUtil_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomGetUtil_Test");
-    UtTest_Add(HS_CustomGetUtil_Test_DivZero, HS_Test_Setup, HS_Test_TearDown, "HS_CustomGetUtil_Test_DivZero");
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtTest_Add(HS_SetUtilParamsCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilParamsCmd_Test_Nominal");
-    UtTest_Add(HS_SetUtilParamsCmd_Test_NominalMultZero, HS_Test_Setup, HS_Test_TearDown,
-               "HS_SetUtilParamsCmd_Test_NominalMultZero");
-    UtTest_Add(HS_SetUtilParamsCmd_Test_NominalDivZero, HS_Test_Setup, HS_Test_TearDown,
-               "HS_SetUtilParamsCmd_Test_NominalDivZero");
-    UtTest_Add(HS_SetUtilParamsCmd_Test_Error, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilParamsCmd_Test_Error");
-    UtTest_Add(HS_SetUtilParamsCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
-               "HS_SetUtilParamsCmd_Test_MsgLengthError");
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
 
-    UtTest_Add(HS_SetUtilDiagCmd_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilDiagCmd_Test");
-    UtTest_Add(HS_SetUtilDiagCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
-               "HS_SetUtilDiagCmd_Test_MsgLengthError");
+} /* end HS_SetCoreUtilParamsCmd_Test_Nominal */
+
+void HS_SetCoreUtilParamsCmd_Test_InvalidCore(void)
+{
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    UT_CmdBuf.SetCoreUtilParamsCmd.Core  = HS_UTIL_NUM_CORES;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult1 = 1;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult2 = 2;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Div   = 3;
+
+    /* Execute the function being tested */
+    HS_SetCoreUtilParamsCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_CORE_UTIL_PARAMS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetCoreUtilParamsCmd_Test_InvalidCore */
+
+void HS_SetCoreUtilParamsCmd_Test_ZeroParam(void)
+{
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    UT_CmdBuf.SetCoreUtilParamsCmd.Core  = 0;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult1 = 1;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult2 = 2;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Div   = 0;
+
+    /* Execute the function being tested */
+    HS_SetCoreUtilParamsCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilDiv, 0);
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_CORE_UTIL_PARAMS_ERR_EID);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetCoreUtilParamsCmd_Test_ZeroParam */
+
+void HS_SetCoreUtilParamsCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    UT_CmdBuf.SetCoreUtilParamsCmd.Core  = 0;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult1 = 1;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Mult2 = 2;
+    UT_CmdBuf.SetCoreUtilParamsCmd.Div   = 3;
+
+    /* Execute the function being tested */
+    HS_SetCoreUtilParamsCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(HS_CustomData.Core[0].UtilMult1, 0);
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_SetCoreUtilParamsCmd_Test_MsgLengthError */
+
+void HS_SetUtilBackendCmd_Test_Nominal(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Utilization backend set to %%d");
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    HS_CustomData.UtilBackend           = HS_UTIL_BACKEND_IDLE_COUNT;
+    UT_CmdBuf.SetUtilBackendCmd.Backend = HS_UTIL_BACKEND_PROC_STAT;
+
+    /* Execute the function being tested */
+    HS_SetUtilBackendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the Idle Tasks are no longer needed */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilBackend, HS_UTIL_BACKEND_PROC_STAT);
+    UtAssert_True(HS_CustomData.IdleTaskRunStatus == !CFE_SUCCESS, "HS_CustomData.IdleTaskRunStatus == !CFE_SUCCESS");
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, HS_UTIL_NUM_CORES);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_BACKEND_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_SetUtilBackendCmd_Test_Nominal */
+
+void HS_SetUtilBackendCmd_Test_Unchanged(void)
+{
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    HS_CustomData.UtilBackend           = HS_UTIL_BACKEND_IDLE_COUNT;
+    UT_CmdBuf.SetUtilBackendCmd.Backend = HS_UTIL_BACKEND_IDLE_COUNT;
+
+    /* Execute the function being tested */
+    HS_SetUtilBackendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the Idle Tasks are left running */
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SET_UTIL_BACKEND_DBG_EID);
+
+} /* end HS_SetUtilBackendCmd_Test_Unchanged */
+
+void HS_SetUtilBackendCmd_Test_Invalid(void)
+{
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    UT_CmdBuf.SetUtilBackendCmd.Backend = HS_UTIL_BACKEND_LAST + 1;
+
+    /* Execute the function being tested */
+    HS_SetUtilBackendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilBackend, HS_UTIL_BACKEND_IDLE_COUNT);
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_BACKEND_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_SetUtilBackendCmd_Test_Invalid */
+
+void HS_SetUtilBackendCmd_Test_NotAvailable(void)
+{
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_ReadProcStat), CFE_STATUS_NOT_IMPLEMENTED);
+
+    HS_CustomData.UtilBackend           = HS_UTIL_BACKEND_IDLE_COUNT;
+    UT_CmdBuf.SetUtilBackendCmd.Backend = HS_UTIL_BACKEND_PROC_STAT;
+
+    /* Execute the function being tested */
+    HS_SetUtilBackendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the previous backend is restarted */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilBackend, HS_UTIL_BACKEND_IDLE_COUNT);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, HS_UTIL_NUM_CORES);
+    UtAssert_INT32_EQ(HS_CustomData.IdleTaskRunStatus, CFE_SUCCESS);
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_BACKEND_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_SetUtilBackendCmd_Test_NotAvailable */
+
+void HS_SetUtilBackendCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    UT_CmdBuf.SetUtilBackendCmd.Backend = HS_UTIL_BACKEND_PROC_STAT;
+
+    /* Execute the function being tested */
+    HS_SetUtilBackendCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.UtilBackend, HS_UTIL_BACKEND_IDLE_COUNT);
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_SetUtilBackendCmd_Test_MsgLengthError */
+
+void HS_StartUtilCalCmd_Test_Nominal(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Utilization Calibration started over %%d intervals: SaveToCDS: %%d TrackPeak: %%d");
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    HS_CustomData.Core[0].CalPeak          = 1234;
+    UT_CmdBuf.StartUtilCalCmd.NumIntervals = 0;
+    UT_CmdBuf.StartUtilCalCmd.SaveToCDS    = 1;
+    UT_CmdBuf.StartUtilCalCmd.TrackPeak    = 0;
+
+    /* Execute the function being tested */
+    HS_StartUtilCalCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.CalIntervalsLeft, HS_UTIL_CAL_DEFAULT_INTERVALS);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalPeak, 0);
+    UtAssert_BOOL_TRUE(HS_CustomData.CalSaveToCDS);
+    UtAssert_BOOL_FALSE(HS_CustomData.CalTrackPeak);
+    UtAssert_True(HS_AppData.CmdCount == 1, "HS_AppData.CmdCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_CAL_START_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_StartUtilCalCmd_Test_Nominal */
+
+void HS_StartUtilCalCmd_Test_Backend(void)
+{
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), true);
+
+    HS_CustomData.UtilBackend              = HS_UTIL_BACKEND_THREAD_TIME;
+    UT_CmdBuf.StartUtilCalCmd.NumIntervals = 5;
+
+    /* Execute the function being tested */
+    HS_StartUtilCalCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.CalIntervalsLeft, 0);
+    UtAssert_True(HS_AppData.CmdErrCount == 1, "HS_AppData.CmdErrCount == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_CAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_StartUtilCalCmd_Test_Backend */
+
+void HS_StartUtilCalCmd_Test_MsgLengthError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(HS_VerifyMsgLength), false);
+
+    UT_CmdBuf.StartUtilCalCmd.NumIntervals = 5;
+
+    /* Execute the function being tested */
+    HS_StartUtilCalCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.CalIntervalsLeft, 0);
+    UtAssert_True(HS_AppData.CmdCount == 0, "HS_AppData.CmdCount == 0");
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_StartUtilCalCmd_Test_MsgLengthError */
+
+void HS_UtilCalUpdate_Test_Complete(void)
+{
+    uint32 i;
+
+    HS_CustomData.CalCDSValid = true;
+
+    HS_UtilCalStart(2, true, false);
+
+    /* The peak of the calibration intervals is kept */
+    for (i = 0; i < HS_UTIL_NUM_CORES; i++)
+    {
+        HS_CustomData.Core[i].LastIdleTaskInterval = 4000;
+    }
+
+    /* Execute the function being tested */
+    HS_UtilCalUpdate();
+
+    UtAssert_UINT32_EQ(HS_CustomData.CalIntervalsLeft, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].UtilScale, 0);
+
+    for (i = 0; i < HS_UTIL_NUM_CORES; i++)
+    {
+        HS_CustomData.Core[i].LastIdleTaskInterval = 3000;
+    }
+
+    HS_UtilCalUpdate();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.CalIntervalsLeft, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalIdleRate, 4000);
+    UtAssert_True(HS_CustomData.Core[0].UtilScale == ((uint64)HS_UTIL_PER_INTERVAL_TOTAL << 32) / 4000,
+                  "HS_CustomData.Core[0].UtilScale == (HS_UTIL_PER_INTERVAL_TOTAL << 32) / 4000");
+    UtAssert_UINT32_EQ(HS_CustomData.CalCDSData.IdleRate[0], 4000);
+    UtAssert_UINT32_EQ(HS_CustomData.CalCDSData.IdleRateNot[0], ~4000U);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_CAL_START_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_UTIL_CAL_DONE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1 + HS_UTIL_NUM_CORES);
+
+} /* end HS_UtilCalUpdate_Test_Complete */
+
+void HS_UtilCalUpdate_Test_NoIdle(void)
+{
+    HS_UtilCalApply(0, 2000);
+
+    /* Nothing saved unless requested */
+    HS_CustomData.CalCDSValid = true;
+
+    HS_UtilCalStart(1, false, false);
+
+    /* Execute the function being tested */
+    HS_UtilCalUpdate();
+
+    /* Verify results, the previous calibration is kept */
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalIdleRate, 2000);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_UTIL_CAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1 + HS_UTIL_NUM_CORES);
+
+} /* end HS_UtilCalUpdate_Test_NoIdle */
+
+void HS_UtilCalUpdate_Test_TrackPeak(void)
+{
+    HS_UtilCalApply(0, 1000);
+
+    HS_CustomData.CalTrackPeak = true;
+    HS_CustomData.CalSaveToCDS = true;
+    HS_CustomData.CalCDSValid  = true;
+
+    /* Execute the function being tested */
+    HS_CustomData.Core[0].LastIdleTaskInterval = 1200;
+    HS_UtilCalUpdate();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalIdleRate, 1200);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    /* Lower counts are ignored */
+    HS_CustomData.Core[0].LastIdleTaskInterval = 1100;
+    HS_UtilCalUpdate();
+
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalIdleRate, 1200);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilCalUpdate_Test_TrackPeak */
+
+void HS_UtilCalUpdate_Test_OtherBackend(void)
+{
+    HS_CustomData.UtilBackend      = HS_UTIL_BACKEND_PROC_STAT;
+    HS_CustomData.CalIntervalsLeft = 3;
+
+    HS_CustomData.Core[0].LastIdleTaskInterval = 1000;
+
+    /* Execute the function being tested */
+    HS_UtilCalUpdate();
+
+    /* Verify results, the calibration is abandoned */
+    UtAssert_UINT32_EQ(HS_CustomData.CalIntervalsLeft, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalPeak, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilCalUpdate_Test_OtherBackend */
+
+void HS_UtilCalRestore_Test_Nominal(void)
+{
+    uint32 i;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 1, CFE_ES_CDS_ALREADY_EXISTS);
+
+    /* Contents left in place by the restore stub */
+    for (i = 0; i < HS_UTIL_NUM_CORES; i++)
+    {
+        HS_CustomData.CalCDSData.IdleRate[i]    = 0;
+        HS_CustomData.CalCDSData.IdleRateNot[i] = ~0U;
+    }
+    HS_CustomData.CalCDSData.IdleRate[0]    = 5000;
+    HS_CustomData.CalCDSData.IdleRateNot[0] = ~5000U;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(HS_UtilCalRestore());
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(HS_CustomData.CalCDSValid);
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalIdleRate, 5000);
+    UtAssert_True(HS_CustomData.Core[0].UtilScale != 0, "HS_CustomData.Core[0].UtilScale != 0");
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilCalRestore_Test_Nominal */
+
+void HS_UtilCalRestore_Test_Corrupt(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 1, CFE_ES_CDS_ALREADY_EXISTS);
+
+    HS_CustomData.CalCDSData.IdleRate[0]    = 5000;
+    HS_CustomData.CalCDSData.IdleRateNot[0] = 5000;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(HS_UtilCalRestore());
+
+    /* Verify results, the block is rewritten */
+    UtAssert_UINT32_EQ(HS_CustomData.Core[0].CalIdleRate, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.CalCDSData.IdleRate[0], 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_CAL_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_UtilCalRestore_Test_Corrupt */
+
+void HS_UtilCalRestore_Test_RestoreError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 1, CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RestoreFromCDS), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(HS_UtilCalRestore());
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(HS_CustomData.CalCDSValid);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_CAL_CDS_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_UtilCalRestore_Test_RestoreError */
+
+void HS_UtilCalRestore_Test_New(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(HS_UtilCalRestore());
+
+    /* Verify results, an empty calibration is written */
+    UtAssert_BOOL_TRUE(HS_CustomData.CalCDSValid);
+    UtAssert_UINT32_EQ(HS_CustomData.CalCDSData.IdleRateNot[0], ~0U);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_UtilCalRestore_Test_New */
+
+void HS_UtilCalRestore_Test_RegisterError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RegisterCDS), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(HS_UtilCalRestore());
+
+    /* Verify results, calibrations are not saved */
+    UtAssert_BOOL_FALSE(HS_CustomData.CalCDSValid);
+
+    HS_UtilCalSave();
+
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_CAL_CDS_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_UtilCalRestore_Test_RegisterError */
+
+void HS_PsiStart_Test_Nominal(void)
+{
+    HS_PsiSample_t Samples[HS_PSI_NUM_RESOURCES];
+
+    memset(Samples, 0, sizeof(Samples));
+    Samples[HS_PSI_RESOURCE_MEMORY].Some.TotalUs = 1000;
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), Samples, sizeof(Samples), false);
+
+    HS_CustomData.PsiActiveMask = 1;
+
+    /* Execute the function being tested */
+    HS_PsiStart();
+
+    /* Verify results, every resource is monitored from its first sample */
+    UtAssert_UINT32_EQ(HS_CustomData.PsiAvailableMask, 0x7);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiActiveMask, 0);
+    UtAssert_True(HS_CustomData.PsiLast[HS_PSI_RESOURCE_MEMORY].Some.TotalUs == 1000,
+                  "HS_CustomData.PsiLast[HS_PSI_RESOURCE_MEMORY].Some.TotalUs == 1000");
+    UtAssert_UINT32_EQ(HS_CustomData.PsiLevels[HS_PSI_RESOURCE_CPU].EnterAvg10, 2000);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiLevels[HS_PSI_RESOURCE_CPU].ActionType, HS_ALARM_ACT_EVENT);
+    UtAssert_STUB_COUNT(HS_ReadPsi, HS_PSI_NUM_RESOURCES);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_PsiStart_Test_Nominal */
+
+void HS_PsiStart_Test_Unavailable(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadPsi), 2, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadPsi), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Execute the function being tested */
+    HS_PsiStart();
+
+    /* Verify results, only the CPU is monitored and a single event reports the rest */
+    UtAssert_UINT32_EQ(HS_CustomData.PsiAvailableMask, 0x1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_PSI_UNAVAILABLE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_PsiStart_Test_Unavailable */
+
+void HS_PsiMonitor_Test_Nominal(void)
+{
+    HS_PsiSample_t Sample;
+
+    memset(&Sample, 0, sizeof(Sample));
+    Sample.Some.Avg10   = 150;
+    Sample.Some.Avg60   = 120;
+    Sample.Some.TotalUs = 5000;
+    Sample.Full.Avg10   = 50;
+    Sample.Full.Avg60   = 40;
+    Sample.Full.TotalUs = 0x200000000ULL;
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &Sample, sizeof(Sample), false);
+
+    HS_CustomData.PsiAvailableMask                         = 1U << HS_PSI_RESOURCE_IO;
+    HS_CustomData.PsiLast[HS_PSI_RESOURCE_IO].Some.TotalUs = 2000;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_IO].EnterAvg10 = 2000;
+    HS_CustomData.PsiTlm[HS_PSI_RESOURCE_CPU].SomeStallUs  = 7;
+
+    /* Execute the function being tested */
+    HS_PsiMonitor();
+
+    /* Verify results, only the I/O file is read and its stall times are per interval */
+    UtAssert_STUB_COUNT(HS_ReadPsi, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].SomeAvg10, 150);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].SomeAvg60, 120);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].FullAvg10, 50);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].FullAvg60, 40);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].SomeStallUs, 3000);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].FullStallUs, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_CPU].SomeStallUs, 7);
+    UtAssert_True(HS_CustomData.PsiLast[HS_PSI_RESOURCE_IO].Some.TotalUs == 5000,
+                  "HS_CustomData.PsiLast[HS_PSI_RESOURCE_IO].Some.TotalUs == 5000");
+    UtAssert_UINT32_EQ(HS_CustomData.PsiActiveMask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* A total that went backwards counts as no stall */
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &Sample, sizeof(Sample), false);
+    HS_CustomData.PsiLast[HS_PSI_RESOURCE_IO].Some.TotalUs = 9000;
+
+    HS_PsiMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].SomeStallUs, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].FullStallUs, 0);
+
+} /* end HS_PsiMonitor_Test_Nominal */
+
+void HS_PsiMonitor_Test_Level(void)
+{
+    HS_PsiSample_t High;
+    HS_PsiSample_t Middle;
+    HS_PsiSample_t Low;
+
+    memset(&High, 0, sizeof(High));
+    memset(&Middle, 0, sizeof(Middle));
+    memset(&Low, 0, sizeof(Low));
+    High.Some.Avg10   = 1500;
+    Middle.Some.Avg10 = 800;
+    Low.Some.Avg10    = 400;
+
+    HS_CustomData.PsiAvailableMask                                 = 1U << HS_PSI_RESOURCE_MEMORY;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_MEMORY].EnterAvg10     = 1000;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_MEMORY].ExitAvg10      = 500;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_MEMORY].DwellIntervals = 2;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_MEMORY].ActionType     = HS_ALARM_ACT_EVENT;
+
+    /* A single high interval is not enough, and a dip restarts the dwell */
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &High, sizeof(High), false);
+    HS_PsiMonitor();
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &Middle, sizeof(Middle), false);
+    HS_PsiMonitor();
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &High, sizeof(High), false);
+    HS_PsiMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.PsiActiveMask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Entered on the second consecutive high interval */
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &High, sizeof(High), false);
+    HS_PsiMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.PsiActiveMask, 1U << HS_PSI_RESOURCE_MEMORY);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_PSI_ENTER_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Held between the thresholds */
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &Middle, sizeof(Middle), false);
+    HS_PsiMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.PsiActiveMask, 1U << HS_PSI_RESOURCE_MEMORY);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Cleared below the exit threshold */
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &Low, sizeof(Low), false);
+    HS_PsiMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.PsiActiveMask, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_PSI_EXIT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+} /* end HS_PsiMonitor_Test_Level */
+
+void HS_PsiMonitor_Test_MsgActs(void)
+{
+    HS_PsiSample_t Sample;
+
+    memset(&Sample, 0, sizeof(Sample));
+    Sample.Some.Avg10 = 10000;
+    UT_SetDataBuffer(UT_KEY(HS_ReadPsi), &Sample, sizeof(Sample), false);
+    UT_SetDefaultReturnValue(UT_KEY(HS_ExecuteMsgAction), true);
+
+    HS_CustomData.PsiAvailableMask                              = 1U << HS_PSI_RESOURCE_CPU;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_CPU].EnterAvg10     = 2000;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_CPU].DwellIntervals = 1;
+    HS_CustomData.PsiLevels[HS_PSI_RESOURCE_CPU].ActionType     = HS_ALARM_ACT_LAST_NONMSG + 1;
+
+    /* Execute the function being tested */
+    HS_PsiMonitor();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_CustomData.PsiActiveMask, 1U << HS_PSI_RESOURCE_CPU);
+    UtAssert_STUB_COUNT(HS_ExecuteMsgAction, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_PSI_MSGACTS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_PsiMonitor_Test_MsgActs */
+
+void HS_PsiMonitor_Test_ReadError(void)
+{
+    HS_CustomData.PsiAvailableMask = 1U << HS_PSI_RESOURCE_CPU;
+
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadPsi), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadPsi), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Execute the function being tested */
+    HS_PsiMonitor();
+    HS_PsiMonitor();
+
+    /* Verify results, a run of failures is reported once */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_PSI_READ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* A good read restarts the reporting */
+    HS_PsiMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.PsiErrReportedMask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_PsiMonitor_Test_ReadError */
+
+void HS_PsiGetStats_Test(void)
+{
+    HS_PsiTlm_t Tlm[HS_PSI_NUM_RESOURCES];
+    uint32      AvailableMask = 0;
+    uint32      ActiveMask    = 0;
+
+    HS_CustomData.PsiAvailableMask                     = 0x5;
+    HS_CustomData.PsiActiveMask                        = 0x4;
+    HS_CustomData.PsiTlm[HS_PSI_RESOURCE_IO].SomeAvg10 = 2500;
+
+    /* Execute the function being tested */
+    HS_PsiGetStats(&AvailableMask, &ActiveMask, Tlm);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(AvailableMask, 0x5);
+    UtAssert_UINT32_EQ(ActiveMask, 0x4);
+    UtAssert_UINT32_EQ(Tlm[HS_PSI_RESOURCE_IO].SomeAvg10, 2500);
+
+} /* end HS_PsiGetStats_Test */
+
+void HS_MemStart_Test_Nominal(void)
+{
+    HS_MemSample_t Sample;
+
+    Sample.TotalKb = 1000000;
+    Sample.AvailKb = 600000;
+    Sample.RssKb   = 20000;
+    UT_SetDataBuffer(UT_KEY(HS_ReadMemory), &Sample, sizeof(Sample), false);
+
+    HS_CustomData.MemHistory[0]      = 5;
+    HS_CustomData.MemHistoryNext     = 3;
+    HS_CustomData.MemTlm.HistoryUsed = 3;
+    HS_CustomData.MemTlm.AlarmMask   = HS_MEM_ALARM_LEAK;
+    HS_CustomData.MemErrReported     = true;
+
+    /* Execute the function being tested */
+    HS_MemStart();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(HS_CustomData.MemMonitored);
+    UtAssert_BOOL_FALSE(HS_CustomData.MemErrReported);
+    UtAssert_UINT32_EQ(HS_CustomData.MemHistory[0], 0);
+    UtAssert_UINT32_EQ(HS_CustomData.MemHistoryNext, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.HistoryUsed, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AlarmMask, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.TotalKb, 1000000);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AvailKb, 600000);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.RssKb, 20000);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_MemStart_Test_Nominal */
+
+void HS_MemStart_Test_Unavailable(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadMemory), 1, CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Execute the function being tested */
+    HS_MemStart();
+
+    /* Verify results, later intervals don't read at all */
+    UtAssert_BOOL_FALSE(HS_CustomData.MemMonitored);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEM_UNAVAILABLE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    HS_MemMonitor();
+
+    UtAssert_STUB_COUNT(HS_ReadMemory, 1);
+
+} /* end HS_MemStart_Test_Unavailable */
+
+void HS_MemMonitor_Test_LowAvail(void)
+{
+    HS_MemSample_t Sample;
+
+    Sample.TotalKb = 1000000;
+    Sample.AvailKb = HS_MEM_LOW_AVAIL_KB;
+    Sample.RssKb   = 20000;
+
+    HS_CustomData.MemMonitored = true;
+
+    /* Raised at the threshold */
+    UT_SetDataBuffer(UT_KEY(HS_ReadMemory), &Sample, sizeof(Sample), false);
+    HS_MemMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AvailKb, HS_MEM_LOW_AVAIL_KB);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AlarmMask, HS_MEM_ALARM_LOW_AVAIL);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEM_LOW_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Held until available memory is back above twice the threshold */
+    Sample.AvailKb = 2 * HS_MEM_LOW_AVAIL_KB;
+    UT_SetDataBuffer(UT_KEY(HS_ReadMemory), &Sample, sizeof(Sample), false);
+    HS_MemMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AlarmMask, HS_MEM_ALARM_LOW_AVAIL);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    Sample.AvailKb = (2 * HS_MEM_LOW_AVAIL_KB) + 1;
+    UT_SetDataBuffer(UT_KEY(HS_ReadMemory), &Sample, sizeof(Sample), false);
+    HS_MemMonitor();
+
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AlarmMask, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MEM_CLEAR_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+} /* end HS_MemMonitor_Test_LowAvail */
+
+void HS_MemMonitor_Test_Leak(void)
+{
+    HS_MemSample_t Sample;
+    uint32         SampleNum;
+    uint32         Interval;
+
+    Sample.TotalKb = 1000000;
+    Sample.AvailKb = 600000;
+
+    HS_CustomData.MemMonitored = true;
+
+    /* Grow by the leak threshold every history sample */
+    for (SampleNum = 0; SampleNum < HS_MEM_HISTORY_SIZE; SampleNum++)
+    {
+        Sample.RssKb = 20000 + (SampleNum * HS_MEM_LEAK_GROWTH_KB);
+
+        for (Interval = 0; Interval < HS_MEM_HISTORY_INTERVALS; Interval++)
+        {
+            UT_SetDataBuffer(UT_KEY(HS_ReadMemory), &Sample, sizeof(Sample), false);
+            HS_MemMonitor();
+        }
+
+        if (SampleNum == 0)
+        {
+            UtAssert_UINT32_EQ(HS_CustomData.MemTlm.HistoryUsed, 1);
+            UtAssert_UINT32_EQ(HS_CustomData.MemHistory[0], 20000);
+        }
+    }
+
+    /* Verify results, raised once the history is full */
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.HistoryUsed, HS_MEM_HISTORY_SIZE);
+    UtAssert_INT32_EQ(HS_CustomData.MemTlm.RssGrowthKb, HS_MEM_LEAK_GROWTH_KB);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AlarmMask, HS_MEM_ALARM_LEAK);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEM_LEAK_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Cleared once the growth falls below half the threshold */
+    for (SampleNum = 0; SampleNum < HS_MEM_HISTORY_SIZE; SampleNum++)
+    {
+        HS_CustomData.MemHistory[SampleNum] = 20000;
+    }
+
+    HS_CustomData.MemIntervals = HS_MEM_HISTORY_INTERVALS - 1;
+    HS_CustomData.MemRssSum    = (uint64)20000 * (HS_MEM_HISTORY_INTERVALS - 1);
+    Sample.RssKb               = 20000;
+    UT_SetDataBuffer(UT_KEY(HS_ReadMemory), &Sample, sizeof(Sample), false);
+    HS_MemMonitor();
+
+    UtAssert_INT32_EQ(HS_CustomData.MemTlm.RssGrowthKb, 0);
+    UtAssert_UINT32_EQ(HS_CustomData.MemTlm.AlarmMask, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MEM_CLEAR_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+} /* end HS_MemMonitor_Test_Leak */
+
+void HS_MemMonitor_Test_ReadError(void)
+{
+    HS_CustomData.MemMonitored = true;
+
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadMemory), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadMemory), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Execute the function being tested */
+    HS_MemMonitor();
+    HS_MemMonitor();
+
+    /* Verify results, a run of failures is reported once and not sampled */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEM_READ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_UINT32_EQ(HS_CustomData.MemIntervals, 0);
+
+    /* A good read restarts the reporting */
+    HS_MemMonitor();
+
+    UtAssert_BOOL_FALSE(HS_CustomData.MemErrReported);
+    UtAssert_UINT32_EQ(HS_CustomData.MemIntervals, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_MemMonitor_Test_ReadError */
+
+void HS_MemHistoryGrowth_Test(void)
+{
+    uint32 Age;
+
+    /* The oldest sample is the next one to write, so the fit follows the wrap */
+    HS_CustomData.MemHistoryNext = 5;
+
+    for (Age = 0; Age < HS_MEM_HISTORY_SIZE; Age++)
+    {
+        HS_CustomData.MemHistory[(Age + 5) % HS_MEM_HISTORY_SIZE] = 50000 + (100 * Age);
+    }
+
+    UtAssert_INT32_EQ(HS_MemHistoryGrowth(), 100);
+
+    for (Age = 0; Age < HS_MEM_HISTORY_SIZE; Age++)
+    {
+        HS_CustomData.MemHistory[(Age + 5) % HS_MEM_HISTORY_SIZE] = 50000 - (100 * Age);
+    }
+
+    UtAssert_INT32_EQ(HS_MemHistoryGrowth(), -100);
+
+} /* end HS_MemHistoryGrowth_Test */
+
+void HS_MemAlarmAction_Test(void)
+{
+    HS_CustomData.MemTlm.AvailKb     = 1024;
+    HS_CustomData.MemTlm.RssKb       = 90000;
+    HS_CustomData.MemTlm.RssGrowthKb = 512;
+
+    /* Execute the function being tested */
+    HS_MemAlarmAction(HS_MEM_ALARM_LOW_AVAIL);
+    HS_MemAlarmAction(HS_MEM_ALARM_LEAK);
+
+    /* Verify results, each alarm takes its own configured action */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MEM_LOW_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MEM_LEAK_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(HS_ExecuteMsgAction, 0);
+
+} /* end HS_MemAlarmAction_Test */
+
+void HS_MemGetStats_Test(void)
+{
+    HS_MemTlm_t Tlm;
+
+    memset(&Tlm, 0, sizeof(Tlm));
+    HS_CustomData.MemTlm.RssKb       = 30000;
+    HS_CustomData.MemTlm.RssGrowthKb = -12;
+    HS_CustomData.MemTlm.AlarmMask   = HS_MEM_ALARM_LEAK;
+
+    /* Execute the function being tested */
+    HS_MemGetStats(&Tlm);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Tlm.RssKb, 30000);
+    UtAssert_INT32_EQ(Tlm.RssGrowthKb, -12);
+    UtAssert_UINT32_EQ(Tlm.AlarmMask, HS_MEM_ALARM_LEAK);
+
+} /* end HS_MemGetStats_Test */
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(HS_IdleTask_Test, HS_Test_Setup, HS_Test_TearDown, "HS_IdleTask_Test");
+    UtTest_Add(HS_IdleTask_Test_Stopped, HS_Test_Setup, HS_Test_TearDown, "HS_IdleTask_Test_Stopped");
+
+    UtTest_Add(HS_IdleTaskCoreIndex_Test_WaitForID, HS_Test_Setup, HS_Test_TearDown,
+               "HS_IdleTaskCoreIndex_Test_WaitForID");
+
+    UtTest_Add(HS_CustomInit_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_CustomInit_Test_Nominal");
+    UtTest_Add(HS_CustomInit_Test_CreateChildTaskError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomInit_Test_CreateChildTaskError");
+    UtTest_Add(HS_CustomInit_Test_RegisterSynchCallbackError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomInit_Test_RegisterSynchCallbackError");
+
+    UtTest_Add(HS_CustomCleanup_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomCleanup_Test");
+
+    UtTest_Add(HS_UtilizationIncrement_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationIncrement_Test");
+
+    UtTest_Add(HS_UtilizationMark_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationMark_Test");
+    UtTest_Add(HS_UtilizationMark_Test_Jitter, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationMark_Test_Jitter");
+
+    UtTest_Add(HS_MarkIdleCallback_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MarkIdleCallback_Test");
+    UtTest_Add(HS_MarkTimerCallback_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MarkTimerCallback_Test");
+
+    UtTest_Add(HS_UtilMarkStart_Test_TimeSync, HS_Test_Setup, HS_Test_TearDown, "HS_UtilMarkStart_Test_TimeSync");
+    UtTest_Add(HS_UtilMarkStart_Test_Timer, HS_Test_Setup, HS_Test_TearDown, "HS_UtilMarkStart_Test_Timer");
+    UtTest_Add(HS_UtilMarkStart_Test_TimerCreateError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilMarkStart_Test_TimerCreateError");
+    UtTest_Add(HS_UtilMarkStart_Test_TimerSetError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilMarkStart_Test_TimerSetError");
+    UtTest_Add(HS_UtilMarkStart_Test_Wakeup, HS_Test_Setup, HS_Test_TearDown, "HS_UtilMarkStart_Test_Wakeup");
+    UtTest_Add(HS_UtilMarkStart_Test_Message, HS_Test_Setup, HS_Test_TearDown, "HS_UtilMarkStart_Test_Message");
+    UtTest_Add(HS_UtilMarkStart_Test_MessageSubscribeError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilMarkStart_Test_MessageSubscribeError");
+    UtTest_Add(HS_UtilMarkStop_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilMarkStop_Test");
+    UtTest_Add(HS_UtilMarkJitter_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilMarkJitter_Test");
+    UtTest_Add(HS_UtilMarkGetStats_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilMarkGetStats_Test");
+    UtTest_Add(HS_CustomMarkPoll_Test_Marks, HS_Test_Setup, HS_Test_TearDown, "HS_CustomMarkPoll_Test_Marks");
+    UtTest_Add(HS_CustomMarkPoll_Test_NoMark, HS_Test_Setup, HS_Test_TearDown, "HS_CustomMarkPoll_Test_NoMark");
+
+    UtTest_Add(HS_CustomMonitorUtilization_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomMonitorUtilization_Test");
+    UtTest_Add(HS_CustomMonitorUtilization_Test_WakeupMark, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomMonitorUtilization_Test_WakeupMark");
+    UtTest_Add(HS_CustomMonitorUtilization_Test_MessageMark, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomMonitorUtilization_Test_MessageMark");
+
+    UtTest_Add(HS_CustomCommands_Test_UtilDiagReport, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomCommands_Test_UtilDiagReport");
+    UtTest_Add(HS_CustomCommands_Test_SetUtilParamsCmd, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomCommands_Test_SetUtilParamsCmd");
+    UtTest_Add(HS_CustomCommands_Test_SetUtilDiagCmd, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomCommands_Test_SetUtilDiagCmd");
+    UtTest_Add(HS_CustomCommands_Test_SetCoreUtilParamsCmd, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomCommands_Test_SetCoreUtilParamsCmd");
+    UtTest_Add(HS_CustomCommands_Test_InvalidCommandCode, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomCommands_Test_InvalidCommandCode");
+
+    UtTest_Add(HS_UtilDiagReport_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilDiagReport_Test");
+    UtTest_Add(HS_UtilDiagReport_Test_Loops, HS_Test_Setup, HS_Test_TearDown, "HS_UtilDiagReport_Test_Loops");
+    UtTest_Add(HS_UtilDiagReport_Test_Overflow, HS_Test_Setup, HS_Test_TearDown, "HS_UtilDiagReport_Test_Overflow");
+    UtTest_Add(HS_UtilDiagSort_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilDiagSort_Test");
+
+    UtTest_Add(HS_CustomGetUtil_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomGetUtil_Test");
+    UtTest_Add(HS_CustomGetUtil_Test_DivZero, HS_Test_Setup, HS_Test_TearDown, "HS_CustomGetUtil_Test_DivZero");
+    UtTest_Add(HS_CustomGetCoreUtil_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomGetCoreUtil_Test");
+    UtTest_Add(HS_CustomGetCoreUtil_Test_Calibrated, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomGetCoreUtil_Test_Calibrated");
+
+    UtTest_Add(HS_SetUtilParamsCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilParamsCmd_Test_Nominal");
+    UtTest_Add(HS_SetUtilParamsCmd_Test_NominalMultZero, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilParamsCmd_Test_NominalMultZero");
+    UtTest_Add(HS_SetUtilParamsCmd_Test_NominalDivZero, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilParamsCmd_Test_NominalDivZero");
+    UtTest_Add(HS_SetUtilParamsCmd_Test_Error, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilParamsCmd_Test_Error");
+    UtTest_Add(HS_SetUtilParamsCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilParamsCmd_Test_MsgLengthError");
+
+    UtTest_Add(HS_SetUtilDiagCmd_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilDiagCmd_Test");
+    UtTest_Add(HS_SetUtilDiagCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilDiagCmd_Test_MsgLengthError");
+
+    UtTest_Add(HS_SetCoreUtilParamsCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetCoreUtilParamsCmd_Test_Nominal");
+    UtTest_Add(HS_SetCoreUtilParamsCmd_Test_InvalidCore, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetCoreUtilParamsCmd_Test_InvalidCore");
+    UtTest_Add(HS_SetCoreUtilParamsCmd_Test_ZeroParam, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetCoreUtilParamsCmd_Test_ZeroParam");
+    UtTest_Add(HS_SetCoreUtilParamsCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetCoreUtilParamsCmd_Test_MsgLengthError");
+
+    UtTest_Add(HS_CustomCleanup_Test_ProcStat, HS_Test_Setup, HS_Test_TearDown, "HS_CustomCleanup_Test_ProcStat");
+    UtTest_Add(HS_CustomStopIdleTasks_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomStopIdleTasks_Test");
+
+    UtTest_Add(HS_UtilBackendStart_Test_ProcStat, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilBackendStart_Test_ProcStat");
+    UtTest_Add(HS_UtilBackendStart_Test_ThreadTime, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilBackendStart_Test_ThreadTime");
+    UtTest_Add(HS_UtilBackendStart_Test_NotAvailable, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilBackendStart_Test_NotAvailable");
+
+    UtTest_Add(HS_UtilBackendSample_Test_ProcStat, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilBackendSample_Test_ProcStat");
+    UtTest_Add(HS_UtilBackendSample_Test_ThreadTime, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilBackendSample_Test_ThreadTime");
+    UtTest_Add(HS_UtilBackendSample_Test_Error, HS_Test_Setup, HS_Test_TearDown, "HS_UtilBackendSample_Test_Error");
+    UtTest_Add(HS_UtilBackendSample_Test_ThreadTimeError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilBackendSample_Test_ThreadTimeError");
+
+    UtTest_Add(HS_CustomCommands_Test_SetUtilBackendCmd, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomCommands_Test_SetUtilBackendCmd");
+    UtTest_Add(HS_CustomCommands_Test_StartUtilCalCmd, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CustomCommands_Test_StartUtilCalCmd");
+
+    UtTest_Add(HS_SetUtilBackendCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilBackendCmd_Test_Nominal");
+    UtTest_Add(HS_SetUtilBackendCmd_Test_Unchanged, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilBackendCmd_Test_Unchanged");
+    UtTest_Add(HS_SetUtilBackendCmd_Test_Invalid, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilBackendCmd_Test_Invalid");
+    UtTest_Add(HS_SetUtilBackendCmd_Test_NotAvailable, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilBackendCmd_Test_NotAvailable");
+    UtTest_Add(HS_SetUtilBackendCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_SetUtilBackendCmd_Test_MsgLengthError");
+    UtTest_Add(HS_StartUtilCalCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_StartUtilCalCmd_Test_Nominal");
+    UtTest_Add(HS_StartUtilCalCmd_Test_Backend, HS_Test_Setup, HS_Test_TearDown, "HS_StartUtilCalCmd_Test_Backend");
+    UtTest_Add(HS_StartUtilCalCmd_Test_MsgLengthError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_StartUtilCalCmd_Test_MsgLengthError");
+    UtTest_Add(HS_UtilCalUpdate_Test_Complete, HS_Test_Setup, HS_Test_TearDown, "HS_UtilCalUpdate_Test_Complete");
+    UtTest_Add(HS_UtilCalUpdate_Test_NoIdle, HS_Test_Setup, HS_Test_TearDown, "HS_UtilCalUpdate_Test_NoIdle");
+    UtTest_Add(HS_UtilCalUpdate_Test_TrackPeak, HS_Test_Setup, HS_Test_TearDown, "HS_UtilCalUpdate_Test_TrackPeak");
+    UtTest_Add(HS_UtilCalUpdate_Test_OtherBackend, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilCalUpdate_Test_OtherBackend");
+    UtTest_Add(HS_UtilCalRestore_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_UtilCalRestore_Test_Nominal");
+    UtTest_Add(HS_UtilCalRestore_Test_Corrupt, HS_Test_Setup, HS_Test_TearDown, "HS_UtilCalRestore_Test_Corrupt");
+    UtTest_Add(HS_UtilCalRestore_Test_RestoreError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilCalRestore_Test_RestoreError");
+    UtTest_Add(HS_UtilCalRestore_Test_New, HS_Test_Setup, HS_Test_TearDown, "HS_UtilCalRestore_Test_New");
+    UtTest_Add(HS_UtilCalRestore_Test_RegisterError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_UtilCalRestore_Test_RegisterError");
+    UtTest_Add(HS_PsiStart_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_PsiStart_Test_Nominal");
+    UtTest_Add(HS_PsiStart_Test_Unavailable, HS_Test_Setup, HS_Test_TearDown, "HS_PsiStart_Test_Unavailable");
+    UtTest_Add(HS_PsiMonitor_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_PsiMonitor_Test_Nominal");
+    UtTest_Add(HS_PsiMonitor_Test_Level, HS_Test_Setup, HS_Test_TearDown, "HS_PsiMonitor_Test_Level");
+    UtTest_Add(HS_PsiMonitor_Test_MsgActs, HS_Test_Setup, HS_Test_TearDown, "HS_PsiMonitor_Test_MsgActs");
+    UtTest_Add(HS_PsiMonitor_Test_ReadError, HS_Test_Setup, HS_Test_TearDown, "HS_PsiMonitor_Test_ReadError");
+    UtTest_Add(HS_PsiGetStats_Test, HS_Test_Setup, HS_Test_TearDown, "HS_PsiGetStats_Test");
+
+    UtTest_Add(HS_MemStart_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_MemStart_Test_Nominal");
+    UtTest_Add(HS_MemStart_Test_Unavailable, HS_Test_Setup, HS_Test_TearDown, "HS_MemStart_Test_Unavailable");
+    UtTest_Add(HS_MemMonitor_Test_LowAvail, HS_Test_Setup, HS_Test_TearDown, "HS_MemMonitor_Test_LowAvail");
+    UtTest_Add(HS_MemMonitor_Test_Leak, HS_Test_Setup, HS_Test_TearDown, "HS_MemMonitor_Test_Leak");
+    UtTest_Add(HS_MemMonitor_Test_ReadError, HS_Test_Setup, HS_Test_TearDown, "HS_MemMonitor_Test_ReadError");
+    UtTest_Add(HS_MemHistoryGrowth_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MemHistoryGrowth_Test");
+    UtTest_Add(HS_MemAlarmAction_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MemAlarmAction_Test");
+    UtTest_Add(HS_MemGetStats_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MemGetStats_Test");
 
 } /* end UtTest_Setup */
 
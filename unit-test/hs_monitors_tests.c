@@ -910,6 +910,8 @@ void HS_MonitorEvent_Test_AppName(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     /* Active table entry where AppName does not match event */
@@ -957,6 +959,8 @@ void HS_MonitorEvent_Test_ProcErrorReset(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_PROC_RESET;
@@ -1015,6 +1019,8 @@ void HS_MonitorEvent_Test_ProcErrorNoReset(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_PROC_RESET;
@@ -1074,6 +1080,8 @@ void HS_MonitorEvent_Test_AppRestartErrors(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_APP_RESTART;
@@ -1132,6 +1140,8 @@ void HS_MonitorEvent_Test_OnlySecondAppRestartError(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_APP_RESTART;
@@ -1182,6 +1192,8 @@ void HS_MonitorEvent_Test_NoSecondAppRestartError(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_APP_RESTART;
@@ -1234,6 +1246,8 @@ void HS_MonitorEvent_Test_DeleteErrors(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_APP_DELETE;
@@ -1292,6 +1306,8 @@ void HS_MonitorEvent_Test_OnlySecondDeleteError(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_APP_DELETE;
@@ -1342,6 +1358,8 @@ void HS_MonitorEvent_Test_NoSecondDeleteError(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_APP_DELETE;
@@ -1392,6 +1410,8 @@ void HS_MonitorEvent_Test_MsgActsError(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + 1;
@@ -1445,6 +1465,8 @@ void HS_MonitorEvent_Test_MsgActsErrorNoEvent(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + 1;
@@ -1489,6 +1511,8 @@ void HS_MonitorEvent_Test_MsgActsDefaultDisabled(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
@@ -1529,6 +1553,8 @@ void HS_MonitorEvent_Test_MsgActsDefaultGreaterLastNonMsg(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
@@ -1569,6 +1595,8 @@ void HS_MonitorEvent_Test_MsgActsDefaultLessMaxActTypes(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
@@ -1605,6 +1633,8 @@ void HS_MonitorEvent_Test_MsgActsDefaultMaxActTypes(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType            = HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES;
@@ -1645,6 +1675,8 @@ void HS_MonitorEvent_Test_MsgActsCoolDown(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + 1;
@@ -1687,6 +1719,8 @@ void HS_MonitorEvent_Test_MsgActsMATDisabled(void)
     Packet.Payload.PacketID.EventID = 3;
 
     HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
     HS_AppData.MATablePtr = MATable;
 
     HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_LAST_NONMSG + 1;
@@ -1713,12 +1747,198 @@ void HS_MonitorEvent_Test_MsgActsMATDisabled(void)
 
 } /* end HS_MonitorEvent_Test_MsgActsMATDisabled */
 
+void HS_MonitorEvent_Test_ProcessorMismatch(void)
+{
+    HS_EMTEntry_t          EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_MATEntry_t          MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_EVS_LongEventTlm_t Packet;
+
+    memset(EMTable, 0, sizeof(EMTable));
+    memset(MATable, 0, sizeof(MATable));
+    memset(&Packet, 0, sizeof(Packet));
+
+    CFE_MSG_Init((CFE_MSG_Message_t *)&Packet, CFE_SB_ValueToMsgId(HS_CMD_MID), sizeof(CFE_EVS_LongEventTlm_t));
+
+    Packet.Payload.PacketID.EventID     = 3;
+    Packet.Payload.PacketID.ProcessorID = 2;
+    strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
+
+    HS_AppData.EMTablePtr = EMTable;
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
+    HS_AppData.MATablePtr = MATable;
+
+    /* Matching entry qualified for another processor */
+    HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_PROC_RESET;
+    HS_AppData.EMTablePtr[0].EventID    = Packet.Payload.PacketID.EventID;
+    HS_AppData.CDSData.MaxResets        = 10;
+    HS_AppData.CDSData.ResetsPerformed  = 1;
+
+    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
+
+    /* Spacecraft qualifier matches, processor qualifier does not */
+    UT_SetDeferredRetcode(UT_KEY(HS_EMTQualifierMatches), 2, false);
+
+    /* Execute the function being tested */
+    HS_MonitorEvent(&Packet);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.ServiceWatchdogFlag != HS_STATE_DISABLED,
+                  "HS_AppData.ServiceWatchdogFlag != HS_STATE_DISABLED");
+
+    UtAssert_True(HS_AppData.ProcEventCountsUsed == 1, "HS_AppData.ProcEventCountsUsed == 1");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorEvent_Test_ProcessorMismatch */
+
+void HS_MonitorEvent_Test_EntryDisabled(void)
+{
+    HS_EMTEntry_t          EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_MATEntry_t          MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_EVS_LongEventTlm_t Packet;
+
+    memset(EMTable, 0, sizeof(EMTable));
+    memset(MATable, 0, sizeof(MATable));
+    memset(&Packet, 0, sizeof(Packet));
+
+    CFE_MSG_Init((CFE_MSG_Message_t *)&Packet, CFE_SB_ValueToMsgId(HS_CMD_MID), sizeof(CFE_EVS_LongEventTlm_t));
+
+    Packet.Payload.PacketID.EventID = 3;
+    strncpy(Packet.Payload.PacketID.AppName, "AppName", 10);
+
+    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.MATablePtr = MATable;
+
+    /* Matching entry whose enable bit is cleared */
+    HS_AppData.EMTablePtr[0].ActionType = HS_EMT_ACT_PROC_RESET;
+    HS_AppData.EMTablePtr[0].EventID    = Packet.Payload.PacketID.EventID;
+    HS_AppData.CDSData.MaxResets        = 10;
+    HS_AppData.CDSData.ResetsPerformed  = 1;
+
+    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
+
+    memset(HS_AppData.EventMonEnables, 0xFF, sizeof(HS_AppData.EventMonEnables));
+    CFE_CLR(HS_AppData.EventMonEnables[0], 0);
+
+    /* Execute the function being tested */
+    HS_MonitorEvent(&Packet);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.ServiceWatchdogFlag != HS_STATE_DISABLED,
+                  "HS_AppData.ServiceWatchdogFlag != HS_STATE_DISABLED");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorEvent_Test_EntryDisabled */
+
+void HS_ExecuteMsgAction_Test_Sent(void)
+{
+    HS_MATEntry_t MATable[HS_MAX_MSG_ACT_TYPES];
+
+    memset(MATable, 0, sizeof(MATable));
+
+    HS_AppData.MATablePtr   = MATable;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+
+    HS_AppData.MATablePtr[1].EnableState = HS_MAT_STATE_ENABLED;
+    HS_AppData.MATablePtr[1].Cooldown    = 5;
+    HS_AppData.MATablePtr[2].EnableState = HS_MAT_STATE_NOEVENT;
+    HS_AppData.MATablePtr[2].Cooldown    = 7;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(HS_ExecuteMsgAction(1));
+    UtAssert_BOOL_FALSE(HS_ExecuteMsgAction(2));
+
+    /* Verify results, both messages go out but only the first asks for an event */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 2);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActCooldown[1], 5);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActCooldown[2], 7);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_ExecuteMsgAction_Test_Sent */
+
+void HS_ExecuteMsgAction_Test_NotSent(void)
+{
+    HS_MATEntry_t MATable[HS_MAX_MSG_ACT_TYPES];
+
+    memset(MATable, 0, sizeof(MATable));
+
+    HS_AppData.MATablePtr = MATable;
+
+    HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
+    HS_AppData.MATablePtr[1].EnableState = HS_MAT_STATE_DISABLED;
+
+    /* Message actions disabled */
+    HS_AppData.MsgActsState = HS_STATE_DISABLED;
+    UtAssert_BOOL_FALSE(HS_ExecuteMsgAction(0));
+
+    /* Index out of range */
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    UtAssert_BOOL_FALSE(HS_ExecuteMsgAction(HS_MAX_MSG_ACT_TYPES));
+
+    /* Entry disabled */
+    UtAssert_BOOL_FALSE(HS_ExecuteMsgAction(1));
+
+    /* Entry cooling down */
+    HS_AppData.MsgActCooldown[0] = 1;
+    UtAssert_BOOL_FALSE(HS_ExecuteMsgAction(0));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActCooldown[0], 1);
+
+} /* end HS_ExecuteMsgAction_Test_NotSent */
+
+void HS_CountProcessorEvent_Test_NewAndExisting(void)
+{
+    /* Execute the function being tested */
+    HS_CountProcessorEvent(42, 1);
+    HS_CountProcessorEvent(42, 2);
+    HS_CountProcessorEvent(42, 1);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.ProcEventCountsUsed == 2, "HS_AppData.ProcEventCountsUsed == 2");
+    UtAssert_True(HS_AppData.ProcEventCounts[0].SpacecraftID == 42, "HS_AppData.ProcEventCounts[0].SpacecraftID == 42");
+    UtAssert_True(HS_AppData.ProcEventCounts[0].ProcessorID == 1, "HS_AppData.ProcEventCounts[0].ProcessorID == 1");
+    UtAssert_True(HS_AppData.ProcEventCounts[0].EventCount == 2, "HS_AppData.ProcEventCounts[0].EventCount == 2");
+    UtAssert_True(HS_AppData.ProcEventCounts[1].ProcessorID == 2, "HS_AppData.ProcEventCounts[1].ProcessorID == 2");
+    UtAssert_True(HS_AppData.ProcEventCounts[1].EventCount == 1, "HS_AppData.ProcEventCounts[1].EventCount == 1");
+    UtAssert_True(HS_AppData.ProcEventOverflowCount == 0, "HS_AppData.ProcEventOverflowCount == 0");
+
+} /* end HS_CountProcessorEvent_Test_NewAndExisting */
+
+void HS_CountProcessorEvent_Test_Overflow(void)
+{
+    uint32 ProcIndex;
+
+    for (ProcIndex = 0; ProcIndex < HS_MAX_EVENT_PROCESSORS; ProcIndex++)
+    {
+        HS_CountProcessorEvent(42, ProcIndex);
+    }
+
+    /* Execute the function being tested */
+    HS_CountProcessorEvent(42, HS_MAX_EVENT_PROCESSORS);
+
+    /* Verify results */
+    UtAssert_True(HS_AppData.ProcEventCountsUsed == HS_MAX_EVENT_PROCESSORS,
+                  "HS_AppData.ProcEventCountsUsed == HS_MAX_EVENT_PROCESSORS");
+    UtAssert_True(HS_AppData.ProcEventOverflowCount == 1, "HS_AppData.ProcEventOverflowCount == 1");
+
+} /* end HS_CountProcessorEvent_Test_Overflow */
+
 void HS_MonitorUtilization_Test_HighCurrentUtil(void)
 {
-    HS_CustomData.LastIdleTaskInterval = 1;
-    HS_CustomData.UtilMult1            = -3;
-    HS_CustomData.UtilMult2            = 1;
-    HS_CustomData.UtilDiv              = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 1;
+    HS_CustomData.Core[0].UtilMult1            = -3;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
 
     HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL - 2;
 
@@ -1742,10 +1962,10 @@ void HS_MonitorUtilization_Test_HighCurrentUtil(void)
 
 void HS_MonitorUtilization_Test_CurrentUtilLessThanZero(void)
 {
-    HS_CustomData.LastIdleTaskInterval = 1;
-    HS_CustomData.UtilMult1            = HS_UTIL_PER_INTERVAL_TOTAL + 1;
-    HS_CustomData.UtilMult2            = 1;
-    HS_CustomData.UtilDiv              = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 1;
+    HS_CustomData.Core[0].UtilMult1            = HS_UTIL_PER_INTERVAL_TOTAL + 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
 
     HS_AppData.CurrentCPUUtilIndex = 0;
 
@@ -1772,17 +1992,19 @@ void HS_MonitorUtilization_Test_CPUHogging(void)
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "CPU Hogging Detected");
     snprintf(ExpectedSysLogString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "HS App: CPU Hogging Detected\n");
 
-    HS_CustomData.LastIdleTaskInterval = 0;
-    HS_CustomData.UtilMult1            = 1;
-    HS_CustomData.UtilMult2            = 1;
-    HS_CustomData.UtilDiv              = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 0;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
 
     HS_AppData.CurrentCPUHogState = HS_STATE_ENABLED;
     HS_AppData.MaxCPUHoggingTime  = 1;
 
-    HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL;
+    HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL - 1;
 
     UT_SetDeferredRetcode(UT_KEY(HS_CustomGetUtil), 1, HS_UTIL_PER_INTERVAL_TOTAL + 1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), sizeof(HS_HogSnapshot_t) - sizeof(HS_AppData.HogSnapshot.Entries));
 
     /* Execute the function being tested */
     HS_MonitorUtilization();
@@ -1790,6 +2012,10 @@ void HS_MonitorUtilization_Test_CPUHogging(void)
     /* Verify results */
     UtAssert_True(HS_AppData.CurrentCPUHoggingTime == 1, "HS_AppData.CurrentCPUHoggingTime == 1");
 
+    /* The hog snapshot includes this interval */
+    UtAssert_UINT32_EQ(HS_AppData.HogSnapshot.Util[HS_HOG_SNAPSHOT_NUM_UTIL - 1], HS_UTIL_PER_INTERVAL_TOTAL);
+    UtAssert_STUB_COUNT(OS_write, 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CPUMON_HOGGING_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
@@ -1798,8 +2024,11 @@ void HS_MonitorUtilization_Test_CPUHogging(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_HOG_SNAPSHOT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
     strCmpResult = strncmp(ExpectedSysLogString, context_CFE_ES_WriteToSysLog.Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
@@ -1813,15 +2042,15 @@ void HS_MonitorUtilization_Test_CPUHogging(void)
 void HS_MonitorUtilization_Test_CPUHoggingNotMax(void)
 {
 
-    HS_CustomData.LastIdleTaskInterval = 0;
-    HS_CustomData.UtilMult1            = 1;
-    HS_CustomData.UtilMult2            = 1;
-    HS_CustomData.UtilDiv              = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 0;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
 
     HS_AppData.CurrentCPUHogState = HS_STATE_ENABLED;
     HS_AppData.MaxCPUHoggingTime  = 2;
 
-    HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL;
+    HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL - 1;
 
     UT_SetDeferredRetcode(UT_KEY(HS_CustomGetUtil), 1, HS_UTIL_PER_INTERVAL_TOTAL + 1);
 
@@ -1841,15 +2070,15 @@ void HS_MonitorUtilization_Test_CPUHoggingNotMax(void)
 
 void HS_MonitorUtilization_Test_CurrentCPUHogStateDisabled(void)
 {
-    HS_CustomData.LastIdleTaskInterval = 0;
-    HS_CustomData.UtilMult1            = 1;
-    HS_CustomData.UtilMult2            = 1;
-    HS_CustomData.UtilDiv              = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 0;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
 
     HS_AppData.CurrentCPUHogState = HS_STATE_DISABLED;
     HS_AppData.MaxCPUHoggingTime  = 1;
 
-    HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL;
+    HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL - 1;
 
     UT_SetDeferredRetcode(UT_KEY(HS_CustomGetUtil), 1, -1);
 
@@ -1869,10 +2098,10 @@ void HS_MonitorUtilization_Test_CurrentCPUHogStateDisabled(void)
 
 void HS_MonitorUtilization_Test_HighUtilIndex(void)
 {
-    HS_CustomData.LastIdleTaskInterval = 0;
-    HS_CustomData.UtilMult1            = 1;
-    HS_CustomData.UtilMult2            = 1;
-    HS_CustomData.UtilDiv              = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 0;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
 
     HS_AppData.CurrentCPUHogState = HS_STATE_DISABLED;
     HS_AppData.MaxCPUHoggingTime  = 1;
@@ -1899,10 +2128,10 @@ void HS_MonitorUtilization_Test_HighUtilIndex(void)
 
 void HS_MonitorUtilization_Test_LowUtilIndex(void)
 {
-    HS_CustomData.LastIdleTaskInterval = 0;
-    HS_CustomData.UtilMult1            = 1;
-    HS_CustomData.UtilMult2            = 1;
-    HS_CustomData.UtilDiv              = 1;
+    HS_CustomData.Core[0].LastIdleTaskInterval = 0;
+    HS_CustomData.Core[0].UtilMult1            = 1;
+    HS_CustomData.Core[0].UtilMult2            = 1;
+    HS_CustomData.Core[0].UtilDiv              = 1;
 
     HS_AppData.CurrentCPUHogState = HS_STATE_DISABLED;
     HS_AppData.MaxCPUHoggingTime  = 1;
@@ -1927,145 +2156,2193 @@ void HS_MonitorUtilization_Test_LowUtilIndex(void)
 
 } /* end HS_MonitorUtilization_Test_LowUtilIndex */
 
-void HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero(void)
+void HS_MonitorUtilization_Test_SlidingWindow(void)
 {
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
-
-    memset(AMTable, 0, sizeof(AMTable));
+    uint32 Interval;
+    uint32 Util[HS_UTIL_PEAK_NUM_INTERVAL + HS_UTIL_AVERAGE_NUM_INTERVAL + 2];
+    uint32 NumIntervals = sizeof(Util) / sizeof(Util[0]);
+    uint32 WindowIndex;
+    uint32 ExpectedSum;
+    uint32 ExpectedPeak;
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+    HS_AppData.CurrentCPUHogState = HS_STATE_DISABLED;
 
-    HS_AppData.AMTablePtr = AMTable;
+    /* Rising then falling utilization so the peak has to age out of the window */
+    for (Interval = 0; Interval < NumIntervals; Interval++)
+    {
+        if (Interval < (NumIntervals / 2))
+        {
+            Util[Interval] = Interval + 1;
+        }
+        else
+        {
+            Util[Interval] = NumIntervals - Interval;
+        }
+    }
 
-    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    for (Interval = 0; Interval < NumIntervals; Interval++)
     {
-        HS_AppData.AMTablePtr[i].ActionType = 99;
-        HS_AppData.AMTablePtr[i].CycleCount = 0;
-        HS_AppData.AMTablePtr[i].NullTerm   = 0;
+        UT_SetDeferredRetcode(UT_KEY(HS_CustomGetUtil), 1, Util[Interval]);
+
+        /* Execute the function being tested */
+        HS_MonitorUtilization();
+
+        /* Verify results against a full rescan of the interval history */
+        ExpectedSum  = 0;
+        ExpectedPeak = 0;
+
+        for (WindowIndex = 0; (WindowIndex < HS_UTIL_PEAK_NUM_INTERVAL) && (WindowIndex <= Interval); WindowIndex++)
+        {
+            if (WindowIndex < HS_UTIL_AVERAGE_NUM_INTERVAL)
+            {
+                ExpectedSum += Util[Interval - WindowIndex];
+            }
+
+            if (Util[Interval - WindowIndex] > ExpectedPeak)
+            {
+                ExpectedPeak = Util[Interval - WindowIndex];
+            }
+        }
+
+        UtAssert_True(HS_AppData.UtilCpuAvg == (ExpectedSum / HS_UTIL_AVERAGE_NUM_INTERVAL),
+                      "Interval %u: HS_AppData.UtilCpuAvg == %u", (unsigned int)Interval,
+                      (unsigned int)(ExpectedSum / HS_UTIL_AVERAGE_NUM_INTERVAL));
+        UtAssert_True(HS_AppData.UtilCpuPeak == ExpectedPeak, "Interval %u: HS_AppData.UtilCpuPeak == %u",
+                      (unsigned int)Interval, (unsigned int)ExpectedPeak);
     }
 
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorUtilization_Test_SlidingWindow */
+
+void HS_MonitorCoreUtilization_Test_Nominal(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(HS_CustomGetCoreUtil), 1, 400);
+
     /* Execute the function being tested */
-    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+    HS_MonitorCoreUtilization(0, 1);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCoreTracker[0][1], 400);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCoreAvg[0], 400 / HS_UTIL_AVERAGE_NUM_INTERVAL);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCorePeak[0], 400);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* The whole CPU tracker belongs to HS_MonitorUtilization */
+    UtAssert_UINT32_EQ(HS_AppData.UtilizationTracker[1], 0);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+} /* end HS_MonitorCoreUtilization_Test_Nominal */
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+void HS_MonitorCoreUtilization_Test_Limits(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(HS_CustomGetCoreUtil), 1, HS_UTIL_PER_INTERVAL_TOTAL + 1);
+    UT_SetDeferredRetcode(UT_KEY(HS_CustomGetCoreUtil), 1, -1);
 
-} /* end HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero */
+    /* Execute the function being tested */
+    HS_MonitorCoreUtilization(0, 0);
+    HS_MonitorCoreUtilization(0, 1);
 
-void HS_ValidateAMTable_Test_UnusedTableEntryActionTypeNOACT(void)
-{
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.UtilCoreTracker[0][0], HS_UTIL_PER_INTERVAL_TOTAL);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCoreTracker[0][1], 0);
+    UtAssert_UINT32_EQ(HS_AppData.UtilCorePeak[0], HS_UTIL_PER_INTERVAL_TOTAL);
 
-    memset(AMTable, 0, sizeof(AMTable));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+} /* end HS_MonitorCoreUtilization_Test_Limits */
 
-    HS_AppData.AMTablePtr = AMTable;
+void HS_MonitorCoreUtilization_Test_Hogging(void)
+{
+    HS_AppData.CurrentCPUHogState = HS_STATE_ENABLED;
+    HS_AppData.MaxCPUHoggingTime  = 1;
 
-    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
-    {
-        HS_AppData.AMTablePtr[i].ActionType = HS_AMT_ACT_NOACT;
-        HS_AppData.AMTablePtr[i].CycleCount = 1;
-        HS_AppData.AMTablePtr[i].NullTerm   = 0;
-    }
+    UT_SetDeferredRetcode(UT_KEY(HS_CustomGetCoreUtil), 1, HS_UTIL_PER_INTERVAL_TOTAL);
 
     /* Execute the function being tested */
-    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+    HS_MonitorCoreUtilization(0, 0);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    if (HS_UTIL_NUM_CORES > 1)
+    {
+        UtAssert_UINT32_EQ(HS_AppData.CurrentCoreHoggingTime[0], 1);
+        UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CPUMON_CORE_HOGGING_ERR_EID);
+        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    }
+    else
+    {
+        /* A single core is covered by the whole CPU hogging check */
+        UtAssert_UINT32_EQ(HS_AppData.CurrentCoreHoggingTime[0], 0);
+        UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    }
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+} /* end HS_MonitorCoreUtilization_Test_Hogging */
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+void HS_UtilWindowUpdate_Test(void)
+{
+    HS_UtilWindow_t Window;
+    uint32          Tracker[HS_UTIL_PEAK_NUM_INTERVAL];
 
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    memset(&Window, 0, sizeof(Window));
+    memset(Tracker, 0, sizeof(Tracker));
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    /* Execute the function being tested */
+    HS_UtilWindowUpdate(&Window, Tracker, 0, 30);
+    HS_UtilWindowUpdate(&Window, Tracker, 1, 10);
+    HS_UtilWindowUpdate(&Window, Tracker, 2, 20);
 
-} /* end HS_ValidateAMTable_Test_UnusedTableEntryActionTypeNOACT */
+    /* Verify results: 20 displaces 10 from the peak queue, 30 stays at its head */
+    UtAssert_UINT32_EQ(Window.Sum, 60);
+    UtAssert_UINT32_EQ(Window.PeakQueueCount, 2);
+    UtAssert_UINT32_EQ(Tracker[Window.PeakQueue[Window.PeakQueueHead]], 30);
+    UtAssert_UINT32_EQ(Tracker[2], 20);
 
-void HS_ValidateAMTable_Test_BufferNotNull(void)
+} /* end HS_UtilWindowUpdate_Test */
+
+void HS_UtilHistRecord_Test_Rollup(void)
 {
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+    uint32 Interval;
 
-    memset(AMTable, 0, sizeof(AMTable));
+    /* Execute the function being tested: one full rollup period of rising values */
+    for (Interval = 0; Interval < HS_UTIL_HIST_ROLLUP; Interval++)
+    {
+        HS_UtilHistRecord(Interval + 1);
+    }
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "AppMon verify err: Entry = %%d, Err = %%d, Action = %%d, App = %%s");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+    /* Verify results */
+    UtAssert_True(HS_AppData.UtilHist[0].NumEntries == HS_UTIL_HIST_ROLLUP,
+                  "HS_AppData.UtilHist[0].NumEntries == HS_UTIL_HIST_ROLLUP");
+    UtAssert_True(HS_AppData.UtilHist[0].Entries[0].Avg == 1, "HS_AppData.UtilHist[0].Entries[0].Avg == 1");
+
+#if HS_UTIL_HIST_NUM_LEVELS > 1
+    UtAssert_True(HS_AppData.UtilHist[1].NumEntries == 1, "HS_AppData.UtilHist[1].NumEntries == 1");
+    UtAssert_True(HS_AppData.UtilHist[1].RollupCount == 0, "HS_AppData.UtilHist[1].RollupCount == 0");
+    UtAssert_True(HS_AppData.UtilHist[1].Entries[0].Avg == ((HS_UTIL_HIST_ROLLUP + 1) / 2),
+                  "HS_AppData.UtilHist[1].Entries[0].Avg == (HS_UTIL_HIST_ROLLUP + 1) / 2");
+    UtAssert_True(HS_AppData.UtilHist[1].Entries[0].Min == 1, "HS_AppData.UtilHist[1].Entries[0].Min == 1");
+    UtAssert_True(HS_AppData.UtilHist[1].Entries[0].Max == HS_UTIL_HIST_ROLLUP,
+                  "HS_AppData.UtilHist[1].Entries[0].Max == HS_UTIL_HIST_ROLLUP");
+#endif
 
-    HS_AppData.AMTablePtr = AMTable;
+#if HS_UTIL_HIST_NUM_LEVELS > 2
+    UtAssert_True(HS_AppData.UtilHist[2].NumEntries == 0, "HS_AppData.UtilHist[2].NumEntries == 0");
+    UtAssert_True(HS_AppData.UtilHist[2].RollupCount == 1, "HS_AppData.UtilHist[2].RollupCount == 1");
+#endif
 
-    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
-    {
-        HS_AppData.AMTablePtr[i].ActionType = 99;
-        HS_AppData.AMTablePtr[i].CycleCount = 1;
-        HS_AppData.AMTablePtr[i].NullTerm   = 2;
-    }
+} /* end HS_UtilHistRecord_Test_Rollup */
 
-    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+void HS_UtilHistRecord_Test_Wrap(void)
+{
+    uint32 Interval;
 
     /* Execute the function being tested */
-    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+    for (Interval = 0; Interval < (HS_UTIL_HIST_DEPTH + 1); Interval++)
+    {
+        HS_UtilHistRecord(Interval);
+    }
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_True(HS_AppData.UtilHist[0].NumEntries == HS_UTIL_HIST_DEPTH,
+                  "HS_AppData.UtilHist[0].NumEntries == HS_UTIL_HIST_DEPTH");
+    UtAssert_True(HS_AppData.UtilHist[0].NextIndex == (1 % HS_UTIL_HIST_DEPTH),
+                  "HS_AppData.UtilHist[0].NextIndex == 1");
+    UtAssert_True(HS_AppData.UtilHist[0].Entries[0].Avg == HS_UTIL_HIST_DEPTH,
+                  "HS_AppData.UtilHist[0].Entries[0].Avg == HS_UTIL_HIST_DEPTH");
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+} /* end HS_UtilHistRecord_Test_Wrap */
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+void HS_UtilPctlRecord_Test_Window(void)
+{
+    uint32 Interval;
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_AMTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    /* Fill the window with fully loaded intervals, then add an idle one */
+    for (Interval = 0; Interval < HS_UTIL_PCTL_WINDOW; Interval++)
+    {
+        HS_UtilPctlRecord(HS_UTIL_PER_INTERVAL_TOTAL);
+    }
 
-    strCmpResult =
-        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    HS_UtilPctlRecord(0);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    /* Verify results, the oldest interval left the histogram */
+    UtAssert_UINT32_EQ(HS_AppData.UtilPctl.NumSamples, HS_UTIL_PCTL_WINDOW);
+    UtAssert_UINT32_EQ(HS_AppData.UtilPctl.Counts[0], 1);
+    UtAssert_UINT32_EQ(HS_AppData.UtilPctl.Counts[HS_UTIL_PCTL_NUM_BUCKETS - 1], HS_UTIL_PCTL_WINDOW - 1);
+    UtAssert_UINT32_EQ(HS_AppData.UtilPctl.NextIndex, 1 % HS_UTIL_PCTL_WINDOW);
 
-    UtAssert_True(Result == HS_AMTVAL_ERR_NUL, "Result == HS_AMTVAL_ERR_NUL");
+} /* end HS_UtilPctlRecord_Test_Window */
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+void HS_UtilPctlValue_Test(void)
+{
+    uint32 Interval;
+
+    /* No intervals recorded */
+    UtAssert_UINT32_EQ(HS_UtilPctlValue(50), 0);
+
+    /* Nine idle intervals and one fully loaded */
+    for (Interval = 0; Interval < 9; Interval++)
+    {
+        HS_UtilPctlRecord(0);
+    }
+
+    HS_UtilPctlRecord(HS_UTIL_PER_INTERVAL_TOTAL);
+
+#if HS_UTIL_PCTL_WINDOW >= 10
+    UtAssert_UINT32_EQ(HS_UtilPctlValue(50), HS_UTIL_PER_INTERVAL_TOTAL / HS_UTIL_PCTL_NUM_BUCKETS);
+    UtAssert_UINT32_EQ(HS_UtilPctlValue(90), HS_UTIL_PER_INTERVAL_TOTAL / HS_UTIL_PCTL_NUM_BUCKETS);
+#endif
+    UtAssert_UINT32_EQ(HS_UtilPctlValue(99), HS_UTIL_PER_INTERVAL_TOTAL);
+
+} /* end HS_UtilPctlValue_Test */
+
+void HS_MonitorUtilLoad_Test_Hysteresis(void)
+{
+    HS_AppData.UtilLoadLevels[0].EnterUtil      = 8500;
+    HS_AppData.UtilLoadLevels[0].ExitUtil       = 8000;
+    HS_AppData.UtilLoadLevels[0].DwellIntervals = 2;
+    HS_AppData.UtilLoadLevels[0].ActionType     = HS_ALARM_ACT_EVENT;
+
+    /* A single interval above the enter threshold is not enough */
+    HS_MonitorUtilLoad(9000);
+    HS_MonitorUtilLoad(7000);
+    HS_MonitorUtilLoad(9000);
+
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadActiveMask, 0);
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadDwell[0], 1);
+
+    /* Entered on the second consecutive interval */
+    HS_MonitorUtilLoad(8500);
+
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadActiveMask, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_LOAD_ENTER_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* Stays active between the exit and enter thresholds */
+    HS_MonitorUtilLoad(8000);
+    HS_MonitorUtilLoad(9000);
+
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadActiveMask, 1);
+
+    /* Left below the exit threshold */
+    HS_MonitorUtilLoad(7999);
+
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadActiveMask, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_UTIL_LOAD_EXIT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorUtilLoad_Test_Hysteresis */
+
+void HS_MonitorUtilLoad_Test_MsgActs(void)
+{
+    HS_MATEntry_t MATable[HS_MAX_MSG_ACT_TYPES];
+
+    memset(MATable, 0, sizeof(MATable));
+
+    HS_AppData.MATablePtr   = MATable;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+
+    HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].Cooldown    = 5;
+
+    HS_AppData.UtilLoadLevels[0].EnterUtil  = 8500;
+    HS_AppData.UtilLoadLevels[0].ExitUtil   = 8000;
+    HS_AppData.UtilLoadLevels[0].ActionType = HS_ALARM_ACT_LAST_NONMSG + 1;
+
+#if HS_UTIL_LOAD_NUM_LEVELS > 1
+    /* Never entered, the enter threshold can't be reached */
+    HS_AppData.UtilLoadLevels[1].EnterUtil  = HS_UTIL_PER_INTERVAL_TOTAL + 1;
+    HS_AppData.UtilLoadLevels[1].ActionType = HS_ALARM_ACT_EVENT;
+#endif
+
+    /* Execute the function being tested */
+    HS_MonitorUtilLoad(HS_UTIL_PER_INTERVAL_TOTAL);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.UtilLoadActiveMask, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActCooldown[0], 5);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_LOAD_MSGACTS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* Re-entering while the message action cools down sends nothing */
+    HS_MonitorUtilLoad(0);
+    HS_MonitorUtilLoad(HS_UTIL_PER_INTERVAL_TOTAL);
+
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorUtilLoad_Test_MsgActs */
+
+void HS_MonitorLoadShed_Test_ShedAndRestore(void)
+{
+    HS_LSTEntry_t LSTable[HS_MAX_LOAD_SHED_STEPS];
+    uint32        i;
+
+    memset(LSTable, 0, sizeof(LSTable));
+
+    HS_AppData.LSTablePtr    = LSTable;
+    HS_AppData.LoadShedState = HS_STATE_ENABLED;
+
+    /* Entry 1 is unused and is skipped both ways */
+    HS_AppData.LSTablePtr[0].EnableState = HS_LST_STATE_ENABLED;
+    HS_AppData.LSTablePtr[2].EnableState = HS_LST_STATE_ENABLED;
+
+    /* Nothing happens until the dwell is met */
+    for (i = 0; i < HS_LOAD_SHED_DWELL - 1; i++)
+    {
+        HS_MonitorLoadShed(HS_LOAD_SHED_HIGH_UTIL);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    HS_MonitorLoadShed(HS_LOAD_SHED_HIGH_UTIL);
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LOADSHED_STEP_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Next step sheds entry 2 */
+    for (i = 0; i < HS_LOAD_SHED_DWELL; i++)
+    {
+        HS_MonitorLoadShed(HS_LOAD_SHED_HIGH_UTIL);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 3);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+
+    /* Nothing left to shed */
+    for (i = 0; i < HS_LOAD_SHED_DWELL; i++)
+    {
+        HS_MonitorLoadShed(HS_LOAD_SHED_HIGH_UTIL);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 3);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+
+    /* Restored in reverse order */
+    for (i = 0; i < HS_LOAD_SHED_DWELL; i++)
+    {
+        HS_MonitorLoadShed(HS_LOAD_SHED_LOW_UTIL - 1);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 3);
+
+    for (i = 0; i < HS_LOAD_SHED_DWELL; i++)
+    {
+        HS_MonitorLoadShed(HS_LOAD_SHED_LOW_UTIL - 1);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 4);
+
+    /* Nothing left to restore */
+    for (i = 0; i < HS_LOAD_SHED_DWELL; i++)
+    {
+        HS_MonitorLoadShed(HS_LOAD_SHED_LOW_UTIL - 1);
+    }
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 4);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 4, "CFE_EVS_SendEvent was called %u time(s), expected 4",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorLoadShed_Test_ShedAndRestore */
+
+void HS_MonitorLoadShed_Test_DwellReset(void)
+{
+    HS_LSTEntry_t LSTable[HS_MAX_LOAD_SHED_STEPS];
+    uint32        i;
+
+    memset(LSTable, 0, sizeof(LSTable));
+
+    HS_AppData.LSTablePtr    = LSTable;
+    HS_AppData.LoadShedState = HS_STATE_ENABLED;
+
+    HS_AppData.LSTablePtr[0].EnableState = HS_LST_STATE_ENABLED;
+
+    /* Dipping between the thresholds restarts the dwell */
+    for (i = 0; i < HS_LOAD_SHED_DWELL - 1; i++)
+    {
+        HS_MonitorLoadShed(HS_LOAD_SHED_HIGH_UTIL);
+    }
+
+    HS_MonitorLoadShed(HS_LOAD_SHED_LOW_UTIL);
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedHighCount, 0);
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedLowCount, 0);
+
+    HS_MonitorLoadShed(HS_LOAD_SHED_HIGH_UTIL);
+
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 0);
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedHighCount, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorLoadShed_Test_DwellReset */
+
+void HS_MonitorLoadShed_Test_Disabled(void)
+{
+    uint32 i;
+
+    HS_AppData.LoadShedState = HS_STATE_DISABLED;
+
+    /* Execute the function being tested */
+    for (i = 0; i < HS_LOAD_SHED_DWELL; i++)
+    {
+        HS_MonitorLoadShed(HS_UTIL_PER_INTERVAL_TOTAL);
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedStep, 0);
+    UtAssert_UINT32_EQ(HS_AppData.LoadShedHighCount, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorLoadShed_Test_Disabled */
+
+void HS_MONITORS_TEST_FeedUtilTrend(uint32 NumIntervals, uint32 FirstUtil, int32 Step)
+{
+    uint32 i;
+    uint32 Util;
+
+    for (i = 0; i < NumIntervals; i++)
+    {
+        Util = FirstUtil + (i * Step);
+
+        HS_UtilTrendUpdate(HS_AppData.CurrentCPUUtilIndex, Util);
+
+        HS_AppData.UtilizationTracker[HS_AppData.CurrentCPUUtilIndex] = Util;
+        HS_AppData.CurrentCPUUtilIndex = (HS_AppData.CurrentCPUUtilIndex + 1) % HS_UTIL_PEAK_NUM_INTERVAL;
+    }
+}
+
+void HS_UtilTrendUpdate_Test_Sliding(void)
+{
+    uint32 i;
+    uint32 Util;
+    uint32 ExpectedSum      = 0;
+    uint64 ExpectedWeighted = 0;
+
+    /* Slide the window past the tracker wrap */
+    HS_AppData.CurrentCPUUtilIndex = HS_UTIL_PEAK_NUM_INTERVAL - 1;
+
+    for (i = 0; i < (2 * HS_UTIL_TREND_NUM_INTERVAL) + 3; i++)
+    {
+        Util = (i * 37) % 1000;
+
+        HS_UtilTrendUpdate(HS_AppData.CurrentCPUUtilIndex, Util);
+
+        HS_AppData.UtilizationTracker[HS_AppData.CurrentCPUUtilIndex] = Util;
+        HS_AppData.CurrentCPUUtilIndex = (HS_AppData.CurrentCPUUtilIndex + 1) % HS_UTIL_PEAK_NUM_INTERVAL;
+    }
+
+    for (i = 0; i < HS_UTIL_TREND_NUM_INTERVAL; i++)
+    {
+        Util = ((i + HS_UTIL_TREND_NUM_INTERVAL + 3) * 37) % 1000;
+
+        ExpectedSum += Util;
+        ExpectedWeighted += (uint64)i * Util;
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.NumSamples, HS_UTIL_TREND_NUM_INTERVAL);
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.SumUtil, ExpectedSum);
+    UtAssert_True(HS_AppData.UtilTrend.SumWeighted == ExpectedWeighted,
+                  "HS_AppData.UtilTrend.SumWeighted == ExpectedWeighted");
+
+} /* end HS_UtilTrendUpdate_Test_Sliding */
+
+void HS_MonitorUtilTrend_Test_Warning(void)
+{
+    uint32 LastUtil  = 1000 + (10 * ((2 * HS_UTIL_TREND_NUM_INTERVAL) - 1));
+    uint32 TimeToSat = (HS_UTIL_TREND_SATURATION_UTIL - LastUtil) / 10;
+
+    HS_AppData.UtilTrendConfig.ActionType = HS_ALARM_ACT_EVENT;
+
+    HS_MONITORS_TEST_FeedUtilTrend(2 * HS_UTIL_TREND_NUM_INTERVAL, 1000, 10);
+
+    /* Saturation is predicted just beyond the horizon */
+    HS_AppData.UtilTrendConfig.HorizonIntervals = TimeToSat - 1;
+
+    /* Execute the function being tested */
+    HS_MonitorUtilTrend();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(HS_AppData.UtilTrend.Slope, 1000);
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.TimeToSat, TimeToSat);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Within the horizon the warning is given once */
+    HS_AppData.UtilTrendConfig.HorizonIntervals = TimeToSat;
+
+    HS_MonitorUtilTrend();
+    HS_MonitorUtilTrend();
+
+    UtAssert_True(HS_AppData.UtilTrend.Warned == true, "HS_AppData.UtilTrend.Warned == true");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_TREND_WARN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Cleared once saturation is more than twice the horizon away */
+    HS_AppData.UtilTrendConfig.HorizonIntervals = (TimeToSat - 1) / 2;
+
+    HS_MonitorUtilTrend();
+
+    UtAssert_True(HS_AppData.UtilTrend.Warned == false, "HS_AppData.UtilTrend.Warned == false");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_UTIL_TREND_CLEAR_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorUtilTrend_Test_Warning */
+
+void HS_MonitorUtilTrend_Test_NotRising(void)
+{
+    HS_AppData.UtilTrendConfig.HorizonIntervals = HS_UTIL_TREND_NOT_RISING - 1;
+    HS_AppData.UtilTrendConfig.ActionType       = HS_ALARM_ACT_EVENT;
+
+    /* Flat utilization */
+    HS_MONITORS_TEST_FeedUtilTrend(HS_UTIL_TREND_NUM_INTERVAL, 5000, 0);
+
+    /* Execute the function being tested */
+    HS_MonitorUtilTrend();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(HS_AppData.UtilTrend.Slope, 0);
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.TimeToSat, HS_UTIL_TREND_NOT_RISING);
+
+    /* Falling utilization */
+    HS_MONITORS_TEST_FeedUtilTrend(HS_UTIL_TREND_NUM_INTERVAL, 5000, -10);
+
+    HS_MonitorUtilTrend();
+
+    UtAssert_INT32_EQ(HS_AppData.UtilTrend.Slope, -1000);
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.TimeToSat, HS_UTIL_TREND_NOT_RISING);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorUtilTrend_Test_NotRising */
+
+void HS_MonitorUtilTrend_Test_NotFull(void)
+{
+    HS_AppData.UtilTrendConfig.HorizonIntervals = HS_UTIL_TREND_NOT_RISING - 1;
+    HS_AppData.UtilTrendConfig.ActionType       = HS_ALARM_ACT_EVENT;
+    HS_AppData.UtilTrend.TimeToSat              = HS_UTIL_TREND_NOT_RISING;
+
+    HS_MONITORS_TEST_FeedUtilTrend(HS_UTIL_TREND_NUM_INTERVAL - 1, 1000, 100);
+
+    /* Execute the function being tested */
+    HS_MonitorUtilTrend();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.TimeToSat, HS_UTIL_TREND_NOT_RISING);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorUtilTrend_Test_NotFull */
+
+void HS_MonitorUtilTrend_Test_MsgActs(void)
+{
+    HS_MATEntry_t MATable[HS_MAX_MSG_ACT_TYPES];
+
+    memset(MATable, 0, sizeof(MATable));
+
+    HS_AppData.MATablePtr   = MATable;
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+
+    HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].Cooldown    = 5;
+
+    HS_AppData.UtilTrendConfig.HorizonIntervals = HS_UTIL_TREND_NOT_RISING - 1;
+    HS_AppData.UtilTrendConfig.ActionType       = HS_ALARM_ACT_LAST_NONMSG + 1;
+
+    /* Already saturated */
+    HS_MONITORS_TEST_FeedUtilTrend(HS_UTIL_TREND_NUM_INTERVAL, HS_UTIL_TREND_SATURATION_UTIL, 1);
+
+    /* Execute the function being tested */
+    HS_MonitorUtilTrend();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.UtilTrend.TimeToSat, 0);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActCooldown[0], 5);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_UTIL_TREND_MSGACTS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorUtilTrend_Test_MsgActs */
+
+void HS_MonitorRebalance_Test_Disabled(void)
+{
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
+
+    memset(RBTable, 0, sizeof(RBTable));
+
+    HS_AppData.RBTablePtr        = RBTable;
+    HS_AppData.RebalanceState    = HS_STATE_DISABLED;
+    HS_AppData.RebalanceCooldown = 2;
+
+    /* Execute the function being tested */
+    HS_MonitorRebalance(0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceCooldown, 2);
+    UtAssert_STUB_COUNT(HS_GetThreadAffinity, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorRebalance_Test_Disabled */
+
+#if HS_UTIL_NUM_CORES > 1
+void HS_MonitorRebalance_Test_Dwell(void)
+{
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
+    uint32        CoreMask = 0x3;
+    uint32        i;
+
+    memset(RBTable, 0, sizeof(RBTable));
+
+    strncpy(RBTable[0].TaskName, "TASK", sizeof(RBTable[0].TaskName));
+    RBTable[0].CoreMask = 0x2;
+
+    HS_AppData.RBTablePtr     = RBTable;
+    HS_AppData.RebalanceState = HS_STATE_ENABLED;
+
+    HS_AppData.TaskCpuNumSamples[0]          = 1;
+    HS_AppData.TaskCpuSamples[0][0].ThreadId = 100;
+    strncpy(HS_AppData.TaskCpuSamples[0][0].Name, "TASK", sizeof(HS_AppData.TaskCpuSamples[0][0].Name));
+
+    HS_AppData.UtilCoreTracker[0][0] = HS_REBALANCE_HIGH_UTIL;
+    HS_AppData.UtilCoreTracker[1][0] = HS_REBALANCE_LOW_UTIL;
+
+    UT_SetDataBuffer(UT_KEY(HS_GetThreadAffinity), &CoreMask, sizeof(CoreMask), false);
+
+    /* Execute the function being tested */
+    for (i = 0; i < HS_REBALANCE_DWELL - 1; i++)
+    {
+        HS_MonitorRebalance(0);
+    }
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceDwell, HS_REBALANCE_DWELL - 1);
+    UtAssert_STUB_COUNT(HS_SetThreadAffinity, 0);
+
+    /* The imbalance has lasted long enough */
+    HS_MonitorRebalance(0);
+
+    UtAssert_STUB_COUNT(HS_SetThreadAffinity, 1);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceMoveCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceLastFromCore, 0);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceLastToCore, 1);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceCooldown, HS_REBALANCE_COOLDOWN);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REBALANCE_MOVE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* Nothing is looked at during the cooldown */
+    HS_MonitorRebalance(0);
+
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceDwell, 0);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceCooldown, HS_REBALANCE_COOLDOWN - 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorRebalance_Test_Dwell */
+#endif
+
+void HS_RebalanceMove_Test_Moved(void)
+{
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
+    uint32        CoreMasks[2] = {0x3, 0x3};
+    bool          Result;
+
+    memset(RBTable, 0, sizeof(RBTable));
+
+    /* The first entry can't go to the idle core */
+    strncpy(RBTable[0].TaskName, "OTHER", sizeof(RBTable[0].TaskName));
+    RBTable[0].CoreMask = 0x1;
+    strncpy(RBTable[1].TaskName, "TASK", sizeof(RBTable[1].TaskName));
+    RBTable[1].CoreMask = 0x3;
+
+    HS_AppData.RBTablePtr = RBTable;
+
+    HS_AppData.TaskCpuCurrent       = 1;
+    HS_AppData.TaskCpuNumSamples[1] = 3;
+    strncpy(HS_AppData.TaskCpuSamples[1][0].Name, "TASK", sizeof(HS_AppData.TaskCpuSamples[1][0].Name));
+    strncpy(HS_AppData.TaskCpuSamples[1][1].Name, "OTHER", sizeof(HS_AppData.TaskCpuSamples[1][1].Name));
+    strncpy(HS_AppData.TaskCpuSamples[1][2].Name, "TASK", sizeof(HS_AppData.TaskCpuSamples[1][2].Name));
+
+    UT_SetDataBuffer(UT_KEY(HS_GetThreadAffinity), CoreMasks, sizeof(CoreMasks), false);
+
+    /* Execute the function being tested */
+    Result = HS_RebalanceMove(0, 1);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(HS_GetThreadAffinity, 2);
+    UtAssert_STUB_COUNT(HS_SetThreadAffinity, 2);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceMoveCount, 1);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceLastEntry, 1);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceLastFromCore, 0);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceLastToCore, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_RebalanceMove_Test_Moved */
+
+void HS_RebalanceMove_Test_NotOnCore(void)
+{
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
+    uint32        CoreMask = 0x2;
+    bool          Result;
+
+    memset(RBTable, 0, sizeof(RBTable));
+
+    strncpy(RBTable[0].TaskName, "TASK", sizeof(RBTable[0].TaskName));
+    RBTable[0].CoreMask = 0x3;
+
+    HS_AppData.RBTablePtr = RBTable;
+
+    HS_AppData.TaskCpuNumSamples[0] = 1;
+    strncpy(HS_AppData.TaskCpuSamples[0][0].Name, "TASK", sizeof(HS_AppData.TaskCpuSamples[0][0].Name));
+
+    /* Already moved off the saturated core */
+    UT_SetDataBuffer(UT_KEY(HS_GetThreadAffinity), &CoreMask, sizeof(CoreMask), false);
+
+    /* Execute the function being tested */
+    Result = HS_RebalanceMove(0, 1);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(HS_SetThreadAffinity, 0);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceMoveCount, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_RebalanceMove_Test_NotOnCore */
+
+void HS_RebalanceMove_Test_SetError(void)
+{
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
+    uint32        CoreMask = 0x1;
+    bool          Result;
+
+    memset(RBTable, 0, sizeof(RBTable));
+
+    strncpy(RBTable[0].TaskName, "TASK", sizeof(RBTable[0].TaskName));
+    RBTable[0].CoreMask = 0x2;
+
+    HS_AppData.RBTablePtr = RBTable;
+
+    HS_AppData.TaskCpuNumSamples[0] = 1;
+    strncpy(HS_AppData.TaskCpuSamples[0][0].Name, "TASK", sizeof(HS_AppData.TaskCpuSamples[0][0].Name));
+
+    UT_SetDataBuffer(UT_KEY(HS_GetThreadAffinity), &CoreMask, sizeof(CoreMask), false);
+    UT_SetDefaultReturnValue(UT_KEY(HS_SetThreadAffinity), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Execute the function being tested */
+    Result = HS_RebalanceMove(0, 1);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_UINT32_EQ(HS_AppData.RebalanceMoveCount, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_REBALANCE_MOVE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_RebalanceMove_Test_SetError */
+
+void HS_MonitorTaskCpu_Test_Baseline(void)
+{
+    HS_TaskCpuSample_t Samples[2];
+
+    memset(Samples, 0, sizeof(Samples));
+    Samples[0].ThreadId = 100;
+    Samples[1].ThreadId = 101;
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadTaskCpuTimes), Samples, sizeof(Samples), false);
+
+    /* Execute the function being tested */
+    HS_MonitorTaskCpu();
+
+    /* Verify results, the first sample only sets the baseline */
+    UtAssert_UINT32_EQ(HS_AppData.TaskCpuCurrent, 1);
+    UtAssert_UINT32_EQ(HS_AppData.TaskCpuNumSamples[1], 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_MonitorTaskCpu_Test_Baseline */
+
+void HS_MonitorTaskCpu_Test_TopN(void)
+{
+    HS_TaskCpuSample_t   Samples[HS_TASK_CPU_TOP_N + 2];
+    HS_TaskCpuPayload_t *PayloadPtr = &HS_AppData.TaskCpuPacket.Payload;
+    uint64               Now        = 2000000000;
+    uint32               NumThreads = HS_TASK_CPU_TOP_N + 1;
+    uint32               i;
+
+    /* Previous sample one second ago, with no CPU time used yet */
+    for (i = 0; i < NumThreads; i++)
+    {
+        HS_AppData.TaskCpuSamples[0][i].ThreadId  = 100 + i;
+        HS_AppData.TaskCpuSamples[0][i].CpuTimeNs = 0;
+    }
+
+    HS_AppData.TaskCpuNumSamples[0] = NumThreads;
+    HS_AppData.TaskCpuCurrent       = 0;
+    HS_AppData.TaskCpuLastTime      = 1000000000;
+
+    /* Thread i used (i + 1) percent of the second, plus one new thread */
+    memset(Samples, 0, sizeof(Samples));
+
+    for (i = 0; i < NumThreads; i++)
+    {
+        Samples[i].ThreadId  = 100 + i;
+        Samples[i].CpuTimeNs = (i + 1) * 10000000;
+        snprintf(Samples[i].Name, sizeof(Samples[i].Name), "TASK%u", (unsigned int)i);
+    }
+
+    Samples[NumThreads].ThreadId  = 999;
+    Samples[NumThreads].CpuTimeNs = 900000000;
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadTaskCpuTimes), Samples, sizeof(Samples), false);
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), &Now, sizeof(Now), false);
+
+    /* The busiest thread is not a cFE task */
+    UT_SetDeferredRetcode(UT_KEY(HS_FindTaskByThreadName), 1, -1);
+
+    /* Execute the function being tested */
+    HS_MonitorTaskCpu();
+
+    /* Verify results, the least busy thread and the new thread are not reported */
+    UtAssert_UINT32_EQ(PayloadPtr->NumTasks, NumThreads + 1);
+    UtAssert_UINT32_EQ(PayloadPtr->NumEntries, HS_TASK_CPU_TOP_N);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].ThreadId, 100 + NumThreads - 1);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].Util, (NumThreads * HS_UTIL_PER_INTERVAL_TOTAL) / 100);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(PayloadPtr->Entries[0].TaskId));
+    UtAssert_STRINGBUF_EQ(PayloadPtr->Entries[0].TaskName, sizeof(PayloadPtr->Entries[0].TaskName),
+                          Samples[NumThreads - 1].Name, sizeof(Samples[NumThreads - 1].Name));
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[HS_TASK_CPU_TOP_N - 1].ThreadId, 101);
+    UtAssert_STUB_COUNT(HS_FindTaskByThreadName, HS_TASK_CPU_TOP_N);
+    UtAssert_UINT32_EQ(HS_AppData.TaskCpuCurrent, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_MonitorTaskCpu_Test_TopN */
+
+void HS_MonitorTaskCpu_Test_Error(void)
+{
+    HS_AppData.TaskCpuLastTime = 1000000000;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_ReadTaskCpuTimes), CFE_STATUS_NOT_IMPLEMENTED);
+
+    /* Execute the function being tested twice, only the first error is reported */
+    HS_MonitorTaskCpu();
+    HS_MonitorTaskCpu();
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(HS_AppData.TaskCpuErrReported);
+    UtAssert_UINT32_EQ(HS_AppData.TaskCpuLastTime, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_TASK_CPU_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_MonitorTaskCpu_Test_Error */
+
+void HS_MonitorTaskCpu_Test_RunDelay(void)
+{
+    HS_TaskCpuSample_t   Samples[3];
+    HS_TaskCpuPayload_t *PayloadPtr = &HS_AppData.TaskCpuPacket.Payload;
+    uint64               Now        = 2000000000;
+    uint32               i;
+
+    /* Previous sample one second ago */
+    for (i = 0; i < 3; i++)
+    {
+        HS_AppData.TaskCpuSamples[0][i].ThreadId         = 100 + i;
+        HS_AppData.TaskCpuSamples[0][i].RunDelayNs       = 1000000;
+        HS_AppData.TaskCpuSamples[0][i].VolCtxSwitches   = 10;
+        HS_AppData.TaskCpuSamples[0][i].InvolCtxSwitches = 0xFFFFFFFF;
+    }
+
+    HS_AppData.TaskCpuNumSamples[0] = 3;
+    HS_AppData.TaskCpuCurrent       = 0;
+    HS_AppData.TaskCpuLastTime      = 1000000000;
+
+    /* Thread 102 waited half the second for a CPU, thread 100 a tenth, thread 101 not at all */
+    memcpy(Samples, HS_AppData.TaskCpuSamples[0], sizeof(Samples));
+
+    Samples[0].CpuTimeNs        = 300000000;
+    Samples[0].RunDelayNs       = 101000000;
+    Samples[1].CpuTimeNs        = 200000000;
+    Samples[2].RunDelayNs       = 501000000;
+    Samples[2].VolCtxSwitches   = 15;
+    Samples[2].InvolCtxSwitches = 2;
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadTaskCpuTimes), Samples, sizeof(Samples), false);
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), &Now, sizeof(Now), false);
+
+    /* Execute the function being tested */
+    HS_MonitorTaskCpu();
+
+    /* Verify results, the waits are ranked apart from the CPU usage */
+    UtAssert_UINT32_EQ(PayloadPtr->NumWaitEntries, 3);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[0].ThreadId, 102);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[0].RunDelay, HS_UTIL_PER_INTERVAL_TOTAL / 2);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[0].Util, 0);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[0].VolCtxSwitches, 5);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[0].InvolCtxSwitches, 3);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[1].ThreadId, 100);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[1].RunDelay, HS_UTIL_PER_INTERVAL_TOTAL / 10);
+    UtAssert_UINT32_EQ(PayloadPtr->WaitEntries[2].ThreadId, 101);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].ThreadId, 100);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].RunDelay, HS_UTIL_PER_INTERVAL_TOTAL / 10);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+#if (HS_TASK_RUN_DELAY_THRESHOLD > 0) && (HS_TASK_RUN_DELAY_THRESHOLD <= HS_UTIL_PER_INTERVAL_TOTAL / 2)
+    UtAssert_BOOL_TRUE(HS_AppData.RunDelayActive);
+#endif
+
+} /* end HS_MonitorTaskCpu_Test_RunDelay */
+
+void HS_TaskCpuRank_Test(void)
+{
+    uint32 TopIndex[HS_TASK_CPU_TOP_N];
+    uint32 TopValue[HS_TASK_CPU_TOP_N];
+    uint32 NumTop = 0;
+    uint32 i;
+
+    /* Rank one more than fits, lowest first */
+    for (i = 0; i <= HS_TASK_CPU_TOP_N; i++)
+    {
+        HS_TaskCpuRank(TopIndex, TopValue, &NumTop, i, 10 * i);
+    }
+
+    /* Ties keep their ranking order */
+    HS_TaskCpuRank(TopIndex, TopValue, &NumTop, 99, 10 * HS_TASK_CPU_TOP_N);
+
+    /* Verify results, the lowest is dropped */
+    UtAssert_UINT32_EQ(NumTop, HS_TASK_CPU_TOP_N);
+    UtAssert_UINT32_EQ(TopIndex[0], HS_TASK_CPU_TOP_N);
+    UtAssert_UINT32_EQ(TopValue[0], 10 * HS_TASK_CPU_TOP_N);
+
+#if HS_TASK_CPU_TOP_N > 1
+    UtAssert_UINT32_EQ(TopIndex[1], 99);
+#endif
+
+} /* end HS_TaskCpuRank_Test */
+
+void HS_MonitorRunDelay_Test_Event(void)
+{
+    HS_TaskCpuPayload_t *PayloadPtr = &HS_AppData.TaskCpuPacket.Payload;
+
+    PayloadPtr->NumWaitEntries          = 1;
+    PayloadPtr->WaitEntries[0].RunDelay = HS_UTIL_PER_INTERVAL_TOTAL;
+    strncpy(PayloadPtr->WaitEntries[0].TaskName, "WAITER", sizeof(PayloadPtr->WaitEntries[0].TaskName) - 1);
+
+    /* Execute the function being tested */
+    HS_MonitorRunDelay(PayloadPtr);
+    HS_MonitorRunDelay(PayloadPtr);
+
+    /* Verify results, the action is taken once */
+    UtAssert_BOOL_TRUE(HS_AppData.RunDelayActive);
+
+#if HS_TASK_RUN_DELAY_ACTION == HS_ALARM_ACT_EVENT
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_TASK_RUN_DELAY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+#endif
+
+    /* Cleared once no thread reaches the threshold */
+    PayloadPtr->NumWaitEntries = 0;
+
+    HS_MonitorRunDelay(PayloadPtr);
+
+    UtAssert_BOOL_FALSE(HS_AppData.RunDelayActive);
+
+#if HS_TASK_RUN_DELAY_ACTION == HS_ALARM_ACT_EVENT
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_TASK_RUN_DELAY_CLEAR_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+#endif
+
+} /* end HS_MonitorRunDelay_Test_Event */
+
+void HS_MonitorRunDelay_Test_Below(void)
+{
+    HS_TaskCpuPayload_t *PayloadPtr = &HS_AppData.TaskCpuPacket.Payload;
+
+    PayloadPtr->NumWaitEntries          = 1;
+    PayloadPtr->WaitEntries[0].RunDelay = HS_TASK_RUN_DELAY_THRESHOLD - 1;
+
+    /* Execute the function being tested */
+    HS_MonitorRunDelay(PayloadPtr);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(HS_AppData.RunDelayActive);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_MonitorRunDelay_Test_Below */
+
+void HS_MonitorStacks_Test_Round(void)
+{
+    HS_StackPayload_t *PayloadPtr = &HS_AppData.StackPacket.Payload;
+    uint32             Stacks[5][2] = {{10000, 2000}, {10000, 9000}, {10000, 100}, {20000, 1000}, {20000, 3000}};
+    uint32             i;
+
+    HS_AppData.TaskCpuCurrent       = 1;
+    HS_AppData.TaskCpuNumSamples[1] = 6;
+
+    for (i = 0; i < 6; i++)
+    {
+        HS_AppData.TaskCpuSamples[1][i].ThreadId = 101 + i;
+        snprintf(HS_AppData.TaskCpuSamples[1][i].Name, sizeof(HS_AppData.TaskCpuSamples[1][i].Name), "TASK%u",
+                 (unsigned int)i);
+    }
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadThreadStack), Stacks, sizeof(Stacks), false);
+
+    /* A thread that can't be measured on this pass is left unmeasured */
+    UT_SetDeferredRetcode(UT_KEY(HS_ReadThreadStack), 3, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Execute the function being tested */
+    HS_MonitorStacks();
+
+    /* Verify results, only the first few threads are measured */
+    UtAssert_STUB_COUNT(HS_ReadThreadStack, HS_STACK_TASKS_PER_INTERVAL < 6 ? HS_STACK_TASKS_PER_INTERVAL : 6);
+
+#if HS_STACK_TASKS_PER_INTERVAL == 4
+    UtAssert_UINT32_EQ(HS_AppData.StackNext, 4);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_True(strcmp(PayloadPtr->Entries[1].TaskName, "TASK1") == 0, "Entries[1].TaskName == TASK1");
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].ThreadId, 101);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].StackSize, 10000);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].StackUsed, 2000);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].Usage, 20);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[1].Usage, 90);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[2].StackSize, 0);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[3].Usage, 1);
+
+#if (HS_STACK_USAGE_THRESHOLD > 0) && (HS_STACK_USAGE_THRESHOLD <= 90)
+    UtAssert_BOOL_TRUE(PayloadPtr->Entries[1].ActionTaken);
+    UtAssert_BOOL_FALSE(PayloadPtr->Entries[0].ActionTaken);
+#if HS_STACK_USAGE_ACTION == HS_ALARM_ACT_EVENT
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_STACK_USAGE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+#endif
+#endif
+
+    /* The rest of the threads complete the pass and the packet is sent */
+    HS_MonitorStacks();
+
+    UtAssert_UINT32_EQ(HS_AppData.StackNext, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(PayloadPtr->NumTasks, 6);
+    UtAssert_UINT32_EQ(PayloadPtr->NumMeasured, 5);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[4].Usage, 5);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[5].Usage, 15);
+    UtAssert_UINT32_EQ(HS_AppData.StackMaxUsage, 90);
+#endif
+
+} /* end HS_MonitorStacks_Test_Round */
+
+void HS_MonitorStacks_Test_HighWater(void)
+{
+    HS_StackPayload_t *PayloadPtr = &HS_AppData.StackPacket.Payload;
+    CFE_ES_TaskInfo_t  TaskInfo;
+    uint32             Stacks[3][2] = {{16384, 4096}, {16384, 1024}, {16384, 2048}};
+
+    memset(&TaskInfo, 0, sizeof(TaskInfo));
+    TaskInfo.StackSize = 8192;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskInfo), &TaskInfo, sizeof(TaskInfo), false);
+    UT_SetDataBuffer(UT_KEY(HS_ReadThreadStack), Stacks, sizeof(Stacks), false);
+
+    HS_AppData.TaskCpuNumSamples[0]          = 1;
+    HS_AppData.TaskCpuSamples[0][0].ThreadId = 7;
+    strncpy(HS_AppData.TaskCpuSamples[0][0].Name, "HS_IDLE_TASK", sizeof(HS_AppData.TaskCpuSamples[0][0].Name) - 1);
+
+    PayloadPtr->Entries[0].ThreadId    = 5;
+    PayloadPtr->Entries[0].StackUsed   = 15000;
+    PayloadPtr->Entries[0].ActionTaken = true;
+    PayloadPtr->Entries[1].ThreadId    = 6;
+
+    /* Execute the function being tested */
+    HS_MonitorStacks();
+
+    /* Verify results, a new thread in the slot starts over and entries past the list are cleared */
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].ThreadId, 7);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].EsStackSize, 8192);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].StackUsed, 4096);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].Usage, 25);
+    UtAssert_BOOL_FALSE(PayloadPtr->Entries[0].ActionTaken);
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[1].ThreadId, 0);
+    UtAssert_UINT32_EQ(PayloadPtr->NumTasks, 1);
+
+    /* The mark never falls */
+    HS_MonitorStacks();
+    HS_MonitorStacks();
+
+    UtAssert_UINT32_EQ(PayloadPtr->Entries[0].StackUsed, 4096);
+    UtAssert_UINT32_EQ(HS_AppData.StackMaxUsage, 25);
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskInfo, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 3);
+
+} /* end HS_MonitorStacks_Test_HighWater */
+
+void HS_MonitorStacks_Test_NoThreads(void)
+{
+    /* Execute the function being tested */
+    HS_MonitorStacks();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(HS_ReadThreadStack, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+} /* end HS_MonitorStacks_Test_NoThreads */
+
+void HS_StackUsageAction_Test(void)
+{
+    HS_StackEntry_t Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+    strncpy(Entry.TaskName, "DEEP", sizeof(Entry.TaskName) - 1);
+    Entry.StackSize = 16384;
+    Entry.StackUsed = 16000;
+    Entry.Usage     = 97;
+
+    /* Execute the function being tested */
+    HS_StackUsageAction(&Entry);
+
+    /* Verify results */
+#if HS_STACK_USAGE_ACTION == HS_ALARM_ACT_EVENT
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_STACK_USAGE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+#elif HS_STACK_USAGE_ACTION == HS_ALARM_ACT_NOACT
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+#endif
+
+} /* end HS_StackUsageAction_Test */
+
+void HS_MonitorSbPipes_Test(void)
+{
+    CFE_SB_PipeId_t PipeId = HS_UT_PIPEID_1;
+    uint32          i;
+
+    strncpy(HS_AppData.SbPipeLimits[0].PipeName, "LATE_PIPE", sizeof(HS_AppData.SbPipeLimits[0].PipeName) - 1);
+    strncpy(HS_AppData.SbPipeLimits[1].PipeName, "NO_PIPE", sizeof(HS_AppData.SbPipeLimits[1].PipeName) - 1);
+    HS_AppData.SbPipeLimits[0].EnterUsage = 50;
+    HS_AppData.SbPipeLimits[1].EnterUsage = 50;
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_GetPipeIdByName), &PipeId, sizeof(PipeId), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_GetPipeIdByName), 2, CFE_SB_BAD_ARGUMENT);
+
+    /* Execute the function being tested */
+    for (i = 1; i < HS_SB_STATS_PERIOD; i++)
+    {
+        HS_MonitorSbPipes();
+    }
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    HS_MonitorSbPipes();
+
+    /* Verify results, the request is sent once per period and found pipes are not looked up again */
+#if HS_SB_STATS_PERIOD != 0
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_GetPipeIdByName, 2);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(HS_AppData.SbPipeIds[0], PipeId));
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(HS_AppData.SbPipeIds[1]));
+    UtAssert_UINT32_EQ(HS_AppData.SbStatsCounter, 0);
+
+    for (i = 0; i < HS_SB_STATS_PERIOD; i++)
+    {
+        HS_MonitorSbPipes();
+    }
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_STUB_COUNT(CFE_SB_GetPipeIdByName, 3);
+#else
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+#endif
+
+} /* end HS_MonitorSbPipes_Test */
+
+void HS_SbStatsTlm_Test_Worst(void)
+{
+    CFE_SB_StatsTlm_t Stats;
+    size_t            MsgSize      = sizeof(Stats);
+    uint16            Depths[5][3] = {{10, 0, 2}, {4, 3, 4}, {0, 0, 0}, {20, 2, 20}, {10, 0, 5}};
+    char              PipeName[]   = "SLOW_PIPE";
+    uint32            i;
+
+    memset(&Stats, 0, sizeof(Stats));
+    Stats.Payload.PipesInUse = 5;
+
+    for (i = 0; i < 5; i++)
+    {
+        Stats.Payload.PipeDepthStats[i].PipeId            = CFE_SB_PIPEID_C(CFE_RESOURCEID_WRAP(i + 1));
+        Stats.Payload.PipeDepthStats[i].MaxQueueDepth     = Depths[i][0];
+        Stats.Payload.PipeDepthStats[i].CurrentQueueDepth = Depths[i][1];
+        Stats.Payload.PipeDepthStats[i].PeakQueueDepth    = Depths[i][2];
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_GetPipeName), PipeName, strlen(PipeName), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_GetPipeName), 3, CFE_SB_BAD_ARGUMENT);
+
+    /* Execute the function being tested */
+    HS_SbStatsTlm((CFE_SB_Buffer_t *)&Stats);
+
+    /* Verify results, highest usage first, then highest peak usage, and pipes without a depth skipped */
+#if HS_SB_WORST_PIPES == 3
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[0].CurrentDepth, 3);
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[0].PeakDepth, 4);
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[0].MaxDepth, 4);
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[0].Usage, 75);
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[0].PeakUsage, 100);
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[1].Usage, 10);
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[2].Usage, 0);
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[2].PeakUsage, 50);
+    UtAssert_True(strcmp(HS_AppData.SbWorstPipes[0].PipeName, "SLOW_PIPE") == 0,
+                  "SbWorstPipes[0].PipeName == SLOW_PIPE");
+    UtAssert_True(HS_AppData.SbWorstPipes[2].PipeName[0] == '\0', "SbWorstPipes[2].PipeName is empty");
+    UtAssert_STUB_COUNT(CFE_SB_GetPipeName, 3);
+#endif
+
+    UtAssert_UINT32_EQ(HS_AppData.SbPipeActiveMask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_SbStatsTlm_Test_Worst */
+
+void HS_SbStatsTlm_Test_Limits(void)
+{
+    CFE_SB_StatsTlm_t Stats;
+    size_t            MsgSize[3] = {sizeof(Stats), sizeof(Stats), sizeof(Stats)};
+
+    memset(&Stats, 0, sizeof(Stats));
+    Stats.Payload.PipesInUse                          = 1;
+    Stats.Payload.PipeDepthStats[0].PipeId            = HS_UT_PIPEID_1;
+    Stats.Payload.PipeDepthStats[0].MaxQueueDepth     = 4;
+    Stats.Payload.PipeDepthStats[0].CurrentQueueDepth = 3;
+
+    strncpy(HS_AppData.SbPipeLimits[0].PipeName, "BUSY_PIPE", sizeof(HS_AppData.SbPipeLimits[0].PipeName) - 1);
+    HS_AppData.SbPipeLimits[0].EnterUsage = 75;
+    HS_AppData.SbPipeLimits[0].ExitUsage  = 25;
+    HS_AppData.SbPipeLimits[0].ActionType = HS_ALARM_ACT_EVENT;
+    HS_AppData.SbPipeIds[0]               = HS_UT_PIPEID_1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    HS_SbStatsTlm((CFE_SB_Buffer_t *)&Stats);
+
+    /* Verify results, the action is taken on reaching the enter usage */
+    UtAssert_UINT32_EQ(HS_AppData.SbPipeActiveMask, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SB_PIPE_BACKLOG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* Not again while above the exit usage */
+    Stats.Payload.PipeDepthStats[0].CurrentQueueDepth = 2;
+    HS_SbStatsTlm((CFE_SB_Buffer_t *)&Stats);
+
+    UtAssert_UINT32_EQ(HS_AppData.SbPipeActiveMask, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Cleared below the exit usage */
+    Stats.Payload.PipeDepthStats[0].CurrentQueueDepth = 0;
+    HS_SbStatsTlm((CFE_SB_Buffer_t *)&Stats);
+
+    UtAssert_UINT32_EQ(HS_AppData.SbPipeActiveMask, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_SB_PIPE_BACKLOG_CLEAR_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+} /* end HS_SbStatsTlm_Test_Limits */
+
+void HS_SbStatsTlm_Test_BadLength(void)
+{
+    CFE_SB_StatsTlm_t Stats;
+    size_t            MsgSize = sizeof(Stats) - 1;
+
+    memset(&Stats, 0, sizeof(Stats));
+    HS_AppData.SbWorstPipes[0].Usage = 5;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    HS_SbStatsTlm((CFE_SB_Buffer_t *)&Stats);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.SbWorstPipes[0].Usage, 5);
+    UtAssert_STUB_COUNT(CFE_SB_GetPipeName, 0);
+
+} /* end HS_SbStatsTlm_Test_BadLength */
+
+void HS_SbHkTlm_Test(void)
+{
+    CFE_SB_HousekeepingTlm_t Hk;
+    size_t                   MsgSize[5] = {sizeof(Hk), sizeof(Hk), sizeof(Hk), sizeof(Hk), sizeof(Hk) - 1};
+
+    memset(&Hk, 0, sizeof(Hk));
+    Hk.Payload.PipeOverflowErrorCounter = 5;
+    Hk.Payload.MsgLimitErrorCounter     = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    HS_SbHkTlm((CFE_SB_Buffer_t *)&Hk);
+
+    /* Verify results, the first packet is only the baseline */
+    UtAssert_BOOL_TRUE(HS_AppData.SbHkReceived);
+    UtAssert_UINT32_EQ(HS_AppData.SbDropCount, 0);
+
+    /* Both counters count dropped messages */
+    Hk.Payload.PipeOverflowErrorCounter = 7;
+    Hk.Payload.MsgLimitErrorCounter     = 2;
+    HS_SbHkTlm((CFE_SB_Buffer_t *)&Hk);
+
+    UtAssert_UINT32_EQ(HS_AppData.SbDropCount, 3);
+
+#if (HS_SB_DROP_THRESHOLD != 0) && (HS_SB_DROP_THRESHOLD <= 3)
+    UtAssert_BOOL_TRUE(HS_AppData.SbDropActive);
+#if HS_SB_DROP_ACTION == HS_ALARM_ACT_EVENT
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SB_DROP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+#endif
+
+    /* A packet without dropped messages clears the action */
+    HS_SbHkTlm((CFE_SB_Buffer_t *)&Hk);
+
+    UtAssert_BOOL_FALSE(HS_AppData.SbDropActive);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent)) - 1].EventID,
+                      HS_SB_DROP_CLEAR_INF_EID);
+#else
+    HS_SbHkTlm((CFE_SB_Buffer_t *)&Hk);
+#endif
+
+    /* A counter that went down was reset */
+    Hk.Payload.PipeOverflowErrorCounter = 1;
+    HS_SbHkTlm((CFE_SB_Buffer_t *)&Hk);
+
+    UtAssert_UINT32_EQ(HS_AppData.SbDropCount, 4);
+    UtAssert_UINT32_EQ(HS_AppData.SbLastOverflowErrors, 1);
+
+    /* Packets of the wrong length are ignored */
+    Hk.Payload.PipeOverflowErrorCounter = 100;
+    HS_SbHkTlm((CFE_SB_Buffer_t *)&Hk);
+
+    UtAssert_UINT32_EQ(HS_AppData.SbDropCount, 4);
+    UtAssert_UINT32_EQ(HS_AppData.SbLastOverflowErrors, 1);
+
+} /* end HS_SbHkTlm_Test */
+
+void HS_SbPipeAction_Test_MsgActs(void)
+{
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+    HS_SbPipeTlm_t PipeTlm;
+
+    memset(MATable, 0, sizeof(MATable));
+    memset(&PipeTlm, 0, sizeof(PipeTlm));
+
+    HS_AppData.MATablePtr                 = MATable;
+    HS_AppData.MsgActsState               = HS_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].EnableState  = HS_MAT_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].Cooldown     = 5;
+    HS_AppData.SbPipeLimits[0].ActionType = HS_ALARM_ACT_LAST_NONMSG + 1;
+
+    strncpy(HS_AppData.SbPipeLimits[0].PipeName, "BUSY_PIPE", sizeof(HS_AppData.SbPipeLimits[0].PipeName) - 1);
+    PipeTlm.CurrentDepth = 9;
+    PipeTlm.MaxDepth     = 10;
+    PipeTlm.Usage        = 90;
+
+    /* Execute the function being tested */
+    HS_SbPipeAction(0, &PipeTlm);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActCooldown[0], 5);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SB_PIPE_BACKLOG_MSGACTS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* Not while cooling down */
+    HS_SbPipeAction(0, &PipeTlm);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_SbPipeAction_Test_MsgActs */
+
+void HS_SbDropAction_Test(void)
+{
+    /* Execute the function being tested */
+    HS_SbDropAction(12);
+
+    /* Verify results */
+#if HS_SB_DROP_ACTION == HS_ALARM_ACT_EVENT
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_SB_DROP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+#elif HS_SB_DROP_ACTION == HS_ALARM_ACT_NOACT
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+#endif
+
+} /* end HS_SbDropAction_Test */
+
+void HS_MonitorWakeup_Test_Intervals(void)
+{
+    HS_WakeupTlm_t *TlmPtr   = &HS_AppData.WakeupTlm;
+    uint64          Times[4] = {5000000000ULL, 6000000000ULL, 7250000000ULL, 7950000000ULL};
+
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), Times, sizeof(Times), false);
+
+    /* Execute the function being tested */
+    HS_MonitorWakeup(CFE_SUCCESS);
+
+    /* Verify results, the first wakeup is only the baseline */
+    UtAssert_UINT32_EQ(TlmPtr->NumIntervals, 0);
+
+    HS_MonitorWakeup(CFE_SUCCESS);
+    HS_MonitorWakeup(CFE_SUCCESS);
+    HS_MonitorWakeup(CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(TlmPtr->NumIntervals, 3);
+    UtAssert_UINT32_EQ(TlmPtr->MinUs, 700000);
+    UtAssert_UINT32_EQ(TlmPtr->MaxUs, 1250000);
+    UtAssert_UINT32_EQ(TlmPtr->MeanUs, 983333);
+    UtAssert_UINT32_EQ(TlmPtr->LastUs, 700000);
+    UtAssert_UINT32_EQ(TlmPtr->MissedCount, 0);
+
+#if (HS_WAKEUP_PERIOD_US == 1000000) && (HS_WAKEUP_LATE_US == 100000)
+    UtAssert_UINT32_EQ(TlmPtr->LateCount, 1);
+#endif
+
+#if (HS_WAKEUP_PERIOD_US == 1000000) && (HS_WAKEUP_HIST_BUCKETS == 16) && (HS_WAKEUP_HIST_BUCKET_US == 10000)
+    UtAssert_UINT32_EQ(TlmPtr->Histogram[0], 1);
+    UtAssert_UINT32_EQ(TlmPtr->Histogram[8], 1);
+    UtAssert_UINT32_EQ(TlmPtr->Histogram[15], 1);
+#endif
+
+} /* end HS_MonitorWakeup_Test_Intervals */
+
+void HS_MonitorWakeup_Test_Timeout(void)
+{
+    uint64 Times[4] = {1000000000ULL, 2200000000ULL, 2500000000ULL, 4000000000ULL};
+
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), Times, sizeof(Times), false);
+
+    /* Execute the function being tested */
+    HS_MonitorWakeup(CFE_SUCCESS);
+    HS_MonitorWakeup(CFE_SB_TIME_OUT);
+
+    /* Verify results, the wakeup due at 2 s is missed */
+#if (HS_WAKEUP_PERIOD_US == 1000000) && (HS_WAKEUP_LATE_US == 100000)
+    UtAssert_UINT32_EQ(HS_AppData.WakeupTlm.MissedCount, 1);
+#endif
+
+    HS_MonitorWakeup(CFE_SB_NO_MESSAGE);
+    HS_MonitorWakeup(CFE_SUCCESS);
+
+    /* Verify results, the wakeup at 4 s settles the gap at two missed and the interval is measured across it */
+#if (HS_WAKEUP_PERIOD_US == 1000000) && (HS_WAKEUP_LATE_US == 100000)
+    UtAssert_UINT32_EQ(HS_AppData.WakeupTlm.MissedCount, 2);
+#endif
+    UtAssert_UINT32_EQ(HS_AppData.WakeupTlm.NumIntervals, 1);
+    UtAssert_UINT32_EQ(HS_AppData.WakeupTlm.LastUs, 3000000);
+    UtAssert_True(HS_AppData.WakeupLastTime == 4000000000ULL, "HS_AppData.WakeupLastTime == 4000000000");
+    UtAssert_True(HS_AppData.WakeupMissed == 0, "HS_AppData.WakeupMissed == 0");
+    UtAssert_STUB_COUNT(HS_GetMonotonicTimeNs, 4);
+
+} /* end HS_MonitorWakeup_Test_Timeout */
+
+void HS_MonitorWakeup_Test_MarkBetweenTimeouts(void)
+{
+    uint64 Times[3] = {1000000000ULL, 2200000000ULL, 3300000000ULL};
+
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), Times, sizeof(Times), false);
+
+    /* Execute the function being tested */
+    HS_MonitorWakeup(CFE_SUCCESS);
+    HS_MonitorWakeup(CFE_SB_TIME_OUT);
+
+    /* A utilization mark arrives between the timeouts, it is drained from its own pipe */
+    HS_CustomMonitorUtilization();
+
+    HS_MonitorWakeup(CFE_SB_TIME_OUT);
+
+    /* Verify results, the mark does not hide the wakeups due at 2 s and 3 s */
+#if (HS_WAKEUP_PERIOD_US == 1000000) && (HS_WAKEUP_LATE_US == 100000)
+    UtAssert_UINT32_EQ(HS_AppData.WakeupTlm.MissedCount, 2);
+#endif
+    UtAssert_UINT32_EQ(HS_AppData.WakeupTlm.NumIntervals, 0);
+    UtAssert_True(HS_AppData.WakeupLastTime == 1000000000ULL, "HS_AppData.WakeupLastTime == 1000000000");
+
+} /* end HS_MonitorWakeup_Test_MarkBetweenTimeouts */
+
+void HS_MonitorCpuBudget_Test_Event(void)
+{
+    HS_CBTEntry_t      CBTable[HS_MAX_CPU_BUDGETS];
+    HS_TaskCpuSample_t Samples[3];
+    uint32             Util[3] = {600, 600, 5000};
+
+    memset(CBTable, 0, sizeof(CBTable));
+    memset(Samples, 0, sizeof(Samples));
+
+    HS_AppData.CBTablePtr     = CBTable;
+    HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+
+    strncpy(HS_AppData.CBTablePtr[0].TaskName, "HOG", sizeof(HS_AppData.CBTablePtr[0].TaskName) - 1);
+    HS_AppData.CBTablePtr[0].Intervals  = 2;
+    HS_AppData.CBTablePtr[0].ActionType = HS_AMT_ACT_EVENT;
+    HS_AppData.CBTablePtr[0].MaxUtil    = 1000;
+
+    /* The threads of the task are summed, other tasks are not */
+    strncpy(Samples[0].Name, "HOG", sizeof(Samples[0].Name) - 1);
+    strncpy(Samples[1].Name, "HOG", sizeof(Samples[1].Name) - 1);
+    strncpy(Samples[2].Name, "OTHER", sizeof(Samples[2].Name) - 1);
+
+    /* Execute the function being tested */
+    HS_MonitorCpuBudget(Samples, Util, 3);
+
+    /* Verify results, nothing happens until the entry's intervals are met */
+    UtAssert_UINT32_EQ(HS_AppData.CpuBudgetCount[0], 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    HS_MonitorCpuBudget(Samples, Util, 3);
+
+    UtAssert_UINT32_EQ(HS_AppData.CpuBudgetCount[0], 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CPUBUDGET_FAIL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* Acted on once while the task stays over budget */
+    HS_MonitorCpuBudget(Samples, Util, 3);
+
+    UtAssert_UINT32_EQ(HS_AppData.CpuBudgetCount[0], 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* Back under budget starts over */
+    Util[0] = 400;
+    HS_MonitorCpuBudget(Samples, Util, 3);
+
+    UtAssert_UINT32_EQ(HS_AppData.CpuBudgetCount[0], 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorCpuBudget_Test_Event */
+
+void HS_MonitorCpuBudget_Test_Restart(void)
+{
+    HS_CBTEntry_t      CBTable[HS_MAX_CPU_BUDGETS];
+    HS_TaskCpuSample_t Samples[1];
+    uint32             Util[1]      = {2000};
+    uint32             UnderUtil[1] = {0};
+
+    memset(CBTable, 0, sizeof(CBTable));
+    memset(Samples, 0, sizeof(Samples));
+
+    HS_AppData.CBTablePtr     = CBTable;
+    HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+
+    strncpy(HS_AppData.CBTablePtr[0].TaskName, "HOG", sizeof(HS_AppData.CBTablePtr[0].TaskName) - 1);
+    HS_AppData.CBTablePtr[0].Intervals  = 1;
+    HS_AppData.CBTablePtr[0].ActionType = HS_AMT_ACT_APP_RESTART;
+    HS_AppData.CBTablePtr[0].MaxUtil    = 1000;
+
+    strncpy(Samples[0].Name, "HOG", sizeof(Samples[0].Name) - 1);
+
+    /* Execute the function being tested */
+    HS_MonitorCpuBudget(Samples, Util, 1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 1);
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskInfo, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RestartApp, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CPUBUDGET_RESTART_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* The owning app can't be found on the next episode */
+    HS_MonitorCpuBudget(Samples, UnderUtil, 1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 1, -1);
+    HS_MonitorCpuBudget(Samples, Util, 1);
+
+    UtAssert_STUB_COUNT(CFE_ES_RestartApp, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_CPUBUDGET_RESTART_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, HS_CPUBUDGET_NOT_RESTARTED_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 3, "CFE_EVS_SendEvent was called %u time(s), expected 3",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorCpuBudget_Test_Restart */
+
+void HS_MonitorCpuBudget_Test_ProcResetLimit(void)
+{
+    HS_CBTEntry_t      CBTable[HS_MAX_CPU_BUDGETS];
+    HS_TaskCpuSample_t Samples[1];
+    uint32             Util[1] = {2000};
+
+    memset(CBTable, 0, sizeof(CBTable));
+    memset(Samples, 0, sizeof(Samples));
+
+    HS_AppData.CBTablePtr     = CBTable;
+    HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+
+    HS_AppData.CDSData.ResetsPerformed = 1;
+    HS_AppData.CDSData.MaxResets       = 1;
+
+    strncpy(HS_AppData.CBTablePtr[0].TaskName, "HOG", sizeof(HS_AppData.CBTablePtr[0].TaskName) - 1);
+    HS_AppData.CBTablePtr[0].Intervals  = 1;
+    HS_AppData.CBTablePtr[0].ActionType = HS_AMT_ACT_PROC_RESET;
+    HS_AppData.CBTablePtr[0].MaxUtil    = 1000;
+
+    strncpy(Samples[0].Name, "HOG", sizeof(Samples[0].Name) - 1);
+
+    /* Execute the function being tested */
+    HS_MonitorCpuBudget(Samples, Util, 1);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_ResetCFE, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CPUBUDGET_PROC_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_RESET_LIMIT_ERR_EID);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorCpuBudget_Test_ProcResetLimit */
+
+void HS_MonitorCpuBudget_Test_MsgActs(void)
+{
+    HS_CBTEntry_t      CBTable[HS_MAX_CPU_BUDGETS];
+    HS_MATEntry_t      MATable[HS_MAX_MSG_ACT_TYPES];
+    HS_TaskCpuSample_t Samples[1];
+    uint32             Util[1] = {2000};
+
+    memset(CBTable, 0, sizeof(CBTable));
+    memset(MATable, 0, sizeof(MATable));
+    memset(Samples, 0, sizeof(Samples));
+
+    HS_AppData.CBTablePtr     = CBTable;
+    HS_AppData.CpuBudgetState = HS_STATE_ENABLED;
+    HS_AppData.MATablePtr     = MATable;
+    HS_AppData.MsgActsState   = HS_STATE_ENABLED;
+
+    HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].Cooldown    = 5;
+
+    strncpy(HS_AppData.CBTablePtr[0].TaskName, "HOG", sizeof(HS_AppData.CBTablePtr[0].TaskName) - 1);
+    HS_AppData.CBTablePtr[0].Intervals  = 1;
+    HS_AppData.CBTablePtr[0].ActionType = HS_AMT_ACT_LAST_NONMSG + 1;
+    HS_AppData.CBTablePtr[0].MaxUtil    = 1000;
+
+    strncpy(Samples[0].Name, "HOG", sizeof(Samples[0].Name) - 1);
+
+    /* Execute the function being tested */
+    HS_MonitorCpuBudget(Samples, Util, 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.MsgActExec, 1);
+    UtAssert_UINT32_EQ(HS_AppData.MsgActCooldown[0], 5);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CPUBUDGET_MSGACTS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorCpuBudget_Test_MsgActs */
+
+void HS_MonitorCpuBudget_Test_Disabled(void)
+{
+    HS_TaskCpuSample_t Samples[1];
+    uint32             Util[1] = {HS_UTIL_PER_INTERVAL_TOTAL};
+
+    memset(Samples, 0, sizeof(Samples));
+
+    HS_AppData.CpuBudgetState = HS_STATE_DISABLED;
+
+    /* Execute the function being tested */
+    HS_MonitorCpuBudget(Samples, Util, 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.CpuBudgetCount[0], 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_MonitorCpuBudget_Test_Disabled */
+
+void HS_HogSnapshotBaseline_Test_TaskCpuSample(void)
+{
+    HS_AppData.TaskCpuSamples[1][0].ThreadId  = 100;
+    HS_AppData.TaskCpuSamples[1][0].CpuTimeNs = 5000;
+    HS_AppData.TaskCpuNumSamples[1]           = 1;
+    HS_AppData.TaskCpuCurrent                 = 1;
+    HS_AppData.TaskCpuLastTime                = 1000000000;
+
+    /* Execute the function being tested */
+    HS_HogSnapshotBaseline();
+
+    /* Verify results, the latest per-task sample is used */
+    UtAssert_UINT32_EQ(HS_AppData.HogBaselineNum, 1);
+    UtAssert_UINT32_EQ(HS_AppData.HogBaseline[0].ThreadId, 100);
+    UtAssert_True(HS_AppData.HogBaselineTime == 1000000000, "HS_AppData.HogBaselineTime == 1000000000");
+    UtAssert_STUB_COUNT(HS_ReadTaskCpuTimes, 0);
+
+} /* end HS_HogSnapshotBaseline_Test_TaskCpuSample */
+
+void HS_HogSnapshotBaseline_Test_Read(void)
+{
+    HS_TaskCpuSample_t Samples[2];
+    uint64             Now = 3000000000;
+
+    memset(Samples, 0, sizeof(Samples));
+    Samples[0].ThreadId = 100;
+    Samples[1].ThreadId = 101;
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadTaskCpuTimes), Samples, sizeof(Samples), false);
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), &Now, sizeof(Now), false);
+
+    /* Execute the function being tested */
+    HS_HogSnapshotBaseline();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(HS_AppData.HogBaselineNum, 2);
+    UtAssert_True(HS_AppData.HogBaselineTime == Now, "HS_AppData.HogBaselineTime == Now");
+
+    /* No baseline when the thread CPU times can't be read */
+    UT_SetDefaultReturnValue(UT_KEY(HS_ReadTaskCpuTimes), CFE_STATUS_NOT_IMPLEMENTED);
+
+    HS_HogSnapshotBaseline();
+
+    UtAssert_True(HS_AppData.HogBaselineTime == 0, "HS_AppData.HogBaselineTime == 0");
+
+} /* end HS_HogSnapshotBaseline_Test_Read */
+
+void HS_HogSnapshotCapture_Test_Nominal(void)
+{
+    HS_HogSnapshot_t * SnapPtr = &HS_AppData.HogSnapshot;
+    HS_TaskCpuSample_t Samples[3];
+    uint64             Now = 3000000000;
+    uint32             i;
+
+    /* Baseline two seconds ago */
+    HS_AppData.HogBaseline[0].ThreadId  = 100;
+    HS_AppData.HogBaseline[0].CpuTimeNs = 1000000000;
+    HS_AppData.HogBaseline[1].ThreadId  = 101;
+    HS_AppData.HogBaseline[1].CpuTimeNs = 0;
+    HS_AppData.HogBaselineNum           = 2;
+    HS_AppData.HogBaselineTime          = 1000000000;
+
+    for (i = 0; i < HS_UTIL_PEAK_NUM_INTERVAL; i++)
+    {
+        HS_AppData.UtilizationTracker[i] = i;
+    }
+
+    /* Thread 101 hogged, thread 102 started during the window */
+    memset(Samples, 0, sizeof(Samples));
+    Samples[0].ThreadId  = 100;
+    Samples[0].CpuTimeNs = 1200000000;
+    Samples[0].State     = 'S';
+    strncpy(Samples[0].Name, "IDLE", sizeof(Samples[0].Name) - 1);
+    Samples[1].ThreadId  = 101;
+    Samples[1].CpuTimeNs = 2000000000;
+    Samples[1].State     = 'R';
+    strncpy(Samples[1].Name, "HOG", sizeof(Samples[1].Name) - 1);
+    Samples[2].ThreadId  = 102;
+    Samples[2].CpuTimeNs = 500000000;
+    Samples[2].State     = 'D';
+    strncpy(Samples[2].Name, "NEW", sizeof(Samples[2].Name) - 1);
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadTaskCpuTimes), Samples, sizeof(Samples), false);
+    UT_SetDataBuffer(UT_KEY(HS_GetMonotonicTimeNs), &Now, sizeof(Now), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write),
+                             sizeof(HS_HogSnapshot_t) - sizeof(SnapPtr->Entries) + (3 * sizeof(HS_HogSnapshotEntry_t)));
+
+    /* Execute the function being tested */
+    HS_HogSnapshotCapture(HS_UTIL_PEAK_NUM_INTERVAL - 1);
+
+    /* Verify results, sorted by CPU time over the window */
+    UtAssert_UINT32_EQ(SnapPtr->WindowMs, 2000);
+    UtAssert_UINT32_EQ(SnapPtr->NumEntries, 3);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[0].ThreadId, 101);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[0].CpuTimeUs, 2000000);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[0].Util, HS_UTIL_PER_INTERVAL_TOTAL);
+    UtAssert_INT32_EQ(SnapPtr->Entries[0].State, 'R');
+    UtAssert_STRINGBUF_EQ(SnapPtr->Entries[0].TaskName, sizeof(SnapPtr->Entries[0].TaskName), "HOG", sizeof("HOG"));
+    UtAssert_UINT32_EQ(SnapPtr->Entries[1].ThreadId, 102);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[1].Util, HS_UTIL_PER_INTERVAL_TOTAL / 4);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[2].ThreadId, 100);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[2].CpuTimeUs, 200000);
+
+    /* Most recent utilization last */
+    UtAssert_UINT32_EQ(SnapPtr->Util[HS_HOG_SNAPSHOT_NUM_UTIL - 1], HS_UTIL_PEAK_NUM_INTERVAL - 1);
+    UtAssert_UINT32_EQ(SnapPtr->Util[0], HS_UTIL_PEAK_NUM_INTERVAL - HS_HOG_SNAPSHOT_NUM_UTIL);
+
+    UtAssert_STUB_COUNT(OS_write, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HOG_SNAPSHOT_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_HogSnapshotCapture_Test_Nominal */
+
+void HS_HogSnapshotCapture_Test_NoBaseline(void)
+{
+    HS_HogSnapshot_t * SnapPtr = &HS_AppData.HogSnapshot;
+    HS_TaskCpuSample_t Samples[1];
+
+    memset(Samples, 0, sizeof(Samples));
+    Samples[0].ThreadId  = 100;
+    Samples[0].CpuTimeNs = 1200000000;
+
+    UT_SetDataBuffer(UT_KEY(HS_ReadTaskCpuTimes), Samples, sizeof(Samples), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write),
+                             sizeof(HS_HogSnapshot_t) - sizeof(SnapPtr->Entries) + sizeof(HS_HogSnapshotEntry_t));
+
+    /* Execute the function being tested */
+    HS_HogSnapshotCapture(0);
+
+    /* Verify results, the threads are listed without CPU time */
+    UtAssert_UINT32_EQ(SnapPtr->WindowMs, 0);
+    UtAssert_UINT32_EQ(SnapPtr->NumEntries, 1);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[0].CpuTimeUs, 0);
+    UtAssert_UINT32_EQ(SnapPtr->Entries[0].Util, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HOG_SNAPSHOT_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_HogSnapshotCapture_Test_NoBaseline */
+
+void HS_HogSnapshotWriteFile_Test_Nominal(void)
+{
+    HS_HogSnapshot_t Snapshot;
+
+    memset(&Snapshot, 0, sizeof(Snapshot));
+    Snapshot.NumEntries = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write),
+                             sizeof(Snapshot) - sizeof(Snapshot.Entries) + (2 * sizeof(HS_HogSnapshotEntry_t)));
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_HogSnapshotWriteFile("/ram/test.dat", &Snapshot), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+} /* end HS_HogSnapshotWriteFile_Test_Nominal */
+
+void HS_HogSnapshotWriteFile_Test_CreateError(void)
+{
+    HS_HogSnapshot_t Snapshot;
+
+    memset(&Snapshot, 0, sizeof(Snapshot));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_HogSnapshotWriteFile("/ram/test.dat", &Snapshot), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HOG_SNAPSHOT_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_HogSnapshotWriteFile_Test_CreateError */
+
+void HS_HogSnapshotWriteFile_Test_HeaderError(void)
+{
+    HS_HogSnapshot_t Snapshot;
+
+    memset(&Snapshot, 0, sizeof(Snapshot));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_HogSnapshotWriteFile("/ram/test.dat", &Snapshot), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HOG_SNAPSHOT_FILE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_HogSnapshotWriteFile_Test_HeaderError */
+
+void HS_HogSnapshotWriteFile_Test_WriteError(void)
+{
+    HS_HogSnapshot_t Snapshot;
+
+    memset(&Snapshot, 0, sizeof(Snapshot));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_HogSnapshotWriteFile("/ram/test.dat", &Snapshot), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_HOG_SNAPSHOT_FILE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+} /* end HS_HogSnapshotWriteFile_Test_WriteError */
+
+void HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        HS_AppData.AMTablePtr[i].ActionType = 99;
+        HS_AppData.AMTablePtr[i].CycleCount = 0;
+        HS_AppData.AMTablePtr[i].NullTerm   = 0;
+    }
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero */
+
+void HS_ValidateAMTable_Test_UnusedTableEntryActionTypeNOACT(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        HS_AppData.AMTablePtr[i].ActionType = HS_AMT_ACT_NOACT;
+        HS_AppData.AMTablePtr[i].CycleCount = 1;
+        HS_AppData.AMTablePtr[i].NullTerm   = 0;
+    }
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateAMTable_Test_UnusedTableEntryActionTypeNOACT */
+
+void HS_ValidateAMTable_Test_BufferNotNull(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify err: Entry = %%d, Err = %%d, Action = %%d, App = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        HS_AppData.AMTablePtr[i].ActionType = 99;
+        HS_AppData.AMTablePtr[i].CycleCount = 1;
+        HS_AppData.AMTablePtr[i].NullTerm   = 2;
+    }
+
+    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_AMTVAL_ERR_NUL, "Result == HS_AMTVAL_ERR_NUL");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateAMTable_Test_BufferNotNull */
+
+void HS_ValidateAMTable_Test_ActionTypeNotValid(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+
+    memset(AMTable, 0, sizeof(AMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify err: Entry = %%d, Err = %%d, Action = %%d, App = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    {
+        HS_AppData.AMTablePtr[i].ActionType = HS_AMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+        HS_AppData.AMTablePtr[i].CycleCount = 1;
+        HS_AppData.AMTablePtr[i].NullTerm   = 0;
+    }
+
+    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_AMTVAL_ERR_ACT, "Result == HS_AMTVAL_ERR_ACT");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateAMTable_Test_BufferNotNull */
+} /* end HS_ValidateAMTable_Test_ActionTypeNotValid */
 
-void HS_ValidateAMTable_Test_ActionTypeNotValid(void)
+void HS_ValidateAMTable_Test_EntryGood(void)
 {
     int32         Result;
     uint32        i;
@@ -2076,34 +4353,236 @@ void HS_ValidateAMTable_Test_ActionTypeNotValid(void)
     memset(AMTable, 0, sizeof(AMTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "AppMon verify err: Entry = %%d, Err = %%d, Action = %%d, App = %%s");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
              "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
 
     HS_AppData.AMTablePtr = AMTable;
 
     for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
     {
-        HS_AppData.AMTablePtr[i].ActionType = HS_AMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+        HS_AppData.AMTablePtr[i].ActionType = HS_AMT_ACT_LAST_NONMSG;
         HS_AppData.AMTablePtr[i].CycleCount = 1;
         HS_AppData.AMTablePtr[i].NullTerm   = 0;
     }
 
     strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
 
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTActionIsValid), true);
+
     /* Execute the function being tested */
     Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateAMTable_Test_EntryGood */
+
+void HS_ValidateAMTable_Test_Null(void)
+{
+    int32 Result;
+
+    /* Execute the function being tested */
+    Result = HS_ValidateAMTable(NULL);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AM_TBL_NULL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
+    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void HS_ValidateEMTable_Test_UnusedTableEntryEventIDZero(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.EMTablePtr = EMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].ActionType = 99;
+        HS_AppData.EMTablePtr[i].EventID    = 0;
+        HS_AppData.EMTablePtr[i].NullTerm   = 0;
+    }
+
+    /* Execute the function being tested */
+    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
     strCmpResult =
         strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateEMTable_Test_UnusedTableEntryEventIDZero */
+
+void HS_ValidateEMTable_Test_UnusedTableEntryActionTypeNOACT(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.EMTablePtr = EMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_NOACT;
+        HS_AppData.EMTablePtr[i].EventID    = 1;
+        HS_AppData.EMTablePtr[i].NullTerm   = 0;
+    }
+
+    /* Execute the function being tested */
+    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateEMTable_Test_UnusedTableEntryActionTypeNOACT */
+
+void HS_ValidateEMTable_Test_BufferNotNull(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EventMon verify err: Entry = %%d, Err = %%d, Action = %%d, ID = %%d App = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.EMTablePtr = EMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].ActionType = 99;
+        HS_AppData.EMTablePtr[i].EventID    = 1;
+        HS_AppData.EMTablePtr[i].NullTerm   = 2;
+    }
+
+    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_EMTVAL_ERR_NUL, "Result == HS_EMTVAL_ERR_NUL");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateEMTable_Test_BufferNotNull */
+
+void HS_ValidateEMTable_Test_ActionTypeNotValid(void)
+{
+    int32         Result;
+    uint32        i;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EventMon verify err: Entry = %%d, Err = %%d, Action = %%d, ID = %%d App = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+
+    HS_AppData.EMTablePtr = EMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
+        HS_AppData.EMTablePtr[i].EventID    = 1;
+        HS_AppData.EMTablePtr[i].NullTerm   = 0;
+    }
+
+    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EMTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2117,39 +4596,71 @@ void HS_ValidateAMTable_Test_ActionTypeNotValid(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateAMTable_Test_ActionTypeNotValid */
+} /* end HS_ValidateEMTable_Test_ActionTypeNotValid */
+
+void HS_ValidateEMTable_Test_PaddingNotZero(void)
+{
+    int32         Result;
+    uint32        i;
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+
+    memset(EMTable, 0, sizeof(EMTable));
+
+    HS_AppData.EMTablePtr = EMTable;
+
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_LAST_NONMSG;
+        HS_AppData.EMTablePtr[i].EventID    = 1;
+    }
+
+    HS_AppData.EMTablePtr[1].Padding = 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(HS_EMTActionIsValid), true);
+
+    /* Execute the function being tested */
+    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+
+    /* Verify results, only the entry with padding set is bad */
+    UtAssert_INT32_EQ(Result, HS_EMTVAL_ERR_PAD);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+} /* end HS_ValidateEMTable_Test_PaddingNotZero */
 
-void HS_ValidateAMTable_Test_EntryGood(void)
+void HS_ValidateEMTable_Test_EntryGood(void)
 {
     int32         Result;
     uint32        i;
     int32         strCmpResult;
     char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_AMTEntry_t AMTable[HS_MAX_MONITORED_APPS];
+    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
 
-    memset(AMTable, 0, sizeof(AMTable));
+    memset(EMTable, 0, sizeof(EMTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "AppMon verify results: good = %%d, bad = %%d, unused = %%d");
+             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.AMTablePtr = AMTable;
+    HS_AppData.EMTablePtr = EMTable;
 
-    for (i = 0; i < HS_MAX_MONITORED_APPS; i++)
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
     {
-        HS_AppData.AMTablePtr[i].ActionType = HS_AMT_ACT_LAST_NONMSG;
-        HS_AppData.AMTablePtr[i].CycleCount = 1;
-        HS_AppData.AMTablePtr[i].NullTerm   = 0;
+        HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_LAST_NONMSG;
+        HS_AppData.EMTablePtr[i].EventID    = 1;
+        HS_AppData.EMTablePtr[i].NullTerm   = 0;
     }
 
-    strncpy(HS_AppData.AMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
 
-    UT_SetDefaultReturnValue(UT_KEY(HS_AMTActionIsValid), true);
+    UT_SetDefaultReturnValue(UT_KEY(HS_EMTActionIsValid), true);
 
     /* Execute the function being tested */
-    Result = HS_ValidateAMTable(HS_AppData.AMTablePtr);
+    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2163,19 +4674,29 @@ void HS_ValidateAMTable_Test_EntryGood(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateAMTable_Test_EntryGood */
+} /* end HS_ValidateEMTable_Test_EntryGood */
 
-void HS_ValidateAMTable_Test_Null(void)
+void HS_ValidateEMTable_Test_Null(void)
 {
     int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error in EM Table Validation. Table is null.");
 
     /* Execute the function being tested */
-    Result = HS_ValidateAMTable(NULL);
+    Result = HS_ValidateEMTable(NULL);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_AM_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EM_TBL_NULL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
+    strCmpResult =
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
     UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
@@ -2183,33 +4704,33 @@ void HS_ValidateAMTable_Test_Null(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void HS_ValidateEMTable_Test_UnusedTableEntryEventIDZero(void)
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_ValidateXCTable_Test_UnusedTableEntry(void)
 {
     int32         Result;
     uint32        i;
     int32         strCmpResult;
     char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
 
-    memset(EMTable, 0, sizeof(EMTable));
+    memset(XCTable, 0, sizeof(XCTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.XCTablePtr = XCTable;
 
-    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
     {
-        HS_AppData.EMTablePtr[i].ActionType = 99;
-        HS_AppData.EMTablePtr[i].EventID    = 0;
-        HS_AppData.EMTablePtr[i].NullTerm   = 0;
+        HS_AppData.XCTablePtr[i].ResourceType = HS_XCT_TYPE_NOTYPE;
+        HS_AppData.XCTablePtr[i].NullTerm     = 0;
     }
 
     /* Execute the function being tested */
-    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2223,81 +4744,101 @@ void HS_ValidateEMTable_Test_UnusedTableEntryEventIDZero(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateEMTable_Test_UnusedTableEntryEventIDZero */
+} /* end HS_ValidateXCTable_Test_UnusedTableEntry */
+#endif
 
-void HS_ValidateEMTable_Test_UnusedTableEntryActionTypeNOACT(void)
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_ValidateXCTable_Test_BufferNotNull(void)
 {
     int32         Result;
     uint32        i;
     int32         strCmpResult;
     char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
 
-    memset(EMTable, 0, sizeof(EMTable));
+    memset(XCTable, 0, sizeof(XCTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.XCTablePtr = XCTable;
 
-    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
     {
-        HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_NOACT;
-        HS_AppData.EMTablePtr[i].EventID    = 1;
-        HS_AppData.EMTablePtr[i].NullTerm   = 0;
+        HS_AppData.XCTablePtr[i].ResourceType = 99;
+        HS_AppData.XCTablePtr[i].NullTerm     = 1;
     }
 
+    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
+
     /* Execute the function being tested */
-    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
         strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_XCTVAL_ERR_NUL, "Result == HS_XCTVAL_ERR_NUL");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateEMTable_Test_UnusedTableEntryActionTypeNOACT */
+} /* end HS_ValidateXCTable_Test_BufferNotNull */
+#endif
 
-void HS_ValidateEMTable_Test_BufferNotNull(void)
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_ValidateXCTable_Test_ResourceTypeNotValid(void)
 {
     int32         Result;
     uint32        i;
     int32         strCmpResult;
     char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
 
-    memset(EMTable, 0, sizeof(EMTable));
+    memset(XCTable, 0, sizeof(XCTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "EventMon verify err: Entry = %%d, Err = %%d, Action = %%d, ID = %%d App = %%s");
+             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
     snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.XCTablePtr = XCTable;
 
-    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
     {
-        HS_AppData.EMTablePtr[i].ActionType = 99;
-        HS_AppData.EMTablePtr[i].EventID    = 1;
-        HS_AppData.EMTablePtr[i].NullTerm   = 2;
+        HS_AppData.XCTablePtr[i].ResourceType = 99;
+        HS_AppData.XCTablePtr[i].NullTerm     = 0;
     }
 
-    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+    /* take all branches for "Resource Type is not valid" */
+    HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_MAIN;
+    HS_AppData.XCTablePtr[1].ResourceType = HS_XCT_TYPE_APP_CHILD;
+    HS_AppData.XCTablePtr[2].ResourceType = HS_XCT_TYPE_DEVICE;
+    HS_AppData.XCTablePtr[3].ResourceType = HS_XCT_TYPE_ISR;
+
+    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
 
     /* Execute the function being tested */
-    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
@@ -2305,7 +4846,7 @@ void HS_ValidateEMTable_Test_BufferNotNull(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2313,99 +4854,124 @@ void HS_ValidateEMTable_Test_BufferNotNull(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 
-    UtAssert_True(Result == HS_EMTVAL_ERR_NUL, "Result == HS_EMTVAL_ERR_NUL");
+    UtAssert_True(Result == HS_XCTVAL_ERR_TYPE, "Result == HS_XCTVAL_ERR_TYPE");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateEMTable_Test_BufferNotNull */
+} /* end HS_ValidateXCTable_Test_ResourceTypeNotValid */
+#endif
 
-void HS_ValidateEMTable_Test_ActionTypeNotValid(void)
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_ValidateXCTable_Test_EntryGood(void)
 {
     int32         Result;
     uint32        i;
     int32         strCmpResult;
     char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
 
-    memset(EMTable, 0, sizeof(EMTable));
+    memset(XCTable, 0, sizeof(XCTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "EventMon verify err: Entry = %%d, Err = %%d, Action = %%d, ID = %%d App = %%s");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.XCTablePtr = XCTable;
 
-    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
     {
-        HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
-        HS_AppData.EMTablePtr[i].EventID    = 1;
-        HS_AppData.EMTablePtr[i].NullTerm   = 0;
+        HS_AppData.XCTablePtr[i].ResourceType = HS_XCT_TYPE_APP_MAIN;
+        HS_AppData.XCTablePtr[i].NullTerm     = 0;
     }
 
-    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
-
     /* Execute the function being tested */
-    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
         strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_EMTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateXCTable_Test_EntryGood */
+#endif
+
+#if HS_MAX_EXEC_CNT_SLOTS != 0
+void HS_ValidateXCTable_Test_Null(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error in XC Table Validation. Table is null.");
+
+    /* Execute the function being tested */
+    Result = HS_ValidateXCTable(NULL);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XC_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
-        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(Result == HS_AMTVAL_ERR_ACT, "Result == HS_AMTVAL_ERR_ACT");
+    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
+}
+#endif
 
-} /* end HS_ValidateEMTable_Test_ActionTypeNotValid */
-
-void HS_ValidateEMTable_Test_EntryGood(void)
+void HS_ValidateMATable_Test_UnusedTableEntry(void)
 {
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_EMTEntry_t EMTable[HS_MAX_MONITORED_EVENTS];
+    int32          Result;
+    uint32         i;
+    CFE_SB_MsgId_t TestMsgId;
+    size_t         MsgSize;
+    int32          strCmpResult;
+    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
 
-    memset(EMTable, 0, sizeof(EMTable));
+    memset(MATable, 0, sizeof(MATable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "EventMon verify results: good = %%d, bad = %%d, unused = %%d");
+             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.EMTablePtr = EMTable;
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    MsgSize   = sizeof(HS_NoArgsCmd_t);
 
-    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    HS_AppData.MATablePtr = MATable;
+
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
     {
-        HS_AppData.EMTablePtr[i].ActionType = HS_EMT_ACT_LAST_NONMSG;
-        HS_AppData.EMTablePtr[i].EventID    = 1;
-        HS_AppData.EMTablePtr[i].NullTerm   = 0;
-    }
+        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_DISABLED;
 
-    strncpy(HS_AppData.EMTablePtr[0].AppName, "AppName", OS_MAX_API_NAME);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    }
 
-    UT_SetDefaultReturnValue(UT_KEY(HS_EMTActionIsValid), true);
+    /* take secondary branch for "Enable State is Invalid" */
+    HS_AppData.MATablePtr[1].EnableState = HS_MAT_STATE_NOEVENT;
 
     /* Execute the function being tested */
-    Result = HS_ValidateEMTable(HS_AppData.EMTablePtr);
+    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EMTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2419,22 +4985,43 @@ void HS_ValidateEMTable_Test_EntryGood(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateEMTable_Test_EntryGood */
+} /* end HS_ValidateMATable_Test_UnusedTableEntry */
 
-void HS_ValidateEMTable_Test_Null(void)
+void HS_ValidateMATable_Test_InvalidEnableState(void)
 {
-    int32 Result;
-    int32 strCmpResult;
-    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    int32          Result;
+    uint32         i;
+    CFE_SB_MsgId_t TestMsgId;
+    size_t         MsgSize;
+    int32          strCmpResult;
+    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+
+    memset(MATable, 0, sizeof(MATable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error in EM Table Validation. Table is null.");
+             "MsgActs verify err: Entry = %%d, Err = %%d, Length = %%d, ID = 0x%%08lX");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
+
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    MsgSize   = sizeof(HS_NoArgsCmd_t);
+
+    HS_AppData.MATablePtr = MATable;
+
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
+    {
+        HS_AppData.MATablePtr[i].EnableState = 99;
+
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    }
 
     /* Execute the function being tested */
-    Result = HS_ValidateEMTable(NULL);
+    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_EM_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
@@ -2442,87 +5029,115 @@ void HS_ValidateEMTable_Test_Null(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_MATVAL_ERR_ENA, "Result == HS_MATVAL_ERR_ENA");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
-}
 
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_ValidateXCTable_Test_UnusedTableEntry(void)
+} /* end HS_ValidateMATable_Test_InvalidEnableState */
+
+void HS_ValidateMATable_Test_MessageIDTooHigh(void)
 {
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+    int32          Result;
+    uint32         i;
+    CFE_SB_MsgId_t TestMsgId;
+    size_t         MsgSize;
+    int32          strCmpResult;
+    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
 
-    memset(XCTable, 0, sizeof(XCTable));
+    memset(MATable, 0, sizeof(MATable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+             "MsgActs verify err: Entry = %%d, Err = %%d, Length = %%d, ID = 0x%%08lX");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.XCTablePtr = XCTable;
+    TestMsgId = CFE_SB_INVALID_MSG_ID;
+    MsgSize   = sizeof(HS_NoArgsCmd_t);
 
-    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
+    HS_AppData.MATablePtr = MATable;
+
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
     {
-        HS_AppData.XCTablePtr[i].ResourceType = HS_XCT_TYPE_NOTYPE;
-        HS_AppData.XCTablePtr[i].NullTerm     = 0;
+        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_ENABLED;
+
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
     }
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
         strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_MATVAL_ERR_ID, "Result == HS_MATVAL_ERR_ID");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateXCTable_Test_UnusedTableEntry */
-#endif
+} /* end HS_ValidateMATable_Test_MessageIDTooHigh */
 
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_ValidateXCTable_Test_BufferNotNull(void)
+void HS_ValidateMATable_Test_LengthTooHigh(void)
 {
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+    int32          Result;
+    uint32         i;
+    CFE_SB_MsgId_t TestMsgId;
+    size_t         MsgSize;
+    int32          strCmpResult;
+    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
 
-    memset(XCTable, 0, sizeof(XCTable));
+    memset(MATable, 0, sizeof(MATable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
+             "MsgActs verify err: Entry = %%d, Err = %%d, Length = %%d, ID = 0x%%08lX");
     snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.XCTablePtr = XCTable;
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    MsgSize   = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
 
-    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
+    HS_AppData.MATablePtr = MATable;
+
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
     {
-        HS_AppData.XCTablePtr[i].ResourceType = 99;
-        HS_AppData.XCTablePtr[i].NullTerm     = 1;
-    }
+        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_ENABLED;
 
-    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    }
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
@@ -2530,7 +5145,7 @@ void HS_ValidateXCTable_Test_BufferNotNull(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MATVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2538,150 +5153,172 @@ void HS_ValidateXCTable_Test_BufferNotNull(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 
-    UtAssert_True(Result == HS_XCTVAL_ERR_NUL, "Result == HS_XCTVAL_ERR_NUL");
+    UtAssert_True(Result == HS_MATVAL_ERR_LEN, "Result == HS_MATVAL_ERR_LEN");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateXCTable_Test_BufferNotNull */
-#endif
+} /* end HS_ValidateMATable_Test_LengthTooHigh */
 
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_ValidateXCTable_Test_ResourceTypeNotValid(void)
+void HS_ValidateMATable_Test_EntryGood(void)
 {
-    int32         Result;
-    uint32        i;
-    int32         strCmpResult;
-    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+    int32          Result;
+    uint32         i;
+    CFE_SB_MsgId_t TestMsgId;
+    size_t         MsgSize;
+    int32          strCmpResult;
+    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
 
-    memset(XCTable, 0, sizeof(XCTable));
+    memset(MATable, 0, sizeof(MATable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify err: Entry = %%d, Err = %%d, Type = %%d, Name = %%s");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
+             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
 
-    HS_AppData.XCTablePtr = XCTable;
+    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
+    MsgSize   = sizeof(HS_NoArgsCmd_t);
 
-    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
-    {
-        HS_AppData.XCTablePtr[i].ResourceType = 99;
-        HS_AppData.XCTablePtr[i].NullTerm     = 0;
-    }
+    HS_AppData.MATablePtr = MATable;
 
-    /* take all branches for "Resource Type is not valid" */
-    HS_AppData.XCTablePtr[0].ResourceType = HS_XCT_TYPE_APP_MAIN;
-    HS_AppData.XCTablePtr[1].ResourceType = HS_XCT_TYPE_APP_CHILD;
-    HS_AppData.XCTablePtr[2].ResourceType = HS_XCT_TYPE_DEVICE;
-    HS_AppData.XCTablePtr[3].ResourceType = HS_XCT_TYPE_ISR;
+    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
+    {
+        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_ENABLED;
 
-    strncpy(HS_AppData.XCTablePtr[0].ResourceName, "ResourceName", OS_MAX_API_NAME);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    }
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
         strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_XCTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateMATable_Test_EntryGood */
+
+void HS_ValidateMATable_Test_Null(void)
+{
+    int32 Result;
+    int32 strCmpResult;
+    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Error in MA Table Validation. Table is null.");
+
+    /* Execute the function being tested */
+    Result = HS_ValidateMATable(NULL);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MA_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
-        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(Result == HS_XCTVAL_ERR_TYPE, "Result == HS_XCTVAL_ERR_TYPE");
+    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
+}
 
-} /* end HS_ValidateXCTable_Test_ResourceTypeNotValid */
-#endif
-
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_ValidateXCTable_Test_EntryGood(void)
+void HS_ValidateLSTable_Test_InvalidEnableState(void)
 {
     int32         Result;
     uint32        i;
     int32         strCmpResult;
     char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_XCTEntry_t XCTable[HS_MAX_EXEC_CNT_SLOTS];
+    HS_LSTEntry_t LSTable[HS_MAX_LOAD_SHED_STEPS];
 
-    memset(XCTable, 0, sizeof(XCTable));
+    memset(LSTable, 0, sizeof(LSTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "ExeCount verify results: good = %%d, bad = %%d, unused = %%d");
-
-    HS_AppData.XCTablePtr = XCTable;
+             "LoadShed verify err: Entry = %%d, Err = %%d, Length = %%d, ID = 0x%%08lX");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "LoadShed verify results: good = %%d, bad = %%d, unused = %%d");
 
-    for (i = 0; i < HS_MAX_EXEC_CNT_SLOTS; i++)
+    for (i = 0; i < HS_MAX_LOAD_SHED_STEPS; i++)
     {
-        HS_AppData.XCTablePtr[i].ResourceType = HS_XCT_TYPE_APP_MAIN;
-        HS_AppData.XCTablePtr[i].NullTerm     = 0;
+        LSTable[i].EnableState = 99;
     }
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(HS_AppData.XCTablePtr);
+    Result = HS_ValidateLSTable(LSTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XCTVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LSTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
         strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_LSTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult =
+        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+
+    UtAssert_True(Result == HS_LSTVAL_ERR_ENA, "Result == HS_LSTVAL_ERR_ENA");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateXCTable_Test_EntryGood */
-#endif
+} /* end HS_ValidateLSTable_Test_InvalidEnableState */
 
-#if HS_MAX_EXEC_CNT_SLOTS != 0
-void HS_ValidateXCTable_Test_Null(void)
+void HS_ValidateLSTable_Test_InvalidMsgId(void)
 {
-    int32 Result;
-    int32 strCmpResult;
-    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    int32          Result;
+    CFE_SB_MsgId_t TestMsgId;
+    size_t         MsgSize;
+    HS_LSTEntry_t  LSTable[HS_MAX_LOAD_SHED_STEPS];
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error in XC Table Validation. Table is null.");
+    memset(LSTable, 0, sizeof(LSTable));
+
+    TestMsgId = CFE_SB_INVALID_MSG_ID;
+    MsgSize   = sizeof(HS_NoArgsCmd_t);
+
+    LSTable[0].EnableState = HS_LST_STATE_ENABLED;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
     /* Execute the function being tested */
-    Result = HS_ValidateXCTable(NULL);
+    Result = HS_ValidateLSTable(LSTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_XC_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LSTVAL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_LSTVAL_INF_EID);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
+    UtAssert_True(Result == HS_LSTVAL_ERR_ID, "Result == HS_LSTVAL_ERR_ID");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
-}
-#endif
 
-void HS_ValidateMATable_Test_UnusedTableEntry(void)
+} /* end HS_ValidateLSTable_Test_InvalidMsgId */
+
+void HS_ValidateLSTable_Test_EntryGood(void)
 {
     int32          Result;
     uint32         i;
@@ -2689,34 +5326,29 @@ void HS_ValidateMATable_Test_UnusedTableEntry(void)
     size_t         MsgSize;
     int32          strCmpResult;
     char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+    HS_LSTEntry_t  LSTable[HS_MAX_LOAD_SHED_STEPS];
 
-    memset(MATable, 0, sizeof(MATable));
+    memset(LSTable, 0, sizeof(LSTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
+             "LoadShed verify results: good = %%d, bad = %%d, unused = %%d");
 
     TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
     MsgSize   = sizeof(HS_NoArgsCmd_t);
 
-    HS_AppData.MATablePtr = MATable;
-
-    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
+    for (i = 0; i < HS_MAX_LOAD_SHED_STEPS; i++)
     {
-        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_DISABLED;
+        LSTable[i].EnableState = HS_LST_STATE_ENABLED;
 
         UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
         UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
     }
 
-    /* take secondary branch for "Enable State is Invalid" */
-    HS_AppData.MATablePtr[1].EnableState = HS_MAT_STATE_NOEVENT;
-
     /* Execute the function being tested */
-    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
+    Result = HS_ValidateLSTable(LSTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LSTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2730,43 +5362,50 @@ void HS_ValidateMATable_Test_UnusedTableEntry(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateMATable_Test_UnusedTableEntry */
+} /* end HS_ValidateLSTable_Test_EntryGood */
 
-void HS_ValidateMATable_Test_InvalidEnableState(void)
+void HS_ValidateLSTable_Test_Null(void)
 {
-    int32          Result;
-    uint32         i;
-    CFE_SB_MsgId_t TestMsgId;
-    size_t         MsgSize;
-    int32          strCmpResult;
-    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+    int32 Result;
 
-    memset(MATable, 0, sizeof(MATable));
+    /* Execute the function being tested */
+    Result = HS_ValidateLSTable(NULL);
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify err: Entry = %%d, Err = %%d, Length = %%d, ID = 0x%%08lX");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_LS_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
-    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
-    MsgSize   = sizeof(HS_NoArgsCmd_t);
+    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
-    HS_AppData.MATablePtr = MATable;
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
 
-    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
-    {
-        HS_AppData.MATablePtr[i].EnableState = 99;
+} /* end HS_ValidateLSTable_Test_Null */
 
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
-    }
+void HS_ValidateCBTable_Test_NullTermError(void)
+{
+    int32         Result;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_CBTEntry_t CBTable[HS_MAX_CPU_BUDGETS];
+
+    memset(CBTable, 0, sizeof(CBTable));
+
+    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CpuBudget verify err: Entry = %%d, Err = %%d, Action = %%d, Task = %%s");
+    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CpuBudget verify results: good = %%d, bad = %%d, unused = %%d");
+
+    CBTable[0].Intervals  = 1;
+    CBTable[0].ActionType = HS_AMT_ACT_EVENT;
+    CBTable[0].NullTerm   = 1;
 
     /* Execute the function being tested */
-    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
+    Result = HS_ValidateCBTable(CBTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CBTVAL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
@@ -2774,7 +5413,7 @@ void HS_ValidateMATable_Test_InvalidEnableState(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_CBTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2782,107 +5421,114 @@ void HS_ValidateMATable_Test_InvalidEnableState(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 
-    UtAssert_True(Result == HS_MATVAL_ERR_ENA, "Result == HS_MATVAL_ERR_ENA");
+    UtAssert_True(Result == HS_CBTVAL_ERR_NUL, "Result == HS_CBTVAL_ERR_NUL");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateMATable_Test_InvalidEnableState */
+} /* end HS_ValidateCBTable_Test_NullTermError */
 
-void HS_ValidateMATable_Test_MessageIDTooHigh(void)
+void HS_ValidateCBTable_Test_InvalidAction(void)
 {
-    int32          Result;
-    uint32         i;
-    CFE_SB_MsgId_t TestMsgId;
-    size_t         MsgSize;
-    int32          strCmpResult;
-    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+    int32         Result;
+    HS_CBTEntry_t CBTable[HS_MAX_CPU_BUDGETS];
 
-    memset(MATable, 0, sizeof(MATable));
+    memset(CBTable, 0, sizeof(CBTable));
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify err: Entry = %%d, Err = %%d, Length = %%d, ID = 0x%%08lX");
-    snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
+    CBTable[0].Intervals  = 1;
+    CBTable[0].ActionType = HS_AMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES + 1;
 
-    TestMsgId = CFE_SB_INVALID_MSG_ID;
-    MsgSize   = sizeof(HS_NoArgsCmd_t);
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTActionIsValid), false);
 
-    HS_AppData.MATablePtr = MATable;
+    /* Execute the function being tested */
+    Result = HS_ValidateCBTable(CBTable);
 
-    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
-    {
-        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_ENABLED;
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CBTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_CBTVAL_INF_EID);
 
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    UtAssert_True(Result == HS_CBTVAL_ERR_ACT, "Result == HS_CBTVAL_ERR_ACT");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateCBTable_Test_InvalidAction */
+
+void HS_ValidateCBTable_Test_EntryGood(void)
+{
+    int32         Result;
+    uint32        i;
+    HS_CBTEntry_t CBTable[HS_MAX_CPU_BUDGETS];
+
+    memset(CBTable, 0, sizeof(CBTable));
+
+    for (i = 0; i < HS_MAX_CPU_BUDGETS; i++)
+    {
+        CBTable[i].Intervals  = 1;
+        CBTable[i].ActionType = HS_AMT_ACT_EVENT;
     }
 
+    UT_SetDefaultReturnValue(UT_KEY(HS_AMTActionIsValid), true);
+
     /* Execute the function being tested */
-    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
+    Result = HS_ValidateCBTable(CBTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CBTVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MATVAL_INF_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
+} /* end HS_ValidateCBTable_Test_EntryGood */
 
-    strCmpResult =
-        strncmp(ExpectedEventString[1], context_CFE_EVS_SendEvent[1].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+void HS_ValidateCBTable_Test_Null(void)
+{
+    int32 Result;
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
+    /* Execute the function being tested */
+    Result = HS_ValidateCBTable(NULL);
 
-    UtAssert_True(Result == HS_MATVAL_ERR_ID, "Result == HS_MATVAL_ERR_ID");
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_CB_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateMATable_Test_MessageIDTooHigh */
+} /* end HS_ValidateCBTable_Test_Null */
 
-void HS_ValidateMATable_Test_LengthTooHigh(void)
+void HS_ValidateRBTable_Test_NullTermError(void)
 {
-    int32          Result;
-    uint32         i;
-    CFE_SB_MsgId_t TestMsgId;
-    size_t         MsgSize;
-    int32          strCmpResult;
-    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+    int32         Result;
+    int32         strCmpResult;
+    char          ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
 
-    memset(MATable, 0, sizeof(MATable));
+    memset(RBTable, 0, sizeof(RBTable));
 
     snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify err: Entry = %%d, Err = %%d, Length = %%d, ID = 0x%%08lX");
+             "Rebalance verify err: Entry = %%d, Err = %%d, CoreMask = 0x%%08X, Task = %%s");
     snprintf(ExpectedEventString[1], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
-
-    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
-    MsgSize   = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
-
-    HS_AppData.MATablePtr = MATable;
-
-    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
-    {
-        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_ENABLED;
+             "Rebalance verify results: good = %%d, bad = %%d, unused = %%d");
 
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
-    }
+    strncpy(RBTable[0].TaskName, "TASK", sizeof(RBTable[0].TaskName));
+    RBTable[0].CoreMask = 0x1;
+    RBTable[0].NullTerm = 1;
 
     /* Execute the function being tested */
-    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
+    Result = HS_ValidateRBTable(RBTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_RBTVAL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
     strCmpResult =
@@ -2890,7 +5536,7 @@ void HS_ValidateMATable_Test_LengthTooHigh(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_RBTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult =
@@ -2898,89 +5544,86 @@ void HS_ValidateMATable_Test_LengthTooHigh(void)
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[1].Spec);
 
-    UtAssert_True(Result == HS_MATVAL_ERR_LEN, "Result == HS_MATVAL_ERR_LEN");
+    UtAssert_True(Result == HS_RBTVAL_ERR_NUL, "Result == HS_RBTVAL_ERR_NUL");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateMATable_Test_LengthTooHigh */
+} /* end HS_ValidateRBTable_Test_NullTermError */
 
-void HS_ValidateMATable_Test_EntryGood(void)
+void HS_ValidateRBTable_Test_InvalidCores(void)
 {
-    int32          Result;
-    uint32         i;
-    CFE_SB_MsgId_t TestMsgId;
-    size_t         MsgSize;
-    int32          strCmpResult;
-    char           ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    HS_MATEntry_t  MATable[HS_MAX_MSG_ACT_TYPES];
+    int32         Result;
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
 
-    memset(MATable, 0, sizeof(MATable));
+    memset(RBTable, 0, sizeof(RBTable));
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MsgActs verify results: good = %%d, bad = %%d, unused = %%d");
+    strncpy(RBTable[0].TaskName, "TASK", sizeof(RBTable[0].TaskName));
+    RBTable[0].CoreMask = 0x80000000;
 
-    TestMsgId = CFE_SB_ValueToMsgId(HS_CMD_MID);
-    MsgSize   = sizeof(HS_NoArgsCmd_t);
+    /* Execute the function being tested */
+    Result = HS_ValidateRBTable(RBTable);
 
-    HS_AppData.MATablePtr = MATable;
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_RBTVAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, HS_RBTVAL_INF_EID);
 
-    for (i = 0; i < HS_MAX_MSG_ACT_TYPES; i++)
-    {
-        HS_AppData.MATablePtr[i].EnableState = HS_MAT_STATE_ENABLED;
+    UtAssert_True(Result == HS_RBTVAL_ERR_CORES, "Result == HS_RBTVAL_ERR_CORES");
 
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-        UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 2, "CFE_EVS_SendEvent was called %u time(s), expected 2",
+                  call_count_CFE_EVS_SendEvent);
+
+} /* end HS_ValidateRBTable_Test_InvalidCores */
+
+void HS_ValidateRBTable_Test_EntryGood(void)
+{
+    int32         Result;
+    uint32        i;
+    HS_RBTEntry_t RBTable[HS_MAX_REBALANCE_TASKS];
+
+    memset(RBTable, 0, sizeof(RBTable));
+
+    for (i = 0; i < HS_MAX_REBALANCE_TASKS; i++)
+    {
+        strncpy(RBTable[i].TaskName, "TASK", sizeof(RBTable[i].TaskName));
+        RBTable[i].CoreMask = 0x1;
     }
 
     /* Execute the function being tested */
-    Result = HS_ValidateMATable(HS_AppData.MATablePtr);
+    Result = HS_ValidateRBTable(RBTable);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MATVAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_RBTVAL_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
     UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-} /* end HS_ValidateMATable_Test_EntryGood */
+} /* end HS_ValidateRBTable_Test_EntryGood */
 
-void HS_ValidateMATable_Test_Null(void)
+void HS_ValidateRBTable_Test_Null(void)
 {
     int32 Result;
-    int32 strCmpResult;
-    char  ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Error in MA Table Validation. Table is null.");
 
     /* Execute the function being tested */
-    Result = HS_ValidateMATable(NULL);
+    Result = HS_ValidateRBTable(NULL);
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_MA_TBL_NULL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, HS_RB_TBL_NULL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
     UtAssert_True(Result == HS_TBL_VAL_ERR, "Result == HS_TBL_VAL_ERR");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
-}
+
+} /* end HS_ValidateRBTable_Test_Null */
 
 void HS_SetCDSData_Test(void)
 {
@@ -3078,6 +5721,20 @@ void UtTest_Setup(void)
     UtTest_Add(HS_MonitorEvent_Test_MsgActsDefaultMaxActTypes, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorEvent_Test_MsgActsDefaultMaxActTypes");
 
+    UtTest_Add(HS_MonitorEvent_Test_ProcessorMismatch, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorEvent_Test_ProcessorMismatch");
+
+    UtTest_Add(HS_MonitorEvent_Test_EntryDisabled, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorEvent_Test_EntryDisabled");
+
+    UtTest_Add(HS_ExecuteMsgAction_Test_Sent, HS_Test_Setup, HS_Test_TearDown, "HS_ExecuteMsgAction_Test_Sent");
+    UtTest_Add(HS_ExecuteMsgAction_Test_NotSent, HS_Test_Setup, HS_Test_TearDown, "HS_ExecuteMsgAction_Test_NotSent");
+
+    UtTest_Add(HS_CountProcessorEvent_Test_NewAndExisting, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CountProcessorEvent_Test_NewAndExisting");
+    UtTest_Add(HS_CountProcessorEvent_Test_Overflow, HS_Test_Setup, HS_Test_TearDown,
+               "HS_CountProcessorEvent_Test_Overflow");
+
     UtTest_Add(HS_MonitorUtilization_Test_HighCurrentUtil, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorUtilization_Test_HighCurrentUtil");
     UtTest_Add(HS_MonitorUtilization_Test_CurrentUtilLessThanZero, HS_Test_Setup, HS_Test_TearDown,
@@ -3092,6 +5749,91 @@ void UtTest_Setup(void)
                "HS_MonitorUtilization_Test_HighUtilIndex");
     UtTest_Add(HS_MonitorUtilization_Test_LowUtilIndex, HS_Test_Setup, HS_Test_TearDown,
                "HS_MonitorUtilization_Test_LowUtilIndex");
+    UtTest_Add(HS_MonitorUtilization_Test_SlidingWindow, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorUtilization_Test_SlidingWindow");
+
+    UtTest_Add(HS_MonitorCoreUtilization_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorCoreUtilization_Test_Nominal");
+    UtTest_Add(HS_MonitorCoreUtilization_Test_Limits, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorCoreUtilization_Test_Limits");
+    UtTest_Add(HS_MonitorCoreUtilization_Test_Hogging, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorCoreUtilization_Test_Hogging");
+
+    UtTest_Add(HS_UtilWindowUpdate_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilWindowUpdate_Test");
+
+    UtTest_Add(HS_UtilHistRecord_Test_Rollup, HS_Test_Setup, HS_Test_TearDown, "HS_UtilHistRecord_Test_Rollup");
+    UtTest_Add(HS_UtilHistRecord_Test_Wrap, HS_Test_Setup, HS_Test_TearDown, "HS_UtilHistRecord_Test_Wrap");
+
+    UtTest_Add(HS_UtilPctlRecord_Test_Window, HS_Test_Setup, HS_Test_TearDown, "HS_UtilPctlRecord_Test_Window");
+    UtTest_Add(HS_UtilPctlValue_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilPctlValue_Test");
+
+    UtTest_Add(HS_MonitorUtilLoad_Test_Hysteresis, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorUtilLoad_Test_Hysteresis");
+    UtTest_Add(HS_MonitorUtilLoad_Test_MsgActs, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorUtilLoad_Test_MsgActs");
+    UtTest_Add(HS_MonitorLoadShed_Test_ShedAndRestore, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorLoadShed_Test_ShedAndRestore");
+    UtTest_Add(HS_MonitorLoadShed_Test_DwellReset, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorLoadShed_Test_DwellReset");
+    UtTest_Add(HS_MonitorLoadShed_Test_Disabled, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorLoadShed_Test_Disabled");
+    UtTest_Add(HS_UtilTrendUpdate_Test_Sliding, HS_Test_Setup, HS_Test_TearDown, "HS_UtilTrendUpdate_Test_Sliding");
+    UtTest_Add(HS_MonitorUtilTrend_Test_Warning, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorUtilTrend_Test_Warning");
+    UtTest_Add(HS_MonitorUtilTrend_Test_NotRising, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorUtilTrend_Test_NotRising");
+    UtTest_Add(HS_MonitorUtilTrend_Test_NotFull, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorUtilTrend_Test_NotFull");
+    UtTest_Add(HS_MonitorUtilTrend_Test_MsgActs, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorUtilTrend_Test_MsgActs");
+
+    UtTest_Add(HS_MonitorRebalance_Test_Disabled, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorRebalance_Test_Disabled");
+#if HS_UTIL_NUM_CORES > 1
+    UtTest_Add(HS_MonitorRebalance_Test_Dwell, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorRebalance_Test_Dwell");
+#endif
+    UtTest_Add(HS_RebalanceMove_Test_Moved, HS_Test_Setup, HS_Test_TearDown, "HS_RebalanceMove_Test_Moved");
+    UtTest_Add(HS_RebalanceMove_Test_NotOnCore, HS_Test_Setup, HS_Test_TearDown, "HS_RebalanceMove_Test_NotOnCore");
+    UtTest_Add(HS_RebalanceMove_Test_SetError, HS_Test_Setup, HS_Test_TearDown, "HS_RebalanceMove_Test_SetError");
+
+    UtTest_Add(HS_MonitorTaskCpu_Test_Baseline, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorTaskCpu_Test_Baseline");
+    UtTest_Add(HS_MonitorTaskCpu_Test_TopN, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorTaskCpu_Test_TopN");
+    UtTest_Add(HS_MonitorTaskCpu_Test_Error, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorTaskCpu_Test_Error");
+    UtTest_Add(HS_MonitorTaskCpu_Test_RunDelay, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorTaskCpu_Test_RunDelay");
+    UtTest_Add(HS_TaskCpuRank_Test, HS_Test_Setup, HS_Test_TearDown, "HS_TaskCpuRank_Test");
+    UtTest_Add(HS_MonitorRunDelay_Test_Event, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorRunDelay_Test_Event");
+    UtTest_Add(HS_MonitorRunDelay_Test_Below, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorRunDelay_Test_Below");
+    UtTest_Add(HS_MonitorStacks_Test_Round, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorStacks_Test_Round");
+    UtTest_Add(HS_MonitorStacks_Test_HighWater, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorStacks_Test_HighWater");
+    UtTest_Add(HS_MonitorStacks_Test_NoThreads, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorStacks_Test_NoThreads");
+    UtTest_Add(HS_StackUsageAction_Test, HS_Test_Setup, HS_Test_TearDown, "HS_StackUsageAction_Test");
+    UtTest_Add(HS_MonitorSbPipes_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorSbPipes_Test");
+    UtTest_Add(HS_SbStatsTlm_Test_Worst, HS_Test_Setup, HS_Test_TearDown, "HS_SbStatsTlm_Test_Worst");
+    UtTest_Add(HS_SbStatsTlm_Test_Limits, HS_Test_Setup, HS_Test_TearDown, "HS_SbStatsTlm_Test_Limits");
+    UtTest_Add(HS_SbStatsTlm_Test_BadLength, HS_Test_Setup, HS_Test_TearDown, "HS_SbStatsTlm_Test_BadLength");
+    UtTest_Add(HS_SbHkTlm_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SbHkTlm_Test");
+    UtTest_Add(HS_SbPipeAction_Test_MsgActs, HS_Test_Setup, HS_Test_TearDown, "HS_SbPipeAction_Test_MsgActs");
+    UtTest_Add(HS_SbDropAction_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SbDropAction_Test");
+    UtTest_Add(HS_MonitorWakeup_Test_Intervals, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorWakeup_Test_Intervals");
+    UtTest_Add(HS_MonitorWakeup_Test_Timeout, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorWakeup_Test_Timeout");
+    UtTest_Add(HS_MonitorWakeup_Test_MarkBetweenTimeouts, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorWakeup_Test_MarkBetweenTimeouts");
+    UtTest_Add(HS_MonitorCpuBudget_Test_Event, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorCpuBudget_Test_Event");
+    UtTest_Add(HS_MonitorCpuBudget_Test_Restart, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorCpuBudget_Test_Restart");
+    UtTest_Add(HS_MonitorCpuBudget_Test_ProcResetLimit, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorCpuBudget_Test_ProcResetLimit");
+    UtTest_Add(HS_MonitorCpuBudget_Test_MsgActs, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorCpuBudget_Test_MsgActs");
+    UtTest_Add(HS_MonitorCpuBudget_Test_Disabled, HS_Test_Setup, HS_Test_TearDown,
+               "HS_MonitorCpuBudget_Test_Disabled");
+    UtTest_Add(HS_HogSnapshotBaseline_Test_TaskCpuSample, HS_Test_Setup, HS_Test_TearDown,
+               "HS_HogSnapshotBaseline_Test_TaskCpuSample");
+    UtTest_Add(HS_HogSnapshotBaseline_Test_Read, HS_Test_Setup, HS_Test_TearDown, "HS_HogSnapshotBaseline_Test_Read");
+    UtTest_Add(HS_HogSnapshotCapture_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_HogSnapshotCapture_Test_Nominal");
+    UtTest_Add(HS_HogSnapshotCapture_Test_NoBaseline, HS_Test_Setup, HS_Test_TearDown,
+               "HS_HogSnapshotCapture_Test_NoBaseline");
+    UtTest_Add(HS_HogSnapshotWriteFile_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_HogSnapshotWriteFile_Test_Nominal");
+    UtTest_Add(HS_HogSnapshotWriteFile_Test_CreateError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_HogSnapshotWriteFile_Test_CreateError");
+    UtTest_Add(HS_HogSnapshotWriteFile_Test_HeaderError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_HogSnapshotWriteFile_Test_HeaderError");
+    UtTest_Add(HS_HogSnapshotWriteFile_Test_WriteError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_HogSnapshotWriteFile_Test_WriteError");
 
     UtTest_Add(HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateAMTable_Test_UnusedTableEntryCycleCountZero");
@@ -3112,6 +5854,8 @@ void UtTest_Setup(void)
                "HS_ValidateEMTable_Test_BufferNotNull");
     UtTest_Add(HS_ValidateEMTable_Test_ActionTypeNotValid, HS_Test_Setup, HS_Test_TearDown,
                "HS_ValidateEMTable_Test_ActionTypeNotValid");
+    UtTest_Add(HS_ValidateEMTable_Test_PaddingNotZero, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateEMTable_Test_PaddingNotZero");
     UtTest_Add(HS_ValidateEMTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateEMTable_Test_EntryGood");
     UtTest_Add(HS_ValidateEMTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateEMTable_Test_Null");
 
@@ -3136,6 +5880,24 @@ void UtTest_Setup(void)
                "HS_ValidateMATable_Test_LengthTooHigh");
     UtTest_Add(HS_ValidateMATable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMATable_Test_EntryGood");
     UtTest_Add(HS_ValidateMATable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateMATable_Test_Null");
+    UtTest_Add(HS_ValidateLSTable_Test_InvalidEnableState, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateLSTable_Test_InvalidEnableState");
+    UtTest_Add(HS_ValidateLSTable_Test_InvalidMsgId, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateLSTable_Test_InvalidMsgId");
+    UtTest_Add(HS_ValidateLSTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateLSTable_Test_EntryGood");
+    UtTest_Add(HS_ValidateLSTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateLSTable_Test_Null");
+    UtTest_Add(HS_ValidateCBTable_Test_NullTermError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateCBTable_Test_NullTermError");
+    UtTest_Add(HS_ValidateCBTable_Test_InvalidAction, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateCBTable_Test_InvalidAction");
+    UtTest_Add(HS_ValidateCBTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateCBTable_Test_EntryGood");
+    UtTest_Add(HS_ValidateCBTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateCBTable_Test_Null");
+    UtTest_Add(HS_ValidateRBTable_Test_NullTermError, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateRBTable_Test_NullTermError");
+    UtTest_Add(HS_ValidateRBTable_Test_InvalidCores, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ValidateRBTable_Test_InvalidCores");
+    UtTest_Add(HS_ValidateRBTable_Test_EntryGood, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateRBTable_Test_EntryGood");
+    UtTest_Add(HS_ValidateRBTable_Test_Null, HS_Test_Setup, HS_Test_TearDown, "HS_ValidateRBTable_Test_Null");
 
     UtTest_Add(HS_SetCDSData_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SetCDSData_Test");
 
@@ -31,6 +31,9 @@
 
 #include <unistd.h>
 #include <stdlib.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #include "cfe.h"
 #include "cfe_msgids.h"
 
@@ -175,6 +178,504 @@ void HS_AMTActionIsValid_Invalid(void)
     UtAssert_True(Result == false, "Result == false");
 }
 
+void HS_EMTQualifierMatches_Any(void)
+{
+    UtAssert_True(HS_EMTQualifierMatches(HS_EMT_QUAL_ANY, 5, 1) == true, "HS_EMT_QUAL_ANY matches remote source");
+    UtAssert_True(HS_EMTQualifierMatches(HS_EMT_QUAL_ANY, 1, 1) == true, "HS_EMT_QUAL_ANY matches local source");
+}
+
+void HS_EMTQualifierMatches_Local(void)
+{
+    UtAssert_True(HS_EMTQualifierMatches(HS_EMT_QUAL_LOCAL, 1, 1) == true, "HS_EMT_QUAL_LOCAL matches local source");
+    UtAssert_True(HS_EMTQualifierMatches(HS_EMT_QUAL_LOCAL, 5, 1) == false,
+                  "HS_EMT_QUAL_LOCAL does not match remote source");
+}
+
+void HS_EMTQualifierMatches_Explicit(void)
+{
+    UtAssert_True(HS_EMTQualifierMatches(5, 5, 1) == true, "Explicit qualifier matches same source");
+    UtAssert_True(HS_EMTQualifierMatches(5, 1, 1) == false, "Explicit qualifier does not match other source");
+}
+
+void HS_SetCpuAffinity_Test(void)
+{
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_SetCpuAffinity(0), CFE_SUCCESS);
+#else
+    UtAssert_INT32_EQ(HS_SetCpuAffinity(0), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+}
+
+void HS_ThreadAffinity_Test(void)
+{
+    uint32 CoreMask = 0;
+
+    /* Thread ID 0 is the calling thread */
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_GetThreadAffinity(0, &CoreMask), CFE_SUCCESS);
+    UtAssert_True(CoreMask != 0, "CoreMask != 0");
+    UtAssert_INT32_EQ(HS_SetThreadAffinity(0, CoreMask), CFE_SUCCESS);
+#else
+    UtAssert_INT32_EQ(HS_GetThreadAffinity(0, &CoreMask), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(HS_SetThreadAffinity(0, CoreMask), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+}
+
+void HS_ParseProcStat_Test_SingleCore(void)
+{
+    const char    Buffer[] = "cpu  100 10 50 800 20 5 5 10 0 0\n"
+                             "cpu0 100 10 50 800 20 5 5 10 0 0\n"
+                             "intr 12345\n";
+    HS_CpuTimes_t Times[1];
+
+    UtAssert_INT32_EQ(HS_ParseProcStat(Buffer, Times, 1), CFE_SUCCESS);
+
+    /* Idle and iowait are not busy time */
+    UtAssert_UINT32_EQ(Times[0].Busy, 180);
+    UtAssert_UINT32_EQ(Times[0].Total, 1000);
+}
+
+void HS_ParseProcStat_Test_MultiCore(void)
+{
+    const char    Buffer[] = "cpu  300 0 0 700 0 0 0 0 0 0\n"
+                             "cpu0 100 0 0 400 0 0 0 0 0 0\n"
+                             "cpu1 200 0 0 300 0 0 0 0 0 0\n"
+                             "intr 12345\n";
+    HS_CpuTimes_t Times[2];
+
+    UtAssert_INT32_EQ(HS_ParseProcStat(Buffer, Times, 2), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(Times[0].Busy, 100);
+    UtAssert_UINT32_EQ(Times[0].Total, 500);
+    UtAssert_UINT32_EQ(Times[1].Busy, 200);
+    UtAssert_UINT32_EQ(Times[1].Total, 500);
+}
+
+void HS_ParseProcStat_Test_MissingCore(void)
+{
+    const char    Buffer[] = "cpu  100 0 0 400 0 0 0 0 0 0\n"
+                             "cpu0 100 0 0 400 0 0 0 0 0 0\n"
+                             "intr 12345\n";
+    HS_CpuTimes_t Times[2];
+
+    UtAssert_INT32_EQ(HS_ParseProcStat(Buffer, Times, 2), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
+void HS_ParseProcStat_Test_ShortLine(void)
+{
+    const char    Buffer[] = "cpu  100 0 0 400\n";
+    HS_CpuTimes_t Times[1];
+
+    UtAssert_INT32_EQ(HS_ParseProcStat(Buffer, Times, 1), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
+void HS_ParseTaskStat_Test_Nominal(void)
+{
+    const char         Buffer[] = "1234 (HS) S 1 1234 1234 0 -1 4194368 100 0 0 0 250 50 0 0 20 0 12 0";
+    HS_TaskCpuSample_t Sample;
+
+    UtAssert_INT32_EQ(HS_ParseTaskStat(Buffer, 10000000, &Sample), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(Sample.ThreadId, 1234);
+    UtAssert_STRINGBUF_EQ(Sample.Name, sizeof(Sample.Name), "HS", sizeof("HS"));
+    UtAssert_INT32_EQ(Sample.State, 'S');
+    UtAssert_True(Sample.CpuTimeNs == 3000000000, "Sample.CpuTimeNs == 3000000000");
+}
+
+void HS_ParseTaskStat_Test_OddName(void)
+{
+    const char         Buffer[] = "42 (A (B) C:0123456789) R 1 1 1 0 -1 0 0 0 0 0 1 2 0 0";
+    HS_TaskCpuSample_t Sample;
+
+    UtAssert_INT32_EQ(HS_ParseTaskStat(Buffer, 1, &Sample), CFE_SUCCESS);
+
+    /* Name is truncated */
+    UtAssert_STRINGBUF_EQ(Sample.Name, sizeof(Sample.Name), "A (B) C:0123456", sizeof("A (B) C:0123456"));
+    UtAssert_INT32_EQ(Sample.State, 'R');
+    UtAssert_True(Sample.CpuTimeNs == 3, "Sample.CpuTimeNs == 3");
+}
+
+void HS_ParseTaskStat_Test_Short(void)
+{
+    HS_TaskCpuSample_t Sample;
+
+    UtAssert_INT32_EQ(HS_ParseTaskStat("42 (HS) S 1 1 1 0 -1 0 0 0 0 0 1", 1, &Sample),
+                      CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseTaskStat("42 HS", 1, &Sample), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
+void HS_ReadTaskCpuTimes_Test(void)
+{
+    HS_TaskCpuSample_t Samples[HS_TASK_CPU_MAX_TASKS];
+    uint32             NumSamples = 0;
+
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_ReadTaskCpuTimes(Samples, HS_TASK_CPU_MAX_TASKS, true, &NumSamples), CFE_SUCCESS);
+    UtAssert_True(NumSamples > 0, "NumSamples > 0");
+
+    /* Without scheduler statistics they are left zero */
+    memset(Samples, 0xFF, sizeof(Samples));
+    UtAssert_INT32_EQ(HS_ReadTaskCpuTimes(Samples, HS_TASK_CPU_MAX_TASKS, false, &NumSamples), CFE_SUCCESS);
+    UtAssert_True(NumSamples > 0, "NumSamples > 0");
+    UtAssert_True(Samples[0].RunDelayNs == 0, "Samples[0].RunDelayNs == 0");
+    UtAssert_UINT32_EQ(Samples[0].VolCtxSwitches, 0);
+    UtAssert_UINT32_EQ(Samples[0].InvolCtxSwitches, 0);
+#else
+    UtAssert_INT32_EQ(HS_ReadTaskCpuTimes(Samples, HS_TASK_CPU_MAX_TASKS, true, &NumSamples),
+                      CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_UINT32_EQ(NumSamples, 0);
+#endif
+}
+
+void HS_ParseTaskSchedstat_Test_Nominal(void)
+{
+    HS_TaskCpuSample_t Sample;
+
+    memset(&Sample, 0, sizeof(Sample));
+
+    UtAssert_INT32_EQ(HS_ParseTaskSchedstat("2500000 750000 12\n", &Sample), CFE_SUCCESS);
+    UtAssert_True(Sample.RunDelayNs == 750000, "Sample.RunDelayNs == 750000");
+}
+
+void HS_ParseTaskSchedstat_Test_Short(void)
+{
+    HS_TaskCpuSample_t Sample;
+
+    UtAssert_INT32_EQ(HS_ParseTaskSchedstat("2500000\n", &Sample), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseTaskSchedstat("", &Sample), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
+void HS_ParseTaskCtxSwitches_Test_Nominal(void)
+{
+    const char         Buffer[] = "Name:\tHS\nState:\tS (sleeping)\nvoluntary_ctxt_switches:\t1234\n"
+                          "nonvoluntary_ctxt_switches:\t56\n";
+    HS_TaskCpuSample_t Sample;
+
+    memset(&Sample, 0, sizeof(Sample));
+
+    UtAssert_INT32_EQ(HS_ParseTaskCtxSwitches(Buffer, &Sample), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Sample.VolCtxSwitches, 1234);
+    UtAssert_UINT32_EQ(Sample.InvolCtxSwitches, 56);
+}
+
+void HS_ParseTaskCtxSwitches_Test_Missing(void)
+{
+    HS_TaskCpuSample_t Sample;
+
+    /* Only the involuntary count, which also ends in voluntary_ctxt_switches */
+    UtAssert_INT32_EQ(HS_ParseTaskCtxSwitches("Name:\tHS\nnonvoluntary_ctxt_switches:\t56\n", &Sample),
+                      CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
+void HS_ReadTaskSchedInfo_Test_Missing(void)
+{
+    HS_TaskCpuSample_t Sample;
+
+    memset(&Sample, 0xFF, sizeof(Sample));
+
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_ReadTaskSchedInfo(-1, &Sample), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+#else
+    UtAssert_INT32_EQ(HS_ReadTaskSchedInfo(-1, &Sample), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+
+    UtAssert_True(Sample.RunDelayNs == 0, "Sample.RunDelayNs == 0");
+    UtAssert_UINT32_EQ(Sample.VolCtxSwitches, 0);
+    UtAssert_UINT32_EQ(Sample.InvolCtxSwitches, 0);
+}
+
+void HS_UTILS_TEST_OS_ForEachObjectOfTypeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_ArgCallback_t CallbackPtr = UT_Hook_GetArgValueByName(Context, "callback_ptr", OS_ArgCallback_t);
+    void *           CallbackArg = UT_Hook_GetArgValueByName(Context, "callback_arg", void *);
+
+    /* Two OSAL tasks */
+    CallbackPtr(OS_OBJECT_ID_UNDEFINED, CallbackArg);
+    CallbackPtr(OS_OBJECT_ID_UNDEFINED, CallbackArg);
+}
+
+void HS_UTILS_TEST_OS_GetResourceNameHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    char * Buffer     = UT_Hook_GetArgValueByName(Context, "buffer", char *);
+    size_t BufferSize = UT_Hook_GetArgValueByName(Context, "buffer_size", size_t);
+
+    UT_Stub_CopyToLocal(UT_KEY(OS_GetResourceName), Buffer, BufferSize);
+}
+
+void HS_ThreadNameMatches_Test(void)
+{
+    /* Linux truncates thread names to HS_TASK_COMM_LEN - 1 characters */
+    UtAssert_BOOL_TRUE(HS_ThreadNameMatches("HS_IDLE_TASK", "HS_IDLE_TASK"));
+    UtAssert_BOOL_FALSE(HS_ThreadNameMatches("HS_IDLE_TASK", "HS_IDLE_TASK_2"));
+    UtAssert_BOOL_TRUE(HS_ThreadNameMatches("HS_LONG_TASK_NA", "HS_LONG_TASK_NAME"));
+    UtAssert_BOOL_FALSE(HS_ThreadNameMatches("HS_LONG_TASK_NB", "HS_LONG_TASK_NAME"));
+}
+
+void HS_FindTaskByThreadName_Test_Exact(void)
+{
+    CFE_ES_TaskId_t TaskId;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_FindTaskByThreadName("HS_IDLE_TASK", &TaskId), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_GetTaskIDByName, 1);
+    UtAssert_STUB_COUNT(OS_ForEachObjectOfType, 0);
+}
+
+void HS_FindTaskByThreadName_Test_Truncated(void)
+{
+    CFE_ES_TaskId_t TaskId;
+    char            Names[2][OS_MAX_API_NAME];
+
+    /* Only the second task has the longer name the thread name was cut from */
+    memset(Names, 0, sizeof(Names));
+    strncpy(Names[0], "HS_OTHER_TASK_NAME", sizeof(Names[0]) - 1);
+    strncpy(Names[1], "HS_LONG_TASK_NAME", sizeof(Names[1]) - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetTaskIDByName), CFE_ES_ERR_NAME_NOT_FOUND);
+    UT_SetHandlerFunction(UT_KEY(OS_ForEachObjectOfType), HS_UTILS_TEST_OS_ForEachObjectOfTypeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(OS_GetResourceName), HS_UTILS_TEST_OS_GetResourceNameHandler, NULL);
+    UT_SetDataBuffer(UT_KEY(OS_GetResourceName), Names, sizeof(Names), false);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(HS_FindTaskByThreadName("HS_LONG_TASK_NA", &TaskId), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_ForEachObjectOfType, 1);
+    UtAssert_STUB_COUNT(OS_GetResourceName, 2);
+    UtAssert_STUB_COUNT(CFE_ES_TaskId_FromOSAL, 1);
+}
+
+void HS_FindTaskByThreadName_Test_NotFound(void)
+{
+    CFE_ES_TaskId_t TaskId;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetTaskIDByName), CFE_ES_ERR_NAME_NOT_FOUND);
+
+    /* A name shorter than the Linux limit can't have been truncated */
+    UtAssert_INT32_EQ(HS_FindTaskByThreadName("HS_SHORT", &TaskId), CFE_ES_ERR_NAME_NOT_FOUND);
+    UtAssert_STUB_COUNT(OS_ForEachObjectOfType, 0);
+
+    /* No OSAL task has the name */
+    UtAssert_INT32_EQ(HS_FindTaskByThreadName("HS_LONG_TASK_NA", &TaskId), CFE_ES_ERR_NAME_NOT_FOUND);
+    UtAssert_STUB_COUNT(OS_ForEachObjectOfType, 1);
+    UtAssert_STUB_COUNT(CFE_ES_TaskId_FromOSAL, 0);
+}
+
+void HS_FindTaskCallback_Test_AlreadyFound(void)
+{
+    HS_TaskSearch_t Search;
+
+    memset(&Search, 0, sizeof(Search));
+    Search.ThreadName = "HS_LONG_TASK_NA";
+    Search.Found      = true;
+
+    /* Execute the function being tested */
+    HS_FindTaskCallback(OS_OBJECT_ID_UNDEFINED, &Search);
+
+    /* Verify results, the first match is kept */
+    UtAssert_STUB_COUNT(OS_GetResourceName, 0);
+    UtAssert_STUB_COUNT(CFE_ES_TaskId_FromOSAL, 0);
+}
+
+void HS_ParsePsi_Test_Nominal(void)
+{
+    const char     Buffer[] = "some avg10=1.23 avg60=0.45 avg300=10.06 total=123456\n"
+                          "full avg10=0.50 avg60=0.00 avg300=0.00 total=789\n";
+    HS_PsiSample_t Sample;
+
+    UtAssert_INT32_EQ(HS_ParsePsi(Buffer, &Sample), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(Sample.Some.Avg10, 123);
+    UtAssert_UINT32_EQ(Sample.Some.Avg60, 45);
+    UtAssert_UINT32_EQ(Sample.Some.Avg300, 1006);
+    UtAssert_True(Sample.Some.TotalUs == 123456, "Sample.Some.TotalUs == 123456");
+    UtAssert_UINT32_EQ(Sample.Full.Avg10, 50);
+    UtAssert_True(Sample.Full.TotalUs == 789, "Sample.Full.TotalUs == 789");
+}
+
+void HS_ParsePsi_Test_SomeOnly(void)
+{
+    HS_PsiSample_t Sample;
+
+    UtAssert_INT32_EQ(HS_ParsePsi("some avg10=99.99 avg60=0.45 avg300=0.06 total=5\n", &Sample), CFE_SUCCESS);
+
+    UtAssert_UINT32_EQ(Sample.Some.Avg10, 9999);
+    UtAssert_UINT32_EQ(Sample.Full.Avg10, 0);
+    UtAssert_True(Sample.Full.TotalUs == 0, "Sample.Full.TotalUs == 0");
+}
+
+void HS_ParsePsi_Test_Invalid(void)
+{
+    HS_PsiSample_t Sample;
+
+    UtAssert_INT32_EQ(HS_ParsePsi("", &Sample), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParsePsi("full avg10=0.50 avg60=0.00 avg300=0.00 total=789\n", &Sample),
+                      CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParsePsi("some avg10=1.00 avg60=", &Sample), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
+void HS_ReadPsi_Test_Missing(void)
+{
+    HS_PsiSample_t Sample;
+
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_ReadPsi("/proc/pressure/missing", &Sample), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+#else
+    UtAssert_INT32_EQ(HS_ReadPsi("/proc/pressure/missing", &Sample), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+}
+
+void HS_ParseKbField_Test_Nominal(void)
+{
+    const char *Buffer = "MemTotal:        6147400 kB\nMemFree:         4490692 kB\nMemAvailable:    5553796 kB\n";
+    uint32      Value  = 0;
+
+    UtAssert_INT32_EQ(HS_ParseKbField(Buffer, "MemTotal", &Value), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Value, 6147400);
+    UtAssert_INT32_EQ(HS_ParseKbField(Buffer, "MemAvailable", &Value), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Value, 5553796);
+    UtAssert_INT32_EQ(HS_ParseKbField("Name:\tcfe\nVmRSS:\t    1800 kB\n", "VmRSS", &Value), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Value, 1800);
+
+    /* Saturates rather than wraps */
+    UtAssert_INT32_EQ(HS_ParseKbField("VmRSS: 99999999999 kB\n", "VmRSS", &Value), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Value, 0xFFFFFFFF);
+}
+
+void HS_ParseKbField_Test_Missing(void)
+{
+    uint32 Value = 5;
+
+    UtAssert_INT32_EQ(HS_ParseKbField("", "VmRSS", &Value), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseKbField("VmRSSMax: 10 kB\n", "VmRSS", &Value), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseKbField("MemFree: 10 kB\n", "Free", &Value), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseKbField("VmRSS: kB\n", "VmRSS", &Value), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_UINT32_EQ(Value, 5);
+}
+
+void HS_ReadMemory_Test(void)
+{
+    HS_MemSample_t Sample;
+
+    memset(&Sample, 0, sizeof(Sample));
+
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_ReadMemory(&Sample), CFE_SUCCESS);
+    UtAssert_True(Sample.TotalKb > 0, "Sample.TotalKb > 0");
+    UtAssert_True(Sample.AvailKb <= Sample.TotalKb, "Sample.AvailKb <= Sample.TotalKb");
+    UtAssert_True(Sample.RssKb > 0, "Sample.RssKb > 0");
+#else
+    UtAssert_INT32_EQ(HS_ReadMemory(&Sample), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+}
+
+void HS_ParseSyscallSp_Test(void)
+{
+    cpuaddr StackPtr = 0;
+
+    /* Blocked in a syscall, and blocked outside of one */
+    UtAssert_INT32_EQ(HS_ParseSyscallSp("230 0x0 0x0 0x7f00e90 0x0 0x0 0x7f016c0 0x7f00e50 0x7f88545\n", &StackPtr),
+                      CFE_SUCCESS);
+    UtAssert_True(StackPtr == 0x7f00e50, "StackPtr == 0x7f00e50");
+    UtAssert_INT32_EQ(HS_ParseSyscallSp("-1 0x7ffd00 0x7f1234\n", &StackPtr), CFE_SUCCESS);
+    UtAssert_True(StackPtr == 0x7ffd00, "StackPtr == 0x7ffd00");
+
+    /* Running, or nothing usable */
+    UtAssert_INT32_EQ(HS_ParseSyscallSp("running\n", &StackPtr), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseSyscallSp("", &StackPtr), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseSyscallSp("-1 0x0 0x0\n", &StackPtr), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_True(StackPtr == 0x7ffd00, "StackPtr == 0x7ffd00");
+}
+
+void HS_ParseMapsRegion_Test(void)
+{
+    const char *Buffer = "00400000-00452000 r-xp 00000000 08:02 173521 /usr/bin/cfe\n"
+                         "7f0a5000-7f0a6000 ---p 00000000 00:00 0\n"
+                         "7f0a6000-7f0b6000 rw-p 00000000 00:00 0\n";
+    cpuaddr     Low    = 0;
+    cpuaddr     High   = 0;
+
+    UtAssert_INT32_EQ(HS_ParseMapsRegion(Buffer, 0x7f0b4e50, &Low, &High), CFE_SUCCESS);
+    UtAssert_True(Low == 0x7f0a6000, "Low == 0x7f0a6000");
+    UtAssert_True(High == 0x7f0b6000, "High == 0x7f0b6000");
+
+    /* The end of a region is not in it */
+    UtAssert_INT32_EQ(HS_ParseMapsRegion(Buffer, 0x452000, &Low, &High), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(HS_ParseMapsRegion("garbage\n", 0x1000, &Low, &High), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+}
+
+void HS_FindMapsRegion_Test(void)
+{
+    cpuaddr Low  = 0;
+    cpuaddr High = 0;
+
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_FindMapsRegion((cpuaddr)&Low, &Low, &High), CFE_SUCCESS);
+    UtAssert_True(Low < High, "Low < High");
+    UtAssert_INT32_EQ(HS_FindMapsRegion(0, &Low, &High), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+#else
+    UtAssert_INT32_EQ(HS_FindMapsRegion((cpuaddr)&Low, &Low, &High), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+}
+
+void HS_StackUnusedBytes_Test(void)
+{
+    uint32 Stack[64];
+    uint32 i;
+
+    /* Never touched, then painted, then used */
+    memset(Stack, 0, sizeof(Stack));
+
+    for (i = 16; i < 32; i++)
+    {
+        Stack[i] = HS_STACK_PAINT_WORD;
+    }
+
+    Stack[32] = 1;
+
+#ifdef __linux__
+    UtAssert_UINT32_EQ(HS_StackUnusedBytes((cpuaddr)Stack, (cpuaddr)&Stack[64]), 32 * sizeof(uint32));
+    UtAssert_UINT32_EQ(HS_StackUnusedBytes((cpuaddr)Stack, (cpuaddr)&Stack[16]), 16 * sizeof(uint32));
+#else
+    UtAssert_UINT32_EQ(HS_StackUnusedBytes((cpuaddr)Stack, (cpuaddr)&Stack[64]), 0);
+#endif
+}
+
+void HS_ReadThreadStack_Test(void)
+{
+    uint32 Size = 0;
+    uint32 Used = 0;
+
+#ifdef __linux__
+    /* The calling thread measures its own stack */
+    UtAssert_INT32_EQ(HS_ReadThreadStack((uint32)syscall(SYS_gettid), &Size, &Used), CFE_SUCCESS);
+    UtAssert_True(Size > 0, "Size > 0");
+    UtAssert_True((Used > 0) && (Used <= Size), "(Used > 0) && (Used <= Size)");
+    UtAssert_INT32_EQ(HS_ReadThreadStack(0, &Size, &Used), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+#else
+    UtAssert_INT32_EQ(HS_ReadThreadStack(1, &Size, &Used), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+
+    /* The main thread is never painted */
+    HS_PaintStack();
+}
+
+void HS_GetThreadCpuClock_Test(void)
+{
+    int32  ClockId = 0;
+    uint64 TimeNs  = 0;
+
+#ifdef __linux__
+    UtAssert_INT32_EQ(HS_GetThreadCpuClock(&ClockId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(HS_GetClockTimeNs(ClockId, &TimeNs), CFE_SUCCESS);
+#else
+    UtAssert_INT32_EQ(HS_GetThreadCpuClock(&ClockId), CFE_STATUS_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(HS_GetClockTimeNs(ClockId, &TimeNs), CFE_STATUS_NOT_IMPLEMENTED);
+#endif
+}
+
 void HS_EMTActionIsValid_Valid(void)
 {
     uint16 Action = (HS_EMT_ACT_LAST_NONMSG + HS_MAX_MSG_ACT_TYPES);
@@ -211,4 +712,57 @@ void UtTest_Setup(void)
     UtTest_Add(HS_EMTActionIsValid_Valid, HS_Test_Setup, HS_Test_TearDown, "HS_EMTActionIsValid_Valid");
 
     UtTest_Add(HS_EMTActionIsValid_Invalid, HS_Test_Setup, HS_Test_TearDown, "HS_EMTActionIsValid_Invalid");
+
+    UtTest_Add(HS_EMTQualifierMatches_Any, HS_Test_Setup, HS_Test_TearDown, "HS_EMTQualifierMatches_Any");
+    UtTest_Add(HS_EMTQualifierMatches_Local, HS_Test_Setup, HS_Test_TearDown, "HS_EMTQualifierMatches_Local");
+    UtTest_Add(HS_EMTQualifierMatches_Explicit, HS_Test_Setup, HS_Test_TearDown, "HS_EMTQualifierMatches_Explicit");
+
+    UtTest_Add(HS_SetCpuAffinity_Test, HS_Test_Setup, HS_Test_TearDown, "HS_SetCpuAffinity_Test");
+    UtTest_Add(HS_ThreadAffinity_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ThreadAffinity_Test");
+
+    UtTest_Add(HS_ParseProcStat_Test_SingleCore, HS_Test_Setup, HS_Test_TearDown, "HS_ParseProcStat_Test_SingleCore");
+    UtTest_Add(HS_ParseProcStat_Test_MultiCore, HS_Test_Setup, HS_Test_TearDown, "HS_ParseProcStat_Test_MultiCore");
+    UtTest_Add(HS_ParseProcStat_Test_MissingCore, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ParseProcStat_Test_MissingCore");
+    UtTest_Add(HS_ParseProcStat_Test_ShortLine, HS_Test_Setup, HS_Test_TearDown, "HS_ParseProcStat_Test_ShortLine");
+
+    UtTest_Add(HS_GetThreadCpuClock_Test, HS_Test_Setup, HS_Test_TearDown, "HS_GetThreadCpuClock_Test");
+
+    UtTest_Add(HS_ParseTaskStat_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_ParseTaskStat_Test_Nominal");
+    UtTest_Add(HS_ParseTaskStat_Test_OddName, HS_Test_Setup, HS_Test_TearDown, "HS_ParseTaskStat_Test_OddName");
+    UtTest_Add(HS_ParseTaskStat_Test_Short, HS_Test_Setup, HS_Test_TearDown, "HS_ParseTaskStat_Test_Short");
+    UtTest_Add(HS_ReadTaskCpuTimes_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ReadTaskCpuTimes_Test");
+    UtTest_Add(HS_ParseTaskSchedstat_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ParseTaskSchedstat_Test_Nominal");
+    UtTest_Add(HS_ParseTaskSchedstat_Test_Short, HS_Test_Setup, HS_Test_TearDown, "HS_ParseTaskSchedstat_Test_Short");
+    UtTest_Add(HS_ParseTaskCtxSwitches_Test_Nominal, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ParseTaskCtxSwitches_Test_Nominal");
+    UtTest_Add(HS_ParseTaskCtxSwitches_Test_Missing, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ParseTaskCtxSwitches_Test_Missing");
+    UtTest_Add(HS_ReadTaskSchedInfo_Test_Missing, HS_Test_Setup, HS_Test_TearDown,
+               "HS_ReadTaskSchedInfo_Test_Missing");
+    UtTest_Add(HS_ThreadNameMatches_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ThreadNameMatches_Test");
+    UtTest_Add(HS_FindTaskByThreadName_Test_Exact, HS_Test_Setup, HS_Test_TearDown,
+               "HS_FindTaskByThreadName_Test_Exact");
+    UtTest_Add(HS_FindTaskByThreadName_Test_Truncated, HS_Test_Setup, HS_Test_TearDown,
+               "HS_FindTaskByThreadName_Test_Truncated");
+    UtTest_Add(HS_FindTaskByThreadName_Test_NotFound, HS_Test_Setup, HS_Test_TearDown,
+               "HS_FindTaskByThreadName_Test_NotFound");
+    UtTest_Add(HS_FindTaskCallback_Test_AlreadyFound, HS_Test_Setup, HS_Test_TearDown,
+               "HS_FindTaskCallback_Test_AlreadyFound");
+
+    UtTest_Add(HS_ParsePsi_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_ParsePsi_Test_Nominal");
+    UtTest_Add(HS_ParsePsi_Test_SomeOnly, HS_Test_Setup, HS_Test_TearDown, "HS_ParsePsi_Test_SomeOnly");
+    UtTest_Add(HS_ParsePsi_Test_Invalid, HS_Test_Setup, HS_Test_TearDown, "HS_ParsePsi_Test_Invalid");
+    UtTest_Add(HS_ReadPsi_Test_Missing, HS_Test_Setup, HS_Test_TearDown, "HS_ReadPsi_Test_Missing");
+
+    UtTest_Add(HS_ParseKbField_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_ParseKbField_Test_Nominal");
+    UtTest_Add(HS_ParseKbField_Test_Missing, HS_Test_Setup, HS_Test_TearDown, "HS_ParseKbField_Test_Missing");
+    UtTest_Add(HS_ReadMemory_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ReadMemory_Test");
+
+    UtTest_Add(HS_ParseSyscallSp_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ParseSyscallSp_Test");
+    UtTest_Add(HS_ParseMapsRegion_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ParseMapsRegion_Test");
+    UtTest_Add(HS_FindMapsRegion_Test, HS_Test_Setup, HS_Test_TearDown, "HS_FindMapsRegion_Test");
+    UtTest_Add(HS_StackUnusedBytes_Test, HS_Test_Setup, HS_Test_TearDown, "HS_StackUnusedBytes_Test");
+    UtTest_Add(HS_ReadThreadStack_Test, HS_Test_Setup, HS_Test_TearDown, "HS_ReadThreadStack_Test");
 }
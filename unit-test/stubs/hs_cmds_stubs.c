@@ -125,12 +125,75 @@ void HS_SetMaxResetsCmd(const CFE_SB_Buffer_t *BufPtr)
     UT_DEFAULT_IMPL(HS_SetMaxResetsCmd);
 }
 
+void HS_EnableEventMonEntriesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_EnableEventMonEntriesCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_EnableEventMonEntriesCmd);
+}
+
+void HS_DisableEventMonEntriesCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_DisableEventMonEntriesCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_DisableEventMonEntriesCmd);
+}
+
+void HS_SendUtilPctlCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_SendUtilPctlCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_SendUtilPctlCmd);
+}
+
+void HS_DumpUtilHistCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_DumpUtilHistCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_DumpUtilHistCmd);
+}
+
+void HS_SetUtilLoadLevelCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_SetUtilLoadLevelCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_SetUtilLoadLevelCmd);
+}
+
+void HS_SetUtilTrendCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_SetUtilTrendCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_SetUtilTrendCmd);
+}
+
+int32 HS_UtilHistWriteFile(const char *Filename, const HS_UtilHistPayload_t *PayloadPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilHistWriteFile), Filename);
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilHistWriteFile), PayloadPtr);
+    return UT_DEFAULT_IMPL(HS_UtilHistWriteFile);
+}
+
 void HS_AppMonStatusRefresh(void)
 {
     UT_DEFAULT_IMPL(HS_AppMonStatusRefresh);
 }
 
+void HS_EventMonStatusRefresh(void)
+{
+    UT_DEFAULT_IMPL(HS_EventMonStatusRefresh);
+}
+
 void HS_MsgActsStatusRefresh(void)
 {
     UT_DEFAULT_IMPL(HS_MsgActsStatusRefresh);
 }
+
+void HS_LoadShedStatusRefresh(void)
+{
+    UT_DEFAULT_IMPL(HS_LoadShedStatusRefresh);
+}
+
+void HS_CpuBudgetStatusRefresh(void)
+{
+    UT_DEFAULT_IMPL(HS_CpuBudgetStatusRefresh);
+}
+
+void HS_RebalanceStatusRefresh(void)
+{
+    UT_DEFAULT_IMPL(HS_RebalanceStatusRefresh);
+}
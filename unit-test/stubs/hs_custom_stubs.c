@@ -36,6 +36,8 @@
 
 HS_CustomData_t HS_CustomData;
 
+const char *const HS_PsiPaths[HS_PSI_NUM_RESOURCES] = {HS_PSI_PATH_CPU, HS_PSI_PATH_MEMORY, HS_PSI_PATH_IO};
+
 int32 HS_CustomInit(void)
 {
     return UT_DEFAULT_IMPL(HS_CustomInit);
@@ -46,6 +48,42 @@ void HS_CustomCleanup(void)
     UT_DEFAULT_IMPL(HS_CustomCleanup);
 }
 
+int32 HS_CustomStartIdleTasks(void)
+{
+    return UT_DEFAULT_IMPL(HS_CustomStartIdleTasks);
+}
+
+void HS_CustomStopIdleTasks(void)
+{
+    UT_DEFAULT_IMPL(HS_CustomStopIdleTasks);
+}
+
+int32 HS_UtilBackendStart(void)
+{
+    return UT_DEFAULT_IMPL(HS_UtilBackendStart);
+}
+
+bool HS_UtilBackendUsesIdleTask(uint32 Backend)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilBackendUsesIdleTask), Backend);
+    return UT_DEFAULT_IMPL_RC(HS_UtilBackendUsesIdleTask, true);
+}
+
+void HS_UtilBackendSample(void)
+{
+    UT_DEFAULT_IMPL(HS_UtilBackendSample);
+}
+
+int32 HS_UtilSampleProcStat(void)
+{
+    return UT_DEFAULT_IMPL(HS_UtilSampleProcStat);
+}
+
+int32 HS_UtilSampleThreadTime(void)
+{
+    return UT_DEFAULT_IMPL(HS_UtilSampleThreadTime);
+}
+
 void HS_CustomMonitorUtilization(void)
 {
     UT_DEFAULT_IMPL(HS_CustomMonitorUtilization);
@@ -56,6 +94,12 @@ int32 HS_CustomGetUtil(void)
     return UT_DEFAULT_IMPL(HS_CustomGetUtil);
 }
 
+int32 HS_CustomGetCoreUtil(uint32 CoreIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_CustomGetCoreUtil), CoreIndex);
+    return UT_DEFAULT_IMPL(HS_CustomGetCoreUtil);
+}
+
 int32 HS_CustomCommands(const CFE_SB_Buffer_t *BufPtr)
 {
     UT_Stub_RegisterContext(UT_KEY(HS_CustomCommands), BufPtr);
@@ -67,8 +111,14 @@ void HS_IdleTask(void)
     UT_DEFAULT_IMPL(HS_IdleTask);
 }
 
-void HS_UtilizationIncrement(void)
+uint32 HS_IdleTaskCoreIndex(void)
 {
+    return UT_DEFAULT_IMPL(HS_IdleTaskCoreIndex);
+}
+
+void HS_UtilizationIncrement(uint32 CoreIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilizationIncrement), CoreIndex);
     UT_DEFAULT_IMPL(HS_UtilizationIncrement);
 }
 
@@ -77,6 +127,42 @@ void HS_UtilizationMark(void)
     UT_DEFAULT_IMPL(HS_UtilizationMark);
 }
 
+int32 HS_UtilMarkStart(void)
+{
+    return UT_DEFAULT_IMPL(HS_UtilMarkStart);
+}
+
+void HS_UtilMarkStop(void)
+{
+    UT_DEFAULT_IMPL(HS_UtilMarkStop);
+}
+
+void HS_UtilMarkJitter(uint64 Interval)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilMarkJitter), Interval);
+    UT_DEFAULT_IMPL(HS_UtilMarkJitter);
+}
+
+void HS_UtilMarkGetStats(uint32 *Source, uint32 *Count, uint32 *JitterAvg, uint32 *JitterMax)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilMarkGetStats), Source);
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilMarkGetStats), Count);
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilMarkGetStats), JitterAvg);
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilMarkGetStats), JitterMax);
+    UT_DEFAULT_IMPL(HS_UtilMarkGetStats);
+}
+
+void HS_CustomMarkPoll(void)
+{
+    UT_DEFAULT_IMPL(HS_CustomMarkPoll);
+}
+
+void HS_MarkTimerCallback(osal_id_t TimerId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_MarkTimerCallback), TimerId);
+    UT_DEFAULT_IMPL(HS_MarkTimerCallback);
+}
+
 void HS_MarkIdleCallback(void)
 {
     UT_DEFAULT_IMPL(HS_MarkIdleCallback);
@@ -87,6 +173,21 @@ void HS_UtilDiagReport(void)
     UT_DEFAULT_IMPL(HS_UtilDiagReport);
 }
 
+void HS_UtilDiagSort(uint64 *Values, uint32 Count)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilDiagSort), Values);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilDiagSort), Count);
+    UT_DEFAULT_IMPL(HS_UtilDiagSort);
+}
+
+void HS_UtilDiagSiftDown(uint64 *Values, uint32 Root, uint32 Count)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_UtilDiagSiftDown), Values);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilDiagSiftDown), Root);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilDiagSiftDown), Count);
+    UT_DEFAULT_IMPL(HS_UtilDiagSiftDown);
+}
+
 void HS_SetUtilParamsCmd(const CFE_SB_Buffer_t *BufPtr)
 {
     UT_Stub_RegisterContext(UT_KEY(HS_SetUtilParamsCmd), BufPtr);
@@ -98,3 +199,96 @@ void HS_SetUtilDiagCmd(const CFE_SB_Buffer_t *BufPtr)
     UT_Stub_RegisterContext(UT_KEY(HS_SetUtilDiagCmd), BufPtr);
     UT_DEFAULT_IMPL(HS_SetUtilDiagCmd);
 }
+
+void HS_SetCoreUtilParamsCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_SetCoreUtilParamsCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_SetCoreUtilParamsCmd);
+}
+
+void HS_SetUtilBackendCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_SetUtilBackendCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_SetUtilBackendCmd);
+}
+
+void HS_StartUtilCalCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_StartUtilCalCmd), BufPtr);
+    UT_DEFAULT_IMPL(HS_StartUtilCalCmd);
+}
+
+void HS_UtilCalStart(uint32 NumIntervals, bool SaveToCDS, bool TrackPeak)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilCalStart), NumIntervals);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilCalStart), SaveToCDS);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilCalStart), TrackPeak);
+    UT_DEFAULT_IMPL(HS_UtilCalStart);
+}
+
+void HS_UtilCalUpdate(void)
+{
+    UT_DEFAULT_IMPL(HS_UtilCalUpdate);
+}
+
+void HS_UtilCalApply(uint32 CoreIndex, uint32 IdleRate)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilCalApply), CoreIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilCalApply), IdleRate);
+    UT_DEFAULT_IMPL(HS_UtilCalApply);
+}
+
+void HS_UtilCalSave(void)
+{
+    UT_DEFAULT_IMPL(HS_UtilCalSave);
+}
+
+bool HS_UtilCalRestore(void)
+{
+    return UT_DEFAULT_IMPL_RC(HS_UtilCalRestore, false);
+}
+
+void HS_PsiStart(void)
+{
+    UT_DEFAULT_IMPL(HS_PsiStart);
+}
+
+void HS_PsiMonitor(void)
+{
+    UT_DEFAULT_IMPL(HS_PsiMonitor);
+}
+
+void HS_PsiGetStats(uint32 *AvailableMask, uint32 *ActiveMask, HS_PsiTlm_t *TlmPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_PsiGetStats), AvailableMask);
+    UT_Stub_RegisterContext(UT_KEY(HS_PsiGetStats), ActiveMask);
+    UT_Stub_RegisterContext(UT_KEY(HS_PsiGetStats), TlmPtr);
+    UT_DEFAULT_IMPL(HS_PsiGetStats);
+}
+
+void HS_MemStart(void)
+{
+    UT_DEFAULT_IMPL(HS_MemStart);
+}
+
+void HS_MemMonitor(void)
+{
+    UT_DEFAULT_IMPL(HS_MemMonitor);
+}
+
+int32 HS_MemHistoryGrowth(void)
+{
+    return UT_DEFAULT_IMPL(HS_MemHistoryGrowth);
+}
+
+void HS_MemAlarmAction(uint32 Alarm)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_MemAlarmAction), Alarm);
+    UT_DEFAULT_IMPL(HS_MemAlarmAction);
+}
+
+void HS_MemGetStats(HS_MemTlm_t *TlmPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_MemGetStats), TlmPtr);
+    UT_DEFAULT_IMPL(HS_MemGetStats);
+}
@@ -39,6 +39,12 @@ void HS_MonitorEvent(const CFE_EVS_LongEventTlm_t *EventPtr)
     UT_DEFAULT_IMPL(HS_MonitorEvent);
 }
 
+bool HS_ExecuteMsgAction(uint32 MsgActsIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ExecuteMsgAction), MsgActsIndex);
+    return UT_DEFAULT_IMPL(HS_ExecuteMsgAction);
+}
+
 void HS_MonitorUtilization(void)
 {
     UT_DEFAULT_IMPL(HS_MonitorUtilization);
@@ -68,9 +74,183 @@ int32 HS_ValidateMATable(void *TableData)
     return UT_DEFAULT_IMPL(HS_ValidateMATable);
 }
 
+int32 HS_ValidateLSTable(void *TableData)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ValidateLSTable), TableData);
+    return UT_DEFAULT_IMPL(HS_ValidateLSTable);
+}
+
+int32 HS_ValidateCBTable(void *TableData)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ValidateCBTable), TableData);
+    return UT_DEFAULT_IMPL(HS_ValidateCBTable);
+}
+
+int32 HS_ValidateRBTable(void *TableData)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ValidateRBTable), TableData);
+    return UT_DEFAULT_IMPL(HS_ValidateRBTable);
+}
+
 void HS_SetCDSData(uint16 ResetsPerformed, uint16 MaxResets)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(HS_SetCDSData), ResetsPerformed);
     UT_Stub_RegisterContextGenericArg(UT_KEY(HS_SetCDSData), MaxResets);
     UT_DEFAULT_IMPL(HS_SetCDSData);
 }
+
+void HS_CountProcessorEvent(uint32 SpacecraftID, uint32 ProcessorID)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_CountProcessorEvent), SpacecraftID);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_CountProcessorEvent), ProcessorID);
+    UT_DEFAULT_IMPL(HS_CountProcessorEvent);
+}
+
+void HS_UtilHistRecord(uint32 CurrentUtil)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilHistRecord), CurrentUtil);
+    UT_DEFAULT_IMPL(HS_UtilHistRecord);
+}
+
+void HS_UtilPctlRecord(uint32 CurrentUtil)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilPctlRecord), CurrentUtil);
+    UT_DEFAULT_IMPL(HS_UtilPctlRecord);
+}
+
+void HS_MonitorUtilLoad(uint32 CurrentUtil)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_MonitorUtilLoad), CurrentUtil);
+    UT_DEFAULT_IMPL(HS_MonitorUtilLoad);
+}
+
+void HS_MonitorLoadShed(uint32 CurrentUtil)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_MonitorLoadShed), CurrentUtil);
+    UT_DEFAULT_IMPL(HS_MonitorLoadShed);
+}
+
+void HS_UtilTrendUpdate(uint32 ThisUtilIndex, uint32 CurrentUtil)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilTrendUpdate), ThisUtilIndex);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilTrendUpdate), CurrentUtil);
+    UT_DEFAULT_IMPL(HS_UtilTrendUpdate);
+}
+
+void HS_MonitorUtilTrend(void)
+{
+    UT_DEFAULT_IMPL(HS_MonitorUtilTrend);
+}
+
+void HS_MonitorRebalance(uint32 ThisUtilIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_MonitorRebalance), ThisUtilIndex);
+    UT_DEFAULT_IMPL(HS_MonitorRebalance);
+}
+
+bool HS_RebalanceMove(uint32 FromCore, uint32 ToCore)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_RebalanceMove), FromCore);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_RebalanceMove), ToCore);
+    return UT_DEFAULT_IMPL(HS_RebalanceMove);
+}
+
+uint32 HS_UtilPctlValue(uint32 Percent)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_UtilPctlValue), Percent);
+    return UT_DEFAULT_IMPL(HS_UtilPctlValue);
+}
+
+void HS_MonitorTaskCpu(void)
+{
+    UT_DEFAULT_IMPL(HS_MonitorTaskCpu);
+}
+
+void HS_TaskCpuRank(uint32 *TopIndex, uint32 *TopValue, uint32 *NumTopPtr, uint32 Index, uint32 Value)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_TaskCpuRank), TopIndex);
+    UT_Stub_RegisterContext(UT_KEY(HS_TaskCpuRank), TopValue);
+    UT_Stub_RegisterContext(UT_KEY(HS_TaskCpuRank), NumTopPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_TaskCpuRank), Index);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_TaskCpuRank), Value);
+    UT_DEFAULT_IMPL(HS_TaskCpuRank);
+}
+
+void HS_MonitorRunDelay(const HS_TaskCpuPayload_t *PayloadPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_MonitorRunDelay), PayloadPtr);
+    UT_DEFAULT_IMPL(HS_MonitorRunDelay);
+}
+
+void HS_MonitorCpuBudget(const HS_TaskCpuSample_t *SamplesPtr, const uint32 *UtilPtr, uint32 NumSamples)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_MonitorCpuBudget), SamplesPtr);
+    UT_Stub_RegisterContext(UT_KEY(HS_MonitorCpuBudget), UtilPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_MonitorCpuBudget), NumSamples);
+    UT_DEFAULT_IMPL(HS_MonitorCpuBudget);
+}
+
+void HS_HogSnapshotBaseline(void)
+{
+    UT_DEFAULT_IMPL(HS_HogSnapshotBaseline);
+}
+
+void HS_MonitorStacks(void)
+{
+    UT_DEFAULT_IMPL(HS_MonitorStacks);
+}
+
+void HS_StackUsageAction(const HS_StackEntry_t *EntryPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_StackUsageAction), EntryPtr);
+    UT_DEFAULT_IMPL(HS_StackUsageAction);
+}
+
+void HS_MonitorSbPipes(void)
+{
+    UT_DEFAULT_IMPL(HS_MonitorSbPipes);
+}
+
+void HS_SbStatsTlm(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_SbStatsTlm), BufPtr);
+    UT_DEFAULT_IMPL(HS_SbStatsTlm);
+}
+
+void HS_SbHkTlm(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_SbHkTlm), BufPtr);
+    UT_DEFAULT_IMPL(HS_SbHkTlm);
+}
+
+void HS_SbPipeAction(uint32 LimitIndex, const HS_SbPipeTlm_t *PipeTlmPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_SbPipeAction), LimitIndex);
+    UT_Stub_RegisterContext(UT_KEY(HS_SbPipeAction), PipeTlmPtr);
+    UT_DEFAULT_IMPL(HS_SbPipeAction);
+}
+
+void HS_SbDropAction(uint32 Drops)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_SbDropAction), Drops);
+    UT_DEFAULT_IMPL(HS_SbDropAction);
+}
+
+void HS_MonitorWakeup(int32 RecvStatus)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_MonitorWakeup), RecvStatus);
+    UT_DEFAULT_IMPL(HS_MonitorWakeup);
+}
+
+void HS_HogSnapshotCapture(uint32 ThisUtilIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_HogSnapshotCapture), ThisUtilIndex);
+    UT_DEFAULT_IMPL(HS_HogSnapshotCapture);
+}
+
+int32 HS_HogSnapshotWriteFile(const char *Filename, const HS_HogSnapshot_t *SnapPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_HogSnapshotWriteFile), Filename);
+    UT_Stub_RegisterContext(UT_KEY(HS_HogSnapshotWriteFile), SnapPtr);
+    return UT_DEFAULT_IMPL(HS_HogSnapshotWriteFile);
+}
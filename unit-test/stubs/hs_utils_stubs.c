@@ -17,6 +17,8 @@
  * limitations under the License.
  ************************************************************************/
 
+#include <string.h>
+
 #include "hs_utils.h"
 
 /* UT includes */
@@ -41,3 +43,289 @@ bool HS_EMTActionIsValid(uint16 ActionType)
     UT_Stub_RegisterContextGenericArg(UT_KEY(HS_EMTActionIsValid), ActionType);
     return UT_DEFAULT_IMPL(HS_EMTActionIsValid);
 }
+
+bool HS_EMTQualifierMatches(uint32 Qualifier, uint32 SourceId, uint32 LocalId)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_EMTQualifierMatches), Qualifier);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_EMTQualifierMatches), SourceId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_EMTQualifierMatches), LocalId);
+    return UT_DEFAULT_IMPL_RC(HS_EMTQualifierMatches, true);
+}
+
+int32 HS_SetCpuAffinity(uint32 CoreIndex)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_SetCpuAffinity), CoreIndex);
+    return UT_DEFAULT_IMPL(HS_SetCpuAffinity);
+}
+
+int32 HS_GetThreadAffinity(uint32 ThreadId, uint32 *CoreMaskPtr)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_GetThreadAffinity), ThreadId);
+    UT_Stub_RegisterContext(UT_KEY(HS_GetThreadAffinity), CoreMaskPtr);
+
+    Status = UT_DEFAULT_IMPL(HS_GetThreadAffinity);
+
+    if (Status == CFE_SUCCESS)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(HS_GetThreadAffinity), CoreMaskPtr, sizeof(*CoreMaskPtr));
+    }
+
+    return Status;
+}
+
+int32 HS_SetThreadAffinity(uint32 ThreadId, uint32 CoreMask)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_SetThreadAffinity), ThreadId);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_SetThreadAffinity), CoreMask);
+    return UT_DEFAULT_IMPL(HS_SetThreadAffinity);
+}
+
+int32 HS_ParseProcStat(const char *Buffer, HS_CpuTimes_t *TimesPtr, uint32 NumCores)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseProcStat), Buffer);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseProcStat), TimesPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ParseProcStat), NumCores);
+    return UT_DEFAULT_IMPL(HS_ParseProcStat);
+}
+
+int32 HS_ReadProcStat(HS_CpuTimes_t *TimesPtr, uint32 NumCores)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadProcStat), TimesPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ReadProcStat), NumCores);
+
+    Status = UT_DEFAULT_IMPL(HS_ReadProcStat);
+
+    if (Status == CFE_SUCCESS)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(HS_ReadProcStat), TimesPtr, NumCores * sizeof(*TimesPtr));
+    }
+
+    return Status;
+}
+
+int32 HS_ParseTaskStat(const char *Buffer, uint64 NsPerTick, HS_TaskCpuSample_t *SamplePtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseTaskStat), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ParseTaskStat), NsPerTick);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseTaskStat), SamplePtr);
+    return UT_DEFAULT_IMPL(HS_ParseTaskStat);
+}
+
+int32 HS_ReadTaskCpuTimes(HS_TaskCpuSample_t *SamplesPtr, uint32 MaxSamples, bool SchedInfo, uint32 *NumSamplesPtr)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadTaskCpuTimes), SamplesPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ReadTaskCpuTimes), MaxSamples);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ReadTaskCpuTimes), SchedInfo);
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadTaskCpuTimes), NumSamplesPtr);
+
+    *NumSamplesPtr = 0;
+
+    Status = UT_DEFAULT_IMPL(HS_ReadTaskCpuTimes);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Each sample in the data buffer is one thread */
+        *NumSamplesPtr =
+            UT_Stub_CopyToLocal(UT_KEY(HS_ReadTaskCpuTimes), SamplesPtr, MaxSamples * sizeof(*SamplesPtr)) /
+            sizeof(*SamplesPtr);
+    }
+
+    return Status;
+}
+
+int32 HS_ParseTaskSchedstat(const char *Buffer, HS_TaskCpuSample_t *SamplePtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseTaskSchedstat), Buffer);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseTaskSchedstat), SamplePtr);
+    return UT_DEFAULT_IMPL(HS_ParseTaskSchedstat);
+}
+
+int32 HS_ParseTaskCtxSwitches(const char *Buffer, HS_TaskCpuSample_t *SamplePtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseTaskCtxSwitches), Buffer);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseTaskCtxSwitches), SamplePtr);
+    return UT_DEFAULT_IMPL(HS_ParseTaskCtxSwitches);
+}
+
+int32 HS_ReadTaskSchedInfo(int TaskDirFd, HS_TaskCpuSample_t *SamplePtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ReadTaskSchedInfo), TaskDirFd);
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadTaskSchedInfo), SamplePtr);
+    return UT_DEFAULT_IMPL(HS_ReadTaskSchedInfo);
+}
+
+bool HS_ThreadNameMatches(const char *ThreadName, const char *TaskName)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ThreadNameMatches), ThreadName);
+    UT_Stub_RegisterContext(UT_KEY(HS_ThreadNameMatches), TaskName);
+    return UT_DEFAULT_IMPL_RC(HS_ThreadNameMatches, strcmp(ThreadName, TaskName) == 0);
+}
+
+int32 HS_FindTaskByThreadName(const char *ThreadName, CFE_ES_TaskId_t *TaskIdPtr)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContext(UT_KEY(HS_FindTaskByThreadName), ThreadName);
+    UT_Stub_RegisterContext(UT_KEY(HS_FindTaskByThreadName), TaskIdPtr);
+
+    Status = UT_DEFAULT_IMPL(HS_FindTaskByThreadName);
+
+    if (Status == CFE_SUCCESS)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(HS_FindTaskByThreadName), TaskIdPtr, sizeof(*TaskIdPtr));
+    }
+
+    return Status;
+}
+
+void HS_FindTaskCallback(osal_id_t ObjectId, void *SearchPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_FindTaskCallback), ObjectId);
+    UT_Stub_RegisterContext(UT_KEY(HS_FindTaskCallback), SearchPtr);
+    UT_DEFAULT_IMPL(HS_FindTaskCallback);
+}
+
+int32 HS_ParsePsi(const char *Buffer, HS_PsiSample_t *SamplePtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParsePsi), Buffer);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParsePsi), SamplePtr);
+    return UT_DEFAULT_IMPL(HS_ParsePsi);
+}
+
+int32 HS_ReadPsi(const char *Path, HS_PsiSample_t *SamplePtr)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadPsi), Path);
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadPsi), SamplePtr);
+
+    Status = UT_DEFAULT_IMPL(HS_ReadPsi);
+
+    if (Status == CFE_SUCCESS)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(HS_ReadPsi), SamplePtr, sizeof(*SamplePtr));
+    }
+
+    return Status;
+}
+
+int32 HS_ParseKbField(const char *Buffer, const char *Name, uint32 *ValuePtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseKbField), Buffer);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseKbField), Name);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseKbField), ValuePtr);
+    return UT_DEFAULT_IMPL(HS_ParseKbField);
+}
+
+int32 HS_ReadMemory(HS_MemSample_t *SamplePtr)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadMemory), SamplePtr);
+
+    Status = UT_DEFAULT_IMPL(HS_ReadMemory);
+
+    if (Status == CFE_SUCCESS)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(HS_ReadMemory), SamplePtr, sizeof(*SamplePtr));
+    }
+
+    return Status;
+}
+
+int32 HS_ParseSyscallSp(const char *Buffer, cpuaddr *SpPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseSyscallSp), Buffer);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseSyscallSp), SpPtr);
+    return UT_DEFAULT_IMPL(HS_ParseSyscallSp);
+}
+
+int32 HS_ParseMapsRegion(const char *Buffer, cpuaddr Address, cpuaddr *LowPtr, cpuaddr *HighPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseMapsRegion), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ParseMapsRegion), Address);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseMapsRegion), LowPtr);
+    UT_Stub_RegisterContext(UT_KEY(HS_ParseMapsRegion), HighPtr);
+    return UT_DEFAULT_IMPL(HS_ParseMapsRegion);
+}
+
+int32 HS_FindMapsRegion(cpuaddr Address, cpuaddr *LowPtr, cpuaddr *HighPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_FindMapsRegion), Address);
+    UT_Stub_RegisterContext(UT_KEY(HS_FindMapsRegion), LowPtr);
+    UT_Stub_RegisterContext(UT_KEY(HS_FindMapsRegion), HighPtr);
+    return UT_DEFAULT_IMPL(HS_FindMapsRegion);
+}
+
+uint32 HS_StackUnusedBytes(cpuaddr Low, cpuaddr High)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_StackUnusedBytes), Low);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_StackUnusedBytes), High);
+    return UT_DEFAULT_IMPL(HS_StackUnusedBytes);
+}
+
+int32 HS_ReadThreadStack(uint32 ThreadId, uint32 *SizePtr, uint32 *UsedPtr)
+{
+    uint32 Stack[2] = {0, 0};
+    int32  Status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_ReadThreadStack), ThreadId);
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadThreadStack), SizePtr);
+    UT_Stub_RegisterContext(UT_KEY(HS_ReadThreadStack), UsedPtr);
+
+    Status = UT_DEFAULT_IMPL(HS_ReadThreadStack);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Each pair in the data buffer is the size then the bytes used of one call */
+        UT_Stub_CopyToLocal(UT_KEY(HS_ReadThreadStack), Stack, sizeof(Stack));
+        *SizePtr = Stack[0];
+        *UsedPtr = Stack[1];
+    }
+
+    return Status;
+}
+
+void HS_PaintStack(void)
+{
+    UT_DEFAULT_IMPL(HS_PaintStack);
+}
+
+int32 HS_GetThreadCpuClock(int32 *ClockIdPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(HS_GetThreadCpuClock), ClockIdPtr);
+    return UT_DEFAULT_IMPL(HS_GetThreadCpuClock);
+}
+
+int32 HS_GetClockTimeNs(int32 ClockId, uint64 *NsPtr)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(HS_GetClockTimeNs), ClockId);
+    UT_Stub_RegisterContext(UT_KEY(HS_GetClockTimeNs), NsPtr);
+
+    Status = UT_DEFAULT_IMPL(HS_GetClockTimeNs);
+
+    if (Status == CFE_SUCCESS)
+    {
+        UT_Stub_CopyToLocal(UT_KEY(HS_GetClockTimeNs), NsPtr, sizeof(*NsPtr));
+    }
+
+    return Status;
+}
+
+uint64 HS_GetMonotonicTimeNs(void)
+{
+    uint64 TimeNs = 0;
+
+    UT_DEFAULT_IMPL(HS_GetMonotonicTimeNs);
+    UT_Stub_CopyToLocal(UT_KEY(HS_GetMonotonicTimeNs), &TimeNs, sizeof(TimeNs));
+
+    return TimeNs;
+}
@@ -67,11 +67,18 @@ extern CFE_ES_WriteToSysLog_context_t context_CFE_ES_WriteToSysLog;
 /* Command buffer typedef for any handler */
 typedef union
 {
-    CFE_SB_Buffer_t       Buf;
-    HS_NoArgsCmd_t        NoArgsCmd;
-    HS_SetMaxResetsCmd_t  SetMaxResetsCmd;
-    HS_SetUtilParamsCmd_t SetUtilParamsCmd;
-    HS_SetUtilDiagCmd_t   SetUtilDiagCmd;
+    CFE_SB_Buffer_t           Buf;
+    HS_NoArgsCmd_t            NoArgsCmd;
+    HS_SetMaxResetsCmd_t      SetMaxResetsCmd;
+    HS_EventMonEntriesCmd_t   EventMonEntriesCmd;
+    HS_DumpUtilHistCmd_t      DumpUtilHistCmd;
+    HS_SetUtilLoadLevelCmd_t  SetUtilLoadLevelCmd;
+    HS_SetUtilTrendCmd_t      SetUtilTrendCmd;
+    HS_SetUtilParamsCmd_t     SetUtilParamsCmd;
+    HS_SetUtilDiagCmd_t       SetUtilDiagCmd;
+    HS_SetCoreUtilParamsCmd_t SetCoreUtilParamsCmd;
+    HS_SetUtilBackendCmd_t    SetUtilBackendCmd;
+    HS_StartUtilCalCmd_t      StartUtilCalCmd;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;